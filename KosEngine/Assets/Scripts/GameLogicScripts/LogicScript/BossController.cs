@@ -44,7 +44,6 @@ public class BossController : ScriptBase
 
     #region Boss Variable
     private BossAttackPattern currentPattern;
-    private long seed = DateTime.Now.Ticks; // seed for randomizer
 
     private Vector2 bossPosition;
     //private bool canAttack = true;
@@ -292,10 +291,10 @@ public class BossController : ScriptBase
     #endregion Animation
 
 
+    // max is excluded
     private int GenerateRandom(int min, int max)
     {
-        seed = (seed * 1664525 + 1013904223) & 0x7FFFFFFF; // Update seed
-        return (int)(min + (seed % (max - min))); // Map to range
+        return InternalCall.m_GetRandomInt(min, max - 1);
     }
 
     #region AttackPattern Execution
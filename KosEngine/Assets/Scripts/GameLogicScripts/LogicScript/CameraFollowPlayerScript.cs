@@ -176,11 +176,8 @@ public class CameraFollowPlayerScript : ScriptBase
 
     public float SimpleRandom(float min, float max)
     {
-        // Using a simple time-based random seed (not truly random but works for effects)
-        int seed = (int)(DateTime.Now.Ticks % int.MaxValue);
-        seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF; // LCG (Linear Congruential Generator)
-        float normalized = seed / (float)int.MaxValue; // Convert to range 0-1
-        return min + (max - min) * normalized;
+        // the engine's generator, so a replayed shake moves the camera the same way
+        return InternalCall.m_GetRandomFloat(min, max);
     }
 
 }
\ No newline at end of file
@@ -16,8 +16,6 @@ public class EnemyCorpseHalf : ScriptBase
 
     public override void Start()
     {
-        Random random = new Random();
-
         Vector2 movement;
 
         Vector2 direction;
@@ -30,9 +28,9 @@ public class EnemyCorpseHalf : ScriptBase
 
         float rotationFloat = (float)(Math.Atan2(direction.X, direction.Y) * (180 / Math.PI)); //Gets rotation away player
 
-        float rotationRandom = (float)(random.NextDouble() * 30 + 10);
+        float rotationRandom = InternalCall.m_GetRandomFloat(10f, 40f);
 
-        if (random.Next(0, 2) == 0)
+        if (InternalCall.m_GetRandomInt(0, 1) == 0)
         {
             rotationRandom = -rotationRandom; // Make it negative 30 to -75
         }
@@ -526,8 +526,7 @@ public class EnemyScript : ScriptBase //Enemy Script, not state machine
 
         if (causeOfDeath == "Katana")
         {
-            Random random = new Random();
-            rotationFloat += (float)(random.NextDouble() * 150 - 75);
+            rotationFloat += InternalCall.m_GetRandomFloat(-75f, 75f);
         }
 
 
@@ -630,8 +629,7 @@ public class EnemyScript : ScriptBase //Enemy Script, not state machine
                         InternalCall.m_InternalCallAddPrefab("EnemyTopHalf", transformComp.m_position.X  * 1.01f, transformComp.m_position.Y * 1.01f, rotationInRadians);
                         break;
                 }
-                Random random = new Random();
-                float randomForce = 0.05f + (float)random.NextDouble() * temp; // 0.05 to 0.3
+                float randomForce = 0.05f + InternalCall.m_GetRandomFloat(0f, 1f) * temp; // 0.05 to 0.3
 
                 movement.X = forwardX * randomForce;
                 movement.Y = forwardY * randomForce;
@@ -1179,18 +1177,16 @@ public class EnemyScript : ScriptBase //Enemy Script, not state machine
 
     private string ReturnRandomAudio(string name)
     {
-        Random random = new Random();
-
         switch (name)
         {
             case "Death":
-                return bodyDeathAudList[(random.Next(bodyDeathAudList.Count - 1))];
+                return bodyDeathAudList[InternalCall.m_GetRandomInt(0, bodyDeathAudList.Count - 1)];
 
             case "Fall":
-                return bodyFallAudList[(random.Next(bodyFallAudList.Count - 1))];
+                return bodyFallAudList[InternalCall.m_GetRandomInt(0, bodyFallAudList.Count - 1)];
 
             case "Stab":
-                return bodyStabAudList[(random.Next(bodyStabAudList.Count - 1))];
+                return bodyStabAudList[InternalCall.m_GetRandomInt(0, bodyStabAudList.Count - 1)];
 
             default:
                 return null;
@@ -21,6 +21,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "Action.h"
 #include "../ECS/Hierachy.h"
 #include "../Asset Manager/AssetManager.h"
+#include "../Asset Manager/PrefabIndex.h"
 
 
 namespace actions {
@@ -48,7 +49,7 @@ namespace actions {
 			m_changedComp->m_rotation = m_oldRot;
 			m_changedComp->m_scale = m_oldScale;
 			m_changedComp->m_transformation = m_oldTrans;
-
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 
 		void m_RedoAction() override {
@@ -56,6 +57,7 @@ namespace actions {
 			m_changedComp->m_rotation = m_newRot;
 			m_changedComp->m_scale = m_newScale;
 			m_changedComp->m_transformation = m_newTrans;
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 
 
@@ -137,7 +139,7 @@ namespace actions {
 		AddEntityAction(ecs::EntityID inID) : m_entityID(inID), m_hasBeenUndo(false) {};
 
 		void m_UndoAction() override {
-			if (ecs::ECS::m_GetInstance()->m_ECS_EntityMap.find(m_entityID) != ecs::ECS::m_GetInstance()->m_ECS_EntityMap.end()) {
+			if (ecs::ECS::m_GetInstance()->m_IsValidEntity(m_entityID)) {
 				if (!m_hasBeenUndo) {
 					ecs::ECS::m_GetInstance()->m_DeleteEntity(m_entityID);
 					m_hasBeenUndo = true;
@@ -146,9 +148,9 @@ namespace actions {
 		}
 
 		void m_RedoAction() override {
-			if (ecs::ECS::m_GetInstance()->m_ECS_EntityMap.find(m_entityID) != ecs::ECS::m_GetInstance()->m_ECS_EntityMap.end()) {
-				if (m_hasBeenUndo) {
-					ecs::ECS::m_GetInstance()->m_RestoreEntity(m_entityID);
+			if (m_hasBeenUndo) {
+				//the entity comes back under the same ID, the actions after it still apply
+				if (ecs::ECS::m_GetInstance()->m_RestoreEntity(m_entityID)) {
 					m_hasBeenUndo = false;
 				}
 			}
@@ -168,16 +170,15 @@ namespace actions {
 		RemoveEntityAction(ecs::EntityID inID) : m_entityID(inID), m_hasBeenUndo(false) {};
 
 		void m_UndoAction() override {
-			if (ecs::ECS::m_GetInstance()->m_ECS_EntityMap.find(m_entityID) != ecs::ECS::m_GetInstance()->m_ECS_EntityMap.end()) {
-				if (!m_hasBeenUndo) {
+			if (!m_hasBeenUndo) {
+				if (ecs::ECS::m_GetInstance()->m_RestoreEntity(m_entityID)) {
 					m_hasBeenUndo = true;
-					ecs::ECS::m_GetInstance()->m_RestoreEntity(m_entityID);
 				}
 			}
 		}
 
 		void m_RedoAction() override {
-			if (ecs::ECS::m_GetInstance()->m_ECS_EntityMap.find(m_entityID) != ecs::ECS::m_GetInstance()->m_ECS_EntityMap.end()) {
+			if (ecs::ECS::m_GetInstance()->m_IsValidEntity(m_entityID)) {
 				if (m_hasBeenUndo) {
 					m_hasBeenUndo = false;
 					ecs::ECS::m_GetInstance()->m_DeleteEntity(m_entityID);
@@ -202,6 +203,7 @@ namespace actions {
 					ecs::Hierachy::m_SetParent(m_prevParent, m_entityID);
 				}
 			}
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 
 		void m_RedoAction() override {
@@ -211,6 +213,7 @@ namespace actions {
 					ecs::Hierachy::m_SetParent(m_newParent, m_entityID);
 				}
 			}
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 	};
 
@@ -229,6 +232,7 @@ namespace actions {
 					ecs::Hierachy::m_SetParent(m_prevParent, m_entityID);
 				}
 			}
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 
 		void m_RedoAction() override {
@@ -238,6 +242,7 @@ namespace actions {
 					ecs::Hierachy::m_RemoveParent(m_entityID);
 				}
 			}
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 	};
 
@@ -256,6 +261,7 @@ namespace actions {
 					ecs::Hierachy::m_RemoveParent(m_entityID);
 				}
 			}
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 
 		void m_RedoAction() override {
@@ -265,6 +271,7 @@ namespace actions {
 					ecs::Hierachy::m_SetParent(m_newParent, m_entityID);
 				}
 			}
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 	};
 
@@ -291,7 +298,7 @@ namespace actions {
 				m_changedComp->m_isAnimating = m_oldIsAnim;
 				m_changedComp->m_stripCount = m_oldStrip;
 			}
-
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 
 		void m_RedoAction() override {
@@ -302,6 +309,7 @@ namespace actions {
 				m_changedComp->m_isAnimating = m_newIsAnim;
 				m_changedComp->m_stripCount = m_newStrip;
 			}
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 
 
@@ -353,6 +361,7 @@ namespace actions {
 					}
 				}
 			}
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 
 		void m_RedoAction() override {
@@ -372,7 +381,7 @@ namespace actions {
 					}
 				}
 			}
-
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 
 
@@ -408,6 +417,7 @@ namespace actions {
 				newAF.m_IsBGM = m_isBGM;
 				m_changedComp->m_AudioFiles.emplace_back(newAF);
 			}
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 
 		void m_RedoAction() override {
@@ -421,7 +431,7 @@ namespace actions {
 					}
 				}
 			}
-			
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 
 
@@ -452,7 +462,7 @@ namespace actions {
 					}
 				}
 			}
-
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 
 		void m_RedoAction() override {
@@ -469,7 +479,7 @@ namespace actions {
 				newAF.m_IsBGM = m_isBGM;
 				m_changedComp->m_AudioFiles.emplace_back(newAF);
 			}
-
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 	};
 
@@ -495,7 +505,7 @@ namespace actions {
 				m_changedComp->m_bottom = m_oldBot;
 				m_changedComp->m_aspectRatio = m_oldAR;
 			}
-			
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 
 		void m_RedoAction() override {
@@ -506,6 +516,7 @@ namespace actions {
 				m_changedComp->m_bottom = m_newBot;
 				m_changedComp->m_aspectRatio = m_newAR;
 			}
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 	};
 
@@ -536,7 +547,7 @@ namespace actions {
 				m_changedComp->m_collisionCheck = m_oldCC;
 				m_changedComp->m_type = m_oldShape;
 			}
-
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 
 		void m_RedoAction() override {
@@ -549,6 +560,7 @@ namespace actions {
 				m_changedComp->m_collisionCheck = m_newCC;
 				m_changedComp->m_type = m_newShape;
 			}
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 	};
 
@@ -570,7 +582,7 @@ namespace actions {
 				m_changedComp->m_enemyTypeInt = m_oldType;
 				m_changedComp->m_enemyRoamBehaviourInt = m_oldBehave;
 			}
-
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 
 		void m_RedoAction() override {
@@ -579,6 +591,7 @@ namespace actions {
 				m_changedComp->m_enemyTypeInt = m_newType;
 				m_changedComp->m_enemyRoamBehaviourInt = m_newBehave;
 			}
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 	};
 
@@ -605,7 +618,7 @@ namespace actions {
 				m_changedComp->m_SetCollidable = m_oldColl;
 				m_changedComp->m_GridKey = m_oldGridKey;
 			}
-
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 
 		void m_RedoAction() override {
@@ -616,6 +629,7 @@ namespace actions {
 				m_changedComp->m_SetCollidable = m_newColl;
 				m_changedComp->m_GridKey = m_newGridKey;
 			}
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 	};
 
@@ -646,6 +660,7 @@ namespace actions {
 				m_changedComp->m_light_scale = m_oldScale;
 				m_changedComp->m_light_OffSet = m_oldOffset;
 			}
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 
 		void m_RedoAction() override {
@@ -658,6 +673,7 @@ namespace actions {
 				m_changedComp->m_light_scale = m_newScale;
 				m_changedComp->m_light_OffSet = m_oldOffset;
 			}
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 	};
 
@@ -680,6 +696,7 @@ namespace actions {
 				m_changedComp->m_TargetPos = m_oldEnd;
 				m_changedComp->m_GridKey = m_oldKey;
 			}
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 
 		void m_RedoAction() override {
@@ -688,6 +705,7 @@ namespace actions {
 				m_changedComp->m_TargetPos = m_newEnd;
 				m_changedComp->m_GridKey = m_newKey;
 			}
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 	};
 
@@ -734,6 +752,7 @@ namespace actions {
 				m_changedComp->m_IsKinematic = m_oldKine;
 				m_changedComp->m_IsStatic = m_oldStatic;
 			}
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 
 		void m_RedoAction() override {
@@ -752,6 +771,7 @@ namespace actions {
 				m_changedComp->m_IsKinematic = m_newKine;
 				m_changedComp->m_IsStatic = m_newStatic;
 			}
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 	};
 
@@ -777,6 +797,7 @@ namespace actions {
 				m_changedComp->m_alpha = m_oldAlpha;
 				m_changedComp->m_isIlluminated = m_oldIllum;
 			}
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 
 		void m_RedoAction() override {
@@ -787,6 +808,7 @@ namespace actions {
 				m_changedComp->m_alpha = m_newAlpha;
 				m_changedComp->m_isIlluminated = m_newIllum;
 			}
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 	};
 
@@ -812,6 +834,7 @@ namespace actions {
 				m_changedComp->m_fontLayer = m_oldLayer;
 				m_changedComp->m_fontSize = m_oldSize;
 			}
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 
 		void m_RedoAction() override {
@@ -822,6 +845,7 @@ namespace actions {
 				m_changedComp->m_fontLayer = m_newLayer;
 				m_changedComp->m_fontSize = m_newSize;
 			}
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 	};
 
@@ -843,6 +867,7 @@ namespace actions {
 				m_changedComp->m_Scale = m_oldScale;
 				m_changedComp->m_IsClick = m_oldClick;
 			}
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 
 		void m_RedoAction() override {
@@ -851,6 +876,7 @@ namespace actions {
 				m_changedComp->m_Scale = m_newScale;
 				m_changedComp->m_IsClick = m_newClick;
 			}
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 	};
 	class ModifyNameAction : public Action {
@@ -879,7 +905,10 @@ namespace actions {
 				m_changedComp->m_isPrefab = m_oldIsPrefab;
 				m_changedComp->m_prefabName = m_oldPrefabName;
 				m_changedComp->m_Layer = m_oldLayer;
+				prefab::PrefabIndex::m_GetInstance()->m_Register(m_entityID);
+				ecs::ECS::m_GetInstance()->m_UpdateTag(m_entityID);
 			}
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 
 		void m_RedoAction() override {
@@ -889,7 +918,10 @@ namespace actions {
 				m_changedComp->m_isPrefab = m_newIsPrefab;
 				m_changedComp->m_prefabName = m_newPrefabName;
 				m_changedComp->m_Layer = m_newLayer;
+				prefab::PrefabIndex::m_GetInstance()->m_Register(m_entityID);
+				ecs::ECS::m_GetInstance()->m_UpdateTag(m_entityID);
 			}
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 	};
 	class ModifyParticleAction : public Action {
@@ -951,6 +983,7 @@ namespace actions {
 				m_changedComp->m_friction = m_oldFriction;
 				m_changedComp->m_fps = m_oldFps;
 			}
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 
 		void m_RedoAction() override {
@@ -971,6 +1004,7 @@ namespace actions {
 				m_changedComp->m_friction = m_newFriction;
 				m_changedComp->m_fps = m_newFps;
 			}
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 	};
 
@@ -1016,6 +1050,7 @@ namespace actions {
 				m_changedComp->m_pictureRowLength = m_oldPictureRowLength;
 				m_changedComp->m_pictureColumnLength = m_oldPictureColumnLength;
 			}
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 
 		void m_RedoAction() override {
@@ -1030,6 +1065,7 @@ namespace actions {
 				m_changedComp->m_pictureRowLength = m_newPictureRowLength;
 				m_changedComp->m_pictureColumnLength = m_newPictureColumnLength;
 			}
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 
 	};
@@ -1059,6 +1095,7 @@ namespace actions {
 				m_changedComp->loop = m_oldLoop;
 				m_changedComp->layer = m_oldLayer;
 			}
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 
 		void m_RedoAction() override {
@@ -1068,6 +1105,7 @@ namespace actions {
 				m_changedComp->loop = m_newLoop;
 				m_changedComp->layer = m_newLayer;
 			}
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 	};
 
@@ -1097,6 +1135,7 @@ namespace actions {
 				newRay.m_targetPosition = m_targetPosition;
 				m_changedComp->m_raycast.emplace_back(newRay);
 			}
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 
 		void m_RedoAction() override {
@@ -1108,7 +1147,7 @@ namespace actions {
 					}
 				}
 			}
-
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 
 
@@ -1140,6 +1179,7 @@ namespace actions {
 					}
 				}
 			}
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 
 		void m_RedoAction() override {
@@ -1151,6 +1191,7 @@ namespace actions {
 				newRay.m_targetPosition = m_targetPosition;
 				m_changedComp->m_raycast.emplace_back(newRay);
 			}
+			ecs::ECS::m_GetInstance()->m_MarkDirty(m_entityID);
 		}
 
 
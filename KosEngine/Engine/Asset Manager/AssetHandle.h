@@ -0,0 +1,278 @@
+/******************************************************************/
+/*!
+\file      AssetHandle.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      March 10, 2025
+\brief     This file contains the AssetHandle and AssetHandleTable
+		   classes. A handle is an index into the table plus a
+		   generation counter, it is resolved once from the asset's
+		   name and is then used by the systems every frame instead
+		   of a string keyed map lookup. A name that is not loaded is
+		   remembered as a miss the same way.
+
+		   The asset's name is still stored in the components for
+		   serialization and the editor. Reloading or renaming an
+		   asset bumps the slot's generation so that every handle
+		   that was resolved before becomes stale and is resolved
+		   again on the next access.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#ifndef ASSETHANDLE_H
+#define ASSETHANDLE_H
+
+#include "../Config/pch.h"
+
+namespace assetmanager {
+
+	/******************************************************************/
+	/*!
+	\class     AssetHandle
+	\brief     Index into an AssetHandleTable and the generation of the
+			   slot at the time the handle was resolved, with the name
+			   it was resolved from. A null handle with a name is a
+			   remembered miss.
+	*/
+	/******************************************************************/
+	struct AssetHandle {
+
+		static constexpr std::uint32_t m_invalidIndex = std::numeric_limits<std::uint32_t>::max();
+
+		std::uint32_t m_index{ m_invalidIndex };
+		std::uint32_t m_generation{};
+
+		//set by AssetHandleTable::m_Resolve, not part of the comparison
+		std::string m_name{};
+		std::uint32_t m_missedAt{};
+
+		bool m_IsNull() const { return m_index == m_invalidIndex; }
+
+		bool operator==(const AssetHandle& other) const { return m_index == other.m_index && m_generation == other.m_generation; }
+		bool operator!=(const AssetHandle& other) const { return !(*this == other); }
+	};
+
+	/******************************************************************/
+	/*!
+	\class     AssetHandleTable
+	\brief     Maps asset names to stable slots. The table does not own
+			   the assets, it stores pointers into the manager's
+			   container, which must not move its elements (node based
+			   containers such as std::unordered_map and std::map).
+	*/
+	/******************************************************************/
+	template <typename T>
+	class AssetHandleTable {
+
+	public:
+
+		/******************************************************************/
+		/*!
+		\fn        AssetHandle m_Register(const std::string& name, T* asset)
+		\brief     Registers an asset under a name. If the name is already
+				   registered (reload), the slot is reused and its
+				   generation bumped so that older handles become stale.
+		\return    handle to the registered asset
+		*/
+		/******************************************************************/
+		AssetHandle m_Register(const std::string& name, T* asset) {
+
+			const auto& it = m_nameToSlot.find(name);
+			if (it != m_nameToSlot.end()) {
+				Slot& slot = m_slots[it->second];
+				slot.m_asset = asset;
+				slot.m_generation++;
+				return AssetHandle{ it->second, slot.m_generation };
+			}
+
+			std::uint32_t index{};
+			if (!m_freeSlots.empty()) {
+				index = m_freeSlots.back();
+				m_freeSlots.pop_back();
+			}
+			else {
+				index = static_cast<std::uint32_t>(m_slots.size());
+				m_slots.emplace_back();
+			}
+
+			Slot& slot = m_slots[index];
+			slot.m_asset = asset;
+			slot.m_name = name;
+			m_nameToSlot[name] = index;
+			m_registrations++;
+
+			return AssetHandle{ index, slot.m_generation };
+		}
+
+		/******************************************************************/
+		/*!
+		\fn        void m_Invalidate(const std::string& name)
+		\brief     Removes the asset from the table, every handle pointing
+				   to it becomes stale. The slot is recycled.
+		*/
+		/******************************************************************/
+		void m_Invalidate(const std::string& name) {
+
+			const auto& it = m_nameToSlot.find(name);
+			if (it == m_nameToSlot.end()) return;
+
+			Slot& slot = m_slots[it->second];
+			slot.m_asset = nullptr;
+			slot.m_name.clear();
+			slot.m_generation++;
+
+			m_freeSlots.push_back(it->second);
+			m_nameToSlot.erase(it);
+		}
+
+		/******************************************************************/
+		/*!
+		\fn        AssetHandle m_Find(const std::string& name) const
+		\brief     Resolves a name into a handle, returns a null handle if
+				   the asset is not loaded.
+		*/
+		/******************************************************************/
+		AssetHandle m_Find(const std::string& name) const {
+
+			const auto& it = m_nameToSlot.find(name);
+			if (it == m_nameToSlot.end()) return AssetHandle{};
+
+			return AssetHandle{ it->second, m_slots[it->second].m_generation };
+		}
+
+		/******************************************************************/
+		/*!
+		\fn        T* m_Get(AssetHandle handle) const
+		\brief     Returns the asset the handle points to, nullptr if the
+				   handle is null or stale.
+		*/
+		/******************************************************************/
+		T* m_Get(AssetHandle handle) const {
+
+			if (handle.m_index >= m_slots.size()) return nullptr;
+
+			const Slot& slot = m_slots[handle.m_index];
+			if (slot.m_generation != handle.m_generation) return nullptr;
+
+			return slot.m_asset;
+		}
+
+		/******************************************************************/
+		/*!
+		\fn        T* m_Resolve(const std::string& name, AssetHandle& handle) const
+		\brief     Fast path used by the systems every frame. Returns the
+				   asset of the cached handle while the name is the one it
+				   was resolved from and the handle is not stale,
+				   otherwise the name is looked up once and the handle is
+				   refreshed.
+		\details   The name check compares the component's field against
+				   the copy kept in the handle, which picks up edits made
+				   by the editor, scripts or undo without a table lookup.
+				   If the name is not registered, m_onMiss is given a
+				   chance to load it on demand. The miss is remembered,
+				   the name is looked up again only once it changes or
+				   another asset is registered.
+		*/
+		/******************************************************************/
+		T* m_Resolve(const std::string& name, AssetHandle& handle) const {
+
+			if (handle.m_name == name) {
+				if (handle.m_IsNull()) {
+					if (handle.m_missedAt == m_registrations) return nullptr;
+				}
+				else if (handle.m_index < m_slots.size()) {
+					const Slot& slot = m_slots[handle.m_index];
+					if (slot.m_generation == handle.m_generation && slot.m_asset) {
+						return slot.m_asset;
+					}
+				}
+			}
+			else {
+				handle.m_name = name;
+			}
+
+			AssetHandle found = m_Find(name);
+			if (found.m_IsNull() && m_onMiss && !name.empty() && m_onMiss(name)) {
+				found = m_Find(name);
+			}
+			handle.m_index = found.m_index;
+			handle.m_generation = found.m_generation;
+			handle.m_missedAt = m_registrations;
+			return m_Get(found);
+		}
+
+		/******************************************************************/
+		/*!
+		\fn        const std::string& m_GetName(AssetHandle handle) const
+		\brief     Returns the name the handle was registered with, empty
+				   if the handle is stale.
+		*/
+		/******************************************************************/
+		const std::string& m_GetName(AssetHandle handle) const {
+
+			static const std::string empty{};
+			if (!m_Get(handle)) return empty;
+
+			return m_slots[handle.m_index].m_name;
+		}
+
+		/******************************************************************/
+		/*!
+		\fn        size_t m_Size() const
+		\brief     Number of assets currently registered.
+		*/
+		/******************************************************************/
+		size_t m_Size() const { return m_nameToSlot.size(); }
+
+		/******************************************************************/
+		/*!
+		\fn        void m_Clear()
+		\brief     Invalidates every registered asset.
+		*/
+		/******************************************************************/
+		void m_Clear() {
+
+			m_freeSlots.clear();
+			for (std::uint32_t n{}; n < m_slots.size(); n++) {
+				m_slots[n].m_asset = nullptr;
+				m_slots[n].m_name.clear();
+				m_slots[n].m_generation++;
+				m_freeSlots.push_back(n);
+			}
+			m_nameToSlot.clear();
+		}
+
+		/******************************************************************/
+		/*!
+		\var       m_onMiss
+		\brief     Called when a name is resolved that is not registered,
+				   returns true if it registered the asset. Set by the
+				   residency manager to load assets lazily.
+		*/
+		/******************************************************************/
+		std::function<bool(const std::string&)> m_onMiss;
+
+	private:
+
+		struct Slot {
+			T* m_asset{};
+			std::uint32_t m_generation{};
+			std::string m_name{};
+		};
+
+		std::vector<Slot> m_slots;
+
+		std::vector<std::uint32_t> m_freeSlots;
+
+		std::unordered_map<std::string, std::uint32_t> m_nameToSlot;
+
+		//names registered so far, a remembered miss is retried once it changes
+		std::uint32_t m_registrations{};
+	};
+
+}
+
+#endif ASSETHANDLE_H
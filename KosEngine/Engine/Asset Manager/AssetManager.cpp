@@ -34,16 +34,9 @@ namespace assetmanager {
 
     void AssetManager::m_funcLoadAssets(std::string Directory )
     {
-        for (auto& directoryPath : std::filesystem::directory_iterator(Directory)) {
-            std::string filepath = directoryPath.path().string();
-            std::replace(filepath.begin(), filepath.end(), '\\', '/');
-
-            if (directoryPath.is_directory()) {
-                m_funcLoadAssets(filepath);
-            }
-            else {
-                m_LoadAsset(directoryPath.path());
-            }
+        //loose files and the mounted archive
+        for (const auto& filepath : VirtualFileSystem::m_GetInstance()->m_ListFiles(Directory)) {
+            m_LoadAsset(filepath);
         }
 
 
@@ -54,6 +47,9 @@ namespace assetmanager {
         std::string filepath = directoryPath.string();
         std::replace(filepath.begin(), filepath.end(), '\\', '/');
 
+        //loaded later by the scenes that reference it
+        if (m_residency.m_Catalog(directoryPath)) return;
+
         if (directoryPath.filename().extension().string() == ".png" || directoryPath.filename().extension().string() == ".jpg") {
             LOGGING_INFO("Filepath: {}", filepath.c_str());
             m_funcLoadImage(filepath);
@@ -128,7 +124,7 @@ namespace assetmanager {
     void AssetManager::m_LoadAudio(const std::string& file) {
         const std::set<std::string> supportedFormats = { ".wav", ".ogg" };
 
-        if (!std::filesystem::exists(file)) {
+        if (!VirtualFileSystem::m_GetInstance()->m_Exists(file)) {
            // std::cerr << "Error: Audio file not found: " << file << "\n";
             return;
         }
@@ -163,6 +159,9 @@ namespace assetmanager {
 
    void AssetManager::m_LoadFont(std::string file)
    {
+       //the glyphs live in a texture, headless runs draw no text
+       if (Helper::Helpers::GetInstance()->m_headless) return;
+
        std::filesystem::path filepath = file;
        std::string filename = filepath.filename().string();
        if (m_fontManager.m_fonts.find(filename) == m_fontManager.m_fonts.end()) {
@@ -186,6 +185,69 @@ namespace assetmanager {
         
     }
 
+    void AssetManager::m_ReloadAsset(std::filesystem::path filepath, image::DecodedImage& decoded)
+    {
+        std::string file = filepath.string();
+        std::replace(file.begin(), file.end(), '\\', '/');
+        const std::string extension = filepath.extension().string();
+
+        if (extension == ".png" || extension == ".jpg") {
+            if (!decoded.m_data && !image::ImageManager::m_DecodeImage(file, decoded)) {
+                LOGGING_WARN("Fail to decode {}, waiting for next change", file);
+                return;
+            }
+            //never loaded before, load as new image
+            if (!m_imageManager.m_ReloadImage(file, decoded)) {
+                m_funcLoadImage(file);
+            }
+        }
+        else if (extension == ".wav") {
+            const std::string name = filepath.stem().string();
+            if (m_audioManager.getSoundMap().find(name) != m_audioManager.getSoundMap().end()) {
+                //replacing the sound stops its voices
+                m_audioManager.m_LoadAudio(name, file);
+            }
+            else {
+                m_LoadAudio(file);
+            }
+        }
+        else if (extension == ".ttf") {
+            const auto& font = m_fontManager.m_fonts.find(filepath.filename().string());
+            if (font != m_fontManager.m_fonts.end() && !font->second.empty()) {
+                //every glyph shares the atlas
+                glDeleteTextures(1, &font->second.begin()->second.m_textureID);
+            }
+            text::FontManager::LoadFont(file);
+        }
+        else if (extension == ".cs") {
+            m_LoadScript(filepath);
+            LOGGING_INFO("Script {} changed, compiled on next play", filepath.filename().string());
+        }
+        else if (extension == ".prefab") {
+            ecs::ECS* ecs = ecs::ECS::m_GetInstance();
+            scenes::SceneManager* scenemanager = scenes::SceneManager::m_GetInstance();
+            const std::string prefabname = filepath.filename().string();
+
+            const auto& prefabscene = ecs->m_ECS_SceneMap.find(prefabname);
+            if (prefabscene == ecs->m_ECS_SceneMap.end()) {
+                scenemanager->m_LoadScene(filepath);
+                return;
+            }
+
+            //keep the prefab open if it is being edited
+            bool isActive = prefabscene->second.m_isActive;
+            scenemanager->m_ClearScene(prefabname);
+            scenemanager->m_LoadScene(filepath);
+            ecs->m_ECS_SceneMap.find(prefabname)->second.m_isActive = isActive;
+
+            prefab::Prefab::m_UpdateAllPrefabEntity(prefabname);
+        }
+        else if (extension == ".json") {
+            //open scenes are owned by the editor, they are not replaced underneath it
+            LOGGING_INFO("Scene {} changed on disk, reload the scene to apply", filepath.filename().string());
+        }
+    }
+
     void AssetManager::m_RenameAsset(std::filesystem::path oldfilepath, std::filesystem::path newfilepath)
     {
         if (oldfilepath == newfilepath) {
@@ -209,6 +271,10 @@ namespace assetmanager {
                     m_imageManager.m_imageMap[newfilepath.filename().string()] = m_imageManager.m_imageMap.find(oldfilepath.filename().string())->second;
                     //delete old name map
                     m_imageManager.m_imageMap.erase(oldfilepath.filename().string());
+
+                    //handles resolved with the old name are stale
+                    m_imageManager.m_imageHandles.m_Invalidate(oldfilepath.filename().string());
+                    m_imageManager.m_imageHandles.m_Register(newfilepath.filename().string(), &m_imageManager.m_imageMap.find(newfilepath.filename().string())->second);
                 }
                 else {
                     return;
@@ -248,18 +314,8 @@ namespace assetmanager {
             }
         }
         if (oldfilepath.extension().string() == ".wav") {
-            auto& soundmap = m_audioManager.getSoundMap();
-            if (soundmap.find(oldfilepath.filename().stem().string()) != soundmap.end()) {
-                if (soundmap.find(newfilepath.filename().stem().string()) == soundmap.end()) {
-
-                    soundmap[newfilepath.filename().stem().string()] = std::move(soundmap.find(oldfilepath.filename().stem().string())->second);
-                    soundmap.erase(oldfilepath.filename().stem().string());
-                }
-                else {
-                    return;
-                }
-            }
-            else {
+            //fails if the old name is not loaded or the new one is
+            if (!m_audioManager.m_RenameAudio(oldfilepath.filename().stem().string(), newfilepath.filename().stem().string())) {
                 return;
             }
         }
@@ -274,6 +330,10 @@ namespace assetmanager {
                     textmap[newfilepath.filename().string()] = std::move(textmap.find(oldfilepath.filename().string())->second);
                     //delete old name map
                     textmap.erase(oldfilepath.filename().string());
+
+                    //handles resolved with the old name are stale
+                    m_fontManager.m_fontHandles.m_Invalidate(oldfilepath.filename().string());
+                    m_fontManager.m_fontHandles.m_Register(newfilepath.filename().string(), &textmap.find(newfilepath.filename().string())->second);
                 }
                 else {
                     return;
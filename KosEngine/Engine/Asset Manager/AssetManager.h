@@ -28,6 +28,9 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "Image.h"
 #include "Text.h"
 #include "Video.h"
+#include "AssetWatcher.h"
+#include "AssetResidency.h"
+#include "VirtualFileSystem.h"
 #include "../C#Mono/mono_handler.h"
 #include "../C#Mono/InternalCall.h"
 
@@ -135,6 +138,18 @@ namespace assetmanager {
         /******************************************************************/
         void m_RenameAsset(std::filesystem::path old, std::filesystem::path _new);
 
+        /******************************************************************/
+        /*!
+        \fn      void m_ReloadAsset(std::filesystem::path filepath, image::DecodedImage& decoded)
+        \brief   Reloads a single asset that changed on disk, called by the
+                 asset watcher at a frame boundary.
+        \param   filepath - Path to the changed asset file.
+        \param   decoded - Pixels decoded by the watch thread for images,
+                 empty for other assets.
+        */
+        /******************************************************************/
+        void m_ReloadAsset(std::filesystem::path filepath, image::DecodedImage& decoded);
+
         /******************************************************************/
         /*!
         \fn      void m_LoadScript(std::filesystem::path filepath)
@@ -186,6 +201,24 @@ namespace assetmanager {
         /******************************************************************/
 
         text::FontManager m_fontManager;
+
+        /******************************************************************/
+        /*!
+        \var     AssetWatcher m_assetWatcher
+        \brief   Watches the asset directory for hot reload and keeps the
+                 cached directory index used by the content browser.
+        */
+        /******************************************************************/
+        AssetWatcher m_assetWatcher;
+
+        /******************************************************************/
+        /*!
+        \var     AssetResidency m_residency
+        \brief   Loads images, audio and fonts when the scenes using them
+                 are loaded and evicts them once unused, off by default.
+        */
+        /******************************************************************/
+        AssetResidency m_residency;
         
     };
 
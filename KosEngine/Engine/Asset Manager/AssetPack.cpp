@@ -0,0 +1,433 @@
+/******************************************************************/
+/*!
+\file      AssetPack.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      March 12, 2025
+\brief     This file contains the definitions of the .kpak reader,
+		   the offline packer and the LZ4 block codec.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include "../Config/pch.h"
+#include "AssetPack.h"
+#include "../Debugging/Logging.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace assetmanager {
+
+	/*--------------------------------------------------------------
+	  LZ4 BLOCK FORMAT
+	--------------------------------------------------------------*/
+
+	//last 5 bytes are always literals, last match starts 12 bytes before the end
+	static constexpr std::size_t lz4LastLiterals = 5;
+	static constexpr std::size_t lz4MatchFindLimit = 12;
+	static constexpr std::size_t lz4MinMatch = 4;
+	static constexpr int lz4HashLog = 12;
+
+	static std::uint32_t Read32(const unsigned char* ptr) {
+		std::uint32_t value;
+		std::memcpy(&value, ptr, sizeof(value));
+		return value;
+	}
+
+	static void WriteLength(std::vector<unsigned char>& dst, std::size_t length) {
+		while (length >= 255) {
+			dst.push_back(255);
+			length -= 255;
+		}
+		dst.push_back(static_cast<unsigned char>(length));
+	}
+
+	static void WriteSequence(std::vector<unsigned char>& dst, const unsigned char* literals, std::size_t literalLength, std::size_t offset, std::size_t matchLength) {
+
+		const std::size_t matchCode = matchLength - lz4MinMatch;
+		dst.push_back(static_cast<unsigned char>(((std::min)(literalLength, std::size_t{ 15 }) << 4) | (std::min)(matchCode, std::size_t{ 15 })));
+		if (literalLength >= 15) WriteLength(dst, literalLength - 15);
+		dst.insert(dst.end(), literals, literals + literalLength);
+
+		dst.push_back(static_cast<unsigned char>(offset & 0xFF));
+		dst.push_back(static_cast<unsigned char>((offset >> 8) & 0xFF));
+		if (matchCode >= 15) WriteLength(dst, matchCode - 15);
+	}
+
+	void Lz4::m_Compress(const unsigned char* src, std::size_t srcSize, std::vector<unsigned char>& dst)
+	{
+		dst.clear();
+		dst.reserve(srcSize + srcSize / 255 + 16);
+
+		std::size_t anchor{};
+
+		if (srcSize > lz4MatchFindLimit) {
+			//position + 1, 0 is empty
+			std::vector<std::uint32_t> table(std::size_t{ 1 } << lz4HashLog, 0);
+
+			const std::size_t matchLimit = srcSize - lz4MatchFindLimit;
+			const std::size_t literalLimit = srcSize - lz4LastLiterals;
+
+			std::size_t ip{};
+			while (ip < matchLimit) {
+				const std::uint32_t sequence = Read32(src + ip);
+				const std::uint32_t hash = (sequence * 2654435761u) >> (32 - lz4HashLog);
+
+				const std::size_t candidate = table[hash];
+				table[hash] = static_cast<std::uint32_t>(ip + 1);
+
+				if (candidate == 0 || ip - (candidate - 1) > 0xFFFF || Read32(src + candidate - 1) != sequence) {
+					ip++;
+					continue;
+				}
+
+				const std::size_t match = candidate - 1;
+				std::size_t length = lz4MinMatch;
+				while (ip + length < literalLimit && src[match + length] == src[ip + length]) {
+					length++;
+				}
+
+				WriteSequence(dst, src + anchor, ip - anchor, ip - match, length);
+				ip += length;
+				anchor = ip;
+			}
+		}
+
+		//trailing literals
+		const std::size_t literalLength = srcSize - anchor;
+		dst.push_back(static_cast<unsigned char>((std::min)(literalLength, std::size_t{ 15 }) << 4));
+		if (literalLength >= 15) WriteLength(dst, literalLength - 15);
+		dst.insert(dst.end(), src + anchor, src + srcSize);
+	}
+
+	bool Lz4::m_Decompress(const unsigned char* src, std::size_t srcSize, unsigned char* dst, std::size_t dstSize)
+	{
+		std::size_t ip{};
+		std::size_t op{};
+
+		auto readLength = [&](std::size_t& length) {
+			unsigned char byte{};
+			do {
+				if (ip >= srcSize) return false;
+				byte = src[ip++];
+				length += byte;
+			} while (byte == 255);
+			return true;
+			};
+
+		while (ip < srcSize) {
+			const unsigned char token = src[ip++];
+
+			std::size_t literalLength = token >> 4;
+			if (literalLength == 15 && !readLength(literalLength)) return false;
+			if (literalLength > srcSize - ip || literalLength > dstSize - op) return false;
+
+			std::memcpy(dst + op, src + ip, literalLength);
+			ip += literalLength;
+			op += literalLength;
+
+			//last sequence has no match
+			if (ip >= srcSize) break;
+
+			if (srcSize - ip < 2) return false;
+			const std::size_t offset = static_cast<std::size_t>(src[ip]) | (static_cast<std::size_t>(src[ip + 1]) << 8);
+			ip += 2;
+			if (offset == 0 || offset > op) return false;
+
+			std::size_t matchLength = token & 15;
+			if (matchLength == 15 && !readLength(matchLength)) return false;
+			matchLength += lz4MinMatch;
+			if (matchLength > dstSize - op) return false;
+
+			//byte copy, the match may overlap the output
+			const unsigned char* match = dst + op - offset;
+			for (std::size_t n{}; n < matchLength; n++) {
+				dst[op + n] = match[n];
+			}
+			op += matchLength;
+		}
+
+		return op == dstSize;
+	}
+
+	/*--------------------------------------------------------------
+	  READER
+	--------------------------------------------------------------*/
+
+	std::uint64_t AssetPack::m_Hash(std::string_view name)
+	{
+		std::uint64_t hash = 14695981039346656037ull;
+		for (const char c : name) {
+			hash ^= static_cast<unsigned char>(c);
+			hash *= 1099511628211ull;
+		}
+		return hash;
+	}
+
+	AssetPack::~AssetPack()
+	{
+		m_Close();
+	}
+
+	bool AssetPack::m_Open(const std::filesystem::path& path)
+	{
+		m_Close();
+
+#ifdef _WIN32
+		HANDLE file = CreateFileW(path.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS, nullptr);
+		if (file == INVALID_HANDLE_VALUE) {
+			LOGGING_ERROR("Fail to open pack {}", path.string());
+			return false;
+		}
+
+		LARGE_INTEGER size{};
+		GetFileSizeEx(file, &size);
+
+		HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		const void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+		if (!view) {
+			if (mapping) CloseHandle(mapping);
+			CloseHandle(file);
+			LOGGING_ERROR("Fail to map pack {}", path.string());
+			return false;
+		}
+
+		m_fileHandle = file;
+		m_mappingHandle = mapping;
+		m_viewSize = static_cast<std::size_t>(size.QuadPart);
+#else
+		int fd = open(path.c_str(), O_RDONLY);
+		if (fd < 0) {
+			LOGGING_ERROR("Fail to open pack {}", path.string());
+			return false;
+		}
+
+		struct stat status {};
+		fstat(fd, &status);
+
+		void* view = status.st_size > 0 ? mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+		//the mapping keeps the file alive
+		close(fd);
+		if (view == MAP_FAILED) {
+			LOGGING_ERROR("Fail to map pack {}", path.string());
+			return false;
+		}
+
+		m_viewSize = static_cast<std::size_t>(status.st_size);
+#endif
+		m_view = static_cast<const unsigned char*>(view);
+
+		//validate before trusting any offset
+		const PackHeader* header = reinterpret_cast<const PackHeader*>(m_view);
+		const PackHeader expected{};
+		if (m_viewSize < sizeof(PackHeader) || std::memcmp(header->m_magic, expected.m_magic, sizeof(expected.m_magic)) != 0 || header->m_version != expected.m_version) {
+			LOGGING_ERROR("{} is not a valid pack", path.string());
+			m_Close();
+			return false;
+		}
+
+		const std::uint64_t tocSize = static_cast<std::uint64_t>(header->m_entryCount) * sizeof(PackEntry);
+		if (header->m_tocOffset > m_viewSize || tocSize > m_viewSize - header->m_tocOffset || header->m_tocOffset % alignof(PackEntry) != 0
+			|| header->m_stringsOffset > m_viewSize || header->m_stringsSize > m_viewSize - header->m_stringsOffset) {
+			LOGGING_ERROR("{} table of contents is corrupted", path.string());
+			m_Close();
+			return false;
+		}
+
+		m_entries = reinterpret_cast<const PackEntry*>(m_view + header->m_tocOffset);
+		m_entryCount = header->m_entryCount;
+		m_strings = reinterpret_cast<const char*>(m_view + header->m_stringsOffset);
+
+		for (const PackEntry* entry = m_Begin(); entry != m_End(); ++entry) {
+			if (entry->m_offset > m_viewSize || entry->m_storedSize > m_viewSize - entry->m_offset
+				|| static_cast<std::uint64_t>(entry->m_nameOffset) + entry->m_nameLength > header->m_stringsSize) {
+				LOGGING_ERROR("{} entry out of bounds", path.string());
+				m_Close();
+				return false;
+			}
+		}
+
+		LOGGING_INFO("Pack {} mounted, {} entries", path.string(), m_entryCount);
+		return true;
+	}
+
+	void AssetPack::m_Close()
+	{
+#ifdef _WIN32
+		if (m_view) UnmapViewOfFile(m_view);
+		if (m_mappingHandle) CloseHandle(m_mappingHandle);
+		if (m_fileHandle) CloseHandle(m_fileHandle);
+		m_mappingHandle = nullptr;
+		m_fileHandle = nullptr;
+#else
+		if (m_view) munmap(const_cast<unsigned char*>(m_view), m_viewSize);
+#endif
+		m_view = nullptr;
+		m_viewSize = 0;
+		m_entries = nullptr;
+		m_entryCount = 0;
+		m_strings = nullptr;
+	}
+
+	const PackEntry* AssetPack::m_Find(std::string_view name) const
+	{
+		if (!m_IsOpen()) return nullptr;
+
+		const std::uint64_t hash = m_Hash(name);
+		const PackEntry* it = std::lower_bound(m_Begin(), m_End(), hash, [](const PackEntry& entry, std::uint64_t value) {return entry.m_hash < value; });
+
+		//hash collisions are adjacent
+		for (; it != m_End() && it->m_hash == hash; ++it) {
+			if (m_GetName(*it) == name) return it;
+		}
+		return nullptr;
+	}
+
+	bool AssetPack::m_Read(const PackEntry& entry, FileData& data) const
+	{
+		const unsigned char* stored = m_view + entry.m_offset;
+
+		if (!(entry.m_flags & PackEntry::m_compressedFlag)) {
+			data.m_storage.clear();
+			data.m_data = stored;
+			data.m_size = static_cast<std::size_t>(entry.m_size);
+			return true;
+		}
+
+		data.m_storage.resize(static_cast<std::size_t>(entry.m_size));
+		if (!Lz4::m_Decompress(stored, static_cast<std::size_t>(entry.m_storedSize), data.m_storage.data(), data.m_storage.size())) {
+			LOGGING_ERROR("Fail to decompress {}", m_GetName(entry));
+			data.m_storage.clear();
+			return false;
+		}
+
+		data.m_data = data.m_storage.data();
+		data.m_size = data.m_storage.size();
+		return true;
+	}
+
+	std::string_view AssetPack::m_GetName(const PackEntry& entry) const
+	{
+		return std::string_view(m_strings + entry.m_nameOffset, entry.m_nameLength);
+	}
+
+	/*--------------------------------------------------------------
+	  PACKER
+	--------------------------------------------------------------*/
+
+	static bool IsCompressedFormat(const std::string& extension) {
+		static const std::set<std::string> compressed{ ".png", ".jpg", ".ogg", ".mp3", ".mpg", ".mpeg", ".kpak" };
+		return compressed.find(extension) != compressed.end();
+	}
+
+	bool AssetPacker::m_PackDirectory(const std::filesystem::path& directory, const std::filesystem::path& output, std::uint32_t alignment)
+	{
+		if (!std::filesystem::is_directory(directory)) {
+			LOGGING_ERROR("Pack directory does not exist");
+			return false;
+		}
+		if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+			LOGGING_ERROR("Pack alignment must be a power of two");
+			return false;
+		}
+
+		//sorted for a deterministic archive
+		std::vector<std::filesystem::path> files;
+		for (const auto& entry : std::filesystem::recursive_directory_iterator(directory)) {
+			if (entry.is_regular_file() && entry.path().extension().string() != ".kpak") {
+				files.push_back(entry.path());
+			}
+		}
+		std::sort(files.begin(), files.end());
+
+		std::ofstream out(output, std::ios::binary | std::ios::trunc);
+		if (!out) {
+			LOGGING_ERROR("Fail to create pack {}", output.string());
+			return false;
+		}
+
+		PackHeader header{};
+		out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+		std::vector<PackEntry> entries;
+		std::string strings;
+		std::vector<unsigned char> compressed;
+		std::uint64_t offset = sizeof(header);
+		std::uint64_t totalSize{};
+
+		for (const auto& file : files) {
+			std::ifstream in(file, std::ios::binary);
+			std::vector<unsigned char> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+			const std::string name = file.lexically_relative(directory).generic_string();
+
+			PackEntry entry{};
+			entry.m_hash = AssetPack::m_Hash(name);
+			entry.m_size = bytes.size();
+			entry.m_alignment = alignment;
+			entry.m_nameOffset = static_cast<std::uint32_t>(strings.size());
+			entry.m_nameLength = static_cast<std::uint32_t>(name.size());
+			strings += name;
+
+			const unsigned char* stored = bytes.data();
+			std::size_t storedSize = bytes.size();
+			if (!IsCompressedFormat(file.extension().string()) && !bytes.empty()) {
+				Lz4::m_Compress(bytes.data(), bytes.size(), compressed);
+				if (compressed.size() * 10 < bytes.size() * 9) {
+					entry.m_flags |= PackEntry::m_compressedFlag;
+					stored = compressed.data();
+					storedSize = compressed.size();
+				}
+			}
+
+			//pad up to the entry's alignment
+			const std::uint64_t aligned = (offset + alignment - 1) & ~static_cast<std::uint64_t>(alignment - 1);
+			for (; offset < aligned; offset++) out.put('\0');
+
+			entry.m_offset = offset;
+			entry.m_storedSize = storedSize;
+			out.write(reinterpret_cast<const char*>(stored), static_cast<std::streamsize>(storedSize));
+			offset += storedSize;
+			totalSize += bytes.size();
+
+			entries.push_back(entry);
+		}
+
+		std::stable_sort(entries.begin(), entries.end(), [](const PackEntry& lhs, const PackEntry& rhs) {return lhs.m_hash < rhs.m_hash; });
+
+		const std::uint64_t tocOffset = (offset + alignof(PackEntry) - 1) & ~static_cast<std::uint64_t>(alignof(PackEntry) - 1);
+		for (; offset < tocOffset; offset++) out.put('\0');
+
+		header.m_entryCount = static_cast<std::uint32_t>(entries.size());
+		header.m_tocOffset = tocOffset;
+		header.m_stringsOffset = tocOffset + entries.size() * sizeof(PackEntry);
+		header.m_stringsSize = strings.size();
+
+		out.write(reinterpret_cast<const char*>(entries.data()), static_cast<std::streamsize>(entries.size() * sizeof(PackEntry)));
+		out.write(strings.data(), static_cast<std::streamsize>(strings.size()));
+
+		out.seekp(0);
+		out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+		if (!out) {
+			LOGGING_ERROR("Fail to write pack {}", output.string());
+			return false;
+		}
+
+		LOGGING_INFO("Packed {} files into {} ({} -> {} bytes)", entries.size(), output.string(), totalSize, header.m_stringsOffset + header.m_stringsSize);
+		return true;
+	}
+
+}
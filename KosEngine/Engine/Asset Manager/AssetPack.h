@@ -0,0 +1,178 @@
+/******************************************************************/
+/*!
+\file      AssetPack.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      March 12, 2025
+\brief     This file contains the .kpak archive format, the reader
+		   and the offline packer.
+
+		   Layout of a .kpak file:
+		   - PackHeader
+		   - entry data, each entry aligned to its own alignment,
+			 optionally compressed with the LZ4 block format
+		   - table of contents, PackEntry sorted by path hash
+		   - string table holding the entry paths
+
+		   The reader memory maps the archive, uncompressed entries
+		   are handed out as pointers into the mapping without a copy.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#ifndef ASSETPACK_H
+#define ASSETPACK_H
+
+#include "../Config/pch.h"
+
+namespace assetmanager {
+
+	struct PackHeader {
+		char m_magic[4]{ 'K', 'P', 'A', 'K' };
+		std::uint32_t m_version{ 1 };
+		std::uint32_t m_entryCount{};
+		std::uint32_t m_flags{};
+		std::uint64_t m_tocOffset{};
+		std::uint64_t m_stringsOffset{};
+		std::uint64_t m_stringsSize{};
+	};
+	static_assert(sizeof(PackHeader) == 40, "PackHeader layout is part of the file format");
+
+	struct PackEntry {
+		static constexpr std::uint32_t m_compressedFlag = 1u;
+
+		std::uint64_t m_hash{};          ///< FNV-1a of the path relative to the pack root
+		std::uint64_t m_offset{};        ///< offset of the stored bytes from the start of the file
+		std::uint64_t m_storedSize{};    ///< size inside the archive
+		std::uint64_t m_size{};          ///< size once decompressed
+		std::uint32_t m_nameOffset{};    ///< offset into the string table
+		std::uint32_t m_nameLength{};
+		std::uint32_t m_flags{};
+		std::uint32_t m_alignment{};
+	};
+	static_assert(sizeof(PackEntry) == 48, "PackEntry layout is part of the file format");
+
+	/******************************************************************/
+	/*!
+	\class     FileData
+	\brief     Bytes of a file read through the archive or the disk.
+			   m_data either points into the archive's mapping or into
+			   m_storage, it is valid as long as the FileData and the
+			   mounted archive are.
+	*/
+	/******************************************************************/
+	struct FileData {
+		const unsigned char* m_data{};
+		std::size_t m_size{};
+		std::vector<unsigned char> m_storage;
+
+		std::string_view m_View() const { return std::string_view(reinterpret_cast<const char*>(m_data), m_size); }
+	};
+
+	class AssetPack {
+
+	public:
+
+		AssetPack() = default;
+		AssetPack(const AssetPack&) = delete;
+		AssetPack& operator=(const AssetPack&) = delete;
+		~AssetPack();
+
+		/******************************************************************/
+		/*!
+		\fn        bool m_Open(const std::filesystem::path& path)
+		\brief     Maps the archive into memory and validates its table
+				   of contents.
+		*/
+		/******************************************************************/
+		bool m_Open(const std::filesystem::path& path);
+
+		void m_Close();
+
+		bool m_IsOpen() const { return m_view != nullptr; }
+
+		/******************************************************************/
+		/*!
+		\fn        const PackEntry* m_Find(std::string_view name) const
+		\brief     Binary searches the table of contents by hash.
+		\param     name - path relative to the pack root, '/' separated
+		\return    nullptr if the archive does not contain the file
+		*/
+		/******************************************************************/
+		const PackEntry* m_Find(std::string_view name) const;
+
+		/******************************************************************/
+		/*!
+		\fn        bool m_Read(const PackEntry& entry, FileData& data) const
+		\brief     Returns the bytes of an entry, decompresses it if needed.
+		*/
+		/******************************************************************/
+		bool m_Read(const PackEntry& entry, FileData& data) const;
+
+		std::string_view m_GetName(const PackEntry& entry) const;
+
+		const PackEntry* m_Begin() const { return m_entries; }
+		const PackEntry* m_End() const { return m_entries + m_entryCount; }
+
+		static std::uint64_t m_Hash(std::string_view name);
+
+	private:
+
+		const unsigned char* m_view{};
+		std::size_t m_viewSize{};
+
+		const PackEntry* m_entries{};
+		std::uint32_t m_entryCount{};
+		const char* m_strings{};
+
+#ifdef _WIN32
+		void* m_fileHandle{};
+		void* m_mappingHandle{};
+#endif
+	};
+
+	/******************************************************************/
+	/*!
+	\class     AssetPacker
+	\brief     Offline tool that packs a directory into a .kpak archive.
+	*/
+	/******************************************************************/
+	class AssetPacker {
+
+	public:
+
+		/******************************************************************/
+		/*!
+		\fn        static bool m_PackDirectory(const std::filesystem::path& directory, const std::filesystem::path& output, std::uint32_t alignment)
+		\brief     Packs every file under directory. Files that are not
+				   already compressed are stored with LZ4 when it saves
+				   at least 10%.
+		\param     alignment - alignment of each entry inside the archive,
+				   power of two
+		*/
+		/******************************************************************/
+		static bool m_PackDirectory(const std::filesystem::path& directory, const std::filesystem::path& output, std::uint32_t alignment = 16);
+	};
+
+	/******************************************************************/
+	/*!
+	\class     Lz4
+	\brief     LZ4 block format compressor and decompressor, greedy
+			   single probe matcher, streams are compatible with the
+			   reference LZ4_decompress_safe.
+	*/
+	/******************************************************************/
+	class Lz4 {
+
+	public:
+
+		static void m_Compress(const unsigned char* src, std::size_t srcSize, std::vector<unsigned char>& dst);
+
+		static bool m_Decompress(const unsigned char* src, std::size_t srcSize, unsigned char* dst, std::size_t dstSize);
+	};
+
+}
+
+#endif ASSETPACK_H
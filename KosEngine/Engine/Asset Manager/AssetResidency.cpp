@@ -0,0 +1,355 @@
+/******************************************************************/
+/*!
+\file      AssetResidency.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      March 14, 2025
+\brief     This file contains the definitions of the AssetResidency
+		   class.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include "../Config/pch.h"
+#include "AssetResidency.h"
+#include "AssetManager.h"
+#include "../ECS/ECS.h"
+#include "../Debugging/Logging.h"
+
+namespace assetmanager {
+
+	static bool LoadAsset(AssetType type, const std::string& name, const std::string& file)
+	{
+		AssetManager* assetmanager = AssetManager::m_funcGetInstance();
+
+		switch (type) {
+		case ASSETIMAGE: {
+			auto& images = assetmanager->m_imageManager;
+			if (images.m_imageMap.find(name) == images.m_imageMap.end()) {
+				images.m_LoadImage(file.c_str());
+				if (images.m_imageMap.find(name) == images.m_imageMap.end()) {
+					LOGGING_ERROR("Fail to load image {}", file);
+					return false;
+				}
+			}
+			else {
+				//evicted before, upload into its old texture
+				image::DecodedImage decoded;
+				if (!image::ImageManager::m_DecodeImage(file, decoded) || !images.m_ReloadImage(file, decoded)) {
+					image::ImageManager::m_FreeDecodedImage(decoded);
+					LOGGING_ERROR("Fail to load image {}", file);
+					return false;
+				}
+			}
+			return true;
+		}
+		case ASSETAUDIO:
+			//queued on the audio loader, the name is in the map while it loads
+			assetmanager->m_LoadAudio(file);
+			if (assetmanager->m_audioManager.getSoundMap().find(name) == assetmanager->m_audioManager.getSoundMap().end()) {
+				LOGGING_ERROR("Fail to load audio {}", file);
+				return false;
+			}
+			return true;
+		case ASSETFONT:
+			text::FontManager::LoadFont(file);
+			return assetmanager->m_fontManager.m_fonts.find(name) != assetmanager->m_fontManager.m_fonts.end();
+		default:
+			return false;
+		}
+	}
+
+	static void UnloadAsset(AssetType type, const std::string& name)
+	{
+		AssetManager* assetmanager = AssetManager::m_funcGetInstance();
+
+		switch (type) {
+		case ASSETIMAGE:
+			assetmanager->m_imageManager.m_UnloadImage(name);
+			break;
+		case ASSETAUDIO:
+			//stops the voices playing it
+			assetmanager->m_audioManager.m_UnloadAudio(name);
+			break;
+		case ASSETFONT:
+			assetmanager->m_fontManager.m_UnloadFont(name);
+			break;
+		default:
+			break;
+		}
+	}
+
+	void AssetResidency::m_Enable(bool enable)
+	{
+		m_enabled = enable;
+
+		//assets loaded through m_onLoad are not in the asset manager's handle tables
+		if (m_onLoad) return;
+
+		AssetManager* assetmanager = AssetManager::m_funcGetInstance();
+		if (!m_enabled) {
+			assetmanager->m_imageManager.m_imageHandles.m_onMiss = nullptr;
+			assetmanager->m_fontManager.m_fontHandles.m_onMiss = nullptr;
+			assetmanager->m_audioManager.m_soundHandles.m_onMiss = nullptr;
+			return;
+		}
+
+		//components resolve their assets through the handle tables, a miss means the asset is not resident
+		assetmanager->m_imageManager.m_imageHandles.m_onMiss = [this](const std::string& name) { return m_Request(ASSETIMAGE, name); };
+		assetmanager->m_fontManager.m_fontHandles.m_onMiss = [this](const std::string& name) { return m_Request(ASSETFONT, name); };
+		assetmanager->m_audioManager.m_soundHandles.m_onMiss = [this](const std::string& name) { return m_Request(ASSETAUDIO, name); };
+	}
+
+	bool AssetResidency::m_Catalog(const std::filesystem::path& path)
+	{
+		if (!m_enabled) return false;
+
+		const std::string extension = path.extension().string();
+		AssetType type{};
+		std::string name;
+		if (extension == ".png" || extension == ".jpg") {
+			type = ASSETIMAGE;
+			name = path.filename().string();
+		}
+		else if (extension == ".wav") {
+			type = ASSETAUDIO;
+			name = path.stem().string();
+		}
+		else if (extension == ".ttf") {
+			type = ASSETFONT;
+			name = path.filename().string();
+		}
+		else {
+			return false;
+		}
+
+		std::string file = path.string();
+		std::replace(file.begin(), file.end(), '\\', '/');
+
+		Entry& entry = m_assets[type][name];
+		entry.m_path = file;
+
+		//a loaded scene is already waiting for it
+		if (entry.m_refCount > 0 && !entry.m_isResident) {
+			m_Load(type, name, entry);
+		}
+		return true;
+	}
+
+	void AssetResidency::m_CollectEntity(ecs::EntityID id, Dependencies& dependencies, std::unordered_set<std::string>& visitedPrefabs)
+	{
+		ecs::ECS* ecs = ecs::ECS::m_GetInstance();
+		const auto& signature = ecs->m_ECS_EntityMap.find(id);
+		if (signature == ecs->m_ECS_EntityMap.end()) return;
+
+		if (signature->second.test(ecs::TYPESPRITECOMPONENT)) {
+			auto* sc = static_cast<ecs::SpriteComponent*>(ecs->m_ECS_CombinedComponentPool[ecs::TYPESPRITECOMPONENT]->m_GetEntityComponent(id));
+			if (!sc->m_imageFile.empty()) dependencies[ASSETIMAGE].insert(sc->m_imageFile);
+		}
+		if (signature->second.test(ecs::TYPEUISPRITECOMPONENT)) {
+			auto* uc = static_cast<ecs::UISpriteComponent*>(ecs->m_ECS_CombinedComponentPool[ecs::TYPEUISPRITECOMPONENT]->m_GetEntityComponent(id));
+			if (!uc->m_imageFile.empty()) dependencies[ASSETIMAGE].insert(uc->m_imageFile);
+		}
+		if (signature->second.test(ecs::TYPEPARTICLECOMPONENT)) {
+			auto* pc = static_cast<ecs::ParticleComponent*>(ecs->m_ECS_CombinedComponentPool[ecs::TYPEPARTICLECOMPONENT]->m_GetEntityComponent(id));
+			if (!pc->m_imageFile.empty()) dependencies[ASSETIMAGE].insert(pc->m_imageFile);
+		}
+		if (signature->second.test(ecs::TYPETILEMAPCOMPONENT)) {
+			auto* tmc = static_cast<ecs::TilemapComponent*>(ecs->m_ECS_CombinedComponentPool[ecs::TYPETILEMAPCOMPONENT]->m_GetEntityComponent(id));
+			if (!tmc->m_tilemapFile.empty()) dependencies[ASSETIMAGE].insert(tmc->m_tilemapFile);
+		}
+		if (signature->second.test(ecs::TYPETEXTCOMPONENT)) {
+			auto* tc = static_cast<ecs::TextComponent*>(ecs->m_ECS_CombinedComponentPool[ecs::TYPETEXTCOMPONENT]->m_GetEntityComponent(id));
+			if (!tc->m_fileName.empty()) dependencies[ASSETFONT].insert(tc->m_fileName);
+		}
+		if (signature->second.test(ecs::TYPEAUDIOCOMPONENT)) {
+			auto* ac = static_cast<ecs::AudioComponent*>(ecs->m_ECS_CombinedComponentPool[ecs::TYPEAUDIOCOMPONENT]->m_GetEntityComponent(id));
+			for (const auto& audio : ac->m_AudioFiles) {
+				const std::string name = audio.m_FilePath.empty() ? audio.m_Name : std::filesystem::path{ audio.m_FilePath }.stem().string();
+				if (name.empty()) continue;
+
+				dependencies[ASSETAUDIO].insert(name);
+				//music is loaded before the scene's other sounds so it can start with the scene
+				if (audio.m_IsBGM) {
+					AssetManager::m_funcGetInstance()->m_audioManager.m_PrefetchAudio(name);
+				}
+			}
+		}
+		if (signature->second.test(ecs::TYPENAMECOMPONENT)) {
+			auto* nc = static_cast<ecs::NameComponent*>(ecs->m_ECS_CombinedComponentPool[ecs::TYPENAMECOMPONENT]->m_GetEntityComponent(id));
+			if (nc->m_isPrefab && !nc->m_prefabName.empty()) {
+				m_CollectPrefab(nc->m_prefabName, dependencies, visitedPrefabs);
+			}
+		}
+		if (signature->second.test(ecs::TYPESCRIPTCOMPONENT)) {
+			//prefabs a script instantiates are assigned through its variables
+			auto* sc = static_cast<ecs::ScriptComponent*>(ecs->m_ECS_CombinedComponentPool[ecs::TYPESCRIPTCOMPONENT]->m_GetEntityComponent(id));
+			for (const auto& script : sc->m_scripts) {
+				for (const auto& [variable, value] : std::get<2>(script)) {
+					if (std::filesystem::path{ value }.extension().string() == ".prefab") {
+						m_CollectPrefab(std::filesystem::path{ value }.filename().string(), dependencies, visitedPrefabs);
+					}
+				}
+			}
+		}
+	}
+
+	void AssetResidency::m_CollectPrefab(const std::string& prefab, Dependencies& dependencies, std::unordered_set<std::string>& visitedPrefabs)
+	{
+		if (!visitedPrefabs.insert(prefab).second) return;
+
+		ecs::ECS* ecs = ecs::ECS::m_GetInstance();
+		const auto& prefabscene = ecs->m_ECS_SceneMap.find(prefab);
+		if (prefabscene == ecs->m_ECS_SceneMap.end()) return;
+
+		for (const auto& id : prefabscene->second.m_sceneIDs) {
+			m_CollectEntity(id, dependencies, visitedPrefabs);
+		}
+	}
+
+	void AssetResidency::m_AcquireScene(const std::string& scene)
+	{
+		if (!m_enabled) return;
+
+		ecs::ECS* ecs = ecs::ECS::m_GetInstance();
+		const auto& sceneID = ecs->m_ECS_SceneMap.find(scene);
+		if (sceneID == ecs->m_ECS_SceneMap.end() || sceneID->second.m_isPrefab) return;
+
+		Dependencies dependencies;
+		std::unordered_set<std::string> visitedPrefabs;
+		for (const auto& id : sceneID->second.m_sceneIDs) {
+			m_CollectEntity(id, dependencies, visitedPrefabs);
+		}
+
+		//merge with anything the scene already holds
+		Dependencies& held = m_sceneAssets[scene];
+		for (int type{}; type < TOTALASSETTYPE; type++) {
+			for (const auto& name : dependencies[type]) {
+				if (held[type].insert(name).second) {
+					m_AddReference(static_cast<AssetType>(type), name);
+				}
+			}
+		}
+
+		LOGGING_INFO("Scene {} acquired, {} assets resident (peak {})", scene, m_residentCount, m_peakResidentCount);
+	}
+
+	void AssetResidency::m_ReleaseScene(const std::string& scene)
+	{
+		if (!m_enabled) return;
+
+		const auto& held = m_sceneAssets.find(scene);
+		if (held == m_sceneAssets.end()) return;
+
+		for (int type{}; type < TOTALASSETTYPE; type++) {
+			for (const auto& name : held->second[type]) {
+				m_RemoveReference(static_cast<AssetType>(type), name);
+			}
+		}
+		m_sceneAssets.erase(held);
+	}
+
+	bool AssetResidency::m_Request(AssetType type, const std::string& name)
+	{
+		if (!m_enabled) return false;
+
+		const auto& entry = m_assets[type].find(name);
+		if (entry == m_assets[type].end()) return false;
+
+		//owned by the scenes that are running, released together with them
+		ecs::ECS* ecs = ecs::ECS::m_GetInstance();
+		for (const auto& [scene, sceneID] : ecs->m_ECS_SceneMap) {
+			if (sceneID.m_isPrefab || !sceneID.m_isActive) continue;
+			if (m_sceneAssets[scene][type].insert(name).second) {
+				entry->second.m_refCount++;
+			}
+		}
+
+		entry->second.m_idleTime = 0.f;
+		if (!entry->second.m_isResident) {
+			LOGGING_WARN("Asset {} was not a dependency of the loaded scenes, loading on demand", name);
+			return m_Load(type, name, entry->second);
+		}
+		return true;
+	}
+
+	void AssetResidency::m_Update(float dt)
+	{
+		if (!m_enabled) return;
+
+		for (int type{}; type < TOTALASSETTYPE; type++) {
+			for (auto& [name, entry] : m_assets[type]) {
+				if (!entry.m_isResident || entry.m_refCount > 0) continue;
+
+				entry.m_idleTime += dt;
+				if (entry.m_idleTime >= m_gracePeriod) {
+					m_Unload(static_cast<AssetType>(type), name, entry);
+				}
+			}
+		}
+	}
+
+	void AssetResidency::m_AddReference(AssetType type, const std::string& name)
+	{
+		const auto& entry = m_assets[type].find(name);
+		if (entry == m_assets[type].end()) {
+			//not cataloged yet, loaded when m_Catalog finds it
+			m_assets[type][name].m_refCount++;
+			return;
+		}
+
+		entry->second.m_refCount++;
+		entry->second.m_idleTime = 0.f;
+		if (!entry->second.m_isResident && !entry->second.m_path.empty()) {
+			m_Load(type, name, entry->second);
+		}
+	}
+
+	void AssetResidency::m_RemoveReference(AssetType type, const std::string& name)
+	{
+		const auto& entry = m_assets[type].find(name);
+		if (entry == m_assets[type].end() || entry->second.m_refCount <= 0) return;
+
+		//eviction waits for the grace period so a reloaded scene keeps its assets
+		entry->second.m_refCount--;
+		entry->second.m_idleTime = 0.f;
+	}
+
+	bool AssetResidency::m_Load(AssetType type, const std::string& name, Entry& entry)
+	{
+		//failed loads clear the path so they are not retried every frame
+		if (entry.m_path.empty()) return false;
+
+		const std::string file = entry.m_path.string();
+		const bool loaded = m_onLoad ? m_onLoad(type, name, file) : LoadAsset(type, name, file);
+		if (!loaded) {
+			entry.m_path.clear();
+			return false;
+		}
+
+		entry.m_isResident = true;
+		entry.m_idleTime = 0.f;
+		m_residentCount++;
+		m_peakResidentCount = (std::max)(m_peakResidentCount, m_residentCount);
+		return true;
+	}
+
+	void AssetResidency::m_Unload(AssetType type, const std::string& name, Entry& entry)
+	{
+		if (m_onUnload) {
+			m_onUnload(type, name);
+		}
+		else {
+			UnloadAsset(type, name);
+		}
+
+		entry.m_isResident = false;
+		entry.m_idleTime = 0.f;
+		m_residentCount--;
+
+		LOGGING_INFO("Evicted {}, {} assets resident", name, m_residentCount);
+	}
+
+}
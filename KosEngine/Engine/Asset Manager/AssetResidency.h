@@ -0,0 +1,146 @@
+/******************************************************************/
+/*!
+\file      AssetResidency.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      March 14, 2025
+\brief     This file contains the AssetResidency class. When enabled,
+		   images, sounds and fonts are only cataloged at startup and
+		   are loaded when a scene that references them is loaded.
+		   Each asset is reference counted by the scenes using it and
+		   is evicted a grace period after the last scene releases it.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#ifndef ASSETRESIDENCY_H
+#define ASSETRESIDENCY_H
+
+#include "../Config/pch.h"
+#include "../ECS/ECSList.h"
+
+namespace assetmanager {
+
+	enum AssetType {
+		ASSETIMAGE,
+		ASSETAUDIO,
+		ASSETFONT,
+
+		TOTALASSETTYPE
+	};
+
+	class AssetResidency {
+
+	public:
+
+		/******************************************************************/
+		/*!
+		\fn        void m_Enable(bool enable)
+		\brief     Turns lazy loading on, must be called before the assets
+				   are loaded. The editor keeps every asset resident.
+		*/
+		/******************************************************************/
+		void m_Enable(bool enable);
+
+		bool m_IsEnabled() const { return m_enabled; }
+
+		/******************************************************************/
+		/*!
+		\fn        bool m_Catalog(const std::filesystem::path& path)
+		\brief     Records where a managed asset lives without loading it.
+		\return    False if residency is disabled or the file type is not
+				   managed, the caller loads it as usual.
+		*/
+		/******************************************************************/
+		bool m_Catalog(const std::filesystem::path& path);
+
+		/******************************************************************/
+		/*!
+		\fn        void m_AcquireScene(const std::string& scene)
+		\brief     Collects the assets referenced by a loaded scene, the
+				   prefabs it places and the prefabs its scripts spawn,
+				   then loads the ones that are not resident.
+		*/
+		/******************************************************************/
+		void m_AcquireScene(const std::string& scene);
+
+		/******************************************************************/
+		/*!
+		\fn        void m_ReleaseScene(const std::string& scene)
+		\brief     Drops the scene's reference to its assets, called before
+				   the scene is cleared.
+		*/
+		/******************************************************************/
+		void m_ReleaseScene(const std::string& scene);
+
+		/******************************************************************/
+		/*!
+		\fn        bool m_Request(AssetType type, const std::string& name)
+		\brief     Loads an asset that was not found in a scene's
+				   dependencies, such as a sprite swapped in by a script.
+				   The asset is kept until the active scenes are released.
+		\return    True if the asset is resident.
+		*/
+		/******************************************************************/
+		bool m_Request(AssetType type, const std::string& name);
+
+		/******************************************************************/
+		/*!
+		\fn        void m_Update(float dt)
+		\brief     Evicts assets that no scene has referenced for the
+				   grace period.
+		*/
+		/******************************************************************/
+		void m_Update(float dt);
+
+		size_t m_GetResidentCount() const { return m_residentCount; }
+
+		size_t m_GetPeakResidentCount() const { return m_peakResidentCount; }
+
+		float m_gracePeriod{ 5.f };
+
+		//loads and evicts through the asset manager when not set, the tests count the loads through them
+		std::function<bool(AssetType type, const std::string& name, const std::string& file)> m_onLoad;
+
+		std::function<void(AssetType type, const std::string& name)> m_onUnload;
+
+	private:
+
+		struct Entry {
+			std::filesystem::path m_path{};
+			int m_refCount{};
+			bool m_isResident{};
+			float m_idleTime{};
+		};
+
+		using Dependencies = std::array<std::unordered_set<std::string>, TOTALASSETTYPE>;
+
+		void m_CollectEntity(ecs::EntityID id, Dependencies& dependencies, std::unordered_set<std::string>& visitedPrefabs);
+
+		void m_CollectPrefab(const std::string& prefab, Dependencies& dependencies, std::unordered_set<std::string>& visitedPrefabs);
+
+		void m_AddReference(AssetType type, const std::string& name);
+
+		void m_RemoveReference(AssetType type, const std::string& name);
+
+		bool m_Load(AssetType type, const std::string& name, Entry& entry);
+
+		void m_Unload(AssetType type, const std::string& name, Entry& entry);
+
+		bool m_enabled{ false };
+
+		//image and font by file name, audio by stem like the sound map
+		std::array<std::unordered_map<std::string, Entry>, TOTALASSETTYPE> m_assets;
+
+		std::unordered_map<std::string, Dependencies> m_sceneAssets;
+
+		size_t m_residentCount{};
+
+		size_t m_peakResidentCount{};
+	};
+
+}
+
+#endif ASSETRESIDENCY_H
@@ -0,0 +1,530 @@
+/******************************************************************/
+/*!
+\file      AssetWatcher.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      March 10, 2025
+\brief     This file contains the definitions of the AssetWatcher
+		   class. The watch thread only records which paths changed
+		   and decodes images, everything that touches OpenGL, FMOD,
+		   mono or the ECS is done by m_ProcessChanges on the main
+		   thread.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include "../Config/pch.h"
+#include "AssetWatcher.h"
+#include "AssetManager.h"
+#include "../Debugging/Logging.h"
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <poll.h>
+#include <unistd.h>
+#elif defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#endif
+
+namespace assetmanager {
+
+	static bool IsImageFile(const std::filesystem::path& path) {
+		const std::string extension = path.extension().string();
+		return extension == ".png" || extension == ".jpg";
+	}
+
+	AssetWatcher::~AssetWatcher()
+	{
+		m_Stop();
+	}
+
+	std::string AssetWatcher::m_Key(const std::filesystem::path& path)
+	{
+		std::string key = path.lexically_normal().generic_string();
+		while (key.size() > 1 && key.back() == '/') {
+			key.pop_back();
+		}
+		return key;
+	}
+
+	void AssetWatcher::m_Start(const std::filesystem::path& root)
+	{
+		if (m_running) return;
+
+		if (!std::filesystem::exists(root)) {
+			LOGGING_ERROR("Asset Watcher: directory does not exist");
+			return;
+		}
+
+		m_root = root;
+
+		//single walk of the asset directory, afterwards only the changed paths are touched
+		m_directoryIndex.clear();
+		m_writeTimes.clear();
+		m_IndexDirectory(m_root);
+		m_pollTimes = m_writeTimes;
+		for (const auto& directory : m_directoryIndex) {
+			m_pollTimes[directory.first] = std::filesystem::file_time_type{};
+		}
+		m_pollTimes.erase(m_Key(m_root));
+
+#ifdef __linux__
+		m_inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+		if (m_inotifyFd < 0) {
+			LOGGING_WARN("Asset Watcher: inotify unavailable, polling for changes");
+		}
+		else {
+			m_AddWatch(m_root);
+		}
+#endif
+
+		m_running = true;
+		m_thread = std::thread(&AssetWatcher::m_WatchThread, this);
+
+		LOGGING_INFO("Asset Watcher started");
+	}
+
+	void AssetWatcher::m_Stop()
+	{
+		if (!m_running) return;
+
+		m_running = false;
+		if (m_thread.joinable()) {
+			m_thread.join();
+		}
+
+#ifdef __linux__
+		if (m_inotifyFd >= 0) {
+			close(m_inotifyFd);
+			m_inotifyFd = -1;
+		}
+		m_watchDescriptors.clear();
+#endif
+
+		for (auto& change : m_ready) {
+			image::ImageManager::m_FreeDecodedImage(change.m_decoded);
+		}
+		m_ready.clear();
+		m_pending.clear();
+	}
+
+	void AssetWatcher::m_ProcessChanges()
+	{
+		if (!m_running) return;
+
+		std::vector<ReadyChange> changes;
+		{
+			std::lock_guard<std::mutex> lock(m_readyMutex);
+			if (m_ready.empty()) return;
+			changes.swap(m_ready);
+		}
+
+		for (auto& change : changes) {
+			m_ApplyChange(change);
+		}
+	}
+
+	void AssetWatcher::m_SuppressPath(const std::filesystem::path& path)
+	{
+		if (!m_running) return;
+
+		std::error_code ec;
+		std::filesystem::directory_entry entry{ path, ec };
+		if (ec || !entry.exists(ec)) return;
+
+		const std::string key = m_Key(path);
+		if (entry.is_directory(ec)) {
+			//records the write time of every file below it as well
+			m_IndexAdd(entry);
+			m_IndexDirectory(path);
+			return;
+		}
+		if (!entry.is_regular_file(ec)) return;
+
+		if (m_writeTimes.find(key) == m_writeTimes.end()) {
+			m_IndexAdd(entry);
+		}
+		m_writeTimes[key] = entry.last_write_time(ec);
+	}
+
+	const std::vector<std::filesystem::directory_entry>& AssetWatcher::m_GetDirectoryEntries(const std::filesystem::path& directory) const
+	{
+		static const std::vector<std::filesystem::directory_entry> empty{};
+
+		const auto& it = m_directoryIndex.find(m_Key(directory));
+		if (it == m_directoryIndex.end()) return empty;
+
+		return it->second;
+	}
+
+	/*--------------------------------------------------------------
+	  WATCH THREAD
+	--------------------------------------------------------------*/
+
+	void AssetWatcher::m_WatchThread()
+	{
+		auto lastPoll = std::chrono::steady_clock::now();
+
+#ifdef _WIN32
+		if (m_WatchDirectoryChanges()) return;
+
+		LOGGING_WARN("Asset Watcher: ReadDirectoryChangesW unavailable, polling for changes");
+#endif
+
+		while (m_running) {
+#ifdef __linux__
+			if (m_inotifyFd >= 0) {
+				pollfd pfd{ m_inotifyFd, POLLIN, 0 };
+				if (poll(&pfd, 1, 50) > 0) {
+					m_ReadEvents();
+				}
+				m_FlushPending();
+				continue;
+			}
+#endif
+			std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+			const auto now = std::chrono::steady_clock::now();
+			if (now - lastPoll >= m_pollInterval) {
+				m_PollChanges();
+				lastPoll = now;
+			}
+			m_FlushPending();
+		}
+	}
+
+	void AssetWatcher::m_QueueChange(const std::filesystem::path& path)
+	{
+		const auto now = std::chrono::steady_clock::now();
+
+		const auto& it = m_pending.find(m_Key(path));
+		if (it == m_pending.end()) {
+			m_pending[m_Key(path)] = PendingChange{ now, now };
+		}
+		else {
+			it->second.m_lastEvent = now;
+		}
+	}
+
+	void AssetWatcher::m_FlushPending()
+	{
+		if (m_pending.empty()) return;
+
+		const auto now = std::chrono::steady_clock::now();
+
+		std::vector<ReadyChange> ready;
+		for (auto it = m_pending.begin(); it != m_pending.end();) {
+			if (now - it->second.m_lastEvent < m_debounceTime) {
+				++it;
+				continue;
+			}
+
+			ReadyChange change{ it->first, it->second.m_firstEvent };
+
+			//decode here so that the main thread only uploads the texture
+			std::error_code ec;
+			if (IsImageFile(change.m_path) && std::filesystem::is_regular_file(change.m_path, ec)) {
+				image::ImageManager::m_DecodeImage(change.m_path.string(), change.m_decoded);
+			}
+
+			ready.push_back(std::move(change));
+			it = m_pending.erase(it);
+		}
+
+		if (ready.empty()) return;
+
+		std::lock_guard<std::mutex> lock(m_readyMutex);
+		for (auto& change : ready) {
+			m_ready.push_back(std::move(change));
+		}
+	}
+
+	void AssetWatcher::m_PollChanges()
+	{
+		std::error_code ec;
+		std::unordered_set<std::string> seen;
+
+		for (auto it = std::filesystem::recursive_directory_iterator(m_root, std::filesystem::directory_options::skip_permission_denied, ec);
+			!ec && it != std::filesystem::recursive_directory_iterator(); it.increment(ec)) {
+
+			const std::string key = m_Key(it->path());
+			seen.insert(key);
+
+			//directories only report being added
+			const auto writeTime = it->is_directory(ec) ? std::filesystem::file_time_type{} : it->last_write_time(ec);
+
+			const auto& time = m_pollTimes.find(key);
+			if (time == m_pollTimes.end() || time->second != writeTime) {
+				m_pollTimes[key] = writeTime;
+				m_QueueChange(it->path());
+			}
+		}
+
+		//partial walk, do not report the unseen paths as removed
+		if (ec) return;
+
+		for (auto it = m_pollTimes.begin(); it != m_pollTimes.end();) {
+			if (seen.find(it->first) == seen.end()) {
+				m_QueueChange(it->first);
+				it = m_pollTimes.erase(it);
+			}
+			else {
+				++it;
+			}
+		}
+	}
+
+#ifdef __linux__
+	void AssetWatcher::m_AddWatch(const std::filesystem::path& directory)
+	{
+		const uint32_t mask = IN_CLOSE_WRITE | IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO;
+		int wd = inotify_add_watch(m_inotifyFd, directory.c_str(), mask);
+		if (wd >= 0) {
+			m_watchDescriptors[wd] = directory;
+		}
+
+		std::error_code ec;
+		for (auto it = std::filesystem::directory_iterator(directory, ec); !ec && it != std::filesystem::directory_iterator(); it.increment(ec)) {
+			if (it->is_directory(ec)) {
+				m_AddWatch(it->path());
+			}
+		}
+	}
+
+	void AssetWatcher::m_ReadEvents()
+	{
+		alignas(inotify_event) char buffer[4096];
+
+		while (true) {
+			ssize_t length = read(m_inotifyFd, buffer, sizeof(buffer));
+			if (length <= 0) break;
+
+			for (char* ptr = buffer; ptr < buffer + length;) {
+				const inotify_event* event = reinterpret_cast<const inotify_event*>(ptr);
+				ptr += sizeof(inotify_event) + event->len;
+
+				if (event->mask & IN_Q_OVERFLOW) {
+					//events were dropped, compare write times instead
+					m_PollChanges();
+					continue;
+				}
+
+				const auto& watch = m_watchDescriptors.find(event->wd);
+				if (watch == m_watchDescriptors.end()) continue;
+
+				if (event->mask & IN_IGNORED) {
+					m_watchDescriptors.erase(watch);
+					continue;
+				}
+
+				if (event->len == 0) continue;
+
+				std::filesystem::path path = watch->second / event->name;
+
+				if ((event->mask & IN_ISDIR) && (event->mask & (IN_CREATE | IN_MOVED_TO))) {
+					//files copied before the watch was added have no events of their own
+					m_AddWatch(path);
+					std::error_code ec;
+					for (auto it = std::filesystem::recursive_directory_iterator(path, ec); !ec && it != std::filesystem::recursive_directory_iterator(); it.increment(ec)) {
+						m_QueueChange(it->path());
+					}
+				}
+
+				m_QueueChange(path);
+			}
+		}
+	}
+#endif
+
+#ifdef _WIN32
+	bool AssetWatcher::m_WatchDirectoryChanges()
+	{
+		HANDLE directory = CreateFileW(m_root.c_str(), FILE_LIST_DIRECTORY, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+			NULL, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, NULL);
+		if (directory == INVALID_HANDLE_VALUE) return false;
+
+		OVERLAPPED overlapped{};
+		overlapped.hEvent = CreateEventW(NULL, TRUE, FALSE, NULL);
+		if (!overlapped.hEvent) {
+			CloseHandle(directory);
+			return false;
+		}
+
+		//DWORD aligned, 64 KB is the most a network share returns
+		std::vector<DWORD> buffer(16 * 1024);
+		const DWORD filter = FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME | FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_SIZE;
+
+		const auto& issueRead = [&]() {
+			ResetEvent(overlapped.hEvent);
+			return ReadDirectoryChangesW(directory, buffer.data(), static_cast<DWORD>(buffer.size() * sizeof(DWORD)), TRUE, filter, NULL, &overlapped, NULL) != 0;
+		};
+
+		bool watching = issueRead();
+		while (m_running && watching) {
+			if (WaitForSingleObject(overlapped.hEvent, 50) == WAIT_OBJECT_0) {
+				DWORD bytes{};
+				if (!GetOverlappedResult(directory, &overlapped, &bytes, FALSE)) {
+					watching = false;
+					break;
+				}
+
+				if (bytes == 0) {
+					//buffer overflowed and the events were dropped, compare write times instead
+					m_PollChanges();
+				}
+				else {
+					for (const BYTE* ptr = reinterpret_cast<const BYTE*>(buffer.data());;) {
+						const FILE_NOTIFY_INFORMATION* info = reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(ptr);
+						const std::filesystem::path path = m_root / std::wstring(info->FileName, info->FileNameLength / sizeof(WCHAR));
+
+						std::error_code ec;
+						if ((info->Action == FILE_ACTION_ADDED || info->Action == FILE_ACTION_RENAMED_NEW_NAME) && std::filesystem::is_directory(path, ec)) {
+							//a directory moved in reports no events for its files
+							for (auto it = std::filesystem::recursive_directory_iterator(path, ec); !ec && it != std::filesystem::recursive_directory_iterator(); it.increment(ec)) {
+								m_QueueChange(it->path());
+							}
+						}
+						m_QueueChange(path);
+
+						if (info->NextEntryOffset == 0) break;
+						ptr += info->NextEntryOffset;
+					}
+				}
+
+				watching = issueRead();
+			}
+			m_FlushPending();
+		}
+
+		CancelIoEx(directory, &overlapped);
+		DWORD bytes{};
+		GetOverlappedResult(directory, &overlapped, &bytes, TRUE);
+		CloseHandle(overlapped.hEvent);
+		CloseHandle(directory);
+
+		//stopped by m_Stop, otherwise the caller falls back to polling
+		return !m_running;
+	}
+#endif
+
+	/*--------------------------------------------------------------
+	  DIRECTORY INDEX
+	--------------------------------------------------------------*/
+
+	void AssetWatcher::m_IndexDirectory(const std::filesystem::path& directory)
+	{
+		std::vector<std::filesystem::directory_entry>& entries = m_directoryIndex[m_Key(directory)];
+		entries.clear();
+
+		std::error_code ec;
+		for (auto it = std::filesystem::directory_iterator(directory, ec); !ec && it != std::filesystem::directory_iterator(); it.increment(ec)) {
+			entries.push_back(*it);
+		}
+
+		std::sort(entries.begin(), entries.end(), [](const auto& lhs, const auto& rhs) {return lhs.path().filename() < rhs.path().filename(); });
+
+		//copy, recursion inserts into the index
+		const std::vector<std::filesystem::directory_entry> children = entries;
+		for (const auto& entry : children) {
+			if (entry.is_directory(ec)) {
+				m_IndexDirectory(entry.path());
+			}
+			else {
+				m_writeTimes[m_Key(entry.path())] = entry.last_write_time(ec);
+			}
+		}
+	}
+
+	void AssetWatcher::m_IndexAdd(const std::filesystem::directory_entry& entry)
+	{
+		std::vector<std::filesystem::directory_entry>& entries = m_directoryIndex[m_Key(entry.path().parent_path())];
+
+		const auto& it = std::lower_bound(entries.begin(), entries.end(), entry, [](const auto& lhs, const auto& rhs) {return lhs.path().filename() < rhs.path().filename(); });
+		if (it != entries.end() && it->path().filename() == entry.path().filename()) return;
+
+		entries.insert(it, entry);
+	}
+
+	void AssetWatcher::m_IndexRemove(const std::filesystem::path& path)
+	{
+		const std::string key = m_Key(path);
+
+		const auto& parent = m_directoryIndex.find(m_Key(path.parent_path()));
+		if (parent != m_directoryIndex.end()) {
+			std::erase_if(parent->second, [&path](const auto& entry) {return entry.path().filename() == path.filename(); });
+		}
+
+		m_writeTimes.erase(key);
+
+		//drop everything below a removed directory
+		const std::string prefix = key + "/";
+		m_directoryIndex.erase(key);
+		m_directoryIndex.erase(m_directoryIndex.lower_bound(prefix), m_directoryIndex.lower_bound(key + char('/' + 1)));
+		std::erase_if(m_writeTimes, [&prefix](const auto& time) {return time.first.compare(0, prefix.size(), prefix) == 0; });
+	}
+
+	void AssetWatcher::m_ApplyChange(ReadyChange& change)
+	{
+		const std::string key = m_Key(change.m_path);
+
+		std::error_code ec;
+		std::filesystem::directory_entry entry{ change.m_path, ec };
+
+		if (ec || !entry.exists(ec)) {
+			//removed, loaded assets stay alive since entities may still reference them
+			if (m_writeTimes.find(key) != m_writeTimes.end() || m_directoryIndex.find(key) != m_directoryIndex.end()) {
+				m_IndexRemove(change.m_path);
+				LOGGING_INFO("Asset Watcher: {} removed", key);
+			}
+		}
+		else if (entry.is_directory(ec)) {
+			if (m_directoryIndex.find(key) == m_directoryIndex.end()) {
+				m_IndexAdd(entry);
+				m_IndexDirectory(change.m_path);
+				if (m_onLoad) {
+					m_onLoad(change.m_path);
+				}
+				else {
+					AssetManager::m_funcGetInstance()->m_funcLoadAssets(key);
+				}
+			}
+		}
+		else {
+			const auto writeTime = entry.last_write_time(ec);
+			const auto& time = m_writeTimes.find(key);
+
+			if (time == m_writeTimes.end()) {
+				m_IndexAdd(entry);
+				m_writeTimes[key] = writeTime;
+				if (m_onLoad) {
+					m_onLoad(change.m_path);
+				}
+				else {
+					AssetManager::m_funcGetInstance()->m_LoadAsset(change.m_path);
+				}
+				LOGGING_INFO("Asset Watcher: {} added", key);
+			}
+			else if (time->second != writeTime) {
+				time->second = writeTime;
+
+				const auto latency = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - change.m_firstEvent);
+				if (m_onReload) {
+					m_onReload(change.m_path, change.m_decoded, latency);
+				}
+				else {
+					AssetManager::m_funcGetInstance()->m_ReloadAsset(change.m_path, change.m_decoded);
+				}
+				LOGGING_INFO("Asset Watcher: {} reloaded ({} ms)", key, latency.count());
+			}
+			//same write time, written by the engine itself or already applied
+		}
+
+		image::ImageManager::m_FreeDecodedImage(change.m_decoded);
+	}
+
+}
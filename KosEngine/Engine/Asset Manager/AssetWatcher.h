@@ -0,0 +1,184 @@
+/******************************************************************/
+/*!
+\file      AssetWatcher.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      March 10, 2025
+\brief     This file contains the AssetWatcher class. The watcher runs
+		   a background thread that listens for file changes inside the
+		   asset directory (inotify on linux, ReadDirectoryChangesW on
+		   windows, polling of the write times if neither is available),
+		   debounces them and decodes images ahead of time.
+
+		   Changes are applied at a frame boundary by m_ProcessChanges,
+		   only the affected asset is reloaded and swapped in through
+		   the handle tables. The watcher also keeps a cached index of
+		   the asset directory that the content browser reads instead
+		   of iterating the file system every frame.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#ifndef ASSETWATCHER_H
+#define ASSETWATCHER_H
+
+#include "../Config/pch.h"
+#include "Image.h"
+#include <atomic>
+#include <mutex>
+
+namespace assetmanager {
+
+	class AssetWatcher {
+
+	public:
+
+		~AssetWatcher();
+
+		/******************************************************************/
+		/*!
+		\fn        void m_Start(const std::filesystem::path& root)
+		\brief     Builds the directory index and starts the watch thread.
+		\param     root - asset directory to watch, recursively
+		*/
+		/******************************************************************/
+		void m_Start(const std::filesystem::path& root);
+
+		/******************************************************************/
+		/*!
+		\fn        void m_Stop()
+		\brief     Stops the watch thread and drops the pending changes.
+		*/
+		/******************************************************************/
+		void m_Stop();
+
+		/******************************************************************/
+		/*!
+		\fn        void m_ProcessChanges()
+		\brief     Applies the debounced changes, must be called from the
+				   main thread at a frame boundary since reloading touches
+				   OpenGL, FMOD and the ECS.
+		*/
+		/******************************************************************/
+		void m_ProcessChanges();
+
+		/******************************************************************/
+		/*!
+		\fn        void m_SuppressPath(const std::filesystem::path& path)
+		\brief     Records the current write time of a file the engine
+				   just wrote or loaded itself (scene or prefab save, a
+				   file dropped into the content browser) so the change
+				   is not loaded a second time. A directory is indexed
+				   with every file below it.
+		*/
+		/******************************************************************/
+		void m_SuppressPath(const std::filesystem::path& path);
+
+		/******************************************************************/
+		/*!
+		\fn        const std::vector<std::filesystem::directory_entry>& m_GetDirectoryEntries(const std::filesystem::path& directory) const
+		\brief     Returns the cached entries of a directory, sorted by
+				   name. Empty if the directory is not inside the index.
+		*/
+		/******************************************************************/
+		const std::vector<std::filesystem::directory_entry>& m_GetDirectoryEntries(const std::filesystem::path& directory) const;
+
+		bool m_IsWatching() const { return m_running; }
+
+		/******************************************************************/
+		/*!
+		\var       m_debounceTime
+		\brief     A file must be quiet for this long before it is reloaded,
+				   editors usually write a file in several steps.
+		*/
+		/******************************************************************/
+		std::chrono::milliseconds m_debounceTime{ 200 };
+
+		std::chrono::milliseconds m_pollInterval{ 500 };
+
+		/******************************************************************/
+		/*!
+		\var       m_onLoad, m_onReload
+		\brief     Applies an added file or directory and a changed file,
+				   through the asset manager when not set. m_onReload is
+				   given the time since the first event of the change.
+		*/
+		/******************************************************************/
+		std::function<void(const std::filesystem::path& path)> m_onLoad;
+
+		std::function<void(const std::filesystem::path& path, image::DecodedImage& decoded, std::chrono::milliseconds latency)> m_onReload;
+
+	private:
+
+		struct PendingChange {
+			std::chrono::steady_clock::time_point m_firstEvent{};
+			std::chrono::steady_clock::time_point m_lastEvent{};
+		};
+
+		struct ReadyChange {
+			std::filesystem::path m_path{};
+			std::chrono::steady_clock::time_point m_firstEvent{};
+			image::DecodedImage m_decoded{};
+		};
+
+		static std::string m_Key(const std::filesystem::path& path);
+
+		/*--------------------------------------------------------------
+		  WATCH THREAD
+		--------------------------------------------------------------*/
+		void m_WatchThread();
+
+		void m_QueueChange(const std::filesystem::path& path);
+
+		void m_FlushPending();
+
+		void m_PollChanges();
+
+#ifdef __linux__
+		void m_AddWatch(const std::filesystem::path& directory);
+
+		void m_ReadEvents();
+
+		int m_inotifyFd{ -1 };
+
+		std::unordered_map<int, std::filesystem::path> m_watchDescriptors;
+#elif defined(_WIN32)
+		//runs the watch loop until m_Stop, false if the directory cannot be watched
+		bool m_WatchDirectoryChanges();
+#endif
+
+		/*--------------------------------------------------------------
+		  DIRECTORY INDEX, MAIN THREAD ONLY
+		--------------------------------------------------------------*/
+		void m_IndexDirectory(const std::filesystem::path& directory);
+
+		void m_IndexAdd(const std::filesystem::directory_entry& entry);
+
+		void m_IndexRemove(const std::filesystem::path& path);
+
+		void m_ApplyChange(ReadyChange& change);
+
+		std::filesystem::path m_root{};
+
+		std::thread m_thread;
+
+		std::atomic<bool> m_running{ false };
+
+		//worker only
+		std::map<std::string, PendingChange> m_pending;
+		std::unordered_map<std::string, std::filesystem::file_time_type> m_pollTimes;
+
+		//shared between the worker and the main thread
+		std::mutex m_readyMutex;
+		std::vector<ReadyChange> m_ready;
+
+		//main thread only
+		std::map<std::string, std::vector<std::filesystem::directory_entry>> m_directoryIndex;
+		std::unordered_map<std::string, std::filesystem::file_time_type> m_writeTimes;
+	};
+
+}
+
+#endif ASSETWATCHER_H
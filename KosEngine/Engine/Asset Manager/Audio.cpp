@@ -4,17 +4,16 @@
 \author    Clarence Boey
 \par       c.boey@digipen.edu
 \date      Sept 30, 2024
-\brief     This file contains the implementation of the Audio class,
-           which provides audio
-
-This file implements a simple wrapper class FModAudio for handling 
-audio playback using the FMOD sound system. It provides basic 
-functionalities such as initializing the FMOD system, creating and 
-playing sounds, controlling volume and panning, pausing and stopping 
-playback, looping, and fading sound. Additionally, the file handles 
-proper resource management by cleaning up the FMOD system and releasing 
-resources when the audio operations are finished or when the object 
-is destroyed.
+\brief     This file contains the implementation of the FModBackend,
+           FModAudio and AudioManager classes, which provide audio
+
+This file implements the FMOD backend of the voice manager, the FModAudio
+sound and the AudioManager. The AudioManager plays the audio files of
+entities through voice handles and provides controls for volume and
+panning, pausing and stopping playback, looping, and fading sound. Sounds
+are loaded by the AudioLoader and moved into the sound map once a frame.
+Additionally, the file handles proper resource management by releasing
+the sounds before the FMOD system when the manager is destroyed.
 
 Copyright (C) 2024 DigiPen Institute of Technology.
 Reproduction or disclosure of this file or its contents without the
@@ -26,590 +25,579 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 //#include <fmod_errors.h>
 
 namespace fmodaudio {
-    FModAudio::FModAudio(FMOD::System* system) : m_system(system), m_sound(nullptr) {
-        m_InitializeChannelPool();
-    }
 
-    FModAudio::~FModAudio() {
-        float fadeOutTime = 0.3f;
-        m_StopAllSounds(fadeOutTime);
+    FModBackend::~FModBackend() {
         m_Shutdown();
     }
 
-    bool FModAudio::m_Init() {
+    bool FModBackend::m_Init(int maxChannels) {
         FMOD_RESULT result = FMOD::System_Create(&m_system);
         if (result != FMOD_OK) {
+            m_system = nullptr;
             return false;
         }
 
-        result = m_system->init(64, FMOD_INIT_NORMAL, nullptr);
-        if (result != FMOD_OK) {
-            return false;
-        }
-        return true;
-    }
+        //larger reads so that a stream touches the disk less often
+        m_system->setStreamBufferSize(STREAM_BUFFER_SIZE, FMOD_TIMEUNIT_RAWBYTES);
 
-    void FModAudio::m_Shutdown() {
-        float fadeOutTime = 0.3f;
-        m_StopAllSounds(fadeOutTime);
-        if (m_system) {
+        result = m_system->init(maxChannels, FMOD_INIT_NORMAL, nullptr);
+        if (result != FMOD_OK) {
             m_system->release();
             m_system = nullptr;
+            return false;
         }
-    }
 
-    void FModAudio::Update(float deltaTime [[maybe_unused]] ) {
-        auto currentTime = std::chrono::steady_clock::now();
-
-        for (auto& info : m_channelPool) {
-            if (info.channel && info.isFading) {
-                float elapsedTime = std::chrono::duration<float>(
-                    currentTime - info.fadeStartTime).count();
+        m_channels.reserve(maxChannels);
+        return true;
+    }
 
-                if (elapsedTime >= info.fadeDuration) {
-                    info.channel->setVolume(info.fadeTargetVolume);
-                    info.isFading = false;
+    void FModBackend::m_Shutdown() {
+        if (!m_system) return;
 
-                    if (info.isFadingOut && info.fadeTargetVolume == 0.0f) {
-                        info.channel->stop();
-                        auto it = m_entityChannels.find(info.entityId);
-                        if (it != m_entityChannels.end()) {
-                            m_entityChannels.erase(it);
-                        }
-                        info.isActive = false;
-                        info.isFadingOut = false;
-                        info.channel = nullptr;
-                    }
-                }
-                else {
-                    float t = elapsedTime / info.fadeDuration;
-                    float newVolume = info.fadeStartVolume +
-                        (info.fadeTargetVolume - info.fadeStartVolume) * t;
-                    info.channel->setVolume(newVolume);
+        {
+            std::lock_guard<std::mutex> lock(m_soundLock);
+            for (FMOD::Sound* sound : m_sounds) {
+                if (sound) {
+                    sound->release();
                 }
             }
+            m_sounds.clear();
+            m_streamed.clear();
+            m_freeSounds.clear();
         }
+        m_channels.clear();
+        m_freeChannels.clear();
 
-        m_ReleaseUnusedChannels();
+        m_system->release();
+        m_system = nullptr;
+    }
+
+    void FModBackend::m_Update(float deltaTime [[maybe_unused]]) {
+        if (m_system) {
+            m_system->update();
+        }
     }
 
-    bool FModAudio::m_CreateSound(const char* soundFile) {
-        FMOD_RESULT result = m_system->createSound(soundFile, FMOD_DEFAULT, nullptr, &m_sound);
+    AudioBackend::SoundID FModBackend::m_CreateSound(const unsigned char* data, size_t size) {
+        if (!m_system || !data) return m_invalidID;
+
+        FMOD_CREATESOUNDEXINFO exinfo{};
+        exinfo.cbsize = sizeof(FMOD_CREATESOUNDEXINFO);
+        exinfo.length = static_cast<unsigned int>(size);
+
+        //FMOD copies the bytes and decodes them into samples
+        FMOD::Sound* sound = nullptr;
+        FMOD_RESULT result = m_system->createSound(reinterpret_cast<const char*>(data), FMOD_DEFAULT | FMOD_CREATESAMPLE | FMOD_OPENMEMORY, &exinfo, &sound);
         if (result != FMOD_OK) {
-            return false;
+            return m_invalidID;
         }
-        return true;
+        return m_AddSound(sound, false);
     }
 
-    bool FModAudio::m_PlaySound(const std::string& entityId) {
-        if (!m_system || !m_sound) {
-            return false;
+    AudioBackend::SoundID FModBackend::m_CreateStream(const std::string& file) {
+        if (!m_system) return m_invalidID;
+
+        FMOD::Sound* sound = nullptr;
+        if (m_system->createStream(file.c_str(), FMOD_DEFAULT, nullptr, &sound) != FMOD_OK) {
+            return m_invalidID;
         }
-        //m_PrintChannelStatus();
+        return m_AddSound(sound, true);
+    }
 
-        m_ReleaseUnusedChannels();
+    AudioBackend::SoundID FModBackend::m_CreateStream(const unsigned char* data, size_t size) {
+        if (!m_system || !data) return m_invalidID;
 
-        FMOD::Channel* channel = nullptr;
-        int channelIndex = -1;
+        FMOD_CREATESOUNDEXINFO exinfo{};
+        exinfo.cbsize = sizeof(FMOD_CREATESOUNDEXINFO);
+        exinfo.length = static_cast<unsigned int>(size);
 
-        for (size_t i = 0; i < m_channelPool.size(); ++i) {
-            if (!m_channelPool[i].isActive || !m_channelPool[i].channel) {
-                channelIndex = static_cast<int>(i);
-                break;
-            }
+        //FMOD reads the bytes where they are, the caller keeps them alive
+        FMOD::Sound* sound = nullptr;
+        if (m_system->createStream(reinterpret_cast<const char*>(data), FMOD_DEFAULT | FMOD_OPENMEMORY_POINT, &exinfo, &sound) != FMOD_OK) {
+            return m_invalidID;
         }
+        return m_AddSound(sound, true);
+    }
 
-        if (channelIndex == -1) {
-            for (size_t i = 0; i < m_channelPool.size(); ++i) {
-                if (m_channelPool[i].channel) {
-                    bool isPlaying = false;
-                    m_channelPool[i].channel->isPlaying(&isPlaying);
-                    if (!isPlaying) {
-                        channelIndex = static_cast<int>(i);
-                        channel = m_channelPool[i].channel;
-                        break;
-                    }
-                }
-            }
+    AudioBackend::SoundID FModBackend::m_AddSound(FMOD::Sound* sound, bool streamed) {
+        std::lock_guard<std::mutex> lock(m_soundLock);
+
+        SoundID id{};
+        if (!m_freeSounds.empty()) {
+            id = m_freeSounds.back();
+            m_freeSounds.pop_back();
+            m_sounds[id] = sound;
+            m_streamed[id] = streamed;
+        }
+        else {
+            id = static_cast<SoundID>(m_sounds.size());
+            m_sounds.push_back(sound);
+            m_streamed.push_back(streamed);
         }
+        return id;
+    }
 
-        if (channelIndex == -1) {
-            channelIndex = m_FindLeastImportantChannel();
-            if (channelIndex >= 0) {
-                channel = m_channelPool[channelIndex].channel;
-                if (channel) {
-                    channel->stop();
-                }
-            }
+    FMOD::Sound* FModBackend::m_GetSound(SoundID sound) const {
+        std::lock_guard<std::mutex> lock(m_soundLock);
+        if (sound >= m_sounds.size()) return nullptr;
+        return m_sounds[sound];
+    }
+
+    void FModBackend::m_ReleaseSound(SoundID sound) {
+        FMOD::Sound* found = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(m_soundLock);
+            if (sound >= m_sounds.size() || !m_sounds[sound]) return;
+
+            found = m_sounds[sound];
+            m_sounds[sound] = nullptr;
+            m_freeSounds.push_back(sound);
         }
 
-        if (channelIndex >= 0) {
-            FMOD_RESULT result;
-            if (channel) {
-                channel->stop();  
-                result = m_system->playSound(m_sound, nullptr, false, &channel);
-            }
-            else {
-                result = m_system->playSound(m_sound, nullptr, false, &channel);
-            }
+        //releasing the sound stops its channels
+        found->release();
+    }
 
-            if (result != FMOD_OK) {
-                return false;
-            }
+    float FModBackend::m_GetLength(SoundID sound) const {
+        FMOD::Sound* found = m_GetSound(sound);
+        if (!found) return 0.f;
 
-            auto& info = m_channelPool[channelIndex];
-            info.channel = channel;
-            info.entityId = entityId;
-            info.isActive = true;
-            info.lastUsed = std::chrono::steady_clock::now();
+        unsigned int length{};
+        if (found->getLength(&length, FMOD_TIMEUNIT_MS) != FMOD_OK) return 0.f;
+        return static_cast<float>(length) / 1000.f;
+    }
 
-            m_entityChannels[entityId] = channel;
+    size_t FModBackend::m_GetMemoryUsage(SoundID sound) const {
+        FMOD::Sound* found = m_GetSound(sound);
+        if (!found) return 0;
 
-            if (channel) {
-                channel->setVolume(1.0f);
-            }
+        bool streamed{};
+        {
+            std::lock_guard<std::mutex> lock(m_soundLock);
+            streamed = m_streamed[sound];
+        }
 
-            return true;
+        if (!streamed) {
+            //the decoded samples
+            unsigned int bytes{};
+            found->getLength(&bytes, FMOD_TIMEUNIT_PCMBYTES);
+            return bytes;
         }
 
-        return false;
+        //FMOD reports no memory per sound, a stream holds its file buffer and 400 ms of decoded samples
+        float frequency{};
+        int channels{}, bits{};
+        found->getDefaults(&frequency, nullptr);
+        found->getFormat(nullptr, nullptr, &channels, &bits);
+        return STREAM_BUFFER_SIZE + static_cast<size_t>(frequency * 0.4f) * channels * (bits / 8);
     }
 
-    int FModAudio::m_GetActiveChannelCount() const {
-        int count = 0;
-        for (const auto& info : m_channelPool) {
-            if (info.isActive && info.channel) {
-                bool isPlaying = false;
-                info.channel->isPlaying(&isPlaying);
-                if (isPlaying) count++;
-            }
+    AudioBackend::ChannelID FModBackend::m_Play(SoundID sound, const ChannelParams& params) {
+        FMOD::Sound* found = m_GetSound(sound);
+        if (!m_system || !found) return m_invalidID;
+
+        //started paused so that it is not heard before it is set up
+        FMOD::Channel* channel = nullptr;
+        if (m_system->playSound(found, nullptr, true, &channel) != FMOD_OK || !channel) {
+            return m_invalidID;
         }
-        return count;
-    }
 
-    void FModAudio::m_PrintChannelStatus() const {
-        //std::cout << "Active Channels: " << m_GetActiveChannelCount() << "/" << MAX_CHANNELS << "\n";
-        for (size_t i = 0; i < m_channelPool.size(); ++i) {
-            const auto& info = m_channelPool[i];
-            if (info.isActive && info.channel) {
-                bool isPlaying = false;
-                info.channel->isPlaying(&isPlaying);
-                //std::cout << "Channel " << i << ": " << (isPlaying ? "Playing" : "Stopped")
-                   // << " EntityID: " << info.entityId << "\n";
-            }
+        channel->setMode(params.m_loop ? FMOD_LOOP_NORMAL : FMOD_LOOP_OFF);
+        channel->setVolume(params.m_volume);
+        channel->setPan(params.m_pan);
+        if (params.m_position > 0.f) {
+            channel->setPosition(static_cast<unsigned int>(params.m_position * 1000.f), FMOD_TIMEUNIT_MS);
+        }
+        channel->setPaused(params.m_paused);
+
+        ChannelID id{};
+        if (!m_freeChannels.empty()) {
+            id = m_freeChannels.back();
+            m_freeChannels.pop_back();
+            m_channels[id] = channel;
         }
+        else {
+            id = static_cast<ChannelID>(m_channels.size());
+            m_channels.push_back(channel);
+        }
+        return id;
     }
 
+    void FModBackend::m_Stop(ChannelID channel) {
+        FMOD::Channel* found = m_GetChannel(channel);
+        if (!found) return;
 
+        //fails harmlessly if the channel already ended
+        found->stop();
+        m_channels[channel] = nullptr;
+        m_freeChannels.push_back(channel);
+    }
 
-    void FModAudio::m_StopSound(const std::string& entityId) {
-        auto it = m_entityChannels.find(entityId);
-        if (it != m_entityChannels.end()) {
-            it->second->stop();
+    void FModBackend::m_SetVolume(ChannelID channel, float volume) {
+        if (FMOD::Channel* found = m_GetChannel(channel)) {
+            found->setVolume(volume);
+        }
+    }
 
-            for (auto& info : m_channelPool) {
-                if (info.entityId == entityId) {
-                    info.isActive = false;
-                    info.channel = nullptr;
-                    break;
-                }
-            }
+    void FModBackend::m_SetPan(ChannelID channel, float pan) {
+        if (FMOD::Channel* found = m_GetChannel(channel)) {
+            found->setPan(pan);
+        }
+    }
 
-            m_entityChannels.erase(it);
+    void FModBackend::m_SetLoop(ChannelID channel, bool loop) {
+        if (FMOD::Channel* found = m_GetChannel(channel)) {
+            found->setMode(loop ? FMOD_LOOP_NORMAL : FMOD_LOOP_OFF);
         }
     }
 
-    void FModAudio::m_StopAllSounds(float fadeOutTime) {
+    void FModBackend::m_SetPaused(ChannelID channel, bool paused) {
+        if (FMOD::Channel* found = m_GetChannel(channel)) {
+            found->setPaused(paused);
+        }
+    }
 
-        for (auto& pair : m_entityChannels) {
-            m_FadeSound(pair.first, 0.0f, fadeOutTime);
+    bool FModBackend::m_IsPlaying(ChannelID channel) const {
+        FMOD::Channel* found = m_GetChannel(channel);
+        if (!found) return false;
 
-            for (auto& info : m_channelPool) {
-                if (info.channel == pair.second) {
-                    info.isFadingOut = true;
-                    info.fadeCompleteTime = std::chrono::steady_clock::now() +
-                        std::chrono::milliseconds(static_cast<int>(fadeOutTime * 1000));
-                    break;
-                }
-            }
-        }
+        //a channel taken by FMOD returns an error
+        bool isPlaying = false;
+        if (found->isPlaying(&isPlaying) != FMOD_OK) return false;
+        return isPlaying;
     }
 
-    void FModAudio::m_PauseAllSounds() {
-        for (auto& pair : m_entityChannels) {
-            FMOD::Channel* channel = pair.second;
-            if (channel) {
-                channel->setPaused(true);
-            }
-        }
+    float FModBackend::m_GetPosition(ChannelID channel) const {
+        FMOD::Channel* found = m_GetChannel(channel);
+        if (!found) return 0.f;
+
+        unsigned int position{};
+        if (found->getPosition(&position, FMOD_TIMEUNIT_MS) != FMOD_OK) return 0.f;
+        return static_cast<float>(position) / 1000.f;
     }
 
-    bool FModAudio::m_UnpauseAllSounds() {
-        for (auto& channelPair : m_entityChannels) {
-            FMOD::Channel* channel = channelPair.second;
-            if (channel) {
-                bool isPaused = false;
-                channel->getPaused(&isPaused);
-                if (isPaused) {
-                    channel->setPaused(false);
-                }
-            }
-        }
-        return true;
+    FMOD::Channel* FModBackend::m_GetChannel(ChannelID channel) const {
+        if (channel >= m_channels.size()) return nullptr;
+        return m_channels[channel];
     }
 
-    bool FModAudio::m_SetVolume(const std::string& entityId, float volume) {
-        volume = std::clamp(volume, 0.0f, 1.0f);
+    FModAudio::FModAudio(AudioBackend* backend) : m_backend(backend) {}
 
-        auto it = m_entityChannels.find(entityId);
-        if (it != m_entityChannels.end()) {
-            FMOD_RESULT result = it->second->setVolume(volume);
-            if (result != FMOD_OK) {
-                return false;
-            }
-            return true;
-        }
-        else {
-            return false;
+    FModAudio::FModAudio(AudioBackend* backend, AudioLoader::LoadJob& job)
+        : m_backend(backend), m_sound(job.m_sound), m_mode(job.m_mode), m_file(std::move(job.m_file)), m_loadTime(job.m_loadTime) {
+        job.m_sound = AudioBackend::m_invalidID;
+    }
+
+    FModAudio::~FModAudio() {
+        if (m_backend && m_sound != AudioBackend::m_invalidID) {
+            m_backend->m_ReleaseSound(m_sound);
         }
     }
 
-    bool FModAudio::m_SetPan(const std::string& entityId, float pan) {
-        auto it = m_entityChannels.find(entityId);
-        if (it != m_entityChannels.end()) {
-            //std::cout << pan << std::endl;
-            FMOD_RESULT result = it->second->setPan(pan);
-            if (result != FMOD_OK) {
-                return false;
-            }
-            return true;
+    size_t FModAudio::m_GetMemoryUsage() const {
+        //an uncompressed archive entry is mapped, not resident
+        return m_backend->m_GetMemoryUsage(m_sound) + m_file.m_storage.size();
+    }
+
+    // AudioManager Implementation (UPDATED 28/11/2024)
+    AudioManager::AudioManager() {
+        //without an audio device the game still runs, silently
+        auto backend = std::make_unique<FModBackend>();
+        if (backend->m_Init(MAX_CHANNELS)) {
+            m_backend = std::move(backend);
         }
         else {
-            return false;
+            m_backend = std::make_unique<NullAudioBackend>();
+            m_backend->m_Init(MAX_CHANNELS);
         }
+        m_voices.m_SetBackend(m_backend.get());
+        m_voices.m_maxRealVoices = MAX_CHANNELS;
+        m_loader.m_SetBackend(m_backend.get());
     }
 
-    bool FModAudio::m_PauseSound(const std::string& entityId) {
-        auto channelIt = m_entityChannels.find(entityId);
-        if (channelIt != m_entityChannels.end()) {
-            FMOD::Channel* channel = channelIt->second;
-            bool isPaused = false;
-            channel->getPaused(&isPaused);
-            if (!isPaused) {
-                channel->setPaused(true);
-                return true;
-            }
-        }
-        return false;
+    AudioManager::~AudioManager() {
+        //loads, voices, then sounds, then the system
+        m_loader.m_Stop();
+        m_voices.m_SetBackend(nullptr);
+        m_soundHandles.m_Clear();
+        m_soundMap.clear();
+        m_backend->m_Shutdown();
     }
 
-    bool FModAudio::m_UnpauseSound(const std::string& entityId) {
-        auto channelIt = m_entityChannels.find(entityId);
-        if (channelIt != m_entityChannels.end()) {
-            FMOD::Channel* channel = channelIt->second;
-            bool isPaused = false;
-            channel->getPaused(&isPaused);
-            if (isPaused) {
-                channel->setPaused(false);
-                return true;
-            }
-        }
-        return false;
+    void AudioManager::m_SetBackend(std::unique_ptr<AudioBackend> backend) {
+        m_loader.m_Stop();
+        m_loading.clear();
+        m_voices.m_SetBackend(nullptr);
+        m_soundHandles.m_Clear();
+        m_soundMap.clear();
+        m_backend->m_Shutdown();
+
+        m_backend = std::move(backend);
+        m_backend->m_Init(MAX_CHANNELS);
+        m_voices.m_SetBackend(m_backend.get());
+        m_loader.m_SetBackend(m_backend.get());
+    }
+
+    void AudioManager::m_Update(float deltaTime) {
+        m_CollectLoads();
+        m_voices.m_Update(deltaTime);
     }
 
+    void AudioManager::m_SetListener(const vector2::Vec2& position, const vector2::Vec2& halfExtents) {
+        m_voices.m_SetListener(position, halfExtents);
+    }
 
-    bool FModAudio::m_IsPlaying(const std::string& entityId) {
-        auto it = m_entityChannels.find(entityId);
-        if (it != m_entityChannels.end()) {
-            bool isPlaying = false;
-            FMOD_RESULT result = it->second->isPlaying(&isPlaying);
-            if (result != FMOD_OK) {
-                return false;
-            }
-            return isPlaying;
-        }
-        else {
-            return false;
+    void AudioManager::m_LoadAudio(const std::string& name, const std::string& path) {
+        auto job = std::make_unique<AudioLoader::LoadJob>();
+        job->m_name = name;
+        job->m_path = path;
+        job->m_mode = m_loader.m_ChooseMode(path);
+        job->m_ticket = ++m_nextTicket;
+
+        //a loaded sound keeps playing until the new one replaces it
+        if (m_soundMap.find(name) == m_soundMap.end()) {
+            m_soundMap[name] = std::make_unique<FModAudio>(m_backend.get());
         }
-    }
 
-    bool FModAudio::m_SetLooping(const std::string& entityId, bool loop) {
-        auto it = m_entityChannels.find(entityId);
-        if (it != m_entityChannels.end()) {
-            FMOD_MODE mode = loop ? FMOD_LOOP_NORMAL : FMOD_LOOP_OFF;
-            FMOD_RESULT result = it->second->setMode(mode);
-            if (result != FMOD_OK) {
-                return false;
-            }
-            return true;
+        //an older load of the name is dropped
+        m_loader.m_Cancel(name);
+        m_loading[name] = job->m_ticket;
+
+        if (!m_asyncLoading) {
+            m_loader.m_Load(*job);
+            m_OnLoaded(std::move(job));
+            return;
         }
-        else {
-            return false;
+
+        if (m_loading.size() == 1) {
+            m_loadStart = std::chrono::steady_clock::now();
         }
+        const bool prefetch = m_prefetchNames.erase(name) > 0;
+        m_loader.m_Queue(std::move(job), prefetch);
     }
 
-    bool FModAudio::m_FadeSound(const std::string& entityId, float targetVolume, float fadeDuration) {
-        auto it = m_entityChannels.find(entityId);
-        if (it == m_entityChannels.end()) {
-            return false;
+    void AudioManager::m_PrefetchAudio(const std::string& name) {
+        const auto& sound = m_soundMap.find(name);
+        if (sound != m_soundMap.end() && sound->second->m_IsLoaded()) return;
+
+        //fails once the worker started it, which is just as good
+        if (m_IsLoading(name)) {
+            m_loader.m_Prefetch(name);
+            return;
         }
+        m_prefetchNames.insert(name);
+    }
 
-        FMOD::Channel* channel = it->second;
+    void AudioManager::m_FinishLoading(const std::string& name) {
+        if (!m_IsLoading(name)) return;
 
-        FMOD_RESULT result = channel->setVolumeRamp(true);
-        if (result != FMOD_OK) {
-            return false;
+        if (std::unique_ptr<AudioLoader::LoadJob> job = m_loader.m_Finish(name)) {
+            m_OnLoaded(std::move(job));
         }
+    }
 
-        float currentVolume;
-        result = channel->getVolume(&currentVolume);
-        if (result != FMOD_OK) {
-            return false;
-        }
+    void AudioManager::m_FinishLoading() {
+        m_loader.m_WaitAll();
+        m_CollectLoads();
+    }
 
-        for (auto& info : m_channelPool) {
-            if (info.channel == channel) {
-                info.isFading = true;
-                info.fadeStartTime = std::chrono::steady_clock::now();
-                info.fadeDuration = fadeDuration;
-                info.fadeStartVolume = currentVolume;
-                info.fadeTargetVolume = targetVolume;
-                return true;
-            }
+    void AudioManager::m_CollectLoads() {
+        m_loader.m_TakeFinished(m_finishedLoads);
+        if (m_finishedLoads.empty()) return;
+
+        m_loadedCount += m_finishedLoads.size();
+        for (auto& job : m_finishedLoads) {
+            m_OnLoaded(std::move(job));
         }
+        m_finishedLoads.clear();
 
-        return false;
+        if (m_loading.empty() && m_loadedCount > 0) {
+            const std::chrono::duration<float, std::milli> time = std::chrono::steady_clock::now() - m_loadStart;
+            LOGGING_INFO("Loaded {} sounds in {} ms, {} KB of audio resident", m_loadedCount, time.count(), m_GetMemoryUsage() / 1024);
+            m_loadedCount = 0;
+        }
     }
 
-    FMOD::Channel* FModAudio::m_GetChannelForEntity(ecs::EntityID entityId) {
-        std::string entityIdStr = std::to_string(entityId);
-        auto it = m_entityChannels.find(entityIdStr);
-        if (it != m_entityChannels.end()) {
-            return it->second;
+    void AudioManager::m_OnLoaded(std::unique_ptr<AudioLoader::LoadJob> job) {
+        //unloaded or loaded again since, released with the temporary
+        const auto& loading = m_loading.find(job->m_name);
+        if (loading == m_loading.end() || loading->second != job->m_ticket) {
+            FModAudio dropped(m_backend.get(), *job);
+            return;
         }
-        return nullptr;
-    }
+        m_loading.erase(loading);
 
-    void FModAudio::m_InitializeChannelPool() {
-        m_channelPool.resize(MAX_CHANNELS);
-        for (auto& info : m_channelPool) {
-            info.channel = nullptr;
-            info.isActive = false;
-            info.priority = 0.0f;
+        const auto& it = m_soundMap.find(job->m_name);
+        if (job->m_sound == AudioBackend::m_invalidID) {
+            LOGGING_WARN("Failed to load audio: {}", job->m_path);
+            //a failed reload keeps the old sound
+            if (it != m_soundMap.end() && !it->second->m_IsLoaded()) {
+                m_soundMap.erase(it);
+            }
+            return;
         }
+
+        //a reloaded sound replaces the old one, its voices are stopped
+        if (it != m_soundMap.end() && it->second->m_IsLoaded()) {
+            m_voices.m_StopSound(it->second->m_GetSound());
+        }
+
+        auto sound = std::make_unique<FModAudio>(m_backend.get(), *job);
+        FModAudio* loaded = sound.get();
+        m_soundMap[job->m_name] = std::move(sound);
+        m_soundHandles.m_Register(job->m_name, loaded);
     }
 
-    FMOD::Channel* FModAudio::m_GetAvailableChannel(const std::string& entityId) {
-        for (auto& info : m_channelPool) {
-            if (!info.isActive) {
-                info.entityId = entityId;
-                info.isActive = true;
-                info.lastUsed = std::chrono::steady_clock::now();
-                return info.channel;
+    size_t AudioManager::m_GetMemoryUsage() const {
+        size_t bytes{};
+        for (const auto& [name, sound] : m_soundMap) {
+            if (sound->m_IsLoaded()) {
+                bytes += sound->m_GetMemoryUsage();
             }
         }
+        return bytes;
+    }
 
-        int index = m_FindLeastImportantChannel();
-        if (index >= 0) {
-            auto& info = m_channelPool[index];
-            if (info.channel) {
-                info.channel->stop();
+    void AudioManager::m_LogMemoryUsage() const {
+        std::vector<std::pair<size_t, const std::string*>> sounds;
+        for (const auto& [name, sound] : m_soundMap) {
+            if (sound->m_IsLoaded()) {
+                sounds.emplace_back(sound->m_GetMemoryUsage(), &name);
             }
-            info.entityId = entityId;
-            info.lastUsed = std::chrono::steady_clock::now();
-            return info.channel;
         }
+        std::sort(sounds.begin(), sounds.end(), [](const auto& a, const auto& b) { return a.first > b.first; });
 
-        return nullptr;
+        for (const auto& [bytes, name] : sounds) {
+            const FModAudio& sound = *m_soundMap.find(*name)->second;
+            LOGGING_INFO("{}: {} KB {}, loaded in {} ms", *name, bytes / 1024, sound.m_IsStreamed() ? "streamed" : "decoded", sound.m_GetLoadTime().count());
+        }
+        LOGGING_INFO("{} sounds, {} KB of audio resident", sounds.size(), m_GetMemoryUsage() / 1024);
     }
 
-    void FModAudio::m_ReleaseUnusedChannels() {
-        auto currentTime = std::chrono::steady_clock::now();
+    void AudioManager::m_UnloadAudio(const std::string& name) {
+        m_loader.m_Cancel(name);
+        m_loading.erase(name);
+        m_prefetchNames.erase(name);
 
-        for (auto& info : m_channelPool) {
-            if (info.channel) {
-                bool isPlaying = false;
-                info.channel->isPlaying(&isPlaying);
+        const auto& it = m_soundMap.find(name);
+        if (it == m_soundMap.end()) return;
 
-                bool shouldRelease = !isPlaying;
+        m_voices.m_StopSound(it->second->m_GetSound());
+        m_soundHandles.m_Invalidate(name);
+        m_soundMap.erase(it);
+    }
 
-                if (info.isFadingOut && currentTime >= info.fadeCompleteTime) {
-                    shouldRelease = true;
-                }
+    bool AudioManager::m_RenameAudio(const std::string& oldName, const std::string& newName) {
+        m_FinishLoading(oldName);
 
-                if (shouldRelease) {
-                    info.channel->stop();
-                    auto it = m_entityChannels.find(info.entityId);
-                    if (it != m_entityChannels.end()) {
-                        m_entityChannels.erase(it);
-                    }
-                    info.isActive = false;
-                    info.isFadingOut = false;
-                    info.channel = nullptr;
-                }
-            }
-        }
+        const auto& it = m_soundMap.find(oldName);
+        if (it == m_soundMap.end() || m_soundMap.find(newName) != m_soundMap.end()) return false;
+
+        //the sound object does not move, its voices keep playing
+        std::unique_ptr<FModAudio> sound = std::move(it->second);
+        m_soundMap.erase(it);
+        m_soundHandles.m_Invalidate(oldName);
+
+        FModAudio* renamed = sound.get();
+        m_soundMap[newName] = std::move(sound);
+        m_soundHandles.m_Register(newName, renamed);
+        return true;
     }
 
-    int FModAudio::m_FindLeastImportantChannel() const {
-        int leastImportantIdx = -1;
-        auto oldestTime = std::chrono::steady_clock::now();
+    ecs::AudioFile* AudioManager::m_FindAudioFile(ecs::EntityID entityId, const std::string& name) {
+        ecs::AudioComponent* ac = ecs::ECS::m_GetInstance()->m_GetComponent<ecs::AudioComponent>(entityId);
+        if (!ac) return nullptr;
 
-        for (size_t i = 0; i < m_channelPool.size(); ++i) {
-            const auto& info = m_channelPool[i];
-            if (info.channel) {
-                bool isPlaying = false;
-                info.channel->isPlaying(&isPlaying);
-                if (!isPlaying || info.lastUsed < oldestTime) {
-                    leastImportantIdx = static_cast<int>(i);
-                    oldestTime = info.lastUsed;
-                }
-            }
-            else {
-                return static_cast<int>(i);
+        for (auto& audioFile : ac->m_AudioFiles) {
+            if (audioFile.m_Name == name) {
+                return &audioFile;
             }
         }
-        return leastImportantIdx;
+        return nullptr;
     }
 
-    // AudioManager Implementation (UPDATED 28/11/2024)
-    AudioManager::AudioManager() {
-        FMOD::System_Create(&m_system);
-        m_system->init(64, FMOD_INIT_NORMAL, nullptr);
+    float AudioManager::m_GetAdjustedVolume(const ecs::AudioFile& audioFile, float volume) const {
+        float adjustedVolume = volume;
+        if (audioFile.m_IsBGM) {
+            adjustedVolume *= m_GlobalBGMVolume;
+        }
+        else if (audioFile.m_IsSFX) {
+            adjustedVolume *= m_GlobalSFXVolume;
+        }
+        return std::max(adjustedVolume, 0.f);
     }
 
-    AudioManager::~AudioManager() {
-        m_system->release();
-        for (auto& pair : m_soundMap) {
-            FModAudio* sound = pair.second.get();
-            if (sound) {
-                sound->m_Shutdown();
-            }
-        }
+    bool AudioManager::m_IsPositional(ecs::EntityID entityId, const ecs::AudioFile& audioFile) {
+        if (audioFile.m_IsBGM) return false;
+
+        ecs::ECS* ecs = ecs::ECS::m_GetInstance();
+        const auto& signature = ecs->m_ECS_EntityMap.find(entityId);
+        return signature != ecs->m_ECS_EntityMap.end() && signature->second.test(ecs::TYPESPRITECOMPONENT) && signature->second.test(ecs::TYPETRANSFORMCOMPONENT);
     }
 
-    void AudioManager::m_LoadAudio(const std::string& name, const std::string& path) {
-        auto sound = std::make_unique<FModAudio>(m_system);
-        if (sound->m_CreateSound(path.c_str())) {
-            m_soundMap[name] = std::move(sound);
+    VoiceHandle AudioManager::m_PlayAudioFile(ecs::EntityID entityId, ecs::AudioFile& audioFile, float volume) {
+        FModAudio* sound = m_soundHandles.m_Resolve(audioFile.m_Name, audioFile.m_soundHandle);
+        if (!sound && m_IsLoading(audioFile.m_Name)) {
+            //played before the loader got to it
+            m_FinishLoading(audioFile.m_Name);
+            sound = m_soundHandles.m_Resolve(audioFile.m_Name, audioFile.m_soundHandle);
         }
-        else {
-            //TODO Handle error (e.g., logging or notification)
-            /*std::cerr << "Failed to load audio: " << path << std::endl;
-            std::cerr << sound->m_Init() << std::endl;
-            std::cerr << sound->m_CreateSound(path.c_str()) << std::endl;*/
+        if (!sound) return VoiceHandle{};
+
+        VoiceParams params{};
+        params.m_volume = m_GetAdjustedVolume(audioFile, volume);
+        params.m_pan = audioFile.m_Pan;
+        params.m_loop = audioFile.m_Loop;
+        params.m_priority = audioFile.m_IsBGM ? m_BGMPriority : m_SFXPriority;
+        params.m_positional = m_IsPositional(entityId, audioFile);
+        if (params.m_positional) {
+            const ecs::TransformComponent* transform = ecs::ECS::m_GetInstance()->m_GetComponent<ecs::TransformComponent>(entityId);
+            params.m_position = { transform->m_transformation.m_e20, transform->m_transformation.m_e21 };
         }
+
+        audioFile.m_voice = m_voices.m_Play(sound->m_GetSound(), params);
+        return audioFile.m_voice;
     }
 
     void AudioManager::m_PlayAudioForEntity(ecs::EntityID entityId, const std::string& name, float volume) {
-        auto it = m_soundMap.find(name);
-        if (it != m_soundMap.end()) {
-            FModAudio* sound = it->second.get();
-            std::string entityIdStr = std::to_string(entityId);
-
-            auto* ecs = ecs::ECS::m_GetInstance();
-            auto* entityComponent = ecs->m_ECS_CombinedComponentPool[ecs::TYPEAUDIOCOMPONENT]->m_GetEntityComponent(entityId);
-
-            if (entityComponent) {
-                ecs::AudioComponent* ac = static_cast<ecs::AudioComponent*>(entityComponent);
-                for (auto& audioFile : ac->m_AudioFiles) {
-                    if (audioFile.m_Name == name) {
-                        float adjustedVolume = volume;
-                        if (audioFile.m_IsBGM) {
-                            if (m_GlobalBGMVolume == 0) return;
-                            adjustedVolume *= m_GlobalBGMVolume;
-                        }
-                        else if (audioFile.m_IsSFX) {
-                            if (m_GlobalSFXVolume == 0) return;
-                            adjustedVolume *= m_GlobalSFXVolume;
-                        }
-
-                        float pan = audioFile.m_Pan;
-
-                        if (sound->m_PlaySound(entityIdStr)) {
-                            sound->m_SetVolume(entityIdStr, adjustedVolume);
-                            sound->m_SetPan(entityIdStr, pan);
-                        }
-                        return;
-                    }
-                }
-            }
-        }
-        else {
-            // TODO Handle error (e.g., logging or notification)
-           // LOGGING_WARN("Sound not found: " + name);
-        }
+        ecs::AudioFile* audioFile = m_FindAudioFile(entityId, name);
+        if (!audioFile) return;
+
+        if (audioFile->m_IsBGM && m_GlobalBGMVolume == 0) return;
+        if (!audioFile->m_IsBGM && audioFile->m_IsSFX && m_GlobalSFXVolume == 0) return;
+
+        m_PlayAudioFile(entityId, *audioFile, volume);
     }
 
 
     void AudioManager::m_StopAudioForEntity(ecs::EntityID entityId, const std::string& name) {
-        auto it = m_soundMap.find(name);
-        if (it != m_soundMap.end()) {
-            FModAudio* sound = it->second.get();
-            sound->m_StopSound(std::to_string(entityId));
-        }
-        else {
-            // TODO Handle error (e.g., logging or notification)
-            // std::cerr << "Sound not found: " << name << std::endl;
+        if (ecs::AudioFile* audioFile = m_FindAudioFile(entityId, name)) {
+            m_voices.m_Stop(audioFile->m_voice);
         }
     }
 
     void AudioManager::m_PauseAudioForEntity(ecs::EntityID entityId, const std::string& name) {
-        auto& sound = m_soundMap[name];
-        if (sound) {
-            sound->m_PauseSound(std::to_string(entityId));
+        if (ecs::AudioFile* audioFile = m_FindAudioFile(entityId, name)) {
+            m_voices.m_SetPaused(audioFile->m_voice, true);
         }
     }
 
     void AudioManager::m_UnpauseAudioForEntity(ecs::EntityID entityId, const std::string& name) {
-        auto& sound = m_soundMap[name];
-        if (sound) {
-            sound->m_UnpauseSound(std::to_string(entityId));
+        if (ecs::AudioFile* audioFile = m_FindAudioFile(entityId, name)) {
+            m_voices.m_SetPaused(audioFile->m_voice, false);
         }
     }
 
     void AudioManager::m_SetVolumeForEntity(ecs::EntityID entityId, const std::string& name, float volume) {
-        auto it = m_soundMap.find(name);
-        if (it != m_soundMap.end()) {
-            FModAudio* sound = it->second.get();
-
-            auto* ecs = ecs::ECS::m_GetInstance();
-            auto* entityComponent = ecs->m_ECS_CombinedComponentPool[ecs::TYPEAUDIOCOMPONENT]->m_GetEntityComponent(entityId);
-
-            if (entityComponent) {
-                ecs::AudioComponent* ac = static_cast<ecs::AudioComponent*>(entityComponent);
-
-                for (auto& audioFile : ac->m_AudioFiles) {
-                    if (audioFile.m_Name == name) {
-                        float adjustedVolume = volume;
-                        if (audioFile.m_IsBGM) {
-                            adjustedVolume *= m_GlobalBGMVolume;
-                        }
-                        else if (audioFile.m_IsSFX) {
-                            adjustedVolume *= m_GlobalSFXVolume;
-                        }
-
-                        sound->m_SetVolume(std::to_string(entityId), adjustedVolume);
-                        return;
-                    }
-                }
-            }
-        }
-        else {
-            LOGGING_WARN("Sound not found: " + name);
+        if (ecs::AudioFile* audioFile = m_FindAudioFile(entityId, name)) {
+            m_voices.m_SetVolume(audioFile->m_voice, m_GetAdjustedVolume(*audioFile, volume));
         }
     }
 
 
     void AudioManager::m_SetLoopingForEntity(ecs::EntityID entityId, const std::string& name, bool loop) {
-        auto it = m_soundMap.find(name);
-        if (it != m_soundMap.end()) {
-            auto& audio = it->second;
-            FMOD::Channel* channel = audio->m_GetChannelForEntity(entityId);
-            if (channel) {
-                // Set the loop count: -1 for infinite loop, 0 for no loop, or a specific number for limited loops
-                channel->setLoopCount(loop ? -1 : 0);
-            }
+        if (ecs::AudioFile* audioFile = m_FindAudioFile(entityId, name)) {
+            m_voices.m_SetLoop(audioFile->m_voice, loop);
         }
     }
 
@@ -716,45 +704,21 @@ namespace fmodaudio {
     }
 
     bool AudioManager::m_IsPlayingForEntity(ecs::EntityID entityId, const std::string& name) {
-        auto it = m_soundMap.find(name);
-        if (it != m_soundMap.end()) {
-            FModAudio* sound = it->second.get();
-            return sound->m_IsPlaying(std::to_string(entityId));
-        }
-        else {
-            // TODO Handle error (e.g., logging or notification)
-            // std::cerr << "Sound not found: " << name << std::endl;
-            return false;
-        }
+        ecs::AudioFile* audioFile = m_FindAudioFile(entityId, name);
+        return audioFile && m_voices.m_IsPlaying(audioFile->m_voice);
     }
 
-    void AudioManager::m_SetPanForEntity(ecs::EntityID entityId, const std::string& audioName, float pan) {
-        auto* ecs = ecs::ECS::m_GetInstance();
-        auto* entityComponent = ecs->m_ECS_CombinedComponentPool[ecs::TYPEAUDIOCOMPONENT]->m_GetEntityComponent(entityId);
-
-        if (entityComponent) {
-            ecs::AudioComponent* ac = static_cast<ecs::AudioComponent*>(entityComponent);
-
-            for (auto& audioFile : ac->m_AudioFiles) {
-                if (audioFile.m_Name == audioName) {
-                    audioFile.m_Pan = pan;
-                    //std::cout << audioFile.m_Pan << std::endl;
-                    audioFile.m_hasChanged = true;
-                    break;
-                }
-            }
-        }
-
-        auto it = m_soundMap.find(audioName);
-        if (it != m_soundMap.end()) {
-            FModAudio* sound = it->second.get();
+    bool AudioManager::m_IsPausedForEntity(ecs::EntityID entityId, const std::string& name) {
+        ecs::AudioFile* audioFile = m_FindAudioFile(entityId, name);
+        return audioFile && m_voices.m_IsPaused(audioFile->m_voice);
+    }
 
-            if (!sound->m_SetPan(std::to_string(entityId), pan)) {
-                //std::cerr << "Failed to set pan for entity " << entityId << " on sound " << audioName << std::endl;
-            }
-        }
-        else {
-            //std::cerr << "Sound not found: " << audioName << std::endl;
+    void AudioManager::m_SetPanForEntity(ecs::EntityID entityId, const std::string& audioName, float pan) {
+        if (ecs::AudioFile* audioFile = m_FindAudioFile(entityId, audioName)) {
+            audioFile->m_Pan = pan;
+            //std::cout << audioFile.m_Pan << std::endl;
+            audioFile->m_hasChanged = true;
+            m_voices.m_SetPan(audioFile->m_voice, pan);
         }
     }
 
@@ -762,31 +726,16 @@ namespace fmodaudio {
 
 
     void AudioManager::m_PauseAllSounds() {
-        for (auto& soundPair : m_soundMap) {
-            FModAudio* audio = soundPair.second.get();
-            if (audio) {
-                audio->m_PauseAllSounds();
-            }
-        }
+        m_voices.m_PauseAll(true);
     }
 
     void AudioManager::m_UnpauseAllSounds() {
-        for (auto& soundPair : m_soundMap) {
-            FModAudio* audio = soundPair.second.get();
-            if (audio) {
-                audio->m_UnpauseAllSounds();
-            }
-        }
+        m_voices.m_PauseAll(false);
     }
 
 
     void AudioManager::m_StopAllSounds() {
-        for (auto& soundPair : m_soundMap) {
-            FModAudio* audio = soundPair.second.get();
-            if (audio) {
-                float fadeOutTime = 0.3f;
-                audio->m_StopAllSounds(fadeOutTime);
-            }
-        }
+        float fadeOutTime = 0.3f;
+        m_voices.m_StopAll(fadeOutTime);
     }
 }
\ No newline at end of file
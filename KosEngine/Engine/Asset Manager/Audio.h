@@ -4,17 +4,18 @@
 \author    Clarence Boey
 \par       c.boey@digipen.edu
 \date      Sept 30, 2024
-\brief     This file contains the declaration of the FModAudio class,
-           which acts as a simple wrapper around the FMOD audio system
-           for handling audio playback and control.
-
-This header file provides the declaration of the FModAudio class, which
-utilizes the FMOD sound system to enable various audio functionalities.
-These include initializing the FMOD system, creating and playing audio
-files, controlling audio parameters such as volume, panning, and looping,
-as well as handling sound playback with pause, stop, and fade features.
-The class ensures proper resource management by cleaning up FMOD objects
-and releasing resources when no longer in use.
+\brief     This file contains the declaration of the FModBackend,
+           FModAudio and AudioManager classes, which handle audio
+           playback and control through FMOD.
+
+This header file provides the declaration of the FModBackend class, which
+plays sounds on FMOD channels, the FModAudio class, a loaded sound, and the
+AudioManager class. The AudioManager plays the sounds of entities through
+integer voice handles kept in the entity's AudioFile, and controls their
+volume, panning, looping, pausing, stopping and fading. Playback goes
+through the VoiceManager, which only gives channels to the voices that
+can be heard. Sounds are loaded by the AudioLoader's thread, long ones
+are streamed.
 
 Copyright (C) 2024 DigiPen Institute of Technology.
 Reproduction or disclosure of this file or its contents without the
@@ -31,280 +32,289 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "../Config/pch.h"
 
 #include "../ECS/ECS.h"
+#include "AssetHandle.h"
+#include "AudioBackend.h"
+#include "AudioVoices.h"
+#include "AudioLoader.h"
 namespace fmodaudio {
 
     /******************************************************************/
     /*!
-    \class   FModAudio
-    \brief   A class that provides an interface to the FMOD audio system.
-             It manages audio initialization, sound creation, playback,
-             and control over various sound parameters such as volume,
-             pan, and looping.
+    \class   FModBackend
+    \brief   Plays the voices through FMOD. Channels are kept in a table
+             so that the voice manager only deals with integer ids.
     */
     /******************************************************************/
-    class FModAudio {
+    class FModBackend : public AudioBackend {
     public:
 
-        /******************************************************************/
-        /*!
-        \fn      FModAudio()
-        \brief   Constructor that initializes default values for the FModAudio class.
-        */
-        /******************************************************************/
-        FModAudio(FMOD::System* system);
+        ~FModBackend() override;
 
-        /******************************************************************/
-        /*!
-        \fn      ~FModAudio()
-        \brief   Destructor that releases FMOD resources.
-        */
-        /******************************************************************/
-        ~FModAudio();
+        bool m_Init(int maxChannels) override;
+        void m_Shutdown() override;
+        void m_Update(float deltaTime) override;
 
-        /******************************************************************/
-        /*!
-        \fn      bool m_Init()
-        \brief   Initializes the FMOD system to manage sound playback.
-        \return  True if the system is successfully initialized, false otherwise.
-        */
-        /******************************************************************/
-        bool m_Init();
+        SoundID m_CreateSound(const unsigned char* data, size_t size) override;
+        SoundID m_CreateStream(const std::string& file) override;
+        SoundID m_CreateStream(const unsigned char* data, size_t size) override;
+        void m_ReleaseSound(SoundID sound) override;
+        float m_GetLength(SoundID sound) const override;
+        size_t m_GetMemoryUsage(SoundID sound) const override;
 
-        /******************************************************************/
-        /*!
-        \fn      void m_Shutdown()
-        \brief   Shuts down the FMOD system and releases all allocated resources.
-        */
-        /******************************************************************/
-        void m_Shutdown();
+        ChannelID m_Play(SoundID sound, const ChannelParams& params) override;
+        void m_Stop(ChannelID channel) override;
 
-        void Update(float deltaTime);
+        void m_SetVolume(ChannelID channel, float volume) override;
+        void m_SetPan(ChannelID channel, float pan) override;
+        void m_SetLoop(ChannelID channel, bool loop) override;
+        void m_SetPaused(ChannelID channel, bool paused) override;
 
-        /******************************************************************/
-        /*!
-        \fn      bool m_CreateSound(const char* soundFile)
-        \brief   Creates a sound object from the given sound file.
-        \param   soundFile - Path to the audio file to load.
-        \return  True if the sound is successfully created, false otherwise.
-        */
-        /******************************************************************/
-        bool m_CreateSound(const char* soundFile);
+        bool m_IsPlaying(ChannelID channel) const override;
+        float m_GetPosition(ChannelID channel) const override;
+
+    private:
+
+        FMOD::Channel* m_GetChannel(ChannelID channel) const;
+
+        FMOD::Sound* m_GetSound(SoundID sound) const;
+
+        SoundID m_AddSound(FMOD::Sound* sound, bool streamed);
+
+        //file buffer of each stream, FMOD's default is 16 KB
+        static constexpr unsigned int STREAM_BUFFER_SIZE = 64 * 1024;
 
         /******************************************************************/
         /*!
-        \fn      bool m_PlaySound(const std::string& entityId)
-        \brief   Plays a sound associated with the specified entity ID.
-        \param   entityId - The ID of the entity that should play the sound.
-        \return  True if the sound is successfully played, false otherwise.
+        \var     FMOD::System* m_system
+        \brief   FMOD system object to manage sound playback.
         */
         /******************************************************************/
-        bool m_PlaySound(const std::string& entityId);
+        FMOD::System* m_system{};
+
+        //sounds are created by the loader's thread, FMOD itself is thread safe
+        mutable std::mutex m_soundLock;
+        std::vector<FMOD::Sound*> m_sounds;
+        std::vector<bool> m_streamed;
+        std::vector<SoundID> m_freeSounds;
+
+        std::vector<FMOD::Channel*> m_channels;
+        std::vector<ChannelID> m_freeChannels;
+    };
+
+    /******************************************************************/
+    /*!
+    \class   FModAudio
+    \brief   A loaded sound. It is played through the voices of the
+             AudioManager and released with the object.
+    */
+    /******************************************************************/
+    class FModAudio {
+    public:
 
         /******************************************************************/
         /*!
-        \fn      void m_StopSound(const std::string& entityId)
-        \brief   Stops the sound associated with the specified entity ID.
-        \param   entityId - The ID of the entity for which to stop the sound.
+        \fn      FModAudio(AudioBackend* backend)
+        \brief   Constructor of a sound that is still loading.
         */
         /******************************************************************/
-        void m_StopSound(const std::string& entityId);
+        FModAudio(AudioBackend* backend);
 
         /******************************************************************/
         /*!
-        \fn      void m_StopAllSounds()
-        \brief   Stops all currently playing sounds.
+        \fn      FModAudio(AudioBackend* backend, AudioLoader::LoadJob& job)
+        \brief   Takes the sound of a finished load, and the bytes a
+                 stream from the archive is decoded from.
         */
         /******************************************************************/
-        void m_StopAllSounds(float fadeOutTime);
+        FModAudio(AudioBackend* backend, AudioLoader::LoadJob& job);
 
         /******************************************************************/
         /*!
-        \fn      void m_PauseAllSounds()
-        \brief   Pauses all currently playing sounds.
+        \fn      ~FModAudio()
+        \brief   Destructor that releases the sound.
         */
         /******************************************************************/
-        void m_PauseAllSounds();
+        ~FModAudio();
+
+        FModAudio(const FModAudio&) = delete;
+        FModAudio& operator=(const FModAudio&) = delete;
+
+        AudioBackend::SoundID m_GetSound() const { return m_sound; }
+
+        float m_GetLength() const { return m_backend->m_GetLength(m_sound); }
+
+        bool m_IsLoaded() const { return m_sound != AudioBackend::m_invalidID; }
+
+        bool m_IsStreamed() const { return m_mode == AUDIOSTREAMED; }
 
         /******************************************************************/
         /*!
-        \fn      bool m_UnpauseAllSounds()
-        \brief   Unpauses all paused sounds.
-        \return  True if sounds are successfully unpaused, false otherwise.
+        \fn      size_t m_GetMemoryUsage() const
+        \brief   Bytes resident for the sound, its samples or its stream
+                 buffers and any bytes it is streamed from.
         */
         /******************************************************************/
-        bool m_UnpauseAllSounds();
+        size_t m_GetMemoryUsage() const;
+
+        std::chrono::duration<float, std::milli> m_GetLoadTime() const { return m_loadTime; }
+
+    private:
+
+        AudioBackend* m_backend;
+
+        AudioBackend::SoundID m_sound{ AudioBackend::m_invalidID };
+
+        AudioLoadMode m_mode{ AUDIODECODED };
+
+        //the stream reads these while it plays
+        assetmanager::FileData m_file;
+
+        std::chrono::duration<float, std::milli> m_loadTime{};
+    };
+
+
+
+    class AudioManager {
+    public:
 
         /******************************************************************/
         /*!
-        \fn      bool m_PauseSound(const std::string& entityId)
-        \brief   Pauses the sound associated with the specified entity ID.
-        \param   entityId - The ID of the entity for which to pause the sound.
-        \return  True if the sound is successfully paused, false otherwise.
+        \fn      AudioManager()
+        \brief   Constructor that initializes the audio manager.
         */
         /******************************************************************/
-        bool m_PauseSound(const std::string& entityId);
+        AudioManager();
 
         /******************************************************************/
         /*!
-        \fn      bool m_UnpauseSound(const std::string& entityId)
-        \brief   Unpauses the sound associated with the specified entity ID.
-        \param   entityId - The ID of the entity for which to unpause the sound.
-        \return  True if the sound is successfully unpaused, false otherwise.
+        \fn      ~AudioManager()
+        \brief   Destructor that cleans up audio resources.
         */
         /******************************************************************/
-        bool m_UnpauseSound(const std::string& entityId);
+        ~AudioManager();
 
         /******************************************************************/
         /*!
-        \fn      bool m_FadeSound(const std::string& entityId, float targetVolume, float fadeDuration)
-        \brief   Gradually changes the volume of a sound to the target volume.
-        \param   entityId - The ID of the entity for which to fade the sound.
-        \param   targetVolume - The desired volume level.
-        \param   fadeDuration - Duration over which the fade should occur.
-        \return  True if the fade is successfully applied, false otherwise.
+        \fn      void m_LoadAudio(const std::string& name, const std::string& path)
+        \brief   Loads an audio file into the sound map. The name is in the
+                 map right away, the sound is played once the loader
+                 finished it. A loaded sound of the same name keeps
+                 playing until the new one replaces it.
+        \param   name - Identifier for the audio asset.
+        \param   path - Path to the audio file.
         */
         /******************************************************************/
-        bool m_FadeSound(const std::string& entityId, float targetVolume, float fadeDuration);
+        void m_LoadAudio(const std::string& name, const std::string& path);
 
         /******************************************************************/
         /*!
-        \fn      bool m_SetLooping(const std::string& entityId, bool loop)
-        \brief   Sets whether a sound should loop continuously.
-        \param   entityId - The ID of the entity for which to set looping.
-        \param   loop - True to enable looping, false to disable.
-        \return  True if looping is set successfully, false otherwise.
+        \fn      void m_PrefetchAudio(const std::string& name)
+        \brief   Marks a sound that will be played soon, such as the music
+                 of a scene being loaded. It is loaded before the sounds
+                 that are not, now or once it is queued.
         */
         /******************************************************************/
-        bool m_SetLooping(const std::string& entityId, bool loop);
+        void m_PrefetchAudio(const std::string& name);
+
+        bool m_IsLoading(const std::string& name) const { return m_loading.find(name) != m_loading.end(); }
 
         /******************************************************************/
         /*!
-        \fn      bool m_SetVolume(const std::string& entityId, float volume)
-        \brief   Sets the volume for a specific sound.
-        \param   entityId - The ID of the entity for which to set the volume.
-        \param   volume - Desired volume level (0.0 to 1.0).
-        \return  True if volume is set successfully, false otherwise.
+        \fn      void m_FinishLoading(const std::string& name)
+        \brief   Finishes the load of a sound on the main thread, used
+                 when it is played before the loader got to it.
         */
         /******************************************************************/
-        bool m_SetVolume(const std::string& entityId, float volume);
+        void m_FinishLoading(const std::string& name);
+
+        //blocks until every queued sound is loaded
+        void m_FinishLoading();
+
+        //bytes resident for every loaded sound
+        size_t m_GetMemoryUsage() const;
 
         /******************************************************************/
         /*!
-        \fn      bool m_SetPan(const std::string& entityId, float pan)
-        \brief   Sets the pan (stereo balance) for a specific sound.
-        \param   entityId - The ID of the entity for which to set the pan.
-        \param   pan - Stereo balance value (-1.0 for left, 1.0 for right).
-        \return  True if pan is set successfully, false otherwise.
+        \fn      void m_LogMemoryUsage() const
+        \brief   Logs the memory of each sound, largest first, and how it
+                 was loaded.
         */
         /******************************************************************/
-        bool m_SetPan(const std::string& entityId, float pan);  
+        void m_LogMemoryUsage() const;
 
         /******************************************************************/
         /*!
-        \fn      bool m_IsPlaying(const std::string& entityId)
-        \brief   Checks if the sound associated with the given entity ID is currently playing.
-        \param   entityId - The ID of the entity for which to check the sound.
-        \return  True if the sound is playing, false otherwise.
+        \fn      void m_UnloadAudio(const std::string& name)
+        \brief   Stops the voices of the sound and releases it.
         */
         /******************************************************************/
-        bool m_IsPlaying(const std::string& entityId);
+        void m_UnloadAudio(const std::string& name);
 
         /******************************************************************/
         /*!
-        \fn      FMOD::Channel* m_GetChannelForEntity(ecs::EntityID entityId)
-        \brief   Retrieves the FMOD channel associated with the given entity ID.
-        \param   entityId - The ID of the entity.
-        \return  Pointer to the FMOD channel associated with the entity.
+        \fn      bool m_RenameAudio(const std::string& oldName, const std::string& newName)
+        \brief   Moves a loaded sound to a new name.
+        \return  False if the old name is not loaded or the new one is.
         */
         /******************************************************************/
-        FMOD::Channel* m_GetChannelForEntity(ecs::EntityID entityId);
+        bool m_RenameAudio(const std::string& oldName, const std::string& newName);
 
-    private:
         /******************************************************************/
         /*!
-        \var     FMOD::System* m_system
-        \brief   FMOD system object to manage sound playback.
+        \fn      void m_SetBackend(std::unique_ptr<AudioBackend> backend)
+        \brief   Plays through another backend, initialised here. Every
+                 voice is stopped and every sound released, the sounds
+                 have to be loaded again.
         */
         /******************************************************************/
-        FMOD::System* m_system;
+        void m_SetBackend(std::unique_ptr<AudioBackend> backend);
+
+        AudioBackend* m_GetBackend() { return m_backend.get(); }
 
         /******************************************************************/
         /*!
-        \var     FMOD::Sound* m_sound
-        \brief   FMOD sound object to represent the loaded audio.
+        \fn      void m_Update(float deltaTime)
+        \brief   Called once a frame after the systems set the voices and
+                 the listener.
         */
         /******************************************************************/
-        FMOD::Sound* m_sound;
+        void m_Update(float deltaTime);
 
         /******************************************************************/
         /*!
-        \var     std::unordered_map<std::string, FMOD::Channel*> m_entityChannels
-        \brief   Map of entity ID to its playing FMOD channel.
+        \fn      void m_SetListener(const vector2::Vec2& position, const vector2::Vec2& halfExtents)
+        \brief   Sets the view of the game camera, the positional voices
+                 are quieter outside of it.
         */
         /******************************************************************/
-        std::unordered_map<std::string, FMOD::Channel*> m_entityChannels;
-
-        struct ChannelInfo {
-            FMOD::Channel* channel;
-            std::string entityId;
-            bool isActive;
-            float priority;
-            std::chrono::steady_clock::time_point lastUsed;
-
-            bool isFading = false;
-            bool isFadingOut = false; // Specifically for stopping sounds
-            std::chrono::steady_clock::time_point fadeStartTime;
-            std::chrono::steady_clock::time_point fadeCompleteTime;
-            float fadeDuration = 0.0f;
-            float fadeStartVolume = 1.0f;
-            float fadeTargetVolume = 1.0f;
-
-            ChannelInfo() : channel(nullptr), isActive(false), priority(0.0f) {}
-        };
-
-        static const int MAX_CHANNELS = 64;
-        std::vector<ChannelInfo> m_channelPool;
-
-        void m_InitializeChannelPool();
-        FMOD::Channel* m_GetAvailableChannel(const std::string& entityId);
-        void m_ReleaseUnusedChannels();
-        int m_FindLeastImportantChannel() const;
-
-        //For Debugging
-        int m_GetActiveChannelCount() const;
-        void m_PrintChannelStatus() const;  // For debugging
-    };
-
-
-
-    class AudioManager {
-    public:
+        void m_SetListener(const vector2::Vec2& position, const vector2::Vec2& halfExtents);
 
         /******************************************************************/
         /*!
-        \fn      AudioManager()
-        \brief   Constructor that initializes the audio manager.
+        \fn      VoiceHandle m_PlayAudioFile(ecs::EntityID entityId, ecs::AudioFile& audioFile, float volume)
+        \brief   Plays the audio file of an entity. The voice is stored in
+                 the audio file, an earlier voice of it keeps playing.
+        \return  Handle of the voice, null if it could not be played.
         */
         /******************************************************************/
-        AudioManager();
+        VoiceHandle m_PlayAudioFile(ecs::EntityID entityId, ecs::AudioFile& audioFile, float volume);
 
         /******************************************************************/
         /*!
-        \fn      ~AudioManager()
-        \brief   Destructor that cleans up audio resources.
+        \fn      float m_GetAdjustedVolume(const ecs::AudioFile& audioFile, float volume) const
+        \brief   Volume scaled by the global BGM or SFX volume.
         */
         /******************************************************************/
-        ~AudioManager();
+        float m_GetAdjustedVolume(const ecs::AudioFile& audioFile, float volume) const;
 
         /******************************************************************/
         /*!
-        \fn      void m_LoadAudio(const std::string& name, const std::string& path)
-        \brief   Loads an audio file into the sound map.
-        \param   name - Identifier for the audio asset.
-        \param   path - Path to the audio file.
+        \fn      static bool m_IsPositional(ecs::EntityID entityId, const ecs::AudioFile& audioFile)
+        \brief   Sound effects of entities drawn in the world are
+                 attenuated by distance, music and interface sounds are not.
         */
         /******************************************************************/
-        void m_LoadAudio(const std::string& name, const std::string& path);
+        static bool m_IsPositional(ecs::EntityID entityId, const ecs::AudioFile& audioFile);
 
         /******************************************************************/
         /*!
@@ -453,6 +463,17 @@ namespace fmodaudio {
         /******************************************************************/
         bool m_IsPlayingForEntity(ecs::EntityID entityId, const std::string& name);
 
+        /******************************************************************/
+        /*!
+        \fn      bool m_IsPausedForEntity(ecs::EntityID entityId, const std::string& name)
+        \brief   Checks if the specified entity's audio is paused.
+        \param   entityId - ID of the entity.
+        \param   name - Name of the audio asset.
+        \return  True if the audio is playing and paused, false otherwise.
+        */
+        /******************************************************************/
+        bool m_IsPausedForEntity(ecs::EntityID entityId, const std::string& name);
+
         /******************************************************************/
         /*!
         \fn      void m_SetPanForEntity(ecs::EntityID entityId, const std::string& name, float pan)
@@ -490,25 +511,79 @@ namespace fmodaudio {
 
         /******************************************************************/
         /*!
-        \fn      std::unordered_map<std::string, std::unique_ptr<fmodaudio::FModAudio>>& getSoundMap()
+        \fn      const std::unordered_map<std::string, std::unique_ptr<fmodaudio::FModAudio>>& getSoundMap() const
         \brief   Retrieves the map of sound names to their respective FModAudio objects.
+                 Sounds are loaded, unloaded and renamed through the manager,
+                 a sound that is still loading is in the map, not loaded.
         \return  Reference to the unordered map containing sound names and FModAudio objects.
         */
         /******************************************************************/
-        std::unordered_map<std::string, std::unique_ptr<FModAudio>>& getSoundMap() {
+        const std::unordered_map<std::string, std::unique_ptr<FModAudio>>& getSoundMap() const {
             return m_soundMap;
         }
 
-        FMOD::System* GetSystem() {
-            return m_system; 
-        }
-
     public:
         float m_GlobalBGMVolume{ 0.5f };
         float m_GlobalSFXVolume{ 0.5f };
 
+        //music keeps its channel before any sound effect
+        int m_BGMPriority{ 192 };
+        int m_SFXPriority{ 128 };
+
+        /******************************************************************/
+        /*!
+        \var     assetmanager::AssetHandleTable<FModAudio> m_soundHandles
+        \brief   Handles to the sounds of m_soundMap, cached by the audio
+                 files of the components.
+        */
+        /******************************************************************/
+        assetmanager::AssetHandleTable<FModAudio> m_soundHandles;
+
+        //channels go to the voices that can be heard
+        VoiceManager m_voices;
+
+        /******************************************************************/
+        /*!
+        \var     AudioLoader m_loader
+        \brief   Creates the sounds on a worker thread, its stream
+                 threshold decides which sounds are streamed.
+        */
+        /******************************************************************/
+        AudioLoader m_loader;
+
+        //loads on the calling thread when false
+        bool m_asyncLoading{ true };
+
     private:
 
+        /******************************************************************/
+        /*!
+        \fn      void m_CollectLoads()
+        \brief   Moves the sounds the loader finished into the sound map.
+        */
+        /******************************************************************/
+        void m_CollectLoads();
+
+        void m_OnLoaded(std::unique_ptr<AudioLoader::LoadJob> job);
+
+        //kept to not allocate every frame
+        std::vector<std::unique_ptr<AudioLoader::LoadJob>> m_finishedLoads;
+
+        /******************************************************************/
+        /*!
+        \fn      ecs::AudioFile* m_FindAudioFile(ecs::EntityID entityId, const std::string& name)
+        \brief   Audio file of the entity with the sound's name, nullptr
+                 if the entity has no such file.
+        */
+        /******************************************************************/
+        ecs::AudioFile* m_FindAudioFile(ecs::EntityID entityId, const std::string& name);
+
+        //maximum number of FMOD channels, the voices beyond it are virtual
+        static constexpr int MAX_CHANNELS = 64;
+
+        //declared before the sounds, which release themselves through it
+        std::unique_ptr<AudioBackend> m_backend;
+
         /******************************************************************/
         /*!
         \var     std::unordered_map<std::string, std::unique_ptr<FModAudio>> m_soundMap
@@ -517,7 +592,16 @@ namespace fmodaudio {
         /******************************************************************/
         std::unordered_map<std::string, std::unique_ptr<FModAudio>> m_soundMap;
 
-        FMOD::System* m_system;  // Single global FMOD system
+        //ticket of the latest load of each sound still loading
+        std::unordered_map<std::string, std::uint32_t> m_loading;
+        std::uint32_t m_nextTicket{};
+
+        //prefetched before their load was queued
+        std::unordered_set<std::string> m_prefetchNames;
+
+        //loads finished since the queue was last empty, logged once it empties
+        size_t m_loadedCount{};
+        std::chrono::steady_clock::time_point m_loadStart{};
     };
 
 }
@@ -0,0 +1,263 @@
+/******************************************************************/
+/*!
+\file      AudioBackend.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      April 06, 2025
+\brief     This file contains the definitions of the NullAudioBackend
+		   class.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include "../Config/pch.h"
+#include "AudioBackend.h"
+
+namespace fmodaudio {
+
+	static std::uint32_t ReadLittleEndian(const unsigned char* data, size_t bytes) {
+		std::uint32_t value{};
+		for (size_t n{}; n < bytes; n++) {
+			value |= static_cast<std::uint32_t>(data[n]) << (8 * n);
+		}
+		return value;
+	}
+
+	//length of a RIFF WAVE file from its fmt and data chunks, 0 if it is not one
+	static float GetWaveLength(const unsigned char* data, size_t size) {
+		if (size < 12 || std::memcmp(data, "RIFF", 4) != 0 || std::memcmp(data + 8, "WAVE", 4) != 0) return 0.f;
+
+		std::uint32_t byteRate{};
+		size_t offset = 12;
+		while (offset + 8 <= size) {
+			const unsigned char* chunk = data + offset;
+			const std::uint32_t chunkSize = ReadLittleEndian(chunk + 4, 4);
+
+			if (std::memcmp(chunk, "fmt ", 4) == 0 && chunkSize >= 12 && offset + 8 + 12 <= size) {
+				byteRate = ReadLittleEndian(chunk + 8 + 8, 4);
+			}
+			else if (std::memcmp(chunk, "data", 4) == 0) {
+				return byteRate ? static_cast<float>(chunkSize) / static_cast<float>(byteRate) : 0.f;
+			}
+
+			//chunks are padded to an even size
+			offset += 8 + static_cast<size_t>(chunkSize) + (chunkSize & 1);
+		}
+		return 0.f;
+	}
+
+	bool NullAudioBackend::m_Init(int maxChannels)
+	{
+		m_maxChannels = maxChannels;
+		return true;
+	}
+
+	void NullAudioBackend::m_Shutdown()
+	{
+		m_channels.clear();
+		m_freeChannels.clear();
+
+		std::lock_guard<std::mutex> lock(m_soundLock);
+		m_sounds.clear();
+		m_freeSounds.clear();
+	}
+
+	void NullAudioBackend::m_Update(float deltaTime)
+	{
+		std::lock_guard<std::mutex> lock(m_soundLock);
+		for (Channel& channel : m_channels) {
+			if (!channel.m_valid || !channel.m_playing || channel.m_params.m_paused) continue;
+
+			const float length = channel.m_sound < m_sounds.size() ? m_sounds[channel.m_sound].m_length : 0.f;
+			channel.m_params.m_position += deltaTime;
+			if (channel.m_params.m_position < length) continue;
+
+			if (channel.m_params.m_loop && length > 0.f) {
+				channel.m_params.m_position = std::fmod(channel.m_params.m_position, length);
+			}
+			else {
+				channel.m_playing = false;
+			}
+		}
+	}
+
+	AudioBackend::SoundID NullAudioBackend::m_CreateSound(const unsigned char* data, size_t size)
+	{
+		if (!data || size == 0) return m_invalidID;
+
+		const float length = GetWaveLength(data, size);
+
+		//a WAV file is mostly its samples, the copy is what a decoded sound holds
+		Sound sound{ true, length > 0.f ? length : m_defaultLength, false };
+		sound.m_samples.assign(data, data + size);
+		return m_AddSound(std::move(sound));
+	}
+
+	AudioBackend::SoundID NullAudioBackend::m_CreateSound(float length)
+	{
+		return m_AddSound(Sound{ true, length, false });
+	}
+
+	AudioBackend::SoundID NullAudioBackend::m_CreateStream(const std::string& file)
+	{
+		//only the header is read, like opening a stream
+		std::ifstream stream(file, std::ios::binary);
+		if (!stream) return m_invalidID;
+
+		std::vector<unsigned char> header(4096);
+		stream.read(reinterpret_cast<char*>(header.data()), header.size());
+		header.resize(static_cast<size_t>(stream.gcount()));
+
+		//the header claims the whole data chunk, only its start was read
+		const float length = GetWaveLength(header.data(), header.size());
+		return m_AddSound(Sound{ true, length > 0.f ? length : m_defaultLength, true });
+	}
+
+	AudioBackend::SoundID NullAudioBackend::m_CreateStream(const unsigned char* data, size_t size)
+	{
+		if (!data || size == 0) return m_invalidID;
+
+		const float length = GetWaveLength(data, size);
+		return m_AddSound(Sound{ true, length > 0.f ? length : m_defaultLength, true });
+	}
+
+	AudioBackend::SoundID NullAudioBackend::m_AddSound(Sound sound)
+	{
+		std::lock_guard<std::mutex> lock(m_soundLock);
+
+		SoundID id{};
+		if (!m_freeSounds.empty()) {
+			id = m_freeSounds.back();
+			m_freeSounds.pop_back();
+		}
+		else {
+			id = static_cast<SoundID>(m_sounds.size());
+			m_sounds.emplace_back();
+		}
+
+		m_sounds[id] = std::move(sound);
+		return id;
+	}
+
+	void NullAudioBackend::m_ReleaseSound(SoundID sound)
+	{
+		std::lock_guard<std::mutex> lock(m_soundLock);
+		if (sound >= m_sounds.size() || !m_sounds[sound].m_valid) return;
+
+		//releasing a sound stops its channels
+		for (Channel& channel : m_channels) {
+			if (channel.m_valid && channel.m_sound == sound) {
+				channel.m_playing = false;
+			}
+		}
+
+		m_sounds[sound] = Sound{};
+		m_freeSounds.push_back(sound);
+	}
+
+	float NullAudioBackend::m_GetLength(SoundID sound) const
+	{
+		std::lock_guard<std::mutex> lock(m_soundLock);
+		if (sound >= m_sounds.size() || !m_sounds[sound].m_valid) return 0.f;
+		return m_sounds[sound].m_length;
+	}
+
+	size_t NullAudioBackend::m_GetMemoryUsage(SoundID sound) const
+	{
+		std::lock_guard<std::mutex> lock(m_soundLock);
+		if (sound >= m_sounds.size() || !m_sounds[sound].m_valid) return 0;
+		return m_sounds[sound].m_streamed ? m_streamMemory : m_sounds[sound].m_samples.size();
+	}
+
+	AudioBackend::ChannelID NullAudioBackend::m_Play(SoundID sound, const ChannelParams& params)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_soundLock);
+			if (sound >= m_sounds.size() || !m_sounds[sound].m_valid) return m_invalidID;
+		}
+		if (m_maxChannels > 0 && m_GetChannelCount() >= static_cast<size_t>(m_maxChannels)) return m_invalidID;
+
+		m_playCount++;
+
+		ChannelID id{};
+		if (!m_freeChannels.empty()) {
+			id = m_freeChannels.back();
+			m_freeChannels.pop_back();
+		}
+		else {
+			id = static_cast<ChannelID>(m_channels.size());
+			m_channels.emplace_back();
+		}
+
+		m_channels[id] = Channel{ true, true, sound, params };
+		return id;
+	}
+
+	void NullAudioBackend::m_Stop(ChannelID channel)
+	{
+		if (!m_GetChannel(channel)) return;
+
+		m_stopCount++;
+		m_channels[channel] = Channel{};
+		m_freeChannels.push_back(channel);
+	}
+
+	void NullAudioBackend::m_SetVolume(ChannelID channel, float volume)
+	{
+		if (Channel* found = m_GetChannel(channel)) {
+			m_setCount++;
+			found->m_params.m_volume = volume;
+		}
+	}
+
+	void NullAudioBackend::m_SetPan(ChannelID channel, float pan)
+	{
+		if (Channel* found = m_GetChannel(channel)) {
+			m_setCount++;
+			found->m_params.m_pan = pan;
+		}
+	}
+
+	void NullAudioBackend::m_SetLoop(ChannelID channel, bool loop)
+	{
+		if (Channel* found = m_GetChannel(channel)) {
+			m_setCount++;
+			found->m_params.m_loop = loop;
+		}
+	}
+
+	void NullAudioBackend::m_SetPaused(ChannelID channel, bool paused)
+	{
+		if (Channel* found = m_GetChannel(channel)) {
+			m_setCount++;
+			found->m_params.m_paused = paused;
+		}
+	}
+
+	bool NullAudioBackend::m_IsPlaying(ChannelID channel) const
+	{
+		const Channel* found = m_GetChannel(channel);
+		return found && found->m_playing;
+	}
+
+	float NullAudioBackend::m_GetPosition(ChannelID channel) const
+	{
+		const Channel* found = m_GetChannel(channel);
+		return found ? found->m_params.m_position : 0.f;
+	}
+
+	NullAudioBackend::Channel* NullAudioBackend::m_GetChannel(ChannelID channel)
+	{
+		if (channel >= m_channels.size() || !m_channels[channel].m_valid) return nullptr;
+		return &m_channels[channel];
+	}
+
+	const NullAudioBackend::Channel* NullAudioBackend::m_GetChannel(ChannelID channel) const
+	{
+		if (channel >= m_channels.size() || !m_channels[channel].m_valid) return nullptr;
+		return &m_channels[channel];
+	}
+
+}
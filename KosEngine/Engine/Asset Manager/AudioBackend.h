@@ -0,0 +1,238 @@
+/******************************************************************/
+/*!
+\file      AudioBackend.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      April 06, 2025
+\brief     This file contains the AudioBackend interface, the layer
+		   between the voice manager and the library that plays the
+		   sounds, and the NullAudioBackend.
+
+		   Sounds and channels are integer ids owned by the backend.
+		   A channel id stays valid until it is stopped, a channel
+		   that finished or was stolen by the library reports that
+		   it is not playing.
+
+		   A sound is either decoded into memory when it is created or
+		   streamed, decoded a little at a time while it plays.
+		   Sounds may be created, and their length and memory read,
+		   from the audio loader's thread while the main thread plays
+		   other sounds.
+
+		   The NullAudioBackend plays nothing. Its channels advance
+		   by the time given to m_Update and end after the length of
+		   their sound, which lets the voice management and the audio
+		   loader run without audio hardware.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#ifndef AUDIOBACKEND_H
+#define AUDIOBACKEND_H
+
+#include "../Config/pch.h"
+#include <mutex>
+
+namespace fmodaudio {
+
+	class AudioBackend {
+
+	public:
+
+		using SoundID = std::uint32_t;
+		using ChannelID = std::uint32_t;
+
+		static constexpr std::uint32_t m_invalidID = std::numeric_limits<std::uint32_t>::max();
+
+		//state a channel starts with
+		struct ChannelParams {
+			float m_volume{ 1.f };
+			float m_pan{};
+			bool m_loop{ false };
+			bool m_paused{ false };
+			//seconds into the sound
+			float m_position{};
+		};
+
+		virtual ~AudioBackend() = default;
+
+		/******************************************************************/
+		/*!
+			\fn        virtual bool m_Init(int maxChannels)
+			\brief     Starts the library with room for the channels.
+			\return    False if no audio device could be used.
+		*/
+		/******************************************************************/
+		virtual bool m_Init(int maxChannels) = 0;
+
+		virtual void m_Shutdown() = 0;
+
+		/******************************************************************/
+		/*!
+			\fn        virtual void m_Update(float deltaTime)
+			\brief     Called once a frame before the channels are polled.
+		*/
+		/******************************************************************/
+		virtual void m_Update(float deltaTime) = 0;
+
+		/******************************************************************/
+		/*!
+			\fn        virtual SoundID m_CreateSound(const unsigned char* data, size_t size)
+			\brief     Creates a sound from the bytes of an audio file, the
+					   bytes are copied.
+			\return    m_invalidID if the file could not be decoded.
+		*/
+		/******************************************************************/
+		virtual SoundID m_CreateSound(const unsigned char* data, size_t size) = 0;
+
+		/******************************************************************/
+		/*!
+			\fn        virtual SoundID m_CreateStream(const std::string& file)
+			\brief     Creates a sound that is read from the file on disk
+					   while it plays.
+			\return    m_invalidID if the file could not be opened.
+		*/
+		/******************************************************************/
+		virtual SoundID m_CreateStream(const std::string& file) = 0;
+
+		/******************************************************************/
+		/*!
+			\fn        virtual SoundID m_CreateStream(const unsigned char* data, size_t size)
+			\brief     Creates a sound that is decoded from the bytes while
+					   it plays. The bytes are not copied, they must stay
+					   valid until the sound is released.
+			\return    m_invalidID if the data could not be decoded.
+		*/
+		/******************************************************************/
+		virtual SoundID m_CreateStream(const unsigned char* data, size_t size) = 0;
+
+		virtual void m_ReleaseSound(SoundID sound) = 0;
+
+		//length of the sound in seconds
+		virtual float m_GetLength(SoundID sound) const = 0;
+
+		//bytes the backend holds for the sound, the samples or the stream buffers
+		virtual size_t m_GetMemoryUsage(SoundID sound) const = 0;
+
+		/******************************************************************/
+		/*!
+			\fn        virtual ChannelID m_Play(SoundID sound, const ChannelParams& params)
+			\brief     Starts the sound on a new channel.
+			\return    m_invalidID if no channel could be started.
+		*/
+		/******************************************************************/
+		virtual ChannelID m_Play(SoundID sound, const ChannelParams& params) = 0;
+
+		//stops the channel and releases its id
+		virtual void m_Stop(ChannelID channel) = 0;
+
+		virtual void m_SetVolume(ChannelID channel, float volume) = 0;
+		virtual void m_SetPan(ChannelID channel, float pan) = 0;
+		virtual void m_SetLoop(ChannelID channel, bool loop) = 0;
+		virtual void m_SetPaused(ChannelID channel, bool paused) = 0;
+
+		//a paused channel is still playing
+		virtual bool m_IsPlaying(ChannelID channel) const = 0;
+
+		//seconds into the sound
+		virtual float m_GetPosition(ChannelID channel) const = 0;
+	};
+
+	class NullAudioBackend : public AudioBackend {
+
+	public:
+
+		bool m_Init(int maxChannels) override;
+		void m_Shutdown() override;
+		void m_Update(float deltaTime) override;
+
+		/******************************************************************/
+		/*!
+			\fn        SoundID m_CreateSound(const unsigned char* data, size_t size) override
+			\brief     Reads the length from the header of a WAV file, any
+					   other data is m_defaultLength long.
+		*/
+		/******************************************************************/
+		SoundID m_CreateSound(const unsigned char* data, size_t size) override;
+
+		/******************************************************************/
+		/*!
+			\fn        SoundID m_CreateSound(float length)
+			\brief     Creates a sound of the given length in seconds.
+		*/
+		/******************************************************************/
+		SoundID m_CreateSound(float length);
+
+		SoundID m_CreateStream(const std::string& file) override;
+		SoundID m_CreateStream(const unsigned char* data, size_t size) override;
+
+		void m_ReleaseSound(SoundID sound) override;
+		float m_GetLength(SoundID sound) const override;
+		size_t m_GetMemoryUsage(SoundID sound) const override;
+
+		ChannelID m_Play(SoundID sound, const ChannelParams& params) override;
+		void m_Stop(ChannelID channel) override;
+
+		void m_SetVolume(ChannelID channel, float volume) override;
+		void m_SetPan(ChannelID channel, float pan) override;
+		void m_SetLoop(ChannelID channel, bool loop) override;
+		void m_SetPaused(ChannelID channel, bool paused) override;
+
+		bool m_IsPlaying(ChannelID channel) const override;
+		float m_GetPosition(ChannelID channel) const override;
+
+		//channels that hold a sound, finished or not
+		size_t m_GetChannelCount() const { return m_channels.size() - m_freeChannels.size(); }
+
+		//calls made by the voice manager, for the benchmark
+		size_t m_GetPlayCount() const { return m_playCount; }
+		size_t m_GetStopCount() const { return m_stopCount; }
+		size_t m_GetSetCount() const { return m_setCount; }
+
+		float m_defaultLength{ 1.f };
+
+		//buffer a stream is counted with, like the one FModBackend asks FMOD for
+		size_t m_streamMemory{ 64 * 1024 };
+
+	private:
+
+		struct Sound {
+			bool m_valid{ false };
+			float m_length{};
+			bool m_streamed{ false };
+			//a decoded sound keeps its samples like a real backend would
+			std::vector<unsigned char> m_samples;
+		};
+
+		SoundID m_AddSound(Sound sound);
+
+		struct Channel {
+			bool m_valid{ false };
+			bool m_playing{ false };
+			SoundID m_sound{ m_invalidID };
+			ChannelParams m_params{};
+		};
+
+		Channel* m_GetChannel(ChannelID channel);
+		const Channel* m_GetChannel(ChannelID channel) const;
+
+		//sounds are created by the loader's thread
+		mutable std::mutex m_soundLock;
+		std::vector<Sound> m_sounds;
+		std::vector<SoundID> m_freeSounds;
+
+		std::vector<Channel> m_channels;
+		std::vector<ChannelID> m_freeChannels;
+
+		int m_maxChannels{};
+
+		size_t m_playCount{};
+		size_t m_stopCount{};
+		size_t m_setCount{};
+	};
+
+}
+
+#endif AUDIOBACKEND_H
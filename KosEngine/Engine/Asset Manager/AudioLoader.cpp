@@ -0,0 +1,189 @@
+/******************************************************************/
+/*!
+\file      AudioLoader.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      April 08, 2025
+\brief     This file contains the definitions of the AudioLoader
+		   class.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include "../Config/pch.h"
+#include "AudioLoader.h"
+#include "VirtualFileSystem.h"
+
+namespace fmodaudio {
+
+	AudioLoader::~AudioLoader()
+	{
+		m_Stop();
+	}
+
+	void AudioLoader::m_SetBackend(AudioBackend* backend)
+	{
+		m_Stop();
+		m_backend = backend;
+	}
+
+	AudioLoadMode AudioLoader::m_ChooseMode(const std::string& path) const
+	{
+		std::uint64_t size{};
+		if (!assetmanager::VirtualFileSystem::m_GetInstance()->m_GetFileSize(path, size)) return AUDIODECODED;
+		return size >= m_streamThreshold ? AUDIOSTREAMED : AUDIODECODED;
+	}
+
+	void AudioLoader::m_Queue(std::unique_ptr<LoadJob> job, bool prefetch)
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+		(prefetch ? m_prefetch : m_queue).push_back(std::move(job));
+
+		if (!m_worker.joinable()) {
+			m_stopping = false;
+			m_worker = std::thread(&AudioLoader::m_Run, this);
+		}
+		m_wake.notify_one();
+	}
+
+	bool AudioLoader::m_Prefetch(const std::string& name)
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+		std::unique_ptr<LoadJob> job = m_Extract(m_queue, name);
+		if (!job) return false;
+
+		m_prefetch.push_back(std::move(job));
+		return true;
+	}
+
+	std::unique_ptr<AudioLoader::LoadJob> AudioLoader::m_Finish(const std::string& name)
+	{
+		std::unique_lock<std::mutex> lock(m_lock);
+
+		std::unique_ptr<LoadJob> job = m_Extract(m_prefetch, name);
+		if (!job) job = m_Extract(m_queue, name);
+		if (job) {
+			//not started, cheaper to load it here than to wait behind the queue
+			lock.unlock();
+			m_Load(*job);
+			return job;
+		}
+
+		m_done.wait(lock, [&] { return !m_current || m_current->m_name != name; });
+		return m_Extract(m_finished, name);
+	}
+
+	void AudioLoader::m_TakeFinished(std::vector<std::unique_ptr<LoadJob>>& finished)
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+		for (auto& job : m_finished) {
+			finished.push_back(std::move(job));
+		}
+		m_finished.clear();
+	}
+
+	void AudioLoader::m_Cancel(const std::string& name)
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+		while (m_Extract(m_prefetch, name) || m_Extract(m_queue, name)) {}
+	}
+
+	void AudioLoader::m_WaitAll()
+	{
+		std::unique_lock<std::mutex> lock(m_lock);
+		m_done.wait(lock, [&] { return m_prefetch.empty() && m_queue.empty() && !m_current; });
+	}
+
+	void AudioLoader::m_Stop()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_lock);
+			m_stopping = true;
+		}
+		m_wake.notify_all();
+		if (m_worker.joinable()) {
+			m_worker.join();
+		}
+
+		//the worker is gone, nothing else touches the queues
+		for (auto* queue : { &m_prefetch, &m_queue, &m_finished }) {
+			for (auto& job : *queue) {
+				m_Release(*job);
+			}
+			queue->clear();
+		}
+		m_stopping = false;
+	}
+
+	size_t AudioLoader::m_GetPendingCount() const
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+		return m_prefetch.size() + m_queue.size() + m_finished.size() + (m_current ? 1 : 0);
+	}
+
+	void AudioLoader::m_Run()
+	{
+		std::unique_lock<std::mutex> lock(m_lock);
+		while (true) {
+			m_wake.wait(lock, [&] { return m_stopping || !m_prefetch.empty() || !m_queue.empty(); });
+			if (m_stopping) break;
+
+			auto& queue = m_prefetch.empty() ? m_queue : m_prefetch;
+			std::unique_ptr<LoadJob> job = std::move(queue.front());
+			queue.pop_front();
+
+			m_current = job.get();
+			lock.unlock();
+			m_Load(*job);
+			lock.lock();
+
+			m_finished.push_back(std::move(job));
+			m_current = nullptr;
+			m_done.notify_all();
+		}
+	}
+
+	void AudioLoader::m_Load(LoadJob& job) const
+	{
+		const auto start = std::chrono::steady_clock::now();
+		assetmanager::VirtualFileSystem* vfs = assetmanager::VirtualFileSystem::m_GetInstance();
+
+		if (job.m_mode == AUDIOSTREAMED && vfs->m_IsLoose(job.m_path)) {
+			job.m_sound = m_backend->m_CreateStream(job.m_path);
+		}
+		else if (vfs->m_ReadFile(job.m_path, job.m_file)) {
+			if (job.m_mode == AUDIOSTREAMED) {
+				//an uncompressed archive entry points into the mapping and costs no memory
+				job.m_sound = m_backend->m_CreateStream(job.m_file.m_data, job.m_file.m_size);
+			}
+			else {
+				//decoded into the backend's own memory
+				job.m_sound = m_backend->m_CreateSound(job.m_file.m_data, job.m_file.m_size);
+				job.m_file = assetmanager::FileData{};
+			}
+		}
+
+		job.m_loadTime = std::chrono::steady_clock::now() - start;
+	}
+
+	void AudioLoader::m_Release(LoadJob& job) const
+	{
+		if (m_backend && job.m_sound != AudioBackend::m_invalidID) {
+			m_backend->m_ReleaseSound(job.m_sound);
+			job.m_sound = AudioBackend::m_invalidID;
+		}
+	}
+
+	std::unique_ptr<AudioLoader::LoadJob> AudioLoader::m_Extract(std::deque<std::unique_ptr<LoadJob>>& queue, const std::string& name)
+	{
+		const auto& it = std::find_if(queue.begin(), queue.end(), [&name](const std::unique_ptr<LoadJob>& job) { return job->m_name == name; });
+		if (it == queue.end()) return nullptr;
+
+		std::unique_ptr<LoadJob> job = std::move(*it);
+		queue.erase(it);
+		return job;
+	}
+
+}
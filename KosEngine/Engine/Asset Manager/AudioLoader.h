@@ -0,0 +1,180 @@
+/******************************************************************/
+/*!
+\file      AudioLoader.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      April 08, 2025
+\brief     This file contains the AudioLoader class, which creates the
+		   sounds of the AudioManager on a worker thread.
+
+		   Short sounds are read and decoded into memory ahead of time
+		   so that playing them costs nothing. Sounds at least
+		   m_streamThreshold bytes large, music and ambience, are
+		   streamed instead: only their header is read and they are
+		   decoded from the disk or the archive while they play.
+
+		   Loads wait in two queues. The prefetch queue holds sounds
+		   that are needed soon, such as the music of a scene being
+		   loaded, and is emptied first. A sound played before its
+		   load finished is loaded on the main thread right away.
+
+		   A streamed sound has a single read position, FMOD plays it
+		   on one channel at a time.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#ifndef AUDIOLOADER_H
+#define AUDIOLOADER_H
+
+#include "../Config/pch.h"
+#include "AudioBackend.h"
+#include "AssetPack.h"
+#include <mutex>
+#include <condition_variable>
+
+namespace fmodaudio {
+
+	enum AudioLoadMode {
+		AUDIODECODED,
+		AUDIOSTREAMED
+	};
+
+	class AudioLoader {
+
+	public:
+
+		struct LoadJob {
+			std::string m_name{};
+			std::string m_path{};
+			AudioLoadMode m_mode{ AUDIODECODED };
+			//tells a reload apart from the load it replaced
+			std::uint32_t m_ticket{};
+
+			//written by the loader
+			AudioBackend::SoundID m_sound{ AudioBackend::m_invalidID };
+			//bytes a stream from the archive is decoded from
+			assetmanager::FileData m_file;
+			std::chrono::duration<float, std::milli> m_loadTime{};
+		};
+
+		~AudioLoader();
+
+		/******************************************************************/
+		/*!
+			\fn        void m_SetBackend(AudioBackend* backend)
+			\brief     Stops the worker, releases the sounds of every
+					   unfinished load and creates sounds through the
+					   backend.
+		*/
+		/******************************************************************/
+		void m_SetBackend(AudioBackend* backend);
+
+		/******************************************************************/
+		/*!
+			\fn        AudioLoadMode m_ChooseMode(const std::string& path) const
+			\brief     Streams files of at least m_streamThreshold bytes,
+					   decodes the others.
+		*/
+		/******************************************************************/
+		AudioLoadMode m_ChooseMode(const std::string& path) const;
+
+		/******************************************************************/
+		/*!
+			\fn        void m_Queue(std::unique_ptr<LoadJob> job, bool prefetch)
+			\brief     Loads the sound on the worker thread, before every
+					   other load if prefetched. The worker is started by
+					   the first load.
+		*/
+		/******************************************************************/
+		void m_Queue(std::unique_ptr<LoadJob> job, bool prefetch);
+
+		/******************************************************************/
+		/*!
+			\fn        bool m_Prefetch(const std::string& name)
+			\brief     Moves a queued load to the back of the prefetch
+					   queue.
+			\return    False if the sound is not waiting to be loaded.
+		*/
+		/******************************************************************/
+		bool m_Prefetch(const std::string& name);
+
+		/******************************************************************/
+		/*!
+			\fn        std::unique_ptr<LoadJob> m_Finish(const std::string& name)
+			\brief     Loads the sound on the calling thread if it is still
+					   queued, waits for it if the worker is loading it.
+			\return    The finished load, nullptr if there is none for the
+					   name.
+		*/
+		/******************************************************************/
+		std::unique_ptr<LoadJob> m_Finish(const std::string& name);
+
+		/******************************************************************/
+		/*!
+			\fn        void m_TakeFinished(std::vector<std::unique_ptr<LoadJob>>& finished)
+			\brief     Moves the loads the worker finished since the last
+					   call into the list. Called once a frame.
+		*/
+		/******************************************************************/
+		void m_TakeFinished(std::vector<std::unique_ptr<LoadJob>>& finished);
+
+		//drops a load that did not start, a started one is still finished
+		void m_Cancel(const std::string& name);
+
+		//blocks until every queued load is finished
+		void m_WaitAll();
+
+		/******************************************************************/
+		/*!
+			\fn        void m_Load(LoadJob& job) const
+			\brief     Reads the file and creates the sound on the calling
+					   thread, m_sound stays invalid if it fails.
+		*/
+		/******************************************************************/
+		void m_Load(LoadJob& job) const;
+
+		/******************************************************************/
+		/*!
+			\fn        void m_Stop()
+			\brief     Joins the worker after the load it is on, releases
+					   the sounds of the loads that were not taken.
+		*/
+		/******************************************************************/
+		void m_Stop();
+
+		//loads queued, running or not yet taken
+		size_t m_GetPendingCount() const;
+
+		std::uint64_t m_streamThreshold{ 1024 * 1024 };
+
+	private:
+
+		void m_Run();
+
+		void m_Release(LoadJob& job) const;
+
+		static std::unique_ptr<LoadJob> m_Extract(std::deque<std::unique_ptr<LoadJob>>& queue, const std::string& name);
+
+		AudioBackend* m_backend{};
+
+		std::thread m_worker;
+
+		mutable std::mutex m_lock;
+		std::condition_variable m_wake;
+		std::condition_variable m_done;
+		bool m_stopping{ false };
+
+		std::deque<std::unique_ptr<LoadJob>> m_prefetch;
+		std::deque<std::unique_ptr<LoadJob>> m_queue;
+		std::deque<std::unique_ptr<LoadJob>> m_finished;
+
+		//owned by the worker while it loads it
+		LoadJob* m_current{};
+	};
+
+}
+
+#endif AUDIOLOADER_H
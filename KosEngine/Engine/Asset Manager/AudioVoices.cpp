@@ -0,0 +1,373 @@
+/******************************************************************/
+/*!
+\file      AudioVoices.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      April 06, 2025
+\brief     This file contains the definitions of the VoiceManager
+		   class.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include "../Config/pch.h"
+#include "AudioVoices.h"
+
+namespace fmodaudio {
+
+	void VoiceManager::m_SetBackend(AudioBackend* backend)
+	{
+		for (std::uint32_t index{}; index < m_voices.size(); index++) {
+			if (m_voices[index].m_active) {
+				m_Free(index);
+			}
+		}
+		m_backend = backend;
+	}
+
+	VoiceHandle VoiceManager::m_Play(AudioBackend::SoundID sound, const VoiceParams& params)
+	{
+		if (!m_backend || sound == AudioBackend::m_invalidID) return VoiceHandle{};
+
+		std::uint32_t index{};
+		if (!m_freeVoices.empty()) {
+			index = m_freeVoices.back();
+			m_freeVoices.pop_back();
+		}
+		else {
+			index = static_cast<std::uint32_t>(m_voices.size());
+			m_voices.emplace_back();
+		}
+
+		Voice& voice = m_voices[index];
+		const std::uint32_t generation = voice.m_generation;
+		voice = Voice{};
+		voice.m_generation = generation;
+		voice.m_active = true;
+		voice.m_sound = sound;
+		voice.m_length = m_backend->m_GetLength(sound);
+		voice.m_params = params;
+		voice.m_params.m_volume = std::clamp(params.m_volume, 0.f, 1.f);
+		voice.m_audibleVolume = voice.m_params.m_volume * m_GetAttenuation(voice);
+		m_voiceCount++;
+
+		//a new sound is not delayed a frame while there is a free channel
+		if (m_realCount < m_maxRealVoices && voice.m_audibleVolume >= m_minAudibleVolume) {
+			m_Promote(voice);
+		}
+
+		return VoiceHandle{ index, generation };
+	}
+
+	void VoiceManager::m_Stop(VoiceHandle handle)
+	{
+		if (m_GetVoice(handle)) {
+			m_Free(handle.m_index);
+		}
+	}
+
+	void VoiceManager::m_Fade(VoiceHandle handle, float targetGain, float duration, bool stopAtEnd)
+	{
+		Voice* voice = m_GetVoice(handle);
+		if (!voice) return;
+
+		if (duration <= 0.f) {
+			if (stopAtEnd) {
+				m_Free(handle.m_index);
+				return;
+			}
+			voice->m_gain = targetGain;
+			voice->m_fading = false;
+			m_ApplyVolume(*voice);
+			return;
+		}
+
+		voice->m_fading = true;
+		voice->m_stopAfterFade = stopAtEnd;
+		voice->m_fadeFrom = voice->m_gain;
+		voice->m_fadeTo = targetGain;
+		voice->m_fadeTime = 0.f;
+		voice->m_fadeDuration = duration;
+	}
+
+	void VoiceManager::m_SetVolume(VoiceHandle handle, float volume)
+	{
+		Voice* voice = m_GetVoice(handle);
+		if (!voice) return;
+
+		voice->m_params.m_volume = std::clamp(volume, 0.f, 1.f);
+		m_ApplyVolume(*voice);
+	}
+
+	void VoiceManager::m_SetPan(VoiceHandle handle, float pan)
+	{
+		Voice* voice = m_GetVoice(handle);
+		if (!voice || voice->m_params.m_pan == pan) return;
+
+		voice->m_params.m_pan = pan;
+		if (voice->m_channel != AudioBackend::m_invalidID) {
+			m_backend->m_SetPan(voice->m_channel, pan);
+		}
+	}
+
+	void VoiceManager::m_SetLoop(VoiceHandle handle, bool loop)
+	{
+		Voice* voice = m_GetVoice(handle);
+		if (!voice || voice->m_params.m_loop == loop) return;
+
+		voice->m_params.m_loop = loop;
+		if (voice->m_channel != AudioBackend::m_invalidID) {
+			m_backend->m_SetLoop(voice->m_channel, loop);
+		}
+	}
+
+	void VoiceManager::m_SetPaused(VoiceHandle handle, bool paused)
+	{
+		Voice* voice = m_GetVoice(handle);
+		if (!voice || voice->m_paused == paused) return;
+
+		voice->m_paused = paused;
+		if (voice->m_channel != AudioBackend::m_invalidID) {
+			m_backend->m_SetPaused(voice->m_channel, paused);
+		}
+	}
+
+	void VoiceManager::m_SetPosition(VoiceHandle handle, bool positional, const vector2::Vec2& position)
+	{
+		Voice* voice = m_GetVoice(handle);
+		if (!voice) return;
+
+		//the volume follows in the next m_Update
+		voice->m_params.m_positional = positional;
+		voice->m_params.m_position = position;
+	}
+
+	bool VoiceManager::m_IsPlaying(VoiceHandle handle) const
+	{
+		return m_GetVoice(handle) != nullptr;
+	}
+
+	bool VoiceManager::m_IsPaused(VoiceHandle handle) const
+	{
+		const Voice* voice = m_GetVoice(handle);
+		return voice && voice->m_paused;
+	}
+
+	bool VoiceManager::m_IsVirtual(VoiceHandle handle) const
+	{
+		const Voice* voice = m_GetVoice(handle);
+		return voice && voice->m_channel == AudioBackend::m_invalidID;
+	}
+
+	void VoiceManager::m_PauseAll(bool paused)
+	{
+		for (std::uint32_t index{}; index < m_voices.size(); index++) {
+			if (m_voices[index].m_active) {
+				m_SetPaused(VoiceHandle{ index, m_voices[index].m_generation }, paused);
+			}
+		}
+	}
+
+	void VoiceManager::m_StopAll(float fadeOutTime)
+	{
+		for (std::uint32_t index{}; index < m_voices.size(); index++) {
+			if (m_voices[index].m_active) {
+				m_Fade(VoiceHandle{ index, m_voices[index].m_generation }, 0.f, fadeOutTime, true);
+			}
+		}
+	}
+
+	void VoiceManager::m_StopSound(AudioBackend::SoundID sound)
+	{
+		for (std::uint32_t index{}; index < m_voices.size(); index++) {
+			if (m_voices[index].m_active && m_voices[index].m_sound == sound) {
+				m_Free(index);
+			}
+		}
+	}
+
+	void VoiceManager::m_SetListener(const vector2::Vec2& position, const vector2::Vec2& halfExtents)
+	{
+		m_listenerSet = true;
+		m_listenerPosition = position;
+		m_listenerHalfExtents = halfExtents;
+	}
+
+	void VoiceManager::m_Update(float deltaTime)
+	{
+		m_hasListener = m_listenerSet;
+		m_listenerSet = false;
+
+		m_promoted = 0;
+		m_demoted = 0;
+		if (!m_backend) return;
+
+		m_backend->m_Update(deltaTime);
+
+		m_ranking.clear();
+		for (std::uint32_t index{}; index < m_voices.size(); index++) {
+			Voice& voice = m_voices[index];
+			if (!voice.m_active) continue;
+
+			if (voice.m_fading) {
+				voice.m_fadeTime += deltaTime;
+				const float t = std::min(voice.m_fadeTime / voice.m_fadeDuration, 1.f);
+				voice.m_gain = voice.m_fadeFrom + (voice.m_fadeTo - voice.m_fadeFrom) * t;
+				if (t >= 1.f) {
+					voice.m_fading = false;
+					if (voice.m_stopAfterFade) {
+						m_Free(index);
+						continue;
+					}
+				}
+			}
+
+			if (voice.m_channel != AudioBackend::m_invalidID) {
+				//ended, or taken by the library
+				if (!m_backend->m_IsPlaying(voice.m_channel)) {
+					m_Free(index);
+					continue;
+				}
+			}
+			else if (!voice.m_paused) {
+				voice.m_time += deltaTime;
+				if (voice.m_time >= voice.m_length) {
+					if (!voice.m_params.m_loop || voice.m_length <= 0.f) {
+						m_Free(index);
+						continue;
+					}
+					voice.m_time = std::fmod(voice.m_time, voice.m_length);
+				}
+			}
+
+			//a paused voice is silent, it gives its channel to the others
+			voice.m_audibleVolume = voice.m_paused ? 0.f : voice.m_params.m_volume * voice.m_gain * m_GetAttenuation(voice);
+			if (voice.m_audibleVolume >= m_minAudibleVolume) {
+				m_ranking.push_back(index);
+			}
+			else if (voice.m_channel != AudioBackend::m_invalidID) {
+				m_Demote(voice);
+			}
+		}
+
+		const size_t realCount = std::min(m_ranking.size(), m_maxRealVoices);
+		if (m_ranking.size() > realCount) {
+			std::nth_element(m_ranking.begin(), m_ranking.begin() + realCount, m_ranking.end(), [this](std::uint32_t lhs, std::uint32_t rhs) {
+				const Voice& left = m_voices[lhs];
+				const Voice& right = m_voices[rhs];
+				if (left.m_params.m_priority != right.m_params.m_priority) return left.m_params.m_priority > right.m_params.m_priority;
+				if (left.m_audibleVolume != right.m_audibleVolume) return left.m_audibleVolume > right.m_audibleVolume;
+				return lhs < rhs;
+			});
+
+			//channels are freed before they are given to the louder voices
+			for (size_t n = realCount; n < m_ranking.size(); n++) {
+				Voice& voice = m_voices[m_ranking[n]];
+				if (voice.m_channel != AudioBackend::m_invalidID) {
+					m_Demote(voice);
+				}
+			}
+		}
+
+		for (size_t n{}; n < realCount; n++) {
+			Voice& voice = m_voices[m_ranking[n]];
+			if (voice.m_channel == AudioBackend::m_invalidID) {
+				m_Promote(voice);
+			}
+			else if (voice.m_channelVolume != voice.m_audibleVolume) {
+				voice.m_channelVolume = voice.m_audibleVolume;
+				m_backend->m_SetVolume(voice.m_channel, voice.m_audibleVolume);
+			}
+		}
+	}
+
+	VoiceManager::Voice* VoiceManager::m_GetVoice(VoiceHandle handle)
+	{
+		if (handle.m_index >= m_voices.size()) return nullptr;
+
+		Voice& voice = m_voices[handle.m_index];
+		if (!voice.m_active || voice.m_generation != handle.m_generation) return nullptr;
+		return &voice;
+	}
+
+	const VoiceManager::Voice* VoiceManager::m_GetVoice(VoiceHandle handle) const
+	{
+		if (handle.m_index >= m_voices.size()) return nullptr;
+
+		const Voice& voice = m_voices[handle.m_index];
+		if (!voice.m_active || voice.m_generation != handle.m_generation) return nullptr;
+		return &voice;
+	}
+
+	float VoiceManager::m_GetAttenuation(const Voice& voice) const
+	{
+		if (!voice.m_params.m_positional || !m_hasListener) return 1.f;
+		if (m_listenerHalfExtents.m_x <= 0.f || m_listenerHalfExtents.m_y <= 0.f) return 1.f;
+
+		//how far outside the view, in view sizes
+		const float outsideX = (std::fabs(voice.m_params.m_position.m_x - m_listenerPosition.m_x) - m_listenerHalfExtents.m_x) / m_listenerHalfExtents.m_x;
+		const float outsideY = (std::fabs(voice.m_params.m_position.m_y - m_listenerPosition.m_y) - m_listenerHalfExtents.m_y) / m_listenerHalfExtents.m_y;
+		const float outside = std::max(outsideX, outsideY);
+
+		if (outside <= 0.f) return 1.f;
+		if (m_silentDistance <= 0.f) return 0.f;
+		return std::max(1.f - outside / m_silentDistance, 0.f);
+	}
+
+	void VoiceManager::m_ApplyVolume(Voice& voice)
+	{
+		voice.m_audibleVolume = voice.m_paused ? 0.f : voice.m_params.m_volume * voice.m_gain * m_GetAttenuation(voice);
+		if (voice.m_channel == AudioBackend::m_invalidID || voice.m_channelVolume == voice.m_audibleVolume) return;
+
+		voice.m_channelVolume = voice.m_audibleVolume;
+		m_backend->m_SetVolume(voice.m_channel, voice.m_audibleVolume);
+	}
+
+	bool VoiceManager::m_Promote(Voice& voice)
+	{
+		AudioBackend::ChannelParams params{};
+		params.m_volume = voice.m_audibleVolume;
+		params.m_pan = voice.m_params.m_pan;
+		params.m_loop = voice.m_params.m_loop;
+		params.m_paused = voice.m_paused;
+		params.m_position = voice.m_time;
+
+		const AudioBackend::ChannelID channel = m_backend->m_Play(voice.m_sound, params);
+		if (channel == AudioBackend::m_invalidID) return false;
+
+		voice.m_channel = channel;
+		voice.m_channelVolume = voice.m_audibleVolume;
+		m_realCount++;
+		m_promoted++;
+		return true;
+	}
+
+	void VoiceManager::m_Demote(Voice& voice)
+	{
+		//continues from here when it gets a channel again
+		voice.m_time = m_backend->m_GetPosition(voice.m_channel);
+		m_backend->m_Stop(voice.m_channel);
+		voice.m_channel = AudioBackend::m_invalidID;
+		m_realCount--;
+		m_demoted++;
+	}
+
+	void VoiceManager::m_Free(std::uint32_t index)
+	{
+		Voice& voice = m_voices[index];
+		if (voice.m_channel != AudioBackend::m_invalidID) {
+			m_backend->m_Stop(voice.m_channel);
+			m_realCount--;
+		}
+
+		//older handles become stale
+		const std::uint32_t generation = voice.m_generation + 1;
+		voice = Voice{};
+		voice.m_generation = generation;
+		m_freeVoices.push_back(index);
+		m_voiceCount--;
+	}
+
+}
@@ -0,0 +1,222 @@
+/******************************************************************/
+/*!
+\file      AudioVoices.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      April 06, 2025
+\brief     This file contains the VoiceHandle and the VoiceManager
+		   class, a flat table of every sound that is playing.
+
+		   A voice is real when it holds a channel of the backend and
+		   virtual when it does not. A virtual voice keeps its volume,
+		   position and playback time, and continues where it would
+		   have been when it gets a channel back.
+
+		   Once a frame the voices are ranked by priority, then by
+		   how loud they would be. The first m_maxRealVoices that are
+		   audible are real, every other voice is virtual. A voice
+		   with a position is silent further than m_silentDistance
+		   view sizes outside the listener's view, and fades in
+		   towards the view.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#ifndef AUDIOVOICES_H
+#define AUDIOVOICES_H
+
+#include "../Config/pch.h"
+#include "AudioBackend.h"
+
+namespace fmodaudio {
+
+	/******************************************************************/
+	/*!
+	\class     VoiceHandle
+	\brief     Index into the voice table and the generation of the
+			   slot when the voice was started. A handle of a voice that
+			   ended is stale and is ignored.
+	*/
+	/******************************************************************/
+	struct VoiceHandle {
+
+		static constexpr std::uint32_t m_invalidIndex = std::numeric_limits<std::uint32_t>::max();
+
+		std::uint32_t m_index{ m_invalidIndex };
+		std::uint32_t m_generation{};
+
+		bool m_IsNull() const { return m_index == m_invalidIndex; }
+
+		bool operator==(const VoiceHandle& other) const { return m_index == other.m_index && m_generation == other.m_generation; }
+		bool operator!=(const VoiceHandle& other) const { return !(*this == other); }
+	};
+
+	//state a voice starts with
+	struct VoiceParams {
+		float m_volume{ 1.f };
+		float m_pan{};
+		bool m_loop{ false };
+		//higher is kept real first
+		int m_priority{ 128 };
+		//a voice without a position is not attenuated by distance
+		bool m_positional{ false };
+		vector2::Vec2 m_position{};
+	};
+
+	class VoiceManager {
+
+	public:
+
+		/******************************************************************/
+		/*!
+			\fn        void m_SetBackend(AudioBackend* backend)
+			\brief     Stops every voice and plays through the backend.
+		*/
+		/******************************************************************/
+		void m_SetBackend(AudioBackend* backend);
+
+		/******************************************************************/
+		/*!
+			\fn        VoiceHandle m_Play(AudioBackend::SoundID sound, const VoiceParams& params)
+			\brief     Starts a voice. It gets a channel right away while
+					   fewer than m_maxRealVoices are real, otherwise it
+					   starts virtual and is ranked in the next m_Update.
+		*/
+		/******************************************************************/
+		VoiceHandle m_Play(AudioBackend::SoundID sound, const VoiceParams& params);
+
+		void m_Stop(VoiceHandle handle);
+
+		/******************************************************************/
+		/*!
+			\fn        void m_Fade(VoiceHandle handle, float targetGain, float duration, bool stopAtEnd)
+			\brief     Moves the gain of the voice to the target over the
+					   duration. The gain multiplies the volume, so the
+					   volume can still be set while the voice fades.
+		*/
+		/******************************************************************/
+		void m_Fade(VoiceHandle handle, float targetGain, float duration, bool stopAtEnd);
+
+		void m_SetVolume(VoiceHandle handle, float volume);
+		void m_SetPan(VoiceHandle handle, float pan);
+		void m_SetLoop(VoiceHandle handle, bool loop);
+		void m_SetPaused(VoiceHandle handle, bool paused);
+		void m_SetPosition(VoiceHandle handle, bool positional, const vector2::Vec2& position);
+
+		//true while the voice exists, real or virtual
+		bool m_IsPlaying(VoiceHandle handle) const;
+		bool m_IsPaused(VoiceHandle handle) const;
+		bool m_IsVirtual(VoiceHandle handle) const;
+
+		void m_PauseAll(bool paused);
+
+		/******************************************************************/
+		/*!
+			\fn        void m_StopAll(float fadeOutTime)
+			\brief     Fades every voice out and stops it, right away if
+					   the time is 0.
+		*/
+		/******************************************************************/
+		void m_StopAll(float fadeOutTime);
+
+		//stops the voices of a sound before it is released
+		void m_StopSound(AudioBackend::SoundID sound);
+
+		/******************************************************************/
+		/*!
+			\fn        void m_SetListener(const vector2::Vec2& position, const vector2::Vec2& halfExtents)
+			\brief     View the positional voices are heard from, set every
+					   frame. A frame without a listener attenuates no
+					   voice.
+		*/
+		/******************************************************************/
+		void m_SetListener(const vector2::Vec2& position, const vector2::Vec2& halfExtents);
+
+		/******************************************************************/
+		/*!
+			\fn        void m_Update(float deltaTime)
+			\brief     Advances fades and virtual voices, frees voices that
+					   ended and moves channels to the loudest voices.
+		*/
+		/******************************************************************/
+		void m_Update(float deltaTime);
+
+		size_t m_GetVoiceCount() const { return m_voiceCount; }
+		size_t m_GetRealCount() const { return m_realCount; }
+		size_t m_GetVirtualCount() const { return m_voiceCount - m_realCount; }
+
+		//voices that got or lost a channel in the last m_Update
+		size_t m_GetPromoted() const { return m_promoted; }
+		size_t m_GetDemoted() const { return m_demoted; }
+
+		size_t m_maxRealVoices{ 64 };
+
+		//quieter voices do not hold a channel
+		float m_minAudibleVolume{ 0.01f };
+
+		//in view sizes outside the listener's view
+		float m_silentDistance{ 1.f };
+
+	private:
+
+		struct Voice {
+			std::uint32_t m_generation{};
+			bool m_active{ false };
+
+			AudioBackend::SoundID m_sound{ AudioBackend::m_invalidID };
+			float m_length{};
+			AudioBackend::ChannelID m_channel{ AudioBackend::m_invalidID };
+
+			VoiceParams m_params{};
+			bool m_paused{ false };
+
+			//playback time while virtual
+			float m_time{};
+
+			float m_gain{ 1.f };
+			bool m_fading{ false };
+			bool m_stopAfterFade{ false };
+			float m_fadeFrom{};
+			float m_fadeTo{};
+			float m_fadeTime{};
+			float m_fadeDuration{};
+
+			//volume with the gain and attenuation, and the one the channel has
+			float m_audibleVolume{};
+			float m_channelVolume{ -1.f };
+		};
+
+		Voice* m_GetVoice(VoiceHandle handle);
+		const Voice* m_GetVoice(VoiceHandle handle) const;
+
+		float m_GetAttenuation(const Voice& voice) const;
+		void m_ApplyVolume(Voice& voice);
+		bool m_Promote(Voice& voice);
+		void m_Demote(Voice& voice);
+		void m_Free(std::uint32_t index);
+
+		AudioBackend* m_backend{};
+
+		std::vector<Voice> m_voices;
+		std::vector<std::uint32_t> m_freeVoices;
+
+		//voices ranked by m_Update, kept to not allocate every frame
+		std::vector<std::uint32_t> m_ranking;
+
+		size_t m_voiceCount{};
+		size_t m_realCount{};
+		size_t m_promoted{};
+		size_t m_demoted{};
+
+		//the listener set since the last m_Update, and the one it used
+		bool m_listenerSet{ false };
+		bool m_hasListener{ false };
+		vector2::Vec2 m_listenerPosition{};
+		vector2::Vec2 m_listenerHalfExtents{};
+	};
+
+}
+
+#endif AUDIOVOICES_H
@@ -33,6 +33,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 #include "../Graphics/GraphicsPipe.h"
 #include "AssetManager.h"
+#include "../Helper/Helper.h"
 #include <regex>
 
 namespace image {
@@ -68,7 +69,12 @@ namespace image {
 
 
 
-        unsigned char* data = stbi_load(file, &image.m_width, &image.m_height, &image.m_channels, 0);
+        //loose file or packed archive
+        assetmanager::FileData filedata;
+        unsigned char* data = nullptr;
+        if (assetmanager::VirtualFileSystem::m_GetInstance()->m_ReadFile(file, filedata)) {
+            data = stbi_load_from_memory(filedata.m_data, static_cast<int>(filedata.m_size), &image.m_width, &image.m_height, &image.m_channels, 0);
+        }
         if (!data)
         {
             LOGGING_ASSERT_WITH_MSG("Error: Could not load image {0}", file);
@@ -157,18 +163,24 @@ namespace image {
             m_imagedataArray.push_back(data);
         }
 
-        unsigned int textureID;
-        glGenTextures(1, &textureID);
-        glBindTexture(GL_TEXTURE_2D, textureID);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, m_imageMap[image.m_spriteName].m_width, m_imageMap[image.m_spriteName].m_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, m_imagedataArray.back());
-        glGenerateMipmap(GL_TEXTURE_2D);
+        //headless runs keep the size and strips the systems read, without a texture
+        unsigned int textureID{};
+        if (!Helper::Helpers::GetInstance()->m_headless) {
+            glGenTextures(1, &textureID);
+            glBindTexture(GL_TEXTURE_2D, textureID);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, m_imageMap[image.m_spriteName].m_width, m_imageMap[image.m_spriteName].m_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, m_imagedataArray.back());
+            glGenerateMipmap(GL_TEXTURE_2D);
+        }
 
         m_imageMap.find(image.m_spriteName)->second.textureID = textureID;
 
+        //register or refresh the handle, reloading stales all previously resolved handles
+        m_imageHandles.m_Register(image.m_spriteName, &m_imageMap.find(image.m_spriteName)->second);
+
         graphics->m_textureIDs.push_back(textureID);
         LOGGING_INFO("Texture Binded, Texture ID : {0} ", textureID);
         LOGGING_INFO("Image ID : {0} ", image.m_imageID);
@@ -178,6 +190,124 @@ namespace image {
 
 	}
 
+    bool ImageManager::m_DecodeImage(const std::string& file, DecodedImage& decoded)
+    {
+        //flip flag is per thread, the global one belongs to the main thread
+        stbi_set_flip_vertically_on_load_thread(true);
+
+        assetmanager::FileData filedata;
+        if (!assetmanager::VirtualFileSystem::m_GetInstance()->m_ReadFile(file, filedata)) {
+            return false;
+        }
+        decoded.m_data = stbi_load_from_memory(filedata.m_data, static_cast<int>(filedata.m_size), &decoded.m_width, &decoded.m_height, &decoded.m_channels, 0);
+
+        return decoded.m_data != nullptr;
+    }
+
+    void ImageManager::m_FreeDecodedImage(DecodedImage& decoded)
+    {
+        if (decoded.m_data) {
+            stbi_image_free(decoded.m_data);
+            decoded.m_data = nullptr;
+        }
+    }
+
+    bool ImageManager::m_ReloadImage(const std::string& file, DecodedImage& decoded)
+    {
+        const std::string name = std::filesystem::path{ file }.filename().string();
+        const auto& it = m_imageMap.find(name);
+        if (it == m_imageMap.end() || !decoded.m_data) {
+            return false;
+        }
+
+        graphicpipe::GraphicsPipe* graphics = graphicpipe::GraphicsPipe::m_funcGetInstance();
+        Image& image = it->second;
+
+        unsigned char* data = decoded.m_data;
+        decoded.m_data = nullptr;
+
+        bool isPadded = false;
+        int width = decoded.m_width;
+        int height = decoded.m_height;
+        if (decoded.m_channels != m_targetChannels)
+        {
+            LOGGING_WARN("Warning: Color channels for {0} are not following RGBA specifications ", file);
+
+            int targetSize = (std::max)(width, height);
+            unsigned char* newData = m_funcPadTexture(data, width, height, decoded.m_channels, targetSize, targetSize, m_targetChannels);
+            stbi_image_free(data);
+            data = newData;
+            width = targetSize;
+            height = targetSize;
+            isPadded = true;
+        }
+
+        //release previous pixels, slot keeps the same image ID
+        if (image.m_imageID < static_cast<int>(m_imagedataArray.size()) && m_imagedataArray[image.m_imageID]) {
+            if (image.m_isPadded) {
+                delete[] m_imagedataArray[image.m_imageID];
+            }
+            else {
+                stbi_image_free(m_imagedataArray[image.m_imageID]);
+            }
+        }
+        m_imagedataArray[image.m_imageID] = data;
+
+        image.m_width = width;
+        image.m_height = height;
+        image.m_channels = m_targetChannels;
+        image.m_isPadded = isPadded;
+
+        //upload into the existing texture, texture array stays untouched
+        if (!Helper::Helpers::GetInstance()->m_headless) {
+            glBindTexture(GL_TEXTURE_2D, image.textureID);
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, image.m_width, image.m_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
+            glGenerateMipmap(GL_TEXTURE_2D);
+            glBindTexture(GL_TEXTURE_2D, 0);
+        }
+
+        if (image.m_imageID < static_cast<int>(graphics->m_imageData.size())) {
+            graphics->m_imageData[image.m_imageID] = image;
+        }
+
+        m_imageHandles.m_Register(name, &image);
+
+        LOGGING_INFO("Texture Reloaded, Texture ID : {0} ", image.textureID);
+        return true;
+    }
+
+    bool ImageManager::m_UnloadImage(const std::string& name)
+    {
+        const auto& it = m_imageMap.find(name);
+        if (it == m_imageMap.end()) {
+            return false;
+        }
+
+        Image& image = it->second;
+        if (image.m_imageID < static_cast<int>(m_imagedataArray.size()) && m_imagedataArray[image.m_imageID]) {
+            if (image.m_isPadded) {
+                delete[] m_imagedataArray[image.m_imageID];
+            }
+            else {
+                stbi_image_free(m_imagedataArray[image.m_imageID]);
+            }
+            m_imagedataArray[image.m_imageID] = nullptr;
+        }
+
+        //keep the texture name alive so the texture array stays valid
+        const unsigned char pixel[4]{};
+        if (!Helper::Helpers::GetInstance()->m_headless) {
+            glBindTexture(GL_TEXTURE_2D, image.textureID);
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixel);
+            glBindTexture(GL_TEXTURE_2D, 0);
+        }
+
+        m_imageHandles.m_Invalidate(name);
+
+        LOGGING_INFO("Texture Unloaded, Texture ID : {0} ", image.textureID);
+        return true;
+    }
+
     int ImageManager::m_extractStripCountFromFilename(const std::string& filename)
     {
         // Use regex to find the strip count in the format "something_strip(number).png"
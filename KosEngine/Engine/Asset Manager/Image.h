@@ -19,6 +19,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #define IMAGE_H
 
 #include "../Config/pch.h"
+#include "AssetHandle.h"
 
 
 namespace image {
@@ -48,6 +49,17 @@ namespace image {
 		unsigned int textureID{};
 	};
 
+	/**
+	 * @struct DecodedImage
+	 * @brief Raw pixels decoded off the main thread, waiting to be uploaded.
+	 */
+	struct DecodedImage {
+		int m_width{};
+		int m_height{};
+		int m_channels{};
+		unsigned char* m_data{}; ///< stb_image allocation, freed by the image manager.
+	};
+
 
 
 
@@ -68,6 +80,44 @@ namespace image {
 		 * the AssetManager's containers for later use.
 		 */
         unsigned int m_LoadImage(const char* file);
+		/**
+		 * @brief Decodes an image file without touching OpenGL or the image map.
+		 *
+		 * @param file Path to the image file.
+		 * @param decoded Receives the decoded pixels.
+		 * @return bool True if the file was decoded.
+		 *
+		 * Safe to call from a worker thread, used by the asset watcher so that
+		 * only the texture upload is left for the main thread.
+		 */
+		static bool m_DecodeImage(const std::string& file, DecodedImage& decoded);
+		/**
+		 * @brief Frees pixels returned by m_DecodeImage that were not consumed.
+		 */
+		static void m_FreeDecodedImage(DecodedImage& decoded);
+		/**
+		 * @brief Swaps the pixels of an already loaded image for freshly decoded ones.
+		 *
+		 * @param file Path to the image file.
+		 * @param decoded Pixels decoded by m_DecodeImage, ownership is taken.
+		 * @return bool False if the image was never loaded.
+		 *
+		 * The image keeps its texture ID and image ID so that the texture array and
+		 * the render data stay valid, the texture is re-uploaded in place and the
+		 * image's handle generation is bumped.
+		 */
+		bool m_ReloadImage(const std::string& file, DecodedImage& decoded);
+		/**
+		 * @brief Releases the pixels of a loaded image.
+		 *
+		 * @param name File name of the image.
+		 * @return bool False if the image was never loaded.
+		 *
+		 * The image keeps its map entry, texture ID and image ID so that it can be
+		 * brought back with m_ReloadImage, the texture shrinks to a single pixel
+		 * and the image's handle is invalidated.
+		 */
+		bool m_UnloadImage(const std::string& name);
 		/**
 		 * @brief Extracts the strip count from the filename using regex.
 		 *
@@ -114,6 +164,12 @@ namespace image {
 		
 		std::unordered_map<std::string, Image> m_imageMap;
 		std::vector<unsigned char*> m_imagedataArray;
+
+		/**
+		 * @brief Handle table pointing into m_imageMap, components keep a handle
+		 * resolved from their image name instead of searching the map every frame.
+		 */
+		assetmanager::AssetHandleTable<Image> m_imageHandles;
     };
 }
 
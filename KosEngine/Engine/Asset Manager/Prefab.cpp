@@ -19,6 +19,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 #include "../Config/pch.h"
 #include "Prefab.h"
+#include "PrefabIndex.h"
 #include "../De&Serialization/json_handler.h"
 #include "../Debugging/Logging.h"
 #include "AssetManager.h"
@@ -98,9 +99,11 @@ namespace prefab {
             nc->m_prefabName = prefabscene;
 
             const auto& vecChild = ecs::Hierachy::m_GetChild(id);
-            if (!vecChild.has_value()) continue;
-            AssignPrefabToNameComponent(id, prefabscene);
-        
+            if (vecChild.has_value()) {
+                AssignPrefabToNameComponent(id, prefabscene);
+            }
+
+            PrefabIndex::m_GetInstance()->m_RegisterHierachy(id);
         }
 
         return vecid[0];
@@ -154,6 +157,7 @@ namespace prefab {
             outputFile << writeBuffer.GetString();
             outputFile.close();
         }
+        assetmanager::AssetManager::m_funcGetInstance()->m_assetWatcher.m_SuppressPath(path);
 
         LOGGING_INFO("Save Prefab Successful");
 
@@ -184,43 +188,8 @@ namespace prefab {
 
     void Prefab::m_UpdateAllPrefabEntity(std::string prefab)
     {
-        ecs::ECS* ecs = ecs::ECS::m_GetInstance();
-
-        //return if prefab dont exist
-        if (ecs->m_ECS_SceneMap.find(prefab) == ecs->m_ECS_SceneMap.end()) {
-            LOGGING_ERROR("Prefab do not exist");
-        }
-
-        ecs::EntityID scenePrefabID = ecs->m_ECS_SceneMap.find(prefab)->second.m_prefabID;
-
-
-        //retrieve prefabs children id
-        const std::vector<ecs::EntityID>& childrenid = ecs->m_ECS_SceneMap.find(prefab)->second.m_sceneIDs;
-
-        //the most scuff way //MAYBE prefab component?
-        for (auto& id : ecs->m_ECS_EntityMap) {
-            ecs::NameComponent* nc = static_cast<ecs::NameComponent*>(ecs->m_ECS_CombinedComponentPool[ecs::TYPENAMECOMPONENT]->m_GetEntityComponent(id.first));
-            ecs::TransformComponent* tc = static_cast<ecs::TransformComponent*>(ecs->m_ECS_CombinedComponentPool[ecs::TYPETRANSFORMCOMPONENT]->m_GetEntityComponent(id.first));
-            if (nc->m_isPrefab && (nc->m_prefabName == prefab)) {
-                //if sync is turn off, skip update
-                if (nc->m_syncPrefab == false) continue;
-
-
-                //skip all prefabs children
-                if (std::find(childrenid.begin(), childrenid.end(), id.first) != childrenid.end()) continue;
-                if (tc->m_haveParent) {
-                    auto* parentnc = static_cast<ecs::NameComponent*>(ecs->m_ECS_CombinedComponentPool[ecs::TYPENAMECOMPONENT]->m_GetEntityComponent(tc->m_parentID));
-                    
-                    if (parentnc->m_isPrefab && parentnc->m_prefabName == prefab)continue;
-                }
-
-                m_UpdatePrefab(scenePrefabID, id.first);
-
-            }
-
-
-        }
-
+        //only the instances of the prefab, and only what changed since the last update
+        PrefabIndex::m_GetInstance()->m_Propagate(prefab);
     }
 
     void Prefab::m_UpdatePrefab(ecs::EntityID sceneprefabID, ecs::EntityID entityid, bool isPrefabChild)
@@ -229,6 +198,7 @@ namespace prefab {
 
         //update all of entity with prefab
         ecs::ECS* ecs = ecs::ECS::m_GetInstance();
+        ecs->m_MarkDirty(entityid);
 
         ecs::compSignature scenePrefabSignature = ecs->m_ECS_EntityMap.find(sceneprefabID)->second;
         ecs::compSignature entitySignature = ecs->m_ECS_EntityMap.find(entityid)->second;
@@ -251,6 +221,7 @@ namespace prefab {
 
                 nc->m_Layer = prefabNc->m_Layer;
                 nc->m_entityTag = prefabNc->m_entityTag;
+                ecs->m_UpdateTag(entityid);
 
                 continue;
             }
@@ -331,6 +302,7 @@ namespace prefab {
 
                     nc->m_isPrefab = true;
                     nc->m_prefabName = scenes::SceneManager::GetSceneByEntityID(prefabchild).value();
+                    PrefabIndex::m_GetInstance()->m_Register(entityChild);
 
                     ecs::Hierachy::m_SetParent(entityid, entityChild);
                 }
@@ -372,6 +344,7 @@ namespace prefab {
             nc->m_isPrefab = true;
             nc->m_prefabName = prefabscene;
         }
+        PrefabIndex::m_GetInstance()->m_Register(id);
 
         const auto& child = ecs::Hierachy::m_GetChild(id);
         if (child.has_value()) {
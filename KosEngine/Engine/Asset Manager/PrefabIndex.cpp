@@ -0,0 +1,276 @@
+/******************************************************************/
+/*!
+\file      PrefabIndex.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      March 28, 2025
+\brief     This file contains the definitions of the PrefabIndex class.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include "../Config/pch.h"
+#include "PrefabIndex.h"
+#include "Prefab.h"
+#include "SceneManager.h"
+#include "../ECS/ECS.h"
+#include "../ECS/Hierachy.h"
+#include "../Debugging/Logging.h"
+
+namespace prefab {
+
+	std::unique_ptr<PrefabIndex> PrefabIndex::m_InstancePtr = nullptr;
+
+	//bits of the reflected members with the given name
+	template <typename T>
+	static uint64_t MemberMask(std::initializer_list<std::string> names) {
+		uint64_t mask{};
+		const auto& members = T::Names();
+		for (size_t n{}; n < members.size(); n++) {
+			if (std::find(names.begin(), names.end(), members[n]) != names.end()) {
+				mask |= 1ull << n;
+			}
+		}
+		return mask;
+	}
+
+	void PrefabIndex::m_Register(ecs::EntityID id)
+	{
+		ecs::ECS* ecs = ecs::ECS::m_GetInstance();
+		if (!ecs->m_IsValidEntity(id)) return;
+
+		ecs::NameComponent* nc = ecs->m_GetComponent<ecs::NameComponent>(id);
+		if (!nc || !nc->m_isPrefab || nc->m_prefabName.empty()) return;
+
+		m_members[nc->m_prefabName].insert(id);
+	}
+
+	void PrefabIndex::m_RegisterHierachy(ecs::EntityID id)
+	{
+		m_Register(id);
+
+		const auto& child = ecs::Hierachy::m_GetChild(id);
+		if (!child.has_value()) return;
+		for (auto childID : child.value()) {
+			m_RegisterHierachy(childID);
+		}
+	}
+
+	std::vector<ecs::EntityID> PrefabIndex::m_GetInstances(const std::string& prefab)
+	{
+		std::vector<ecs::EntityID> instances;
+
+		const auto& membersIt = m_members.find(prefab);
+		if (membersIt == m_members.end()) return instances;
+
+		ecs::ECS* ecs = ecs::ECS::m_GetInstance();
+		auto& members = membersIt->second;
+		for (auto it = members.begin(); it != members.end();) {
+			const ecs::EntityID id = *it;
+
+			ecs::NameComponent* nc = ecs->m_IsValidEntity(id) ? ecs->m_GetComponent<ecs::NameComponent>(id) : nullptr;
+			if (!nc || !nc->m_isPrefab || nc->m_prefabName != prefab) {
+				it = members.erase(it);
+				continue;
+			}
+			++it;
+
+			//parked pool instances are reset when they are acquired
+			const std::string* scene = ecs->m_GetEntityScene(id);
+			if (scene->empty() || *scene == prefab) continue;
+
+			//if sync is turn off, skip update
+			if (!nc->m_syncPrefab) continue;
+
+			//children are updated with their root
+			const auto& parent = ecs::Hierachy::m_GetParent(id);
+			if (parent.has_value()) {
+				ecs::NameComponent* parentnc = ecs->m_GetComponent<ecs::NameComponent>(parent.value());
+				if (parentnc && parentnc->m_isPrefab && parentnc->m_prefabName == prefab) continue;
+			}
+
+			instances.push_back(id);
+		}
+
+		return instances;
+	}
+
+	void PrefabIndex::m_CollectTree(ecs::EntityID id, std::vector<ecs::EntityID>& entities, std::vector<size_t>& childCount)
+	{
+		const size_t position = entities.size();
+		entities.push_back(id);
+		childCount.push_back(0);
+
+		const auto& child = ecs::Hierachy::m_GetChild(id);
+		if (!child.has_value()) return;
+
+		childCount[position] = child.value().size();
+		for (auto childID : child.value()) {
+			m_CollectTree(childID, entities, childCount);
+		}
+	}
+
+	bool PrefabIndex::m_MatchesTree(const Baseline& baseline, const std::vector<ecs::EntityID>& entities, const std::vector<size_t>& childCount)
+	{
+		if (childCount != baseline.m_childCount) return false;
+
+		ecs::ECS* ecs = ecs::ECS::m_GetInstance();
+		for (size_t n{}; n < entities.size(); n++) {
+			if (ecs->m_ECS_EntityMap.find(entities[n])->second != baseline.m_signatures[n]) return false;
+		}
+		return true;
+	}
+
+	void PrefabIndex::m_Capture(Baseline& baseline, ecs::EntityID source)
+	{
+		ecs::ECS* ecs = ecs::ECS::m_GetInstance();
+
+		baseline.m_source = source;
+		baseline.m_entities.clear();
+		baseline.m_childCount.clear();
+		m_CollectTree(source, baseline.m_entities, baseline.m_childCount);
+
+		baseline.m_signatures.clear();
+		for (ecs::EntityID id : baseline.m_entities) {
+			baseline.m_signatures.push_back(ecs->m_ECS_EntityMap.find(id)->second);
+		}
+
+		for (size_t n{}; n < ecs::TOTALTYPECOMPONENT; n++) {
+			ComponentBlock& block = baseline.m_components[n];
+			block.m_owners.clear();
+
+			std::vector<ecs::EntityID> owners;
+			for (uint32_t position{}; position < baseline.m_entities.size(); position++) {
+				if (baseline.m_signatures[position].test(n)) {
+					block.m_owners.push_back(position);
+					owners.push_back(baseline.m_entities[position]);
+				}
+			}
+
+			block.m_copies = owners.empty() ? nullptr : ecs->m_ECS_CombinedComponentPool[(ecs::ComponentType)n]->m_CopyComponents(owners);
+		}
+	}
+
+	void PrefabIndex::m_ApplyChanges(ecs::ComponentType type, ecs::EntityID source, ecs::EntityID target, uint64_t changes, bool isRoot)
+	{
+		ecs::ECS* ecs = ecs::ECS::m_GetInstance();
+		const auto& pool = ecs->m_ECS_CombinedComponentPool[type];
+
+		//same rules as Prefab::m_UpdatePrefab, instances keep their name and root position
+		if (type == ecs::TYPENAMECOMPONENT) {
+			static const uint64_t shared = MemberMask<ecs::NameComponent>({ "m_Layer", "m_entityTag" });
+			if (changes & shared) {
+				pool->m_CopyMembers(source, target, changes & shared);
+			}
+			return;
+		}
+
+		if (type == ecs::TYPETRANSFORMCOMPONENT) {
+			static const uint64_t shared = MemberMask<ecs::TransformComponent>({ "m_position", "m_rotation", "m_scale" });
+			if (!isRoot && (changes & shared)) {
+				pool->m_CopyMembers(source, target, changes & shared);
+			}
+			return;
+		}
+
+		if (changes & ecs::IComponentPool::m_otherMembers) {
+			ecs::Component* comp = static_cast<ecs::Component*>(pool->m_DuplicateComponent(source, target));
+			comp->m_scene = *ecs->m_GetEntityScene(target);
+			return;
+		}
+
+		pool->m_CopyMembers(source, target, changes);
+	}
+
+	size_t PrefabIndex::m_Propagate(const std::string& prefab)
+	{
+		ecs::ECS* ecs = ecs::ECS::m_GetInstance();
+
+		const auto& sceneIt = ecs->m_ECS_SceneMap.find(prefab);
+		if (sceneIt == ecs->m_ECS_SceneMap.end()) {
+			LOGGING_ERROR("Prefab do not exist");
+			return 0;
+		}
+
+		const ecs::EntityID source = sceneIt->second.m_prefabID;
+		if (!ecs->m_IsValidEntity(source)) return 0;
+
+		const std::vector<ecs::EntityID> instances = m_GetInstances(prefab);
+
+		Baseline& baseline = m_baselines[prefab];
+
+		std::vector<ecs::EntityID> sourceTree;
+		std::vector<size_t> sourceChildCount;
+		m_CollectTree(source, sourceTree, sourceChildCount);
+
+		//a new prefab or a change to its hierachy updates every instance in full
+		const bool rebuild = baseline.m_source != source || baseline.m_entities != sourceTree || !m_MatchesTree(baseline, sourceTree, sourceChildCount);
+
+		std::array<std::vector<uint64_t>, ecs::TOTALTYPECOMPONENT> changes;
+		bool changed{ false };
+		if (!rebuild) {
+			for (size_t n{}; n < ecs::TOTALTYPECOMPONENT; n++) {
+				const ComponentBlock& block = baseline.m_components[n];
+				if (!block.m_copies) continue;
+
+				std::vector<ecs::EntityID> owners;
+				owners.reserve(block.m_owners.size());
+				for (uint32_t position : block.m_owners) {
+					owners.push_back(sourceTree[position]);
+				}
+
+				changes[n] = ecs->m_ECS_CombinedComponentPool[(ecs::ComponentType)n]->m_DiffComponents(block.m_copies, owners);
+				changed = changed || std::any_of(changes[n].begin(), changes[n].end(), [](uint64_t change) { return change != 0; });
+			}
+		}
+
+		size_t updated{};
+		std::vector<ecs::EntityID> instanceTree;
+		std::vector<size_t> instanceChildCount;
+		for (ecs::EntityID instance : instances) {
+			if (!rebuild && baseline.m_synced.find(instance) != baseline.m_synced.end()) {
+				if (!changed) continue;
+
+				instanceTree.clear();
+				instanceChildCount.clear();
+				m_CollectTree(instance, instanceTree, instanceChildCount);
+
+				if (m_MatchesTree(baseline, instanceTree, instanceChildCount)) {
+					for (size_t n{}; n < ecs::TOTALTYPECOMPONENT; n++) {
+						const ComponentBlock& block = baseline.m_components[n];
+						for (size_t k{}; k < changes[n].size(); k++) {
+							if (changes[n][k] == 0) continue;
+
+							const uint32_t position = block.m_owners[k];
+							m_ApplyChanges((ecs::ComponentType)n, sourceTree[position], instanceTree[position], changes[n][k], position == 0);
+							ecs->m_MarkDirty(instanceTree[position]);
+						}
+					}
+
+					updated++;
+					continue;
+				}
+			}
+
+			Prefab::m_UpdatePrefab(source, instance);
+			updated++;
+		}
+
+		if (rebuild || changed) {
+			m_Capture(baseline, source);
+		}
+
+		baseline.m_synced.clear();
+		baseline.m_synced.insert(instances.begin(), instances.end());
+
+		return updated;
+	}
+
+	void PrefabIndex::m_Forget(const std::string& prefab)
+	{
+		m_baselines.erase(prefab);
+	}
+
+}
@@ -0,0 +1,131 @@
+/******************************************************************/
+/*!
+\file      PrefabIndex.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      March 28, 2025
+\brief     This file contains the PrefabIndex class, which keeps track
+		   of the instances of each prefab so an edit to a prefab does
+		   not scan every entity in the ECS.
+
+		   Entities are registered whenever they are linked to a prefab,
+		   when a prefab is instantiated, an entity is duplicated or
+		   loaded from a scene file. Entries that are deleted or
+		   unlinked are dropped the next time the prefab is looked up.
+
+		   For each prefab the index also keeps a copy of the prefab's
+		   components as they were last propagated. Propagating diffs
+		   the prefab against that copy and writes only the changed
+		   members to the instances, so values an instance overrides
+		   are kept unless the prefab changes the same value. Instances
+		   that were never synced, or whose hierarchy no longer matches
+		   the prefab, are fully updated with Prefab::m_UpdatePrefab.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#ifndef PREFABINDEX_H
+#define PREFABINDEX_H
+
+#include "../Config/pch.h"
+#include "../ECS/ECSList.h"
+
+namespace prefab {
+
+	class PrefabIndex {
+
+	public:
+		static PrefabIndex* m_GetInstance() {
+			if (!m_InstancePtr) {
+				m_InstancePtr.reset(new PrefabIndex{});
+			}
+			return m_InstancePtr.get();
+		}
+
+		/******************************************************************/
+		/*!
+			\fn        void m_Register(ecs::EntityID id)
+			\brief     Adds the entity to the index of the prefab its name
+					   component links it to, does nothing if it is not
+					   linked to a prefab.
+		*/
+		/******************************************************************/
+		void m_Register(ecs::EntityID id);
+
+		/******************************************************************/
+		/*!
+			\fn        void m_RegisterHierachy(ecs::EntityID id)
+			\brief     Registers the entity and all of its children.
+		*/
+		/******************************************************************/
+		void m_RegisterHierachy(ecs::EntityID id);
+
+		/******************************************************************/
+		/*!
+			\fn        std::vector<ecs::EntityID> m_GetInstances(const std::string& prefab)
+			\brief     Root entities of the prefab's instances that are in a
+					   scene and have sync turned on. The prefab's own
+					   entities and children of an instance are left out.
+		*/
+		/******************************************************************/
+		std::vector<ecs::EntityID> m_GetInstances(const std::string& prefab);
+
+		/******************************************************************/
+		/*!
+			\fn        size_t m_Propagate(const std::string& prefab)
+			\brief     Writes the changes made to a prefab since the last
+					   call to all of its instances.
+			\return    Number of instances that were written to.
+		*/
+		/******************************************************************/
+		size_t m_Propagate(const std::string& prefab);
+
+		/******************************************************************/
+		/*!
+			\fn        void m_Forget(const std::string& prefab)
+			\brief     Drops the copy of an unloaded prefab, its instances
+					   are fully updated the next time it is propagated.
+		*/
+		/******************************************************************/
+		void m_Forget(const std::string& prefab);
+
+	private:
+
+		struct ComponentBlock {
+			//positions in the subtree of the entities owning the component
+			std::vector<uint32_t> m_owners;
+			std::shared_ptr<void> m_copies;
+		};
+
+		struct Baseline {
+			ecs::EntityID m_source{};
+			//prefab subtree, parents before their children
+			std::vector<ecs::EntityID> m_entities;
+			std::vector<size_t> m_childCount;
+			std::vector<ecs::compSignature> m_signatures;
+			std::array<ComponentBlock, ecs::TOTALTYPECOMPONENT> m_components;
+			//instances that received the last propagation
+			std::unordered_set<ecs::EntityID> m_synced;
+		};
+
+		static void m_CollectTree(ecs::EntityID id, std::vector<ecs::EntityID>& entities, std::vector<size_t>& childCount);
+
+		static bool m_MatchesTree(const Baseline& baseline, const std::vector<ecs::EntityID>& entities, const std::vector<size_t>& childCount);
+
+		static void m_Capture(Baseline& baseline, ecs::EntityID source);
+
+		static void m_ApplyChanges(ecs::ComponentType type, ecs::EntityID source, ecs::EntityID target, uint64_t changes, bool isRoot);
+
+		static std::unique_ptr<PrefabIndex> m_InstancePtr;
+
+		//entities linked to each prefab scene
+		std::unordered_map<std::string, std::unordered_set<ecs::EntityID>> m_members;
+
+		std::unordered_map<std::string, Baseline> m_baselines;
+	};
+
+}
+
+#endif PREFABINDEX_H
@@ -0,0 +1,352 @@
+/******************************************************************/
+/*!
+\file      PrefabPool.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      March 20, 2025
+\brief     This file contains the definitions of the PrefabPool class.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include "../Config/pch.h"
+#include "PrefabPool.h"
+#include "PrefabIndex.h"
+#include "Prefab.h"
+#include "SceneManager.h"
+#include "AssetManager.h"
+#include "../ECS/ECS.h"
+#include "../ECS/Hierachy.h"
+#include "../Debugging/Logging.h"
+
+namespace prefab {
+
+	std::unique_ptr<PrefabPool> PrefabPool::m_InstancePtr = nullptr;
+
+	//entity followed by all of its children
+	static void CollectHierachy(ecs::EntityID id, std::vector<ecs::EntityID>& entities) {
+		entities.push_back(id);
+
+		const auto& child = ecs::Hierachy::m_GetChild(id);
+		if (!child.has_value()) return;
+		for (auto childID : child.value()) {
+			CollectHierachy(childID, entities);
+		}
+	}
+
+	std::string PrefabPool::m_FindInsertScene()
+	{
+		ecs::ECS* ecs = ecs::ECS::m_GetInstance();
+		for (auto& scene : ecs->m_ECS_SceneMap) {
+			if (scene.second.m_isActive && (!scene.second.m_isPrefab)) {
+				return scene.first;
+			}
+		}
+		return {};
+	}
+
+	size_t PrefabPool::m_Prewarm(const std::string& prefabscene, size_t count, std::string insertscene)
+	{
+		if (insertscene.empty()) {
+			insertscene = m_FindInsertScene();
+		}
+
+		std::vector<ecs::EntityID>& parked = m_parked[prefabscene];
+		while (parked.size() < count) {
+			int id = Prefab::m_CreatePrefab(prefabscene, insertscene);
+			if (id < 0) break;
+
+			m_Park(static_cast<ecs::EntityID>(id));
+			parked.push_back(static_cast<ecs::EntityID>(id));
+		}
+
+		return parked.size();
+	}
+
+	int PrefabPool::m_Acquire(const std::string& prefabscene, const vector2::Vec2& position, float rotation, std::string insertscene)
+	{
+		ecs::ECS* ecs = ecs::ECS::m_GetInstance();
+
+		const auto& prefabIt = ecs->m_ECS_SceneMap.find(prefabscene);
+		if (prefabIt == ecs->m_ECS_SceneMap.end()) {
+			LOGGING_ERROR("Prefab not loaded into scene");
+			return -1;
+		}
+
+		if (insertscene.empty()) {
+			insertscene = m_FindInsertScene();
+		}
+		if (ecs->m_ECS_SceneMap.find(insertscene) == ecs->m_ECS_SceneMap.end()) {
+			LOGGING_ERROR("No scene to insert prefab");
+			return -1;
+		}
+
+		const ecs::EntityID source = prefabIt->second.m_prefabID;
+
+		bool reused = false;
+		ecs::EntityID id{};
+		std::vector<ecs::EntityID>& parked = m_parked[prefabscene];
+		while (!parked.empty()) {
+			ecs::EntityID candidate = parked.back();
+			parked.pop_back();
+
+			if (!ecs->m_IsValidEntity(candidate)) continue;
+
+			//prefab gained or lost children since the instance was made
+			if (!m_MatchesPrefab(source, candidate)) {
+				ecs->m_DeleteEntity(candidate);
+				continue;
+			}
+
+			m_Unpark(candidate, insertscene);
+			m_Reset(source, candidate);
+			id = candidate;
+			reused = true;
+			break;
+		}
+
+		if (!reused) {
+			int created = Prefab::m_CreatePrefab(prefabscene, insertscene);
+			if (created < 0) return -1;
+			id = static_cast<ecs::EntityID>(created);
+		}
+
+		ecs::TransformComponent* transform = ecs->m_GetComponent<ecs::TransformComponent>(id);
+		transform->m_position = position;
+		transform->m_rotation = rotation;
+
+		//new instances are awoken by the logic system
+		if (reused) {
+			m_WakeScripts(id);
+		}
+
+		m_active[id] = prefabscene;
+
+		return static_cast<int>(id);
+	}
+
+	bool PrefabPool::m_Release(ecs::EntityID id)
+	{
+		ecs::ECS* ecs = ecs::ECS::m_GetInstance();
+
+		const auto& activeIt = m_active.find(id);
+		if (activeIt == m_active.end() || !ecs->m_IsValidEntity(id) || ecs->m_IsPendingDelete(id)) {
+			if (activeIt != m_active.end()) {
+				m_active.erase(activeIt);
+			}
+
+			//not pooled, destroy as usual
+			ecs->m_QueueDeleteEntity(id);
+			return false;
+		}
+
+		std::string prefabscene = std::move(activeIt->second);
+		m_active.erase(activeIt);
+
+		if (ecs->m_ECS_SceneMap.find(prefabscene) == ecs->m_ECS_SceneMap.end()) {
+			ecs->m_QueueDeleteEntity(id);
+			return false;
+		}
+
+		m_Park(id);
+		m_parked[prefabscene].push_back(id);
+
+		return true;
+	}
+
+	void PrefabPool::m_ReleaseScene(const std::string& scene)
+	{
+		ecs::ECS* ecs = ecs::ECS::m_GetInstance();
+
+		//instances in the scene are deleted with it
+		for (auto it = m_active.begin(); it != m_active.end();) {
+			const std::string* entityScene = ecs->m_GetEntityScene(it->first);
+			if (!entityScene || *entityScene == scene) {
+				it = m_active.erase(it);
+			}
+			else {
+				++it;
+			}
+		}
+
+		const auto& parkedIt = m_parked.find(scene);
+		if (parkedIt == m_parked.end()) return;
+
+		ecs->m_DeleteEntities(parkedIt->second);
+		m_parked.erase(parkedIt);
+	}
+
+	void PrefabPool::m_Clear()
+	{
+		ecs::ECS* ecs = ecs::ECS::m_GetInstance();
+
+		std::vector<ecs::EntityID> entities;
+		for (auto& [prefabscene, parked] : m_parked) {
+			entities.insert(entities.end(), parked.begin(), parked.end());
+		}
+		ecs->m_DeleteEntities(entities);
+
+		m_parked.clear();
+		m_active.clear();
+	}
+
+	size_t PrefabPool::m_GetParkedCount(const std::string& prefabscene) const
+	{
+		const auto& parkedIt = m_parked.find(prefabscene);
+		return parkedIt == m_parked.end() ? 0 : parkedIt->second.size();
+	}
+
+	bool PrefabPool::m_MatchesPrefab(ecs::EntityID source, ecs::EntityID instance)
+	{
+		const auto& sourceChild = ecs::Hierachy::m_GetChild(source);
+		const auto& instanceChild = ecs::Hierachy::m_GetChild(instance);
+
+		const size_t sourceCount = sourceChild.has_value() ? sourceChild.value().size() : 0;
+		const size_t instanceCount = instanceChild.has_value() ? instanceChild.value().size() : 0;
+		if (sourceCount != instanceCount) return false;
+
+		for (size_t n{}; n < sourceCount; n++) {
+			if (!m_MatchesPrefab(sourceChild.value()[n], instanceChild.value()[n])) return false;
+		}
+
+		return true;
+	}
+
+	void PrefabPool::m_Reset(ecs::EntityID source, ecs::EntityID instance)
+	{
+		ecs::ECS* ecs = ecs::ECS::m_GetInstance();
+
+		const ecs::compSignature sourceSignature = ecs->m_ECS_EntityMap.find(source)->second;
+		const std::string scene = *ecs->m_GetEntityScene(instance);
+		ecs->m_MarkDirty(instance);
+
+		for (size_t n{}; n < ecs::TOTALTYPECOMPONENT; n++) {
+			const ecs::ComponentType type = (ecs::ComponentType)n;
+			const bool instanceHas = ecs->m_ECS_EntityMap.find(instance)->second.test(type);
+
+			//drop components added at runtime
+			if (!sourceSignature.test(type)) {
+				if (instanceHas) {
+					ecs->m_RemoveComponent(type, instance);
+				}
+				continue;
+			}
+
+			if (!instanceHas) {
+				ecs->m_AddComponent(type, instance);
+			}
+
+			//only TRS, parent and child links stay
+			if (type == ecs::TYPETRANSFORMCOMPONENT) {
+				ecs::TransformComponent* tc = ecs->m_GetComponent<ecs::TransformComponent>(instance);
+				ecs::TransformComponent* prefabtc = ecs->m_GetComponent<ecs::TransformComponent>(source);
+				tc->m_position = prefabtc->m_position;
+				tc->m_rotation = prefabtc->m_rotation;
+				tc->m_scale = prefabtc->m_scale;
+				continue;
+			}
+
+			ecs::Component* comp{};
+			if (type == ecs::TYPESCRIPTCOMPONENT) {
+				//keep the script objects, they are reused
+				ecs::ScriptComponent* sc = ecs->m_GetComponent<ecs::ScriptComponent>(instance);
+				auto instances = std::move(sc->m_scriptInstances);
+				auto handlers = std::move(sc->m_scriptHandler);
+
+				comp = static_cast<ecs::Component*>(ecs->m_ECS_CombinedComponentPool[type]->m_DuplicateComponent(source, instance));
+				sc->m_scriptInstances = std::move(instances);
+				sc->m_scriptHandler = std::move(handlers);
+			}
+			else {
+				comp = static_cast<ecs::Component*>(ecs->m_ECS_CombinedComponentPool[type]->m_DuplicateComponent(source, instance));
+			}
+			comp->m_scene = scene;
+
+			if (type == ecs::TYPENAMECOMPONENT) {
+				ecs::NameComponent* nc = static_cast<ecs::NameComponent*>(comp);
+				nc->m_isPrefab = true;
+				nc->m_prefabName = *ecs->m_GetEntityScene(source);
+				PrefabIndex::m_GetInstance()->m_Register(instance);
+				ecs->m_UpdateTag(instance);
+			}
+		}
+
+		//hierachy was checked by m_MatchesPrefab
+		const auto& sourceChild = ecs::Hierachy::m_GetChild(source);
+		if (!sourceChild.has_value()) return;
+
+		const std::vector<ecs::EntityID> instanceChild = ecs::Hierachy::m_GetChild(instance).value();
+		for (size_t n{}; n < instanceChild.size(); n++) {
+			m_Reset(sourceChild.value()[n], instanceChild[n]);
+		}
+	}
+
+	void PrefabPool::m_WakeScripts(ecs::EntityID instance)
+	{
+		ecs::ECS* ecs = ecs::ECS::m_GetInstance();
+		assetmanager::AssetManager* assetManager = assetmanager::AssetManager::m_funcGetInstance();
+
+		std::vector<ecs::EntityID> entities;
+		CollectHierachy(instance, entities);
+
+		for (ecs::EntityID id : entities) {
+			ecs::ScriptComponent* sc = ecs->m_GetComponent<ecs::ScriptComponent>(id);
+			if (!sc) continue;
+
+			for (auto& [scriptName, script] : sc->m_scriptInstances) {
+				if (!script.first) continue;
+
+				//serialized fields back to the prefab's values, start runs again next update
+				assetManager->m_scriptManager.m_assignVaraiblestoScript(sc, scriptName);
+
+				void* params[1];
+				params[0] = &sc->m_Entity;
+				assetManager->m_scriptManager.m_InvokeMethod(assetManager->m_scriptManager.m_GetClassID(scriptName), script::METHODAWAKE, script.first, params);
+				script.second = false;
+			}
+		}
+	}
+
+	void PrefabPool::m_Park(ecs::EntityID id)
+	{
+		ecs::ECS* ecs = ecs::ECS::m_GetInstance();
+
+		ecs::Hierachy::m_RemoveParent(id);
+
+		std::vector<ecs::EntityID> entities;
+		CollectHierachy(id, entities);
+
+		for (ecs::EntityID entity : entities) {
+			const std::string* scene = ecs->m_GetEntityScene(entity);
+			if (!scene) continue;
+
+			const auto& sceneIt = ecs->m_ECS_SceneMap.find(*scene);
+			if (sceneIt == ecs->m_ECS_SceneMap.end()) continue;
+
+			auto& entityList = sceneIt->second.m_sceneIDs;
+			auto it = std::find(entityList.rbegin(), entityList.rend(), entity);
+			if (it != entityList.rend()) {
+				entityList.erase(std::next(it).base());
+			}
+		}
+
+		//no scene matches an empty name, every system skips the instance
+		scenes::SceneManager::m_GetInstance()->m_AssignEntityNewSceneName(std::string{}, id);
+	}
+
+	void PrefabPool::m_Unpark(ecs::EntityID id, const std::string& scene)
+	{
+		ecs::ECS* ecs = ecs::ECS::m_GetInstance();
+
+		scenes::SceneManager::m_GetInstance()->m_AssignEntityNewSceneName(scene, id);
+
+		std::vector<ecs::EntityID> entities;
+		CollectHierachy(id, entities);
+
+		auto& entityList = ecs->m_ECS_SceneMap.find(scene)->second.m_sceneIDs;
+		entityList.insert(entityList.end(), entities.begin(), entities.end());
+	}
+
+}
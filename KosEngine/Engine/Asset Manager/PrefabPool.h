@@ -0,0 +1,135 @@
+/******************************************************************/
+/*!
+\file      PrefabPool.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      March 20, 2025
+\brief     This file contains the PrefabPool class, pooled instantiation
+		   for prefabs that are spawned and despawned often, such as
+		   bullets and hit effects.
+
+		   A released instance is parked instead of destroyed. It is
+		   taken out of its scene's entity list and its components are
+		   given an empty scene name, so no system updates it, while it
+		   stays registered to its systems and keeps its script
+		   instances. Acquiring it moves it back into a scene and copies
+		   the prefab's component data over it again.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#ifndef PREFABPOOL_H
+#define PREFABPOOL_H
+
+#include "../Config/pch.h"
+#include "../ECS/ECSList.h"
+
+namespace prefab {
+
+	class PrefabPool {
+
+	public:
+		static PrefabPool* m_GetInstance() {
+			if (!m_InstancePtr) {
+				m_InstancePtr.reset(new PrefabPool{});
+			}
+			return m_InstancePtr.get();
+		}
+
+		/******************************************************************/
+		/*!
+			\fn        size_t m_Prewarm(const std::string& prefabscene, size_t count, std::string insertscene = {})
+			\brief     Creates parked instances of a prefab until the pool
+					   holds count of them.
+			\param[in] insertscene Scene the instances are created in before
+					   they are parked, the first active scene if empty.
+			\return    Number of instances parked for the prefab.
+		*/
+		/******************************************************************/
+		size_t m_Prewarm(const std::string& prefabscene, size_t count, std::string insertscene = {});
+
+		/******************************************************************/
+		/*!
+			\fn        int m_Acquire(const std::string& prefabscene, const vector2::Vec2& position, float rotation, std::string insertscene = {})
+			\brief     Activates a parked instance of the prefab, or creates
+					   one if the pool is empty. The instance is reset to the
+					   prefab's data, placed at position and its scripts are
+					   woken up again.
+			\return    ID of the instance's root entity, -1 on error.
+		*/
+		/******************************************************************/
+		int m_Acquire(const std::string& prefabscene, const vector2::Vec2& position, float rotation, std::string insertscene = {});
+
+		/******************************************************************/
+		/*!
+			\fn        bool m_Release(ecs::EntityID id)
+			\brief     Parks an instance given out by m_Acquire. Any other
+					   entity is deleted.
+			\return    True if the entity was returned to its pool.
+		*/
+		/******************************************************************/
+		bool m_Release(ecs::EntityID id);
+
+		/******************************************************************/
+		/*!
+			\fn        void m_ReleaseScene(const std::string& scene)
+			\brief     Called before a scene is cleared, forgets the pooled
+					   instances living in it. Clearing a prefab scene also
+					   deletes the instances parked for it.
+		*/
+		/******************************************************************/
+		void m_ReleaseScene(const std::string& scene);
+
+		/******************************************************************/
+		/*!
+			\fn        void m_Clear()
+			\brief     Deletes every parked instance.
+		*/
+		/******************************************************************/
+		void m_Clear();
+
+		size_t m_GetParkedCount(const std::string& prefabscene) const;
+
+	private:
+
+		/******************************************************************/
+		/*!
+			\fn        bool m_MatchesPrefab(ecs::EntityID source, ecs::EntityID instance)
+			\brief     Checks that the instance has the same child hierarchy
+					   as the prefab, so it can be reset in place.
+		*/
+		/******************************************************************/
+		bool m_MatchesPrefab(ecs::EntityID source, ecs::EntityID instance);
+
+		/******************************************************************/
+		/*!
+			\fn        void m_Reset(ecs::EntityID source, ecs::EntityID instance)
+			\brief     Copies the prefab's components onto the instance,
+					   adding and removing components to match. Hierarchy
+					   links and script instances are kept.
+		*/
+		/******************************************************************/
+		void m_Reset(ecs::EntityID source, ecs::EntityID instance);
+
+		void m_WakeScripts(ecs::EntityID instance);
+
+		void m_Park(ecs::EntityID id);
+
+		void m_Unpark(ecs::EntityID id, const std::string& scene);
+
+		static std::string m_FindInsertScene();
+
+		static std::unique_ptr<PrefabPool> m_InstancePtr;
+
+		//parked instances by prefab scene
+		std::unordered_map<std::string, std::vector<ecs::EntityID>> m_parked;
+
+		//active instances to their prefab scene
+		std::unordered_map<ecs::EntityID, std::string> m_active;
+	};
+
+}
+
+#endif PREFABPOOL_H
@@ -35,6 +35,10 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "../ECS/ECS.h"
 #include "../ECS/Hierachy.h"
 #include "Prefab.h"
+#include "PrefabPool.h"
+#include "PrefabIndex.h"
+#include "AssetManager.h"
+#include "../Helper/Helper.h"
 
 namespace scenes {
 
@@ -72,30 +76,32 @@ namespace scenes {
         return true;
     }
 
-    void SceneManager::m_LoadScene(std::filesystem::path scene)
+    bool SceneManager::m_PrepareLoad(const std::filesystem::path& scene)
     {
         // check if it is json file type
         if (scene.filename().extension().string() != ".json" && scene.filename().extension().string() != ".prefab") {
             LOGGING_WARN("File Type not .json");
-            return;
+            return false;
         }
 
 
         ecs::ECS* ecs = ecs::ECS::m_GetInstance();
-        if (ecs->m_ECS_SceneMap.find(scene.filename().string()) != ecs->m_ECS_SceneMap.end()) {
+        if (ecs->m_ECS_SceneMap.find(scene.filename().string()) != ecs->m_ECS_SceneMap.end() || m_streamer.m_IsStreaming(scene.filename().string())) {
 #if _DEBUG
             LOGGING_WARN("Scene already loaded");
 #endif
-            return;
+            return false;
         }
 
+        //do not read a file that is still being written
+        m_writer.m_Wait(scene.filename().string());
+
         // Ensure the JSON file exists
 
-        std::ifstream checkFile(scene.string());
-        if (!checkFile) {
+        if (!assetmanager::VirtualFileSystem::m_GetInstance()->m_Exists(scene)) {
             if (!m_CreateNewScene(scene)) {
                 LOGGING_ERROR("Fail to Create file");
-                return;
+                return false;
             }
    
         }
@@ -116,19 +122,14 @@ namespace scenes {
             }
         }
 
+        return true;
+    }
 
-        std::string scenename = scene.filename().string();
-
-        //create new scene
-        ecs->m_ECS_SceneMap[scenename];
-        //check if file is prefab or scene
-
-            
-        // Load entities from the JSON file
-        LOGGING_INFO("Loading entities from: {}", scene.string().c_str());
-        Serialization::Serialize::m_LoadComponentsJson(scene.string());  // Load into ECS
+    void SceneManager::m_FinishLoad(const std::string& scenename)
+    {
+        ecs::ECS* ecs = ecs::ECS::m_GetInstance();
 
-        if (scene.filename().extension().string() == ".prefab") {
+        if (std::filesystem::path(scenename).extension().string() == ".prefab") {
             ecs->m_ECS_SceneMap.find(scenename)->second.m_isPrefab = true;
             ecs->m_ECS_SceneMap.find(scenename)->second.m_isActive = false;
 
@@ -151,9 +152,69 @@ namespace scenes {
         }
         isSceneChanged = true;
 
+        assetmanager::AssetManager::m_funcGetInstance()->m_residency.m_AcquireScene(scenename);
+
         LOGGING_INFO("Entities successfully loaded!");
     }
 
+    void SceneManager::m_LoadScene(std::filesystem::path scene)
+    {
+        if (!m_PrepareLoad(scene)) return;
+
+        ecs::ECS* ecs = ecs::ECS::m_GetInstance();
+        std::string scenename = scene.filename().string();
+
+        //create new scene
+        ecs->m_ECS_SceneMap[scenename];
+        //check if file is prefab or scene
+
+            
+        // Load entities from the JSON file
+        LOGGING_INFO("Loading entities from: {}", scene.string().c_str());
+        ecs->m_BeginRegistrationBatch();
+        Serialization::Serialize::m_LoadComponentsJson(scene.string());  // Load into ECS
+        ecs->m_EndRegistrationBatch();
+
+        m_FinishLoad(scenename);
+    }
+
+    void SceneManager::m_LoadSceneAsync(std::filesystem::path scene)
+    {
+        //prefabs are small and needed right away, headless runs load on the frame asked so every run matches
+        if (scene.filename().extension().string() == ".prefab" || Helper::Helpers::GetInstance()->m_headless) {
+            m_LoadScene(scene);
+            return;
+        }
+
+        if (!m_PrepareLoad(scene)) return;
+
+        LOGGING_INFO("Streaming entities from: {}", scene.string().c_str());
+        m_streamer.m_Begin(scene);
+    }
+
+    void SceneManager::m_UpdateStreaming()
+    {
+        for (const auto& scenename : m_streamer.m_Update()) {
+            m_FinishLoad(scenename);
+        }
+    }
+
+    void SceneManager::m_UpdateSaving()
+    {
+        //the editor wrote the file, do not hot reload it
+        for (const auto& path : m_writer.m_Update()) {
+            assetmanager::AssetManager::m_funcGetInstance()->m_assetWatcher.m_SuppressPath(path);
+        }
+    }
+
+    float SceneManager::m_GetLoadProgress(const std::string& scene) const
+    {
+        const float progress = m_streamer.m_GetProgress(scene);
+        if (progress >= 0.f) return progress;
+
+        return ecs::ECS::m_GetInstance()->m_ECS_SceneMap.count(scene) ? 1.f : 0.f;
+    }
+
     void SceneManager::m_ReloadScene()
     {
         //retrieve open scenes
@@ -196,6 +257,9 @@ namespace scenes {
             m_ClearScene(scenes);
         }
 
+        //parked instances belong to no scene
+        prefab::PrefabPool::m_GetInstance()->m_Clear();
+
 
     }
 
@@ -203,16 +267,29 @@ namespace scenes {
     {
         ecs::ECS* ecs = ecs::ECS::m_GetInstance();
 
-        size_t numberOfEntityInScene = ecs->m_ECS_SceneMap.find(scene)->second.m_sceneIDs.size();
-        for (int n{}; n < numberOfEntityInScene; n++) {
-            if (ecs->m_ECS_SceneMap.find(scene)->second.m_sceneIDs.size() <= 0) break;
-            auto entityid = ecs->m_ECS_SceneMap.find(scene)->second.m_sceneIDs.begin();
-            if (!ecs::Hierachy::m_GetParent(*entityid)) {
-                ecs->m_DeleteEntity(*entityid);
+        m_streamer.m_Cancel(scene);
+        m_writer.m_Forget(scene);
+        if (ecs->m_ECS_SceneMap.find(scene) == ecs->m_ECS_SceneMap.end()) return;
+
+        prefab::PrefabPool::m_GetInstance()->m_ReleaseScene(scene);
+        prefab::PrefabIndex::m_GetInstance()->m_Forget(scene);
+
+        //delete the whole scene in one batch, the list is copied as it is compacted
+        const std::vector<ecs::EntityID> entities = ecs->m_ECS_SceneMap.find(scene)->second.m_sceneIDs;
+        ecs->m_DeleteEntities(entities);
+
+
+        assetmanager::AssetManager::m_funcGetInstance()->m_residency.m_ReleaseScene(scene);
+
+        for (auto it = m_snapshots.begin(); it != m_snapshots.end();) {
+            if (it->second.m_GetScene() == scene) {
+                it = m_snapshots.erase(it);
+            }
+            else {
+                ++it;
             }
         }
 
-
         //remove scene from activescenes
         ecs->m_ECS_SceneMap.erase(scene);
 
@@ -222,7 +299,7 @@ namespace scenes {
     {
         const auto& scenepath = m_loadScenePath.find(scene);
         if (scenepath != m_loadScenePath.end()) {
-            Serialization::Serialize::m_SaveComponentsJson(scenepath->second.string());
+            m_writer.m_Save(scenepath->second);
         }
        
 
@@ -241,15 +318,38 @@ namespace scenes {
 
     std::optional<std::string> SceneManager::GetSceneByEntityID(ecs::EntityID entityID) {
         ecs::ECS* ecs = ecs::ECS::m_GetInstance();
-        for (const auto& [sceneName, entityList] : ecs->m_ECS_SceneMap) {
-            // Check if the entityID is in the current vector of entity IDs
-            if (std::find(entityList.m_sceneIDs.begin(), entityList.m_sceneIDs.end(), entityID) != entityList.m_sceneIDs.end()) {
-                return sceneName;  // Found the matching scene name
-            }
+        const std::string* scene = ecs->m_GetEntityScene(entityID);
+        if (scene && !scene->empty()) {
+            return *scene;
         }
         return std::nullopt;  // No match found
     }
 
+    bool SceneManager::m_SaveSnapshot(const std::string& name, const std::string& scene)
+    {
+        SceneSnapshot snapshot;
+        if (!snapshot.m_Capture(scene)) return false;
+
+        m_snapshots[name] = std::move(snapshot);
+        return true;
+    }
+
+    bool SceneManager::m_RestoreSnapshot(const std::string& name)
+    {
+        const auto& snapshot = m_snapshots.find(name);
+        if (snapshot == m_snapshots.end()) {
+            LOGGING_ERROR("Snapshot not found");
+            return false;
+        }
+
+        return snapshot->second.m_Restore();
+    }
+
+    void SceneManager::m_DeleteSnapshot(const std::string& name)
+    {
+        m_snapshots.erase(name);
+    }
+
     void SceneManager::m_SwapScenes(std::string oldscene, std::string newscene , ecs::EntityID id)
     {
         ecs::ECS* ecs = ecs::ECS::m_GetInstance();
@@ -263,6 +363,7 @@ namespace scenes {
         vectorenityid.erase(it);
 
         ecs->m_ECS_SceneMap.find(newscene)->second.m_sceneIDs.push_back(id);
+        ecs->m_SetEntityScene(id, newscene);
 
         for (size_t n{}; n < ecs::TOTALTYPECOMPONENT; n++) {
             if (ecs->m_ECS_EntityMap.find(id)->second.test((ecs::ComponentType)n)) {
@@ -280,6 +381,8 @@ namespace scenes {
     void SceneManager::m_AssignEntityNewSceneName(const std::string& scene, ecs::EntityID id)
     {
         ecs::ECS* ecs = ecs::ECS::m_GetInstance();
+        ecs->m_SetEntityScene(id, scene);
+
         //assign all of entity's scene component into new scene
         for (size_t n{}; n < ecs::TOTALTYPECOMPONENT; n++) {
             if (ecs->m_ECS_EntityMap.find(id)->second.test((ecs::ComponentType)n)) {
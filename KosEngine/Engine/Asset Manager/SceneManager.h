@@ -9,6 +9,7 @@
 		   of scenes within the ECS framework.
 		   - m_CreateNewScene: Creates a new JSON file for a scene.
 		   - m_LoadScene: Loads entities from a JSON file into the ECS system.
+		   - m_LoadSceneAsync: Streams a scene in over several frames.
 		   - m_ReloadScene: Reloads all active scenes.
 		   - m_ClearAllScene: Clears all non-prefab scenes.
 		   - m_ClearScene: Removes all entities from a specified scene.
@@ -16,6 +17,8 @@
 		   - m_SaveAllActiveScenes: Saves all active scenes.
 		   - m_SwapScenes: Moves an entity from one scene to another.
 		   - GetSceneByEntityID: Finds the scene that contains a specified entity.
+		   - m_SaveSnapshot: Captures a scene in memory for restarts and checkpoints.
+		   - m_RestoreSnapshot: Puts a scene back to a captured snapshot.
 
 This file supports scene management by providing functions for creating, saving,
 loading, and clearing scenes within a game, allowing dynamic control of game states.
@@ -31,6 +34,9 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 #include "../Config/pch.h"
 #include "../De&Serialization/json_handler.h"
+#include "SceneSnapshot.h"
+#include "SceneStreamer.h"
+#include "SceneWriter.h"
 
 namespace scenes {
 
@@ -66,6 +72,47 @@ namespace scenes {
 		/******************************************************************/
 		void m_LoadScene(std::filesystem::path scenepath);
 
+		/******************************************************************/
+		/*!
+			\fn        void m_LoadSceneAsync(std::filesystem::path scenepath)
+			\brief     Loads a scene without stalling the frame. The file is
+					   parsed on a worker thread and its entities are added
+					   by m_UpdateStreaming within the streamer's frame
+					   budget. The scene is inactive until it is complete.
+			\param[in] scenepath The file path of the scene JSON to load.
+		*/
+		/******************************************************************/
+		void m_LoadSceneAsync(std::filesystem::path scenepath);
+
+		/******************************************************************/
+		/*!
+			\fn        void m_UpdateStreaming()
+			\brief     Commits part of the streaming scenes, called once per
+					   frame before the ECS update.
+		*/
+		/******************************************************************/
+		void m_UpdateStreaming();
+
+		/******************************************************************/
+		/*!
+			\fn        void m_UpdateSaving()
+			\brief     Finishes the scene saves written since the last call,
+					   called once per frame before the asset watcher
+					   processes its changes so saved scenes are not
+					   reloaded.
+		*/
+		/******************************************************************/
+		void m_UpdateSaving();
+
+		/******************************************************************/
+		/*!
+			\fn        float m_GetLoadProgress(const std::string& scene) const
+			\brief     Progress of a scene load from 0 to 1, 1 once the
+					   scene is loaded and 0 if it is unknown.
+		*/
+		/******************************************************************/
+		float m_GetLoadProgress(const std::string& scene) const;
+
 		/******************************************************************/
 		/*!
 			\fn        void m_ReloadScene()
@@ -103,7 +150,10 @@ namespace scenes {
 			\brief     Saves the current state of a specified scene to its JSON file.
 			\param[in] scene The name of the scene to save.
 			\details   Serializes the scenes entities and components to its associated
-					   JSON file, preserving the current state of the scene.
+					   JSON file, preserving the current state of the scene. Only
+					   entities changed since the last save are serialised again
+					   and the file is written by m_writer in the background,
+					   m_UpdateSaving reports it to the asset watcher.
 		*/
 		/******************************************************************/
 		void m_SaveScene(std::string scene);
@@ -147,11 +197,35 @@ namespace scenes {
 			\brief     Retrieves the name of the scene containing a specified entity.
 			\param[in] entityID The ID of the entity to search for.
 			\return    An optional containing the name of the scene, or nullopt if no match is found.
-			\details   Searches through each loaded scene to find the one containing the given entity ID.
+			\details   Reads the entity-to-scene table kept by the ECS, no scene is searched.
 		*/
 		/******************************************************************/
 		static std::optional<std::string> GetSceneByEntityID(ecs::EntityID entityID);
 
+		/******************************************************************/
+		/*!
+			\fn        bool m_SaveSnapshot(const std::string& name, const std::string& scene)
+			\brief     Captures a loaded scene in memory under a name, used
+					   for level restarts and checkpoints. Saving under an
+					   existing name replaces it.
+			\return    False if the scene is not loaded.
+		*/
+		/******************************************************************/
+		bool m_SaveSnapshot(const std::string& name, const std::string& scene);
+
+		/******************************************************************/
+		/*!
+			\fn        bool m_RestoreSnapshot(const std::string& name)
+			\brief     Puts the scene saved under name back to its captured
+					   state, without reading its JSON file.
+			\return    False if there is no such snapshot or its scene is no
+					   longer loaded.
+		*/
+		/******************************************************************/
+		bool m_RestoreSnapshot(const std::string& name);
+
+		void m_DeleteSnapshot(const std::string& name);
+
 
 
 
@@ -179,11 +253,32 @@ namespace scenes {
 		/******************************************************************/
 		std::vector<std::filesystem::path> m_recentFiles;
 
+		/******************************************************************/
+		/*!
+		\var     SceneStreamer m_streamer
+		\brief   Scenes loading in the background, see m_LoadSceneAsync.
+		*/
+		/******************************************************************/
+		SceneStreamer m_streamer;
+
+		/******************************************************************/
+		/*!
+		\var     SceneWriter m_writer
+		\brief   Scenes saving in the background, see m_SaveScene.
+		*/
+		/******************************************************************/
+		SceneWriter m_writer;
+
 		bool isSceneChanged{};
 		//std::string m_AddScene(std::string filepath);
 
 	private:
 
+		//checks and bookkeeping shared by the synchronous and streamed loads
+		bool m_PrepareLoad(const std::filesystem::path& scenepath);
+
+		void m_FinishLoad(const std::string& scenename);
+
 		/******************************************************************/
 		/*!
 		\var     static std::unique_ptr<SceneManager> m_InstancePtr
@@ -192,6 +287,14 @@ namespace scenes {
 		/******************************************************************/
 		static std::unique_ptr<SceneManager> m_InstancePtr;
 
+		/******************************************************************/
+		/*!
+		\var     std::unordered_map<std::string, SceneSnapshot> m_snapshots
+		\brief   Snapshots by name, dropped when their scene is cleared.
+		*/
+		/******************************************************************/
+		std::unordered_map<std::string, SceneSnapshot> m_snapshots;
+
 	};
 }
 #endif SCENE_H
@@ -0,0 +1,172 @@
+/******************************************************************/
+/*!
+\file      SceneSnapshot.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      March 22, 2025
+\brief     This file contains the definitions of the SceneSnapshot class.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include "../Config/pch.h"
+#include "SceneSnapshot.h"
+#include "PrefabPool.h"
+#include "PrefabIndex.h"
+#include "AssetManager.h"
+#include "../ECS/ECS.h"
+#include "../Debugging/Logging.h"
+
+namespace scenes {
+
+	bool SceneSnapshot::m_Capture(const std::string& scene)
+	{
+		ecs::ECS* ecs = ecs::ECS::m_GetInstance();
+
+		const auto& sceneIt = ecs->m_ECS_SceneMap.find(scene);
+		if (sceneIt == ecs->m_ECS_SceneMap.end()) {
+			LOGGING_ERROR("Snapshot scene not loaded");
+			return false;
+		}
+
+		m_scene = scene;
+		m_entities.clear();
+		m_signatures.clear();
+
+		//entities deleted this frame are left out
+		for (ecs::EntityID id : sceneIt->second.m_sceneIDs) {
+			if (!ecs->m_IsValidEntity(id) || ecs->m_IsPendingDelete(id)) continue;
+
+			m_entities.push_back(id);
+			m_signatures.push_back(ecs->m_ECS_EntityMap.find(id)->second);
+		}
+
+		for (size_t n{}; n < ecs::TOTALTYPECOMPONENT; n++) {
+			ComponentBlock& block = m_components[n];
+			block.m_owners.clear();
+
+			std::vector<ecs::EntityID> owners;
+			for (uint32_t position{}; position < m_entities.size(); position++) {
+				if (m_signatures[position].test(n)) {
+					block.m_owners.push_back(position);
+					owners.push_back(m_entities[position]);
+				}
+			}
+
+			block.m_copies = owners.empty() ? nullptr : ecs->m_ECS_CombinedComponentPool[(ecs::ComponentType)n]->m_CopyComponents(owners);
+		}
+
+		//keep the live field values, the instances themselves are not copied
+		const ComponentBlock& scriptBlock = m_components[ecs::TYPESCRIPTCOMPONENT];
+		if (scriptBlock.m_copies) {
+			assetmanager::AssetManager* assetManager = assetmanager::AssetManager::m_funcGetInstance();
+
+			for (ecs::ScriptComponent& sc : *std::static_pointer_cast<std::vector<ecs::ScriptComponent>>(scriptBlock.m_copies)) {
+				for (const auto& script : sc.m_scriptInstances) {
+					assetManager->m_scriptManager.m_storeVariablesFromScript(&sc, script.first);
+				}
+				sc.m_scriptInstances.clear();
+				sc.m_scriptHandler.clear();
+			}
+		}
+
+		return true;
+	}
+
+	bool SceneSnapshot::m_Restore() const
+	{
+		ecs::ECS* ecs = ecs::ECS::m_GetInstance();
+
+		const auto& sceneIt = ecs->m_ECS_SceneMap.find(m_scene);
+		if (sceneIt == ecs->m_ECS_SceneMap.end()) {
+			LOGGING_ERROR("Snapshot scene not loaded");
+			return false;
+		}
+
+		prefab::PrefabPool::m_GetInstance()->m_ReleaseScene(m_scene);
+
+		//copy, the list shrinks while deleting
+		const std::vector<ecs::EntityID> current = sceneIt->second.m_sceneIDs;
+		ecs->m_DeleteEntities(current);
+
+		ecs->m_BeginRegistrationBatch();
+
+		std::vector<ecs::EntityID> entities;
+		entities.reserve(m_entities.size());
+		std::unordered_map<ecs::EntityID, ecs::EntityID> newID;
+		for (ecs::EntityID id : m_entities) {
+			ecs::EntityID created = ecs->m_CreateEntity(m_scene);
+			entities.push_back(created);
+			newID[id] = created;
+		}
+
+		for (size_t n{}; n < ecs::TOTALTYPECOMPONENT; n++) {
+			const ComponentBlock& block = m_components[n];
+			if (!block.m_copies) continue;
+
+			const ecs::ComponentType type = (ecs::ComponentType)n;
+
+			std::vector<ecs::EntityID> owners;
+			owners.reserve(block.m_owners.size());
+			for (uint32_t position : block.m_owners) {
+				ecs::EntityID id = entities[position];
+				if (!ecs->m_ECS_EntityMap.find(id)->second.test(type)) {
+					ecs->m_AddComponent(type, id);
+				}
+				owners.push_back(id);
+			}
+
+			ecs->m_ECS_CombinedComponentPool[type]->m_RestoreComponents(block.m_copies, owners);
+		}
+
+		//copies still point at the captured IDs
+		for (ecs::EntityID id : entities) {
+			ecs::TransformComponent* tc = ecs->m_GetComponent<ecs::TransformComponent>(id);
+
+			if (tc->m_haveParent) {
+				const auto& parent = newID.find(tc->m_parentID);
+				if (parent != newID.end()) {
+					tc->m_parentID = parent->second;
+				}
+				else {
+					//parent lived outside the scene
+					tc->m_haveParent = false;
+					tc->m_parentID = 0;
+				}
+			}
+
+			std::vector<ecs::EntityID> children;
+			children.reserve(tc->m_childID.size());
+			for (ecs::EntityID child : tc->m_childID) {
+				const auto& childIt = newID.find(child);
+				if (childIt != newID.end()) {
+					children.push_back(childIt->second);
+				}
+			}
+			tc->m_childID = std::move(children);
+
+			//collision data is rebuilt by the physics next frame
+			ecs::ColliderComponent* cc = ecs->m_GetComponent<ecs::ColliderComponent>(id);
+			if (cc) {
+				cc->m_collidedWith.clear();
+				cc->m_triColWith.clear();
+				cc->m_collisionState.clear();
+				cc->m_keys.clear();
+				cc->m_contactPoints.clear();
+				cc->m_isCollided = false;
+			}
+		}
+
+		ecs->m_EndRegistrationBatch();
+
+		for (ecs::EntityID id : entities) {
+			prefab::PrefabIndex::m_GetInstance()->m_Register(id);
+			ecs->m_UpdateTag(id);
+		}
+
+		return true;
+	}
+
+}
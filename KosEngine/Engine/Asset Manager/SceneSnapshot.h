@@ -0,0 +1,82 @@
+/******************************************************************/
+/*!
+\file      SceneSnapshot.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      March 22, 2025
+\brief     This file contains the SceneSnapshot class, an in memory copy
+		   of a loaded scene used to restart a level or go back to a
+		   checkpoint without reading the scene's JSON again.
+
+		   A snapshot keeps, for every component type, one block of
+		   component copies with the entities that own them. Script
+		   components keep the field values of their live instances.
+		   Restoring deletes the scene's entities, creates new ones,
+		   writes the blocks back with the component pools, relinks the
+		   hierarchy to the new IDs and registers the entities to their
+		   systems in one batch. Script instances are created again by
+		   the logic system on its next update.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#ifndef SCENESNAPSHOT_H
+#define SCENESNAPSHOT_H
+
+#include "../Config/pch.h"
+#include "../ECS/ECSList.h"
+
+namespace scenes {
+
+	class SceneSnapshot {
+
+	public:
+
+		/******************************************************************/
+		/*!
+			\fn        bool m_Capture(const std::string& scene)
+			\brief     Copies every entity of a loaded scene, replacing what
+					   the snapshot held before.
+			\return    False if the scene is not loaded.
+		*/
+		/******************************************************************/
+		bool m_Capture(const std::string& scene);
+
+		/******************************************************************/
+		/*!
+			\fn        bool m_Restore() const
+			\brief     Replaces the entities of the captured scene with the
+					   snapshot's copies. The snapshot is kept, so it can be
+					   restored again.
+			\return    False if the scene is no longer loaded.
+		*/
+		/******************************************************************/
+		bool m_Restore() const;
+
+		const std::string& m_GetScene() const { return m_scene; }
+
+		size_t m_GetEntityCount() const { return m_entities.size(); }
+
+	private:
+
+		struct ComponentBlock {
+			//positions in m_entities of the owners, in the order of the copies
+			std::vector<uint32_t> m_owners;
+			std::shared_ptr<void> m_copies;
+		};
+
+		std::string m_scene;
+
+		//captured IDs, only used to relink the hierarchy
+		std::vector<ecs::EntityID> m_entities;
+
+		std::vector<ecs::compSignature> m_signatures;
+
+		std::array<ComponentBlock, ecs::TOTALTYPECOMPONENT> m_components;
+	};
+
+}
+
+#endif SCENESNAPSHOT_H
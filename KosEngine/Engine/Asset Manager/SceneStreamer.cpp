@@ -0,0 +1,192 @@
+/******************************************************************/
+/*!
+\file      SceneStreamer.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      March 24, 2025
+\brief     This file contains the definitions of the SceneStreamer class.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include "../Config/pch.h"
+#include "SceneStreamer.h"
+#include "VirtualFileSystem.h"
+#include "../ECS/ECS.h"
+#include "../De&Serialization/json_handler.h"
+#include "../Debugging/Logging.h"
+
+namespace scenes {
+
+	SceneStreamer::~SceneStreamer()
+	{
+		for (auto& job : m_jobs) {
+			if (job->m_worker.joinable()) {
+				job->m_worker.join();
+			}
+		}
+	}
+
+	bool SceneStreamer::m_Begin(const std::filesystem::path& scenepath)
+	{
+		const std::string scene = scenepath.filename().string();
+		if (m_IsStreaming(scene)) return false;
+
+		auto job = std::make_unique<StreamJob>();
+		job->m_path = scenepath;
+		job->m_scene = scene;
+		job->m_worker = std::thread(&SceneStreamer::m_Parse, job.get());
+
+		m_jobs.push_back(std::move(job));
+		return true;
+	}
+
+	void SceneStreamer::m_Parse(StreamJob* job)
+	{
+		assetmanager::FileData filedata;
+		if (!assetmanager::VirtualFileSystem::m_GetInstance()->m_ReadFile(job->m_path, filedata)) {
+			job->m_failed = true;
+			job->m_parsed = true;
+			return;
+		}
+
+		std::string fileContent(filedata.m_View());
+		job->m_doc.Parse(fileContent.c_str());
+		if (job->m_doc.HasParseError() || !job->m_doc.IsArray()) {
+			job->m_failed = true;
+			job->m_parsed = true;
+			return;
+		}
+
+		//same order as the recursive load, each parent before its children
+		std::vector<StagedEntity> stack;
+		for (rapidjson::SizeType i = job->m_doc.Size(); i > 0; i--) {
+			const rapidjson::Value& entityData = job->m_doc[i - 1];
+			if (entityData.HasMember("GlobalSettings") || entityData.HasMember("CursorSettings")) continue;
+
+			stack.push_back({ &entityData, -1 });
+		}
+
+		while (!stack.empty()) {
+			StagedEntity entity = stack.back();
+			stack.pop_back();
+
+			const int position = static_cast<int>(job->m_staged.size());
+			job->m_staged.push_back(entity);
+
+			const rapidjson::Value& entityData = *entity.m_data;
+			if (entityData.HasMember("children") && entityData["children"].IsArray()) {
+				const rapidjson::Value& childrenArray = entityData["children"];
+				for (rapidjson::SizeType i = childrenArray.Size(); i > 0; i--) {
+					stack.push_back({ &childrenArray[i - 1], position });
+				}
+			}
+		}
+
+		job->m_parsed = true;
+	}
+
+	std::vector<std::string> SceneStreamer::m_Update()
+	{
+		std::vector<std::string> finished;
+
+		for (auto it = m_jobs.begin(); it != m_jobs.end();) {
+			StreamJob& job = **it;
+			if (!job.m_parsed) {
+				++it;
+				continue;
+			}
+
+			if (job.m_worker.joinable()) {
+				job.m_worker.join();
+			}
+
+			if (job.m_failed) {
+				LOGGING_ERROR("Failed to stream scene: {}", job.m_path.string().c_str());
+				it = m_jobs.erase(it);
+				continue;
+			}
+
+			if (m_Commit(job)) {
+				LOGGING_INFO("Streamed {} entities of {} over {} frames, longest slice {} ms", job.m_created.size(), job.m_scene, job.m_frames, job.m_longestSlice.count());
+				finished.push_back(job.m_scene);
+				it = m_jobs.erase(it);
+				continue;
+			}
+
+			++it;
+		}
+
+		return finished;
+	}
+
+	bool SceneStreamer::m_Commit(StreamJob& job)
+	{
+		ecs::ECS* ecs = ecs::ECS::m_GetInstance();
+
+		const auto start = std::chrono::steady_clock::now();
+
+		//the scene is kept out of every system until it is complete
+		if (!job.m_started) {
+			ecs::ECS::SceneID& scene = ecs->m_ECS_SceneMap[job.m_scene];
+			scene.m_isActive = false;
+			job.m_created.reserve(job.m_staged.size());
+			job.m_started = true;
+		}
+
+		ecs->m_BeginRegistrationBatch();
+		while (job.m_created.size() < job.m_staged.size()) {
+			const StagedEntity& entity = job.m_staged[job.m_created.size()];
+
+			std::optional<ecs::EntityID> parent;
+			if (entity.m_parent >= 0) {
+				parent = job.m_created[entity.m_parent];
+			}
+			job.m_created.push_back(Serialization::Serialize::m_LoadEntity(*entity.m_data, parent, job.m_scene, false));
+
+			if (std::chrono::steady_clock::now() - start >= m_frameBudget) break;
+		}
+		ecs->m_EndRegistrationBatch();
+
+		job.m_frames++;
+		const std::chrono::duration<float, std::milli> slice = std::chrono::steady_clock::now() - start;
+		job.m_longestSlice = (std::max)(job.m_longestSlice, slice);
+
+		if (job.m_created.size() < job.m_staged.size()) return false;
+
+		Serialization::Serialize::m_LoadGlobalSettings(job.m_doc);
+		ecs->m_ECS_SceneMap[job.m_scene].m_isActive = true;
+
+		return true;
+	}
+
+	void SceneStreamer::m_Cancel(const std::string& scene)
+	{
+		const auto& it = std::find_if(m_jobs.begin(), m_jobs.end(), [&scene](const auto& job) { return job->m_scene == scene; });
+		if (it == m_jobs.end()) return;
+
+		if ((*it)->m_worker.joinable()) {
+			(*it)->m_worker.join();
+		}
+		m_jobs.erase(it);
+	}
+
+	float SceneStreamer::m_GetProgress(const std::string& scene) const
+	{
+		const auto& it = std::find_if(m_jobs.begin(), m_jobs.end(), [&scene](const auto& job) { return job->m_scene == scene; });
+		if (it == m_jobs.end()) return -1.f;
+
+		const StreamJob& job = **it;
+		if (!job.m_parsed || job.m_staged.empty()) return 0.f;
+
+		return static_cast<float>(job.m_created.size()) / static_cast<float>(job.m_staged.size());
+	}
+
+	bool SceneStreamer::m_IsStreaming(const std::string& scene) const
+	{
+		return std::find_if(m_jobs.begin(), m_jobs.end(), [&scene](const auto& job) { return job->m_scene == scene; }) != m_jobs.end();
+	}
+
+}
@@ -0,0 +1,127 @@
+/******************************************************************/
+/*!
+\file      SceneStreamer.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      March 24, 2025
+\brief     This file contains the SceneStreamer class, which loads a
+		   scene in the background instead of freezing the frame.
+
+		   Only the file read, the JSON parse and the flattening of
+		   the entity tree into a staging list, parents before their
+		   children, run on the worker thread. Building the entities
+		   and their components with Serialize::m_LoadEntity touches
+		   the ECS and runs on the main thread, a slice at a time,
+		   stopping each frame once the frame budget is used. The
+		   scene stays inactive until the last entity is committed,
+		   so no system sees half a scene.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#ifndef SCENESTREAMER_H
+#define SCENESTREAMER_H
+
+#include "../Config/pch.h"
+#include "../ECS/ECSList.h"
+#include "../Dependencies/rapidjson/document.h"
+#include <atomic>
+
+namespace scenes {
+
+	class SceneStreamer {
+
+	public:
+
+		~SceneStreamer();
+
+		/******************************************************************/
+		/*!
+			\fn        bool m_Begin(const std::filesystem::path& scenepath)
+			\brief     Starts parsing a scene file on a worker thread.
+			\return    False if the scene is already streaming.
+		*/
+		/******************************************************************/
+		bool m_Begin(const std::filesystem::path& scenepath);
+
+		/******************************************************************/
+		/*!
+			\fn        std::vector<std::string> m_Update()
+			\brief     Commits staged entities until m_frameBudget is used,
+					   at least one entity per frame. Must be called on the
+					   main thread, outside of the ECS update.
+			\return    Scenes whose last entity was committed this call,
+					   they are active again.
+		*/
+		/******************************************************************/
+		std::vector<std::string> m_Update();
+
+		/******************************************************************/
+		/*!
+			\fn        void m_Cancel(const std::string& scene)
+			\brief     Stops streaming a scene, entities already committed
+					   stay in the scene.
+		*/
+		/******************************************************************/
+		void m_Cancel(const std::string& scene);
+
+		/******************************************************************/
+		/*!
+			\fn        float m_GetProgress(const std::string& scene) const
+			\brief     Fraction of the scene's entities committed so far, 0
+					   while the file is still parsing.
+			\return    -1 if the scene is not streaming.
+		*/
+		/******************************************************************/
+		float m_GetProgress(const std::string& scene) const;
+
+		bool m_IsStreaming(const std::string& scene) const;
+
+		/******************************************************************/
+		/*!
+		\var       m_frameBudget
+		\brief     Main thread time spent committing entities each frame,
+				   the commit of a level takes about 1 to 3 ms in all.
+		*/
+		/******************************************************************/
+		std::chrono::microseconds m_frameBudget{ 2000 };
+
+	private:
+
+		struct StagedEntity {
+			const rapidjson::Value* m_data{};
+			//position of the parent in the staging list, -1 for a root
+			int m_parent{ -1 };
+		};
+
+		struct StreamJob {
+			std::filesystem::path m_path{};
+			std::string m_scene{};
+
+			std::thread m_worker;
+			std::atomic<bool> m_parsed{ false };
+
+			//written by the worker, read once m_parsed is set
+			bool m_failed{ false };
+			rapidjson::Document m_doc;
+			std::vector<StagedEntity> m_staged;
+
+			//main thread only
+			bool m_started{ false };
+			std::vector<ecs::EntityID> m_created;
+			size_t m_frames{};
+			std::chrono::duration<float, std::milli> m_longestSlice{};
+		};
+
+		static void m_Parse(StreamJob* job);
+
+		bool m_Commit(StreamJob& job);
+
+		std::vector<std::unique_ptr<StreamJob>> m_jobs;
+	};
+
+}
+
+#endif SCENESTREAMER_H
@@ -0,0 +1,227 @@
+/******************************************************************/
+/*!
+\file      SceneWriter.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      March 26, 2025
+\brief     This file contains the definitions of the SceneWriter class.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include "../Config/pch.h"
+#include "SceneWriter.h"
+#include "../ECS/ECS.h"
+#include "../ECS/Hierachy.h"
+#include "../De&Serialization/json_handler.h"
+#include "../Dependencies/rapidjson/prettywriter.h"
+#include "../Debugging/Logging.h"
+
+namespace scenes {
+
+	SceneWriter::~SceneWriter()
+	{
+		for (auto& job : m_jobs) {
+			if (job->m_worker.joinable()) {
+				job->m_worker.join();
+			}
+		}
+	}
+
+	void SceneWriter::m_CollectVersions(ecs::EntityID id, std::vector<std::pair<ecs::EntityID, uint32_t>>& versions)
+	{
+		versions.emplace_back(id, ecs::ECS::m_GetInstance()->m_GetEntityVersion(id));
+
+		const auto& child = ecs::Hierachy::m_GetChild(id);
+		if (!child.has_value()) return;
+		for (auto childID : child.value()) {
+			m_CollectVersions(childID, versions);
+		}
+	}
+
+	bool SceneWriter::m_Save(const std::filesystem::path& scenepath)
+	{
+		ecs::ECS* ecs = ecs::ECS::m_GetInstance();
+
+		const std::string scene = scenepath.filename().string();
+		const auto& sceneIt = ecs->m_ECS_SceneMap.find(scene);
+		if (sceneIt == ecs->m_ECS_SceneMap.end()) {
+			LOGGING_ERROR("Save scene not loaded");
+			return false;
+		}
+
+		//the previous save fills the fragments this one reuses
+		m_Wait(scene);
+
+		const auto start = std::chrono::steady_clock::now();
+
+		//scripts change entities without marking them while the game runs
+		const bool useCache = ecs->m_getState() == ecs::STOP;
+
+		SceneCache& cache = m_caches[scene];
+		if (!useCache || cache.m_epoch != ecs->m_GetDirtyEpoch()) {
+			cache.m_roots.clear();
+			cache.m_epoch = ecs->m_GetDirtyEpoch();
+		}
+
+		auto job = std::make_unique<SaveJob>();
+		job->m_path = scenepath;
+		job->m_scene = scene;
+
+		//a handful of values, always written again
+		auto settings = std::make_unique<PendingFragment>();
+		settings->m_doc.SetArray();
+		Serialization::Serialize::m_SaveGlobalSettings(settings->m_doc, settings->m_doc.GetAllocator());
+		settings->m_text = std::make_shared<std::string>();
+		job->m_fragments.push_back(settings->m_text);
+		job->m_pending.push_back(std::move(settings));
+
+		std::unordered_map<ecs::EntityID, CachedRoot> roots;
+		std::unordered_set<ecs::EntityID> savedEntities;
+		std::vector<std::pair<ecs::EntityID, uint32_t>> versions;
+		for (ecs::EntityID id : sceneIt->second.m_sceneIDs) {
+			if (ecs::Hierachy::m_GetParent(id).has_value() || roots.find(id) != roots.end()) continue;
+
+			versions.clear();
+			m_CollectVersions(id, versions);
+			job->m_entities += versions.size();
+
+			const auto& cached = cache.m_roots.find(id);
+			if (cached != cache.m_roots.end() && cached->second.m_versions == versions) {
+				if (cached->second.m_text) {
+					job->m_fragments.push_back(cached->second.m_text);
+				}
+				roots[id] = std::move(cached->second);
+				continue;
+			}
+
+			auto fragment = std::make_unique<PendingFragment>();
+			fragment->m_doc.SetArray();
+			Serialization::Serialize::m_SaveEntity(id, fragment->m_doc, fragment->m_doc.GetAllocator(), savedEntities);
+			job->m_serialised += versions.size();
+
+			CachedRoot& root = roots[id];
+			root.m_versions = versions;
+
+			//entities without components are not saved
+			if (fragment->m_doc.Empty()) continue;
+
+			fragment->m_text = std::make_shared<std::string>();
+			root.m_text = fragment->m_text;
+			job->m_fragments.push_back(fragment->m_text);
+			job->m_pending.push_back(std::move(fragment));
+		}
+
+		//roots deleted since the last save are dropped
+		if (useCache) {
+			cache.m_roots = std::move(roots);
+		}
+		else {
+			m_caches.erase(scene);
+		}
+
+		job->m_mainThreadTime = std::chrono::steady_clock::now() - start;
+		job->m_worker = std::thread(&SceneWriter::m_Write, job.get());
+
+		m_jobs.push_back(std::move(job));
+		return true;
+	}
+
+	void SceneWriter::m_Write(SaveJob* job)
+	{
+		for (auto& fragment : job->m_pending) {
+			std::string& text = *fragment->m_text;
+
+			for (const auto& value : fragment->m_doc.GetArray()) {
+				rapidjson::StringBuffer writeBuffer;
+				rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(writeBuffer);
+				value.Accept(writer);
+
+				if (!text.empty()) {
+					text += ",\n";
+				}
+
+				//one level deeper than a document of its own, strings never hold a raw newline
+				text += "    ";
+				for (const char* c = writeBuffer.GetString(); *c; c++) {
+					text += *c;
+					if (*c == '\n') {
+						text += "    ";
+					}
+				}
+			}
+		}
+
+		//same layout as PrettyWriter writing the whole scene array
+		std::ofstream outputFile(job->m_path);
+		if (outputFile) {
+			outputFile << '[';
+			for (size_t n{}; n < job->m_fragments.size(); n++) {
+				outputFile << (n == 0 ? "\n" : ",\n") << *job->m_fragments[n];
+			}
+			outputFile << "\n]";
+			outputFile.close();
+		}
+
+		job->m_failed = !outputFile;
+		job->m_done = true;
+	}
+
+	void SceneWriter::m_Finish(SaveJob& job)
+	{
+		if (job.m_worker.joinable()) {
+			job.m_worker.join();
+		}
+
+		if (job.m_failed) {
+			LOGGING_ERROR("Failed to save scene: {}", job.m_path.string().c_str());
+			return;
+		}
+
+		LOGGING_INFO("Saved {}, {} of {} entities serialised, {} ms on the main thread", job.m_scene, job.m_serialised, job.m_entities, job.m_mainThreadTime.count());
+		m_written.push_back(job.m_path);
+	}
+
+	std::vector<std::filesystem::path> SceneWriter::m_Update()
+	{
+		for (auto it = m_jobs.begin(); it != m_jobs.end();) {
+			if (!(*it)->m_done) {
+				++it;
+				continue;
+			}
+
+			m_Finish(**it);
+			it = m_jobs.erase(it);
+		}
+
+		std::vector<std::filesystem::path> written;
+		written.swap(m_written);
+		return written;
+	}
+
+	void SceneWriter::m_Wait(const std::string& scene)
+	{
+		for (auto it = m_jobs.begin(); it != m_jobs.end();) {
+			if (!scene.empty() && (*it)->m_scene != scene) {
+				++it;
+				continue;
+			}
+
+			m_Finish(**it);
+			it = m_jobs.erase(it);
+		}
+	}
+
+	void SceneWriter::m_Forget(const std::string& scene)
+	{
+		m_caches.erase(scene);
+	}
+
+	bool SceneWriter::m_IsSaving(const std::string& scene) const
+	{
+		return std::find_if(m_jobs.begin(), m_jobs.end(), [&scene](const auto& job) { return job->m_scene == scene; }) != m_jobs.end();
+	}
+
+}
@@ -0,0 +1,134 @@
+/******************************************************************/
+/*!
+\file      SceneWriter.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      March 26, 2025
+\brief     This file contains the SceneWriter class, which saves a scene
+		   without writing the whole file on the main thread.
+
+		   The scene file is split into fragments, one for the global
+		   settings and one for each root entity with its children.
+		   The main thread copies only the root entities whose subtree
+		   changed since the last save into their own documents, a
+		   subtree is unchanged when it holds the same entities with
+		   the same ECS versions. A worker thread formats the copies
+		   and streams every fragment to the file, unchanged ones are
+		   reused as text. The file is byte for byte the same as the
+		   one written by Serialize::m_SaveComponentsJson.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#ifndef SCENEWRITER_H
+#define SCENEWRITER_H
+
+#include "../Config/pch.h"
+#include "../ECS/ECSList.h"
+#include "../Dependencies/rapidjson/document.h"
+#include <atomic>
+
+namespace scenes {
+
+	class SceneWriter {
+
+	public:
+
+		~SceneWriter();
+
+		/******************************************************************/
+		/*!
+			\fn        bool m_Save(const std::filesystem::path& scenepath)
+			\brief     Copies the changed entities of a loaded scene and
+					   starts writing the file on a worker thread. Waits
+					   for the previous save of the same scene first.
+			\return    False if the scene is not loaded.
+		*/
+		/******************************************************************/
+		bool m_Save(const std::filesystem::path& scenepath);
+
+		/******************************************************************/
+		/*!
+			\fn        std::vector<std::filesystem::path> m_Update()
+			\brief     Finishes the saves whose worker is done, including
+					   the ones joined by m_Wait since the last call.
+			\return    Paths of the files written.
+		*/
+		/******************************************************************/
+		std::vector<std::filesystem::path> m_Update();
+
+		/******************************************************************/
+		/*!
+			\fn        void m_Wait(const std::string& scene = {})
+			\brief     Blocks until the saves of a scene are written, every
+					   scene's when no scene is given.
+		*/
+		/******************************************************************/
+		void m_Wait(const std::string& scene = {});
+
+		/******************************************************************/
+		/*!
+			\fn        void m_Forget(const std::string& scene)
+			\brief     Drops the cached fragments of an unloaded scene.
+		*/
+		/******************************************************************/
+		void m_Forget(const std::string& scene);
+
+		bool m_IsSaving(const std::string& scene) const;
+
+	private:
+
+		struct CachedRoot {
+			//entities of the subtree and their versions, parents first
+			std::vector<std::pair<ecs::EntityID, uint32_t>> m_versions;
+			//never changed once written, a changed root gets a new string
+			std::shared_ptr<std::string> m_text;
+		};
+
+		struct SceneCache {
+			uint32_t m_epoch{};
+			std::unordered_map<ecs::EntityID, CachedRoot> m_roots;
+		};
+
+		struct PendingFragment {
+			rapidjson::Document m_doc;
+			std::shared_ptr<std::string> m_text;
+		};
+
+		struct SaveJob {
+			std::filesystem::path m_path{};
+			std::string m_scene{};
+
+			std::thread m_worker;
+			std::atomic<bool> m_done{ false };
+
+			//fragments in file order, the pending ones are filled by the worker
+			std::vector<std::shared_ptr<std::string>> m_fragments;
+			std::vector<std::unique_ptr<PendingFragment>> m_pending;
+
+			//written by the worker, read once m_done is set
+			bool m_failed{ false };
+
+			size_t m_entities{};
+			size_t m_serialised{};
+			std::chrono::duration<float, std::milli> m_mainThreadTime{};
+		};
+
+		static void m_Write(SaveJob* job);
+
+		static void m_CollectVersions(ecs::EntityID id, std::vector<std::pair<ecs::EntityID, uint32_t>>& versions);
+
+		void m_Finish(SaveJob& job);
+
+		std::unordered_map<std::string, SceneCache> m_caches;
+
+		std::vector<std::unique_ptr<SaveJob>> m_jobs;
+
+		std::vector<std::filesystem::path> m_written;
+	};
+
+}
+
+#endif SCENEWRITER_H
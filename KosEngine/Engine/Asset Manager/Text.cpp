@@ -50,9 +50,11 @@ namespace text {
             return;
         }
 
-        // load font as face
+        // load font as face, the bytes must outlive the face
+        assetmanager::FileData filedata;
         FT_Face face;
-        if (FT_New_Face(ft, file.c_str(), 0, &face)) {
+        if (!assetmanager::VirtualFileSystem::m_GetInstance()->m_ReadFile(file, filedata) ||
+            FT_New_Memory_Face(ft, filedata.m_data, static_cast<FT_Long>(filedata.m_size), 0, &face)) {
             LOGGING_ERROR("ERROR::FREETYPE: Failed to load font: {}", file.c_str());
             return;
         }
@@ -135,9 +137,29 @@ namespace text {
                 }
             }
             glBindTexture(GL_TEXTURE_2D, 0);
+
+            //register or refresh the handle, reloading stales all previously resolved handles
+            assetmanager->m_fontManager.m_fontHandles.m_Register(filename, &assetmanager->m_fontManager.m_fonts[filename]);
         }
         FT_Done_Face(face);
         FT_Done_FreeType(ft);
 	}
 
+	bool FontManager::m_UnloadFont(const std::string& name) {
+
+        const auto& font = m_fonts.find(name);
+        if (font == m_fonts.end()) {
+            return false;
+        }
+
+        //every glyph shares the atlas
+        if (!font->second.empty()) {
+            glDeleteTextures(1, &font->second.begin()->second.m_textureID);
+        }
+
+        m_fontHandles.m_Invalidate(name);
+        m_fonts.erase(font);
+        return true;
+	}
+
 }
\ No newline at end of file
@@ -29,6 +29,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <glm.hpp>
 #include <glew.h>
 #include "../Config/pch.h"
+#include "AssetHandle.h"
 #include <../Freetype_Font/include/ft2build.h>
 #include <../Freetype_Font/include/freetype/freetype.h>
 
@@ -81,6 +82,17 @@ namespace text {
         /******************************************************************/
         static void LoadFont(std::string file);
 
+        /******************************************************************/
+        /*!
+        \fn      bool m_UnloadFont(const std::string& name)
+        \brief   Deletes the glyph atlas of a loaded font and invalidates
+                 its handle.
+        \param   name - The file name of the font.
+        \return  False if the font was not loaded.
+        */
+        /******************************************************************/
+        bool m_UnloadFont(const std::string& name);
+
         /******************************************************************/
         /*!
         \typedef using FontMap = std::map<char, text::CharacterData>
@@ -104,6 +116,15 @@ namespace text {
         */
         /******************************************************************/
         std::map<std::string, FontMap> m_fonts;
+
+        /******************************************************************/
+        /*!
+        \var     assetmanager::AssetHandleTable<FontMap> m_fontHandles
+        \brief   Handle table pointing into m_fonts, text components resolve
+                 their font once instead of indexing m_fonts per glyph.
+        */
+        /******************************************************************/
+        assetmanager::AssetHandleTable<FontMap> m_fontHandles;
     };
 
 }
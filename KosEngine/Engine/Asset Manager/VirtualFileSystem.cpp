@@ -0,0 +1,162 @@
+/******************************************************************/
+/*!
+\file      VirtualFileSystem.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      March 12, 2025
+\brief     This file contains the definitions of the VirtualFileSystem
+		   class.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include "../Config/pch.h"
+#include "VirtualFileSystem.h"
+#include "../Debugging/Logging.h"
+
+namespace assetmanager {
+
+	std::unique_ptr<VirtualFileSystem> VirtualFileSystem::m_InstancePtr = nullptr;
+
+	std::string VirtualFileSystem::m_Key(const std::filesystem::path& path)
+	{
+		std::string key = path.lexically_normal().generic_string();
+		while (key.size() > 1 && key.back() == '/') {
+			key.pop_back();
+		}
+		return key;
+	}
+
+	bool VirtualFileSystem::m_Mount(const std::filesystem::path& pack, const std::filesystem::path& mountPoint)
+	{
+		if (!m_pack.m_Open(pack)) {
+			return false;
+		}
+
+		m_mountPoint = mountPoint;
+		m_mountKey = m_Key(mountPoint);
+		return true;
+	}
+
+	void VirtualFileSystem::m_Unmount()
+	{
+		m_pack.m_Close();
+		m_mountPoint.clear();
+		m_mountKey.clear();
+	}
+
+	bool VirtualFileSystem::m_ToPackName(const std::filesystem::path& path, std::string& name) const
+	{
+		if (!m_IsMounted()) return false;
+
+		const std::string key = m_Key(path);
+		if (key.size() <= m_mountKey.size() || key.compare(0, m_mountKey.size(), m_mountKey) != 0 || key[m_mountKey.size()] != '/') {
+			return false;
+		}
+
+		name = key.substr(m_mountKey.size() + 1);
+		return true;
+	}
+
+	bool VirtualFileSystem::m_Exists(const std::filesystem::path& path) const
+	{
+		std::error_code ec;
+		if (std::filesystem::is_regular_file(path, ec)) return true;
+
+		std::string name;
+		return m_ToPackName(path, name) && m_pack.m_Find(name) != nullptr;
+	}
+
+	bool VirtualFileSystem::m_ReadFile(const std::filesystem::path& path, FileData& data) const
+	{
+		//loose file overrides the archive
+		std::error_code ec;
+		if (std::filesystem::is_regular_file(path, ec)) {
+			std::ifstream file(path, std::ios::binary);
+			if (!file) return false;
+
+			data.m_storage.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+			data.m_data = data.m_storage.data();
+			data.m_size = data.m_storage.size();
+			return true;
+		}
+
+		std::string name;
+		if (!m_ToPackName(path, name)) return false;
+
+		const PackEntry* entry = m_pack.m_Find(name);
+		if (!entry) return false;
+
+		return m_pack.m_Read(*entry, data);
+	}
+
+	bool VirtualFileSystem::m_GetFileSize(const std::filesystem::path& path, std::uint64_t& size) const
+	{
+		std::error_code ec;
+		if (std::filesystem::is_regular_file(path, ec)) {
+			size = std::filesystem::file_size(path, ec);
+			return !ec;
+		}
+
+		std::string name;
+		if (!m_ToPackName(path, name)) return false;
+
+		const PackEntry* entry = m_pack.m_Find(name);
+		if (!entry) return false;
+
+		size = entry->m_size;
+		return true;
+	}
+
+	bool VirtualFileSystem::m_IsLoose(const std::filesystem::path& path) const
+	{
+		std::error_code ec;
+		return std::filesystem::is_regular_file(path, ec);
+	}
+
+	std::vector<std::filesystem::path> VirtualFileSystem::m_ListFiles(const std::filesystem::path& directory) const
+	{
+		std::vector<std::filesystem::path> files;
+		std::unordered_set<std::string> loose;
+
+		std::error_code ec;
+		if (std::filesystem::is_directory(directory, ec)) {
+			for (auto it = std::filesystem::recursive_directory_iterator(directory, ec); !ec && it != std::filesystem::recursive_directory_iterator(); it.increment(ec)) {
+				if (it->is_regular_file(ec)) {
+					files.push_back(it->path());
+					loose.insert(m_Key(it->path()));
+				}
+			}
+		}
+
+		if (!m_IsMounted()) return files;
+
+		//prefix inside the archive, empty for the mount point itself
+		std::string prefix;
+		const std::string key = m_Key(directory);
+		if (key != m_mountKey) {
+			if (!m_ToPackName(directory, prefix)) return files;
+			prefix += '/';
+		}
+
+		std::vector<std::filesystem::path> packed;
+		for (const PackEntry* entry = m_pack.m_Begin(); entry != m_pack.m_End(); ++entry) {
+			const std::string_view name = m_pack.m_GetName(*entry);
+			if (name.compare(0, prefix.size(), prefix) != 0) continue;
+
+			std::filesystem::path path = m_mountPoint / std::filesystem::path(name);
+			if (loose.find(m_Key(path)) != loose.end()) continue;
+
+			packed.push_back(path);
+		}
+
+		//table of contents is in hash order
+		std::sort(packed.begin(), packed.end());
+		files.insert(files.end(), packed.begin(), packed.end());
+
+		return files;
+	}
+
+}
@@ -0,0 +1,113 @@
+/******************************************************************/
+/*!
+\file      VirtualFileSystem.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      March 12, 2025
+\brief     This file contains the VirtualFileSystem class. Asset
+		   loaders read their files through it instead of opening
+		   them directly, the file is taken from the loose asset
+		   directory if it exists there, otherwise from the mounted
+		   .kpak archive.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#ifndef VIRTUALFILESYSTEM_H
+#define VIRTUALFILESYSTEM_H
+
+#include "../Config/pch.h"
+#include "AssetPack.h"
+
+namespace assetmanager {
+
+	class VirtualFileSystem {
+
+	public:
+
+		static VirtualFileSystem* m_GetInstance() {
+			if (!m_InstancePtr) {
+				m_InstancePtr.reset(new VirtualFileSystem{});
+			}
+			return m_InstancePtr.get();
+		}
+
+		/******************************************************************/
+		/*!
+		\fn        bool m_Mount(const std::filesystem::path& pack, const std::filesystem::path& mountPoint)
+		\brief     Mounts an archive, a path such as mountPoint/Sprites/a.png
+				   resolves to the archive's Sprites/a.png entry.
+		*/
+		/******************************************************************/
+		bool m_Mount(const std::filesystem::path& pack, const std::filesystem::path& mountPoint);
+
+		void m_Unmount();
+
+		bool m_IsMounted() const { return m_pack.m_IsOpen(); }
+
+		/******************************************************************/
+		/*!
+		\fn        bool m_Exists(const std::filesystem::path& path) const
+		\brief     True if the file exists loose or inside the archive.
+		*/
+		/******************************************************************/
+		bool m_Exists(const std::filesystem::path& path) const;
+
+		/******************************************************************/
+		/*!
+		\fn        bool m_ReadFile(const std::filesystem::path& path, FileData& data) const
+		\brief     Reads a whole file, loose files override the archive.
+				   Uncompressed archive entries are not copied. Safe to
+				   call from worker threads.
+		*/
+		/******************************************************************/
+		bool m_ReadFile(const std::filesystem::path& path, FileData& data) const;
+
+		/******************************************************************/
+		/*!
+		\fn        bool m_GetFileSize(const std::filesystem::path& path, std::uint64_t& size) const
+		\brief     Size of a file without reading it, the decompressed
+				   size for archive entries.
+		*/
+		/******************************************************************/
+		bool m_GetFileSize(const std::filesystem::path& path, std::uint64_t& size) const;
+
+		//true if the file is read from the loose asset directory
+		bool m_IsLoose(const std::filesystem::path& path) const;
+
+		/******************************************************************/
+		/*!
+		\fn        std::vector<std::filesystem::path> m_ListFiles(const std::filesystem::path& directory) const
+		\brief     Lists every file below a directory, recursively, loose
+				   files first then the archive entries not overridden.
+		*/
+		/******************************************************************/
+		std::vector<std::filesystem::path> m_ListFiles(const std::filesystem::path& directory) const;
+
+	private:
+
+		static std::unique_ptr<VirtualFileSystem> m_InstancePtr;
+
+		static std::string m_Key(const std::filesystem::path& path);
+
+		/******************************************************************/
+		/*!
+		\fn        bool m_ToPackName(const std::filesystem::path& path, std::string& name) const
+		\brief     Converts an engine path into the archive's relative name,
+				   false if the path is outside the mount point.
+		*/
+		/******************************************************************/
+		bool m_ToPackName(const std::filesystem::path& path, std::string& name) const;
+
+		AssetPack m_pack;
+
+		std::filesystem::path m_mountPoint{};
+
+		std::string m_mountKey{};
+	};
+
+}
+
+#endif VIRTUALFILESYSTEM_H
@@ -15,6 +15,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "../Helper/Helper.h"
 #include "../Asset Manager/AssetManager.h"
 #include "../Asset Manager/SceneManager.h"
+#include "../Asset Manager/PrefabPool.h"
 #include "../Graphics/GraphicsCamera.h"
 #include "../ECS/Hierachy.h"
 
@@ -30,10 +31,44 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 namespace script {
 
+	//calls the function with every entity of the tag that is in an active scene and not being deleted,
+	//stops early when it returns false
+	template <typename Func>
+	static void ForEachTagged(int tag, Func&& func)
+	{
+		ecs::ECS* ecs = ecs::ECS::m_GetInstance();
+
+		//entities of a tag are mostly in the same scene
+		const std::string* lastScene{};
+		bool lastActive{};
+
+		for (ecs::EntityID id : ecs->m_tagIndex.m_GetEntities(tag)) {
+			if (ecs->m_IsPendingDelete(id)) continue;
+
+			const std::string* scene = ecs->m_GetEntityScene(id);
+			if (!lastScene || *scene != *lastScene) {
+				const auto& sceneIt = ecs->m_ECS_SceneMap.find(*scene);
+				lastActive = sceneIt != ecs->m_ECS_SceneMap.end() && !sceneIt->second.m_isPrefab && sceneIt->second.m_isActive;
+				lastScene = scene;
+			}
+			if (!lastActive) continue;
+
+			if (!func(id)) return;
+		}
+	}
+
+	static int FindTag(MonoString* monostring)
+	{
+		char* nativeString = mono_string_to_utf8(monostring);
+		const int tag = ecs::ECS::m_GetInstance()->m_tagIndex.m_Find(nativeString);
+		mono_free(nativeString);
+		return tag;
+	}
+
 	bool InternalCall::m_InternalGetTransformComponent(ecs::EntityID entity, vector2::Vec2* trans, vector2::Vec2* scale, float* rotate)
 	{
 
-		auto* transform = static_cast<ecs::TransformComponent*>(ecs::ECS::m_GetInstance()->m_ECS_CombinedComponentPool[ecs::TYPETRANSFORMCOMPONENT]->m_GetEntityComponent(entity));
+		auto* transform = ecs::ECS::m_GetInstance()->m_GetComponent<ecs::TransformComponent>(entity);
 
 		if (transform) {
 			*trans = { transform->m_position.m_x, transform->m_position.m_y };
@@ -53,7 +88,7 @@ namespace script {
 
 	bool InternalCall::m_InternalSetTransformComponent(ecs::EntityID entity, vector2::Vec2* trans, vector2::Vec2* scale, float* rotate)
 	{
-		auto* transform = static_cast<ecs::TransformComponent*>(ecs::ECS::m_GetInstance()->m_ECS_CombinedComponentPool[ecs::TYPETRANSFORMCOMPONENT]->m_GetEntityComponent(entity));
+		auto* transform = ecs::ECS::m_GetInstance()->m_GetComponent<ecs::TransformComponent>(entity);
 
 		if (transform) {
 
@@ -68,10 +103,64 @@ namespace script {
 		return true;
 	}
 
+	int InternalCall::m_InternalGetTransformComponents(MonoArray* entities, MonoArray* transforms, int count)
+	{
+		if (!entities || !transforms || count <= 0) return 0;
+
+		count = static_cast<int>(std::min<uintptr_t>({ static_cast<uintptr_t>(count), mono_array_length(entities), mono_array_length(transforms) }));
+
+		//both arrays are blittable, read and write the managed memory directly
+		const ecs::EntityID* ids = mono_array_addr(entities, ecs::EntityID, 0);
+		TransformData* data = mono_array_addr(transforms, TransformData, 0);
+
+		auto* pool = ecs::ECS::m_GetInstance()->m_GetPool<ecs::TransformComponent>();
+
+		int found{};
+		for (int n{}; n < count; n++) {
+			auto* transform = pool->m_GetComponent(ids[n]);
+			if (!transform) {
+				data[n] = {};
+				continue;
+			}
+
+			data[n].m_position = transform->m_position;
+			data[n].m_scale = transform->m_scale;
+			data[n].m_rotation = transform->m_rotation;
+			found++;
+		}
+
+		return found;
+	}
+
+	int InternalCall::m_InternalSetTransformComponents(MonoArray* entities, MonoArray* transforms, int count)
+	{
+		if (!entities || !transforms || count <= 0) return 0;
+
+		count = static_cast<int>(std::min<uintptr_t>({ static_cast<uintptr_t>(count), mono_array_length(entities), mono_array_length(transforms) }));
+
+		const ecs::EntityID* ids = mono_array_addr(entities, ecs::EntityID, 0);
+		const TransformData* data = mono_array_addr(transforms, TransformData, 0);
+
+		auto* pool = ecs::ECS::m_GetInstance()->m_GetPool<ecs::TransformComponent>();
+
+		int found{};
+		for (int n{}; n < count; n++) {
+			auto* transform = pool->m_GetComponent(ids[n]);
+			if (!transform) continue;
+
+			transform->m_position = data[n].m_position;
+			transform->m_scale = data[n].m_scale;
+			transform->m_rotation = data[n].m_rotation;
+			found++;
+		}
+
+		return found;
+	}
+
 	bool InternalCall::m_InternalGetTranslate(ecs::EntityID entity, vector2::Vec2* trans)
 	{
 
-		auto* transform = static_cast<ecs::TransformComponent*>(ecs::ECS::m_GetInstance()->m_ECS_CombinedComponentPool[ecs::TYPETRANSFORMCOMPONENT]->m_GetEntityComponent(entity)); 
+		auto* transform = ecs::ECS::m_GetInstance()->m_GetComponent<ecs::TransformComponent>(entity); 
 
 		if (transform) {
 			vector2::Vec2 translate, rotate; 
@@ -88,7 +177,7 @@ namespace script {
 
 	bool InternalCall::m_InternalSetTranslate(ecs::EntityID entity, vector2::Vec2* trans)
 	{
-		auto* transform = static_cast<ecs::TransformComponent*>(ecs::ECS::m_GetInstance()->m_ECS_CombinedComponentPool[ecs::TYPETRANSFORMCOMPONENT]->m_GetEntityComponent(entity));
+		auto* transform = ecs::ECS::m_GetInstance()->m_GetComponent<ecs::TransformComponent>(entity);
 		if (transform) {
 			transform->m_position = *trans;
 		}
@@ -102,7 +191,7 @@ namespace script {
 	//Collider Component
 	bool InternalCall::m_InternalGetColliderComponent(ecs::EntityID entity, vector2::Vec2* size, vector2::Vec2* offset, bool* drawDebug, float* radius, unsigned int* m_blockedFlag, float* isCollided, bool* collisionCheck, bool* collisionresponse)
 	{
-		auto* collider = static_cast<ecs::ColliderComponent*>(ecs::ECS::m_GetInstance()->m_ECS_CombinedComponentPool[ecs::TYPECOLLIDERCOMPONENT]->m_GetEntityComponent(entity));
+		auto* collider = ecs::ECS::m_GetInstance()->m_GetComponent<ecs::ColliderComponent>(entity);
 
 		if (collider) {
 			*size = collider->m_Size;
@@ -124,7 +213,7 @@ namespace script {
 
 	bool InternalCall::m_InternalSetColliderComponent(ecs::EntityID entity, vector2::Vec2* size, vector2::Vec2* offset, bool* drawDebug, float* radius, unsigned int* m_blockedFlag, float* isCollided, bool* collisionCheck, bool* collisionresponse)
 	{
-		auto* collider = static_cast<ecs::ColliderComponent*>(ecs::ECS::m_GetInstance()->m_ECS_CombinedComponentPool[ecs::TYPECOLLIDERCOMPONENT]->m_GetEntityComponent(entity));
+		auto* collider = ecs::ECS::m_GetInstance()->m_GetComponent<ecs::ColliderComponent>(entity);
 
 		if (collider) {
 
@@ -147,7 +236,7 @@ namespace script {
 	//Player Component
 	bool InternalCall::m_InternalGetEnemyComponent(ecs::EntityID entity, int* enemytag, int* enemytype, int* enemybehaviour)
 	{
-		auto* player = static_cast<ecs::EnemyComponent*>(ecs::ECS::m_GetInstance()->m_ECS_CombinedComponentPool[ecs::TYPEENEMYCOMPONENT]->m_GetEntityComponent(entity));
+		auto* player = ecs::ECS::m_GetInstance()->m_GetComponent<ecs::EnemyComponent>(entity);
 
 		if (player) {
 			*enemytag = player->m_enemyTag;
@@ -164,7 +253,7 @@ namespace script {
 
 	bool InternalCall::m_InternalSetEnemyComponent(ecs::EntityID entity, int* enemytag, int* enemytype, int* enemybehaviour)
 	{
-		auto* player = static_cast<ecs::EnemyComponent*>(ecs::ECS::m_GetInstance()->m_ECS_CombinedComponentPool[ecs::TYPEENEMYCOMPONENT]->m_GetEntityComponent(entity));
+		auto* player = ecs::ECS::m_GetInstance()->m_GetComponent<ecs::EnemyComponent>(entity);
 
 		if (player) {
 			player->m_enemyTag = *enemytag;
@@ -182,7 +271,7 @@ namespace script {
 	//RigidBody Component
 	bool InternalCall::m_InternalGetRigidBodyComponent(ecs::EntityID entity, vector2::Vec2* velocity, vector2::Vec2* acceleration, float* rotation, vector2::Vec2* previouspos, vector2::Vec2* directionvector, vector2::Vec2* force)
 	{
-		auto* rbComponent = static_cast<ecs::RigidBodyComponent*>(ecs::ECS::m_GetInstance()->m_ECS_CombinedComponentPool[ecs::TYPERIGIDBODYCOMPONENT]->m_GetEntityComponent(entity));
+		auto* rbComponent = ecs::ECS::m_GetInstance()->m_GetComponent<ecs::RigidBodyComponent>(entity);
 
 		if (rbComponent) {
 			*velocity = rbComponent->m_Velocity;
@@ -202,7 +291,7 @@ namespace script {
 
 	bool InternalCall::m_InternalSetRigidBodyComponent(ecs::EntityID entity, vector2::Vec2* velocity, vector2::Vec2* acceleration, float* rotation, vector2::Vec2* previouspos, vector2::Vec2* directionvector, vector2::Vec2* force)
 	{
-		auto* rbComponent = static_cast<ecs::RigidBodyComponent*>(ecs::ECS::m_GetInstance()->m_ECS_CombinedComponentPool[ecs::TYPERIGIDBODYCOMPONENT]->m_GetEntityComponent(entity));
+		auto* rbComponent = ecs::ECS::m_GetInstance()->m_GetComponent<ecs::RigidBodyComponent>(entity);
 
 		if (rbComponent) {
 			rbComponent->m_Velocity = *velocity;
@@ -223,7 +312,7 @@ namespace script {
 	//Text Component
 	bool InternalCall::m_InternalGetTextComponent(ecs::EntityID entity, MonoString** text, MonoString** fileName, int* fontLayer, float* fontSize, vector3::Vec3* color)
 	{
-		auto* textComponent = static_cast<ecs::TextComponent*>(ecs::ECS::m_GetInstance()->m_ECS_CombinedComponentPool[ecs::TYPETEXTCOMPONENT]->m_GetEntityComponent(entity));
+		auto* textComponent = ecs::ECS::m_GetInstance()->m_GetComponent<ecs::TextComponent>(entity);
 
 		if (textComponent) {
 			*text = mono_string_new(mono_domain_get(), textComponent->m_text.c_str());
@@ -244,7 +333,7 @@ namespace script {
 
 	bool InternalCall::m_InternalSetTextComponent(ecs::EntityID entity, MonoString* text, MonoString* fileName, int* fontLayer, float* fontSize, const vector3::Vec3* color)
 	{
-		auto* textComponent = static_cast<ecs::TextComponent*>(ecs::ECS::m_GetInstance()->m_ECS_CombinedComponentPool[ecs::TYPETEXTCOMPONENT]->m_GetEntityComponent(entity));
+		auto* textComponent = ecs::ECS::m_GetInstance()->m_GetComponent<ecs::TextComponent>(entity);
 
 		if (textComponent) {
 			char* nativeText = mono_string_to_utf8(text);
@@ -272,7 +361,7 @@ namespace script {
 	//Animation Component
 	bool InternalCall::m_InternalGetAnimationComponent(ecs::EntityID entity, int* frameNumber, int* framesPerSecond, float* frameTimer, bool* isAnimating, int* stripcount)
 	{
-		auto* animComponent = static_cast<ecs::AnimationComponent*>(ecs::ECS::m_GetInstance()->m_ECS_CombinedComponentPool[ecs::TYPEANIMATIONCOMPONENT]->m_GetEntityComponent(entity));
+		auto* animComponent = ecs::ECS::m_GetInstance()->m_GetComponent<ecs::AnimationComponent>(entity);
 
 		if (animComponent) {
 			*frameNumber = animComponent->m_frameNumber;
@@ -291,7 +380,7 @@ namespace script {
 
 	bool InternalCall::m_InternalSetAnimationComponent(ecs::EntityID entity, int* frameNumber, int* framesPerSecond, float* frameTimer, bool* isAnimating, int* stripcount)
 	{
-		auto* animComponent = static_cast<ecs::AnimationComponent*>(ecs::ECS::m_GetInstance()->m_ECS_CombinedComponentPool[ecs::TYPEANIMATIONCOMPONENT]->m_GetEntityComponent(entity));
+		auto* animComponent = ecs::ECS::m_GetInstance()->m_GetComponent<ecs::AnimationComponent>(entity);
 
 		if (animComponent) {
 			animComponent->m_frameNumber = *frameNumber;
@@ -312,7 +401,7 @@ namespace script {
 	//Sprite Component
 	bool InternalCall::m_InternalGetSpriteComponent(ecs::EntityID entity, MonoString** imageFile, int* layer, vector3::Vec3* color, float* alpha)
 	{
-		auto* spriteComponent = static_cast<ecs::SpriteComponent*>(ecs::ECS::m_GetInstance()->m_ECS_CombinedComponentPool[ecs::TYPESPRITECOMPONENT]->m_GetEntityComponent(entity));
+		auto* spriteComponent = ecs::ECS::m_GetInstance()->m_GetComponent<ecs::SpriteComponent>(entity);
 
 		if (spriteComponent) {
 			*imageFile = mono_string_new(mono_domain_get(), spriteComponent->m_imageFile.c_str());
@@ -332,7 +421,7 @@ namespace script {
 
 	bool InternalCall::m_InternalSetSpriteComponent(ecs::EntityID entity, MonoString* imageFile, const int* layer, const vector3::Vec3* color, const float* alpha)
 	{
-		auto* spriteComponent = static_cast<ecs::SpriteComponent*>(ecs::ECS::m_GetInstance()->m_ECS_CombinedComponentPool[ecs::TYPESPRITECOMPONENT]->m_GetEntityComponent(entity));
+		auto* spriteComponent = ecs::ECS::m_GetInstance()->m_GetComponent<ecs::SpriteComponent>(entity);
 
 		if (spriteComponent) {
 			char* nativeString = mono_string_to_utf8(imageFile);
@@ -356,7 +445,7 @@ namespace script {
 	//Camera Component
 	bool InternalCall::m_InternalGetCameraComponent(ecs::EntityID entity, float* left, float* right, float* top, float* bottom, float* aspectRatio)
 	{
-		auto* cameraComponent = static_cast<ecs::CameraComponent*>(ecs::ECS::m_GetInstance()->m_ECS_CombinedComponentPool[ecs::TYPECAMERACOMPONENT]->m_GetEntityComponent(entity));
+		auto* cameraComponent = ecs::ECS::m_GetInstance()->m_GetComponent<ecs::CameraComponent>(entity);
 
 		if (cameraComponent) {
 			*left = cameraComponent->m_left;
@@ -375,7 +464,7 @@ namespace script {
 
 	bool InternalCall::m_InternalSetCameraComponent(ecs::EntityID entity, float left, float right, float top, float bottom, float aspectRatio)
 	{
-		auto* cameraComponent = static_cast<ecs::CameraComponent*>(ecs::ECS::m_GetInstance()->m_ECS_CombinedComponentPool[ecs::TYPECAMERACOMPONENT]->m_GetEntityComponent(entity));
+		auto* cameraComponent = ecs::ECS::m_GetInstance()->m_GetComponent<ecs::CameraComponent>(entity);
 
 		if (cameraComponent) {
 			cameraComponent->m_left = left;
@@ -395,7 +484,7 @@ namespace script {
 	//Button Components
 	bool InternalCall::m_InternalGetButtonComponent(ecs::EntityID entity, vector2::Vec2* position, vector2::Vec2* scale, bool* isClick)
 	{
-		auto* buttonComponent = static_cast<ecs::ButtonComponent*>(ecs::ECS::m_GetInstance()->m_ECS_CombinedComponentPool[ecs::TYPEBUTTONCOMPONENT]->m_GetEntityComponent(entity));
+		auto* buttonComponent = ecs::ECS::m_GetInstance()->m_GetComponent<ecs::ButtonComponent>(entity);
 
 		if (buttonComponent) {
 			*position = buttonComponent->m_Position;
@@ -412,7 +501,7 @@ namespace script {
 
 	bool InternalCall::m_InternalIsButtonHovered(ecs::EntityID entity)
 	{
-		auto* buttonComponent = static_cast<ecs::ButtonComponent*>(ecs::ECS::m_GetInstance()->m_ECS_CombinedComponentPool[ecs::TYPEBUTTONCOMPONENT]->m_GetEntityComponent(entity));
+		auto* buttonComponent = ecs::ECS::m_GetInstance()->m_GetComponent<ecs::ButtonComponent>(entity);
 
 		if (buttonComponent) {
 			return buttonComponent->m_IsHover;
@@ -427,7 +516,7 @@ namespace script {
 
 	bool InternalCall::m_InternalSetButtonComponent(ecs::EntityID entity, const vector2::Vec2& position, const vector2::Vec2& scale, bool isClick)
 	{
-		auto* buttonComponent = static_cast<ecs::ButtonComponent*>(ecs::ECS::m_GetInstance()->m_ECS_CombinedComponentPool[ecs::TYPEBUTTONCOMPONENT]->m_GetEntityComponent(entity));
+		auto* buttonComponent = ecs::ECS::m_GetInstance()->m_GetComponent<ecs::ButtonComponent>(entity);
 
 		if (buttonComponent) {
 			buttonComponent->m_Position = position;
@@ -446,9 +535,7 @@ namespace script {
 	MonoArray* InternalCall::m_InternalGetScriptNames(ecs::EntityID entity)
 	{
 		ecs::ECS* ecs = ecs::ECS::m_GetInstance();
-		ecs::ScriptComponent* scriptComponent = static_cast<ecs::ScriptComponent*>(
-			ecs->m_ECS_CombinedComponentPool[ecs::TYPESCRIPTCOMPONENT]->m_GetEntityComponent(entity)
-			);
+		ecs::ScriptComponent* scriptComponent = ecs->m_GetComponent<ecs::ScriptComponent>(entity);
 
 		if (!scriptComponent) return nullptr;
 		
@@ -499,7 +586,7 @@ namespace script {
 
 	bool InternalCall::m_InternalGetVelocity(ecs::EntityID entity, vector2::Vec2* vec)
 	{
-		auto* rbcomp = static_cast<ecs::RigidBodyComponent*>(ecs::ECS::m_GetInstance()->m_ECS_CombinedComponentPool[ecs::TYPERIGIDBODYCOMPONENT]->m_GetEntityComponent(entity));
+		auto* rbcomp = ecs::ECS::m_GetInstance()->m_GetComponent<ecs::RigidBodyComponent>(entity);
 		if (rbcomp) {
 			*vec = rbcomp->m_Velocity;
 		}
@@ -514,7 +601,7 @@ namespace script {
 
 	bool InternalCall::m_InternalSetVelocity(ecs::EntityID entity, vector2::Vec2* vec)
 	{
-		auto* rbcomp = static_cast<ecs::RigidBodyComponent*>(ecs::ECS::m_GetInstance()->m_ECS_CombinedComponentPool[ecs::TYPERIGIDBODYCOMPONENT]->m_GetEntityComponent(entity));
+		auto* rbcomp = ecs::ECS::m_GetInstance()->m_GetComponent<ecs::RigidBodyComponent>(entity);
 		if (rbcomp) {
 			rbcomp->m_Velocity = *vec;
 		}
@@ -552,32 +639,21 @@ namespace script {
 
 	int InternalCall::m_InternalCallGetTagID(MonoString* monostring)
 	{
+		int found{ -1 };
+		ForEachTagged(FindTag(monostring), [&found](ecs::EntityID id) {
+			found = static_cast<int>(id);
+			return false;
+			});
 
-		ecs::ECS* ecs = ecs::ECS::m_GetInstance();
+		return found;
+	}
+
+	int InternalCall::m_InternalCallGetTagHandle(MonoString* monostring)
+	{
 		char* nativeString = mono_string_to_utf8(monostring);
-		std::string tag = nativeString;
+		const int tag = ecs::ECS::m_GetInstance()->m_tagIndex.m_Intern(nativeString);
 		mono_free(nativeString);
-
-		for (const auto& scene : ecs->m_ECS_SceneMap) {
-			if (scene.second.m_isPrefab == false && scene.second.m_isActive) {
-				for (const auto& id : scene.second.m_sceneIDs) {
-					ecs::NameComponent* nc = static_cast<ecs::NameComponent*>(ecs->m_ECS_CombinedComponentPool[ecs::TYPENAMECOMPONENT]->m_GetEntityComponent(id));
-					
-					if (nc->m_entityTag == tag ) {
-						//check prefab and ignore if prefab
-						
-
-
-						return id;
-
-						break;
-					}
-				}
-			}
-		}
-
-
-		return -1;
+		return tag;
 	}
 
 	int InternalCall::m_InternalGetEntityIdFromGridKey(int gridkey) {
@@ -585,7 +661,8 @@ namespace script {
 		for (const auto& scene : ecs->m_ECS_SceneMap) {
 			if (scene.second.m_isPrefab == false && scene.second.m_isActive) {
 				for (const auto& id : scene.second.m_sceneIDs) {
-					ecs::GridComponent* gc = static_cast<ecs::GridComponent*>(ecs->m_ECS_CombinedComponentPool[ecs::TYPEGRIDCOMPONENT]->m_GetEntityComponent(id));
+					if (ecs->m_IsPendingDelete(id)) continue;
+					ecs::GridComponent* gc = ecs->m_GetComponent<ecs::GridComponent>(id);
 					if (gc != NULL)
 					{
 						if (gc->m_GridKey == gridkey) {
@@ -601,7 +678,7 @@ namespace script {
 	void InternalCall::m_ChangeLayer(ecs::EntityID id, unsigned int layerid)
 	{
 		ecs::ECS* ecs = ecs::ECS::m_GetInstance();
-		ecs::NameComponent* nc = static_cast<ecs::NameComponent*>(ecs->m_ECS_CombinedComponentPool[ecs::TYPENAMECOMPONENT]->m_GetEntityComponent(id));
+		ecs::NameComponent* nc = ecs->m_GetComponent<ecs::NameComponent>(id);
 		if (nc) {
 			nc->m_Layer = (layer::LAYERS)layerid;
 		}
@@ -615,7 +692,7 @@ namespace script {
 
 	void InternalCall::m_InternalCallGetLightingComponent(ecs::EntityID id, vector2::Vec2* innerouterradius, vector3::Vec3* color, float* intensity)
 	{
-		auto* LC = static_cast<ecs::LightingComponent*>(ecs::ECS::m_GetInstance()->m_ECS_CombinedComponentPool[ecs::TYPELIGHTINGCOMPONENT]->m_GetEntityComponent(id));
+		auto* LC = ecs::ECS::m_GetInstance()->m_GetComponent<ecs::LightingComponent>(id);
 
 		if (LC) {
 			*innerouterradius = LC->m_innerOuterRadius;
@@ -633,7 +710,7 @@ namespace script {
 
 	void InternalCall::m_InternalCallSetLightingComponent(ecs::EntityID id, vector2::Vec2* innerouterradius, vector3::Vec3* color, float* intensity)
 	{
-		auto* LC = static_cast<ecs::LightingComponent*>(ecs::ECS::m_GetInstance()->m_ECS_CombinedComponentPool[ecs::TYPELIGHTINGCOMPONENT]->m_GetEntityComponent(id));
+		auto* LC = ecs::ECS::m_GetInstance()->m_GetComponent<ecs::LightingComponent>(id);
 
 		if (LC) {
 			LC->m_innerOuterRadius = *innerouterradius;
@@ -658,7 +735,7 @@ namespace script {
 	void InternalCall::m_GetColliderDecomposedTRS(ecs::EntityID id, vector2::Vec2* _translate, vector2::Vec2* _rotate, float* _scale)
 	{
 
-		auto* CC = static_cast<ecs::ColliderComponent*>(ecs::ECS::m_GetInstance()->m_ECS_CombinedComponentPool[ecs::TYPECOLLIDERCOMPONENT]->m_GetEntityComponent(id));
+		auto* CC = ecs::ECS::m_GetInstance()->m_GetComponent<ecs::ColliderComponent>(id);
 
 		if (CC) {
 			vector2::Vec2 translate, rotate;
@@ -678,18 +755,22 @@ namespace script {
 
 	float InternalCall::m_GetRandomFloat(float min, float max)
 	{
-		static std::random_device rd;
-		static std::mt19937 gen(rd()); // Mersenne Twister RNG
+		//the engine's generator, seeded from the recording when replaying
 		std::uniform_real_distribution<float> dist(min, max);
-		return dist(gen);
+		return dist(Helper::Helpers::GetInstance()->m_random);
 	}
 
 	int InternalCall::m_GetRandomInt(int min, int max)
 	{
-		static std::random_device rd;
-		static std::mt19937 gen(rd());
 		std::uniform_int_distribution<int> dist(min, max);
-		return dist(gen);
+		return dist(Helper::Helpers::GetInstance()->m_random);
+	}
+
+	void InternalCall::m_InternalCallLogError(MonoString* message)
+	{
+		char* nativeString = mono_string_to_utf8(message);
+		LOGGING_ERROR_NO_SOURCE_LOCATION("{}", nativeString);
+		mono_free(nativeString);
 	}
 
 	MonoString* InternalCall::m_GetScenefromID(ecs::EntityID id)
@@ -725,7 +806,7 @@ namespace script {
 	void InternalCall::m_StopVideo(ecs::EntityID id )
 	{
 
-		auto* VC = static_cast<ecs::VideoComponent*>(ecs::ECS::m_GetInstance()->m_ECS_CombinedComponentPool[ecs::TYPEVIDEOCOMPONENT]->m_GetEntityComponent(id));
+		auto* VC = ecs::ECS::m_GetInstance()->m_GetComponent<ecs::VideoComponent>(id);
 
 		if (VC) {
 			VC->play = false;
@@ -738,7 +819,7 @@ namespace script {
 
 	void InternalCall::m_PauseVideo(ecs::EntityID id , bool _boolean)
 	{
-		auto* VC = static_cast<ecs::VideoComponent*>(ecs::ECS::m_GetInstance()->m_ECS_CombinedComponentPool[ecs::TYPEVIDEOCOMPONENT]->m_GetEntityComponent(id));
+		auto* VC = ecs::ECS::m_GetInstance()->m_GetComponent<ecs::VideoComponent>(id);
 
 		if (VC) {
 			VC->pause = _boolean;
@@ -752,7 +833,7 @@ namespace script {
 
 	void InternalCall::m_StartVideo(ecs::EntityID id )
 	{
-		auto* VC = static_cast<ecs::VideoComponent*>(ecs::ECS::m_GetInstance()->m_ECS_CombinedComponentPool[ecs::TYPEVIDEOCOMPONENT]->m_GetEntityComponent(id));
+		auto* VC = ecs::ECS::m_GetInstance()->m_GetComponent<ecs::VideoComponent>(id);
 
 		if (VC) {
 			VC->play = true;
@@ -772,29 +853,18 @@ namespace script {
 			return it->second->HasStopped();
 		}
 
-		return false;
+		//headless runs play no video
+		return Helper::Helpers::GetInstance()->m_headless;
 
 	}
 
 	MonoArray* InternalCall::m_InternalCallGetTagIDs(MonoString* monostring)
 	{
-		ecs::ECS* ecs = ecs::ECS::m_GetInstance();
-		char* nativeString = mono_string_to_utf8(monostring);
-		std::string tag = nativeString;
-		mono_free(nativeString);
-
 		std::vector<int> tagIDs;
-
-		for (const auto& scene : ecs->m_ECS_SceneMap) {
-			if (scene.second.m_isPrefab == false && scene.second.m_isActive) {
-				for (const auto& id : scene.second.m_sceneIDs) {
-					ecs::NameComponent* nc = static_cast<ecs::NameComponent*>(ecs->m_ECS_CombinedComponentPool[ecs::TYPENAMECOMPONENT]->m_GetEntityComponent(id));
-					if (nc->m_entityTag == tag) {
-						tagIDs.push_back(id);
-					}
-				}
-			}
-		}
+		ForEachTagged(FindTag(monostring), [&tagIDs](ecs::EntityID id) {
+			tagIDs.push_back(static_cast<int>(id));
+			return true;
+			});
 
 		if (tagIDs.size() > 0) {
 			MonoArray* Array = mono_array_new(assetmanager::AssetManager::m_funcGetInstance()->m_scriptManager.m_GetDomain(), mono_get_int32_class(), tagIDs.size());
@@ -809,10 +879,27 @@ namespace script {
 		return nullptr;
 	}
 
+	int InternalCall::m_InternalCallGetTagIDsNonAlloc(int tag, MonoArray* results)
+	{
+		const size_t length = results ? mono_array_length(results) : 0;
+		int* data = length ? mono_array_addr(results, int, 0) : nullptr;
+
+		size_t count{};
+		ForEachTagged(tag, [&](ecs::EntityID id) {
+			if (count < length) {
+				data[count] = static_cast<int>(id);
+			}
+			count++;
+			return true;
+			});
+
+		return static_cast<int>(count);
+	}
+
 	MonoArray* InternalCall::m_InternalCallGetCollidedEntities(ecs::EntityID entity)
 	{
 		ecs::ECS* ecs = ecs::ECS::m_GetInstance();
-		ecs::ColliderComponent* cc = static_cast<ecs::ColliderComponent*>(ecs->m_ECS_CombinedComponentPool[ecs::TYPECOLLIDERCOMPONENT]->m_GetEntityComponent(entity));
+		ecs::ColliderComponent* cc = ecs->m_GetComponent<ecs::ColliderComponent>(entity);
 		if (cc)
 		{
 			if (cc->m_isCollided) {
@@ -834,11 +921,30 @@ namespace script {
 		return nullptr;
 	}
 
+	int InternalCall::m_InternalCallGetCollidedEntitiesNonAlloc(ecs::EntityID entity, MonoArray* results)
+	{
+		ecs::ColliderComponent* cc = ecs::ECS::m_GetInstance()->m_GetComponent<ecs::ColliderComponent>(entity);
+		if (!cc) {
+			ASSERTNOCOMPONENT(ColliderComponent, entity);
+			return 0;
+		}
+
+		if (!cc->m_isCollided) return 0;
+
+		const size_t length = results ? mono_array_length(results) : 0;
+		const size_t count = std::min(length, cc->m_collidedWith.size());
+		for (size_t i = 0; i < count; ++i) {
+			mono_array_set(results, int, i, cc->m_collidedWith[i]);
+		}
+
+		return static_cast<int>(cc->m_collidedWith.size());
+	}
+
 	MonoString* InternalCall::m_InternalCallGetTag(ecs::EntityID entity)
 	{
 		ecs::ECS* ecs = ecs::ECS::m_GetInstance();
 		assetmanager::AssetManager* assetmanager = assetmanager::AssetManager::m_funcGetInstance();
-		ecs::NameComponent* nc = static_cast<ecs::NameComponent*>(ecs->m_ECS_CombinedComponentPool[ecs::TYPENAMECOMPONENT]->m_GetEntityComponent(entity));
+		ecs::NameComponent* nc = ecs->m_GetComponent<ecs::NameComponent>(entity);
 		if (!nc)
 		{
 			ASSERTNOCOMPONENT(ColliderComponent, entity);
@@ -899,6 +1005,30 @@ namespace script {
 		throw 1;//stop the loop in the logic system
 	}
 
+	void InternalCall::m_InternalCallLoadSceneAsync(MonoString* monoString)
+	{
+		scenes::SceneManager* scenemanager = scenes::SceneManager::m_GetInstance();
+
+		char* nativeString = mono_string_to_utf8(monoString);
+		std::string scenefile = std::string{ nativeString } + ".json";
+		mono_free(nativeString);
+
+		//entities are added between frames, the logic loop can carry on
+		const auto& scene = scenemanager->m_unloadScenePath.find(scenefile);
+		if (scene != scenemanager->m_unloadScenePath.end()) {
+			scenemanager->m_LoadSceneAsync(scene->second);
+		}
+	}
+
+	float InternalCall::m_InternalCallGetSceneLoadProgress(MonoString* monoString)
+	{
+		char* nativeString = mono_string_to_utf8(monoString);
+		std::string scenefile = std::string{ nativeString } + ".json";
+		mono_free(nativeString);
+
+		return scenes::SceneManager::m_GetInstance()->m_GetLoadProgress(scenefile);
+	}
+
 	int InternalCall::m_InternalCallAddPrefab(MonoString* prefab, const float* x, const float* y, const float* rotation)
 	{
 		ecs::ECS* ecs = ecs::ECS::m_GetInstance();
@@ -910,7 +1040,7 @@ namespace script {
 
 		if (ecs->m_ECS_SceneMap.find(prefabfile) != ecs->m_ECS_SceneMap.end()) {
 			ecs::EntityID id = prefab::Prefab::m_CreatePrefab(prefabfile);
-			ecs::TransformComponent* transCom = static_cast<ecs::TransformComponent*>(ecs->m_ECS_CombinedComponentPool[ecs::TYPETRANSFORMCOMPONENT]->m_GetEntityComponent(id));
+			ecs::TransformComponent* transCom = ecs->m_GetComponent<ecs::TransformComponent>(id);
 			transCom->m_position = { *x, *y };
 			transCom->m_rotation = *rotation;
 
@@ -995,7 +1125,7 @@ namespace script {
 
 		//check if audio component is present
 		ecs::ECS* ecs = ecs::ECS::m_GetInstance();
-		ecs::AudioComponent* aud = static_cast<ecs::AudioComponent*>(ecs->m_ECS_CombinedComponentPool[ecs::TYPEAUDIOCOMPONENT]->m_GetEntityComponent(id));
+		ecs::AudioComponent* aud = ecs->m_GetComponent<ecs::AudioComponent>(id);
 
 		if (aud == nullptr) return;
 
@@ -1004,6 +1134,7 @@ namespace script {
 		const auto& it = std::find_if(aud->m_AudioFiles.begin(), aud->m_AudioFiles.end(), [filepath](const auto& audio) {return audio.m_Name == filepath.filename().stem().string(); });
 		
 		if (it != aud->m_AudioFiles.end()) {
+			//a sound that is not resident is loaded when its handle is resolved
 			assetmanager->m_audioManager.m_PlayAudioForEntity(id, filepath.filename().stem().string(), it->m_Volume);
 		}
 		
@@ -1174,7 +1305,7 @@ namespace script {
 	{
 		char* nativeString = mono_string_to_utf8(monoString);
 		ecs::ECS* ecs = ecs::ECS::m_GetInstance();
-		ecs::ScriptComponent* script = static_cast<ecs::ScriptComponent*>(ecs->m_ECS_CombinedComponentPool[ecs::TYPESCRIPTCOMPONENT]->m_GetEntityComponent(id));
+		ecs::ScriptComponent* script = ecs->m_GetComponent<ecs::ScriptComponent>(id);
 
 		if (script == NULL) return;
 
@@ -1191,7 +1322,7 @@ namespace script {
 	{
 		char* nativeString = mono_string_to_utf8(monoString);
 		ecs::ECS* ecs = ecs::ECS::m_GetInstance();
-		ecs::ScriptComponent* script = static_cast<ecs::ScriptComponent*>(ecs->m_ECS_CombinedComponentPool[ecs::TYPESCRIPTCOMPONENT]->m_GetEntityComponent(id));
+		ecs::ScriptComponent* script = ecs->m_GetComponent<ecs::ScriptComponent>(id);
 
 		if (script == NULL) return;
 
@@ -1216,7 +1347,7 @@ namespace script {
 
 		if (scenes == ecs->m_ECS_SceneMap.end()) return nullptr;
 		for (auto ids : scenes->second.m_sceneIDs) {
-			auto* cc = static_cast<ecs::ColliderComponent*>(ecs->m_ECS_CombinedComponentPool[ecs::TYPECOLLIDERCOMPONENT]->m_GetEntityComponent(ids));
+			auto* cc = ecs->m_GetComponent<ecs::ColliderComponent>(ids);
 
 			if (cc != NULL) {
 				if (cc->m_collisionResponse) {
@@ -1245,7 +1376,7 @@ namespace script {
 		mono_free(nativeString);
 
 		ecs::ECS* ecs = ecs::ECS::m_GetInstance();
-		ecs::RaycastComponent* rc = static_cast<ecs::RaycastComponent*>(ecs->m_ECS_CombinedComponentPool[ecs::TYPERAYCASTINGCOMPONENT]->m_GetEntityComponent(id));
+		ecs::RaycastComponent* rc = ecs->m_GetComponent<ecs::RaycastComponent>(id);
 
 		if (rc) {
 			
@@ -1282,7 +1413,7 @@ namespace script {
 		mono_free(nativeString);
 
 		ecs::ECS* ecs = ecs::ECS::m_GetInstance();
-		ecs::RaycastComponent* rc = static_cast<ecs::RaycastComponent*>(ecs->m_ECS_CombinedComponentPool[ecs::TYPERAYCASTINGCOMPONENT]->m_GetEntityComponent(id));
+		ecs::RaycastComponent* rc = ecs->m_GetComponent<ecs::RaycastComponent>(id);
 
 		if (rc) {
 
@@ -1317,7 +1448,7 @@ namespace script {
 		vector2::Vec2* acceleration, vector3::Vec3* color, float* coneRotation, float* coneAngle, float* randomFactor, MonoString** imageFile, int* stripCount,
 		int* frameNumber, int* layer, float* friction, int* fps, [[maybe_unused]]bool* loopAnimation)
 	{
-		auto* particleComponent = static_cast<ecs::ParticleComponent*>(ecs::ECS::m_GetInstance()->m_ECS_CombinedComponentPool[ecs::TYPEPARTICLECOMPONENT]->m_GetEntityComponent(entity));
+		auto* particleComponent = ecs::ECS::m_GetInstance()->m_GetComponent<ecs::ParticleComponent>(entity);
 		if (particleComponent) {
 			*willSpawn = particleComponent->m_willSpawn;
 			*noOfParticles = particleComponent->m_noOfParticles;
@@ -1345,7 +1476,7 @@ namespace script {
 
 	bool InternalCall::m_InternalSetParticleComponent(ecs::EntityID entity, bool* willSpawn, int* noOfParticles, float* lifeSpan, [[maybe_unused]]vector2::Vec2* size, vector2::Vec2* velocity, vector2::Vec2* acceleration, vector3::Vec3* color, float* coneRotation, float* coneAngle, float* randomFactor, MonoString* imageFile, int* stripCount, int* frameNumber, int* layer, float* friction, int* fps,[[maybe_unused]] bool* loopAnimation)
 	{
-		auto* particleComponent = static_cast<ecs::ParticleComponent*>(ecs::ECS::m_GetInstance()->m_ECS_CombinedComponentPool[ecs::TYPEPARTICLECOMPONENT]->m_GetEntityComponent(entity));
+		auto* particleComponent = ecs::ECS::m_GetInstance()->m_GetComponent<ecs::ParticleComponent>(entity);
 		if (particleComponent) {
 			particleComponent->m_willSpawn = *willSpawn;
 			particleComponent->m_noOfParticles = *noOfParticles;
@@ -1377,7 +1508,7 @@ namespace script {
 
 	bool InternalCall::m_InternalCallSpawnParticle(ecs::EntityID entity)
 	{
-		auto* particleComponent = static_cast<ecs::ParticleComponent*>(ecs::ECS::m_GetInstance()->m_ECS_CombinedComponentPool[ecs::TYPEPARTICLECOMPONENT]->m_GetEntityComponent(entity));
+		auto* particleComponent = ecs::ECS::m_GetInstance()->m_GetComponent<ecs::ParticleComponent>(entity);
 		if (particleComponent)
 		{
 			particleComponent->m_willSpawn = true;
@@ -1392,7 +1523,7 @@ namespace script {
 
 	bool InternalCall::m_InternalCallSetParticleLayer(ecs::EntityID entity, int* layer)
 	{
-		auto* particleComponent = static_cast<ecs::ParticleComponent*>(ecs::ECS::m_GetInstance()->m_ECS_CombinedComponentPool[ecs::TYPEPARTICLECOMPONENT]->m_GetEntityComponent(entity));
+		auto* particleComponent = ecs::ECS::m_GetInstance()->m_GetComponent<ecs::ParticleComponent>(entity);
 		if (particleComponent)
 		{
 			particleComponent->m_layer = *layer;
@@ -1407,7 +1538,7 @@ namespace script {
 
 	bool InternalCall::m_InternalCallSetParticleConeRotation(ecs::EntityID entity, float* angle)
 	{
-		auto* particleComponent = static_cast<ecs::ParticleComponent*>(ecs::ECS::m_GetInstance()->m_ECS_CombinedComponentPool[ecs::TYPEPARTICLECOMPONENT]->m_GetEntityComponent(entity));
+		auto* particleComponent = ecs::ECS::m_GetInstance()->m_GetComponent<ecs::ParticleComponent>(entity);
 		if (particleComponent)
 		{
 			particleComponent->m_coneRotation= *angle;
@@ -1422,7 +1553,7 @@ namespace script {
 
 	bool InternalCall::m_InternalCallDespawnParticle(ecs::EntityID entity)
 	{
-		auto* particleComponent = static_cast<ecs::ParticleComponent*>(ecs::ECS::m_GetInstance()->m_ECS_CombinedComponentPool[ecs::TYPEPARTICLECOMPONENT]->m_GetEntityComponent(entity));
+		auto* particleComponent = ecs::ECS::m_GetInstance()->m_GetComponent<ecs::ParticleComponent>(entity);
 		if (particleComponent)
 		{
 			particleComponent->m_willSpawn = false;
@@ -1438,7 +1569,7 @@ namespace script {
 
 	// Grid Component
 	bool InternalCall::m_InternalGetGridComponent(ecs::EntityID entity, vector2::Vec2* anchor, int* gridRowLength, int* gridColumnLength, bool* setCollidable, int* gridKey) {
-		auto* gridComponent = static_cast<ecs::GridComponent*>(ecs::ECS::m_GetInstance()->m_ECS_CombinedComponentPool[ecs::TYPEGRIDCOMPONENT]->m_GetEntityComponent(entity));
+		auto* gridComponent = ecs::ECS::m_GetInstance()->m_GetComponent<ecs::GridComponent>(entity);
 		if (gridComponent) {
 			*anchor = gridComponent->m_Anchor;
 			*gridRowLength = gridComponent->m_GridRowLength;
@@ -1456,7 +1587,7 @@ namespace script {
 	}
 
 	bool InternalCall::m_InternalSetGridComponent(ecs::EntityID entity, vector2::Vec2* anchor, int* gridRowLength, int* gridColumnLength, bool* setCollidable, int* gridKey) {
-		auto* gridComponent = static_cast<ecs::GridComponent*>(ecs::ECS::m_GetInstance()->m_ECS_CombinedComponentPool[ecs::TYPEGRIDCOMPONENT]->m_GetEntityComponent(entity));
+		auto* gridComponent = ecs::ECS::m_GetInstance()->m_GetComponent<ecs::GridComponent>(entity);
 		if (gridComponent) {
 			gridComponent->m_Anchor = *anchor;
 			gridComponent->m_GridRowLength = *gridRowLength;
@@ -1474,7 +1605,7 @@ namespace script {
 	bool InternalCall::m_InternalCallGetPathfinding(ecs::EntityID id, vector2::Vec2* m_startpos, vector2::Vec2* m_startend, int* gridkey)
 	{
 		ecs::ECS* ecs = ecs::ECS::m_GetInstance();
-		ecs::PathfindingComponent* pfc = static_cast<ecs::PathfindingComponent*>(ecs->m_ECS_CombinedComponentPool[ecs::TYPEPATHFINDINGCOMPONENT]->m_GetEntityComponent(id));
+		ecs::PathfindingComponent* pfc = ecs->m_GetComponent<ecs::PathfindingComponent>(id);
 
 		if (pfc) {
 
@@ -1516,7 +1647,7 @@ namespace script {
 	{
 		AStarPathfinding pathfinder;
 		int entityID = InternalCall::m_InternalGetEntityIdFromGridKey(gridKey);
-		auto* gridComponent = static_cast<ecs::GridComponent*>(ecs::ECS::m_GetInstance()->m_ECS_CombinedComponentPool[ecs::TYPEGRIDCOMPONENT]->m_GetEntityComponent(entityID));
+		auto* gridComponent = ecs::ECS::m_GetInstance()->m_GetComponent<ecs::GridComponent>(entityID);
 		
 		if (gridComponent)
 		{
@@ -1545,7 +1676,7 @@ namespace script {
 	{
 
 		ecs::ECS* ecs = ecs::ECS::m_GetInstance();
-		ecs::PathfindingComponent* pfc = static_cast<ecs::PathfindingComponent*>(ecs->m_ECS_CombinedComponentPool[ecs::TYPEPATHFINDINGCOMPONENT]->m_GetEntityComponent(id));
+		ecs::PathfindingComponent* pfc = ecs->m_GetComponent<ecs::PathfindingComponent>(id);
 
 		if (pfc) {
 
@@ -1583,7 +1714,7 @@ namespace script {
 	{
 
 		ecs::ECS* ecs = ecs::ECS::m_GetInstance();
-		ecs::NameComponent* nc = static_cast<ecs::NameComponent*>(ecs->m_ECS_CombinedComponentPool[ecs::TYPENAMECOMPONENT]->m_GetEntityComponent(id));
+		ecs::NameComponent* nc = ecs->m_GetComponent<ecs::NameComponent>(id);
 		*outptr = static_cast<void*>(nc); // Assign pointer to output parameter
 
 	}
@@ -1599,15 +1730,64 @@ namespace script {
 			return;
 		}
 
-		ecs->m_DeleteEntity(id);
+		//scripts run inside the logic system's loop, delete at the end of the frame
+		ecs->m_QueueDeleteEntity(id);
+
+	}
 
+	int InternalCall::m_InternalCallPrewarmPrefab(MonoString* prefab, int count)
+	{
+		char* nativeString = mono_string_to_utf8(prefab);
+		std::string prefabfile = std::string{ nativeString } + ".prefab";
+		mono_free(nativeString);
+
+		if (count < 0) count = 0;
+
+		return static_cast<int>(prefab::PrefabPool::m_GetInstance()->m_Prewarm(prefabfile, static_cast<size_t>(count)));
+	}
+
+	int InternalCall::m_InternalCallAcquirePrefab(MonoString* prefab, const float* x, const float* y, const float* rotation)
+	{
+		char* nativeString = mono_string_to_utf8(prefab);
+		std::string prefabfile = std::string{ nativeString } + ".prefab";
+		mono_free(nativeString);
+
+		return prefab::PrefabPool::m_GetInstance()->m_Acquire(prefabfile, { *x, *y }, *rotation);
+	}
+
+	bool InternalCall::m_InternalCallReleaseEntity(ecs::EntityID id)
+	{
+		return prefab::PrefabPool::m_GetInstance()->m_Release(id);
+	}
+
+	bool InternalCall::m_InternalCallSaveSnapshot(MonoString* name, MonoString* scene)
+	{
+		char* nativeName = mono_string_to_utf8(name);
+		char* nativeScene = mono_string_to_utf8(scene);
+		std::string snapshotname{ nativeName };
+		std::string scenefile = std::string{ nativeScene } + ".json";
+		mono_free(nativeName);
+		mono_free(nativeScene);
+
+		return scenes::SceneManager::m_GetInstance()->m_SaveSnapshot(snapshotname, scenefile);
+	}
+
+	void InternalCall::m_InternalCallRestoreSnapshot(MonoString* name)
+	{
+		char* nativeName = mono_string_to_utf8(name);
+		std::string snapshotname{ nativeName };
+		mono_free(nativeName);
+
+		if (scenes::SceneManager::m_GetInstance()->m_RestoreSnapshot(snapshotname)) {
+			throw 1;//stop the loop in the logic system
+		}
 	}
 
 	float InternalCall::m_InternalCallIsCollided(ecs::EntityID entity)
 	{
 
 		ecs::ECS* ecs = ecs::ECS::m_GetInstance();
-		ecs::ColliderComponent* cc = static_cast<ecs::ColliderComponent*>(ecs->m_ECS_CombinedComponentPool[ecs::TYPECOLLIDERCOMPONENT]->m_GetEntityComponent(entity));
+		ecs::ColliderComponent* cc = ecs->m_GetComponent<ecs::ColliderComponent>(entity);
 		if (cc) {
 			return cc->m_isCollided;
 		}
@@ -1688,6 +1868,8 @@ namespace script {
 	{
 		MONO_ADD_INTERNAL_CALL(m_InternalGetTransformComponent);
 		MONO_ADD_INTERNAL_CALL(m_InternalSetTransformComponent);
+		MONO_ADD_INTERNAL_CALL(m_InternalGetTransformComponents);
+		MONO_ADD_INTERNAL_CALL(m_InternalSetTransformComponents);
 
 		MONO_ADD_INTERNAL_CALL(m_InternalGetTranslate);
 		MONO_ADD_INTERNAL_CALL(m_InternalSetTranslate);
@@ -1732,17 +1914,27 @@ namespace script {
 
 		MONO_ADD_INTERNAL_CALL(m_InternalCallGetTagID);
 		MONO_ADD_INTERNAL_CALL(m_InternalCallGetTagIDs);
+		MONO_ADD_INTERNAL_CALL(m_InternalCallGetTagHandle);
+		MONO_ADD_INTERNAL_CALL(m_InternalCallGetTagIDsNonAlloc);
 
 		MONO_ADD_INTERNAL_CALL(m_InternalCallGetCollidedEntities);
+		MONO_ADD_INTERNAL_CALL(m_InternalCallGetCollidedEntitiesNonAlloc);
 		MONO_ADD_INTERNAL_CALL(m_InternalCallGetTag);
 
 		MONO_ADD_INTERNAL_CALL(m_InternalCallSetSceneActive);
 
 		MONO_ADD_INTERNAL_CALL(m_UnloadAllScene);
 		MONO_ADD_INTERNAL_CALL(m_InternalCallLoadScene);
+		MONO_ADD_INTERNAL_CALL(m_InternalCallLoadSceneAsync);
+		MONO_ADD_INTERNAL_CALL(m_InternalCallGetSceneLoadProgress);
 
 		MONO_ADD_INTERNAL_CALL(m_InternalCallAddPrefab);
 		MONO_ADD_INTERNAL_CALL(m_InternalCallDeleteEntity);
+		MONO_ADD_INTERNAL_CALL(m_InternalCallPrewarmPrefab);
+		MONO_ADD_INTERNAL_CALL(m_InternalCallAcquirePrefab);
+		MONO_ADD_INTERNAL_CALL(m_InternalCallReleaseEntity);
+		MONO_ADD_INTERNAL_CALL(m_InternalCallSaveSnapshot);
+		MONO_ADD_INTERNAL_CALL(m_InternalCallRestoreSnapshot);
 
 		MONO_ADD_INTERNAL_CALL(m_InternalCallIsCollided); 
 
@@ -1821,6 +2013,7 @@ namespace script {
 
 		MONO_ADD_INTERNAL_CALL(m_GetRandomFloat);
 		MONO_ADD_INTERNAL_CALL(m_GetRandomInt);
+		MONO_ADD_INTERNAL_CALL(m_InternalCallLogError);
 
 		MONO_ADD_INTERNAL_CALL(m_GetScenefromID);
 
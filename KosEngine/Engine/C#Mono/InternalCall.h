@@ -20,6 +20,21 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 namespace script {
 
+	/******************************************************************/
+	/*!
+	\struct    TransformData
+	\brief     Blittable copy of a transform, same layout as the
+			   TransformData struct in ScriptCore so arrays of it are
+			   read and written by C# without marshalling.
+	*/
+	/******************************************************************/
+	struct TransformData {
+		vector2::Vec2 m_position;
+		vector2::Vec2 m_scale;
+		float m_rotation;
+	};
+	static_assert(sizeof(TransformData) == 5 * sizeof(float), "TransformData must match the C# layout");
+
 	class InternalCall {
 		/******************************************************************/
 		/*!
@@ -47,6 +62,33 @@ namespace script {
 		/******************************************************************/
 		static bool m_InternalSetTransformComponent(ecs::EntityID entity, vector2::Vec2* trans, vector2::Vec2* scale, float* rotate);
 
+		/******************************************************************/
+		/*!
+			\fn        int InternalCall::m_InternalGetTransformComponents(MonoArray* entities, MonoArray* transforms, int count)
+			\brief     Reads the transforms of many entities in one call.
+			\param[in] entities   uint[] of the entity IDs to read.
+			\param[out] transforms TransformData[] filled in the same order,
+						entries of entities without a transform are zeroed.
+			\param[in] count      Number of entries to read, clamped to the
+						length of both arrays.
+			\return    Number of entities that have a transform.
+		*/
+		/******************************************************************/
+		static int m_InternalGetTransformComponents(MonoArray* entities, MonoArray* transforms, int count);
+
+		/******************************************************************/
+		/*!
+			\fn        int InternalCall::m_InternalSetTransformComponents(MonoArray* entities, MonoArray* transforms, int count)
+			\brief     Writes the transforms of many entities in one call.
+			\param[in] entities   uint[] of the entity IDs to write.
+			\param[in] transforms TransformData[] in the same order.
+			\param[in] count      Number of entries to write, clamped to the
+						length of both arrays.
+			\return    Number of entities that have a transform.
+		*/
+		/******************************************************************/
+		static int m_InternalSetTransformComponents(MonoArray* entities, MonoArray* transforms, int count);
+
 		/******************************************************************/
 		/*!
 			\fn        bool InternalCall::m_InternalGetTranslate(ecs::EntityID entity, vector2::Vec2* trans)
@@ -357,6 +399,16 @@ namespace script {
 		/******************************************************************/
 		static int m_InternalCallGetTagID(MonoString* tag);
 
+		/******************************************************************/
+		/*! \fn        int InternalCall::m_InternalCallGetTagHandle(MonoString* monostring)
+			\brief     Interns a tag so scripts can look it up by ID every
+					   frame without passing the string.
+			\param[in] monostring Pointer to the tag as a MonoString.
+			\return    The ID of the tag, stays the same while the engine runs.
+		*/
+		/******************************************************************/
+		static int m_InternalCallGetTagHandle(MonoString* tag);
+
 		/******************************************************************/
 		/*! \fn        MonoArray* InternalCall::m_InternalCallGetTagIDs(MonoString* monostring)
 			\brief     Retrieves all entity IDs associated with a specific tag.
@@ -366,6 +418,19 @@ namespace script {
 		/******************************************************************/
 		static MonoArray* m_InternalCallGetTagIDs(MonoString* tag);
 
+		/******************************************************************/
+		/*! \fn        int InternalCall::m_InternalCallGetTagIDsNonAlloc(int tag, MonoArray* results)
+			\brief     Same as m_InternalCallGetTagIDs but takes a tag ID
+					   from m_InternalCallGetTagHandle and fills an int[]
+					   owned by the script instead of allocating one.
+			\param[in] tag     The ID of the tag.
+			\param[out] results Filled with as many IDs as it holds.
+			\return    Number of entities with the tag, can be larger than
+					   the array.
+		*/
+		/******************************************************************/
+		static int m_InternalCallGetTagIDsNonAlloc(int tag, MonoArray* results);
+
 		/******************************************************************/
 		/*! \fn        MonoArray* InternalCall::m_InternalCallGetCollidedEntities(ecs::EntityID entity)
 			\brief     Retrieves the IDs of entities collided with a specified entity.
@@ -375,6 +440,18 @@ namespace script {
 		/******************************************************************/
 		static MonoArray* m_InternalCallGetCollidedEntities(ecs::EntityID entity);
 
+		/******************************************************************/
+		/*! \fn        int InternalCall::m_InternalCallGetCollidedEntitiesNonAlloc(ecs::EntityID entity, MonoArray* results)
+			\brief     Same as m_InternalCallGetCollidedEntities but fills an
+					   int[] owned by the script instead of allocating one.
+			\param[in] entity  The ID of the entity to check for collisions.
+			\param[out] results Filled with as many IDs as it holds.
+			\return    Number of entities collided with, can be larger than
+					   the array, 0 if not collided.
+		*/
+		/******************************************************************/
+		static int m_InternalCallGetCollidedEntitiesNonAlloc(ecs::EntityID entity, MonoArray* results);
+
 		/******************************************************************/
 		/*! \fn        MonoString* InternalCall::m_InternalCallGetTag(ecs::EntityID entity)
 			\brief     Retrieves the tag associated with a specified entity.
@@ -410,6 +487,24 @@ namespace script {
 		/******************************************************************/
 		static void m_InternalCallLoadScene(MonoString* monoString);
 
+		/******************************************************************/
+		/*!
+			\fn        void InternalCall::m_InternalCallLoadSceneAsync(MonoString* monoString)
+			\brief     Starts streaming a scene in over the next frames, the
+					   current scene keeps running meanwhile.
+			\param[in] monoString Pointer to the MonoString containing the name of the scene to load.
+		*/
+		/******************************************************************/
+		static void m_InternalCallLoadSceneAsync(MonoString* monoString);
+
+		/******************************************************************/
+		/*!
+			\fn        float InternalCall::m_InternalCallGetSceneLoadProgress(MonoString* monoString)
+			\brief     Load progress of a scene from 0 to 1, 1 once it is loaded.
+		*/
+		/******************************************************************/
+		static float m_InternalCallGetSceneLoadProgress(MonoString* monoString);
+
 		/******************************************************************/
 		/*!
 			\fn        int InternalCall::m_InternalCallAddPrefab(MonoString* prefab, const float* x, const float* y, const float* rotation)
@@ -432,6 +527,56 @@ namespace script {
 		/******************************************************************/
 		static void m_InternalCallDeleteEntity(ecs::EntityID entity);
 
+		/******************************************************************/
+		/*!
+			\fn        int InternalCall::m_InternalCallPrewarmPrefab(MonoString* prefab, int count)
+			\brief     Creates parked instances of a prefab for m_InternalCallAcquirePrefab.
+			\param[in] prefab Pointer to the MonoString containing the prefab name.
+			\param[in] count Number of instances the pool should hold.
+			\return    Number of instances parked for the prefab.
+		*/
+		/******************************************************************/
+		static int m_InternalCallPrewarmPrefab(MonoString* prefab, int count);
+
+		/******************************************************************/
+		/*!
+			\fn        int InternalCall::m_InternalCallAcquirePrefab(MonoString* prefab, const float* x, const float* y, const float* rotation)
+			\brief     Same as m_InternalCallAddPrefab, but reuses a parked instance
+					   of the prefab when there is one.
+			\return    An integer representing the ID of the instance, -1 on error.
+		*/
+		/******************************************************************/
+		static int m_InternalCallAcquirePrefab(MonoString* prefab, const float* x, const float* y, const float* rotation);
+
+		/******************************************************************/
+		/*!
+			\fn        bool InternalCall::m_InternalCallReleaseEntity(ecs::EntityID entity)
+			\brief     Returns an acquired instance to its pool, other entities are deleted.
+			\param[in] entity The ID of the entity to release.
+			\return    True if the entity was parked.
+		*/
+		/******************************************************************/
+		static bool m_InternalCallReleaseEntity(ecs::EntityID entity);
+
+		/******************************************************************/
+		/*!
+			\fn        bool InternalCall::m_InternalCallSaveSnapshot(MonoString* name, MonoString* scene)
+			\brief     Captures a loaded scene in memory under a name, for a
+					   checkpoint or a level restart.
+			\return    False if the scene is not loaded.
+		*/
+		/******************************************************************/
+		static bool m_InternalCallSaveSnapshot(MonoString* name, MonoString* scene);
+
+		/******************************************************************/
+		/*!
+			\fn        void InternalCall::m_InternalCallRestoreSnapshot(MonoString* name)
+			\brief     Puts the scene saved under name back to its captured
+					   state, the rest of the frame's scripts are skipped.
+		*/
+		/******************************************************************/
+		static void m_InternalCallRestoreSnapshot(MonoString* name);
+
 		/******************************************************************/
 		/*!
 			\fn        float InternalCall::m_InternalCallIsCollided(ecs::EntityID entity)
@@ -1159,6 +1304,15 @@ namespace script {
 		/******************************************************************/
 		static int m_GetRandomInt(int min, int max);
 
+		/******************************************************************/
+		/*!
+		\fn      static void m_InternalCallLogError(MonoString* message)
+		\brief   Writes an error from a script to the engine log.
+		\param   message - Text of the error.
+		*/
+		/******************************************************************/
+		static void m_InternalCallLogError(MonoString* message);
+
 		/******************************************************************/
 		/*!
 		\fn      static MonoString* m_GetScenefromID(ecs::EntityID id)
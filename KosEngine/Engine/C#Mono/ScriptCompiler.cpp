@@ -0,0 +1,290 @@
+/******************************************************************/
+/*!
+\file      ScriptCompiler.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      April 02, 2025
+\brief     This file contains the definitions of the ScriptCompiler
+		   class.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include "../Config/pch.h"
+#include "ScriptCompiler.h"
+#include "../Debugging/Logging.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#else
+#include <spawn.h>
+#include <sys/wait.h>
+extern char** environ;
+#endif
+
+namespace script {
+
+	static constexpr uint64_t fnvOffset = 14695981039346656037ull;
+	static constexpr uint64_t fnvPrime = 1099511628211ull;
+
+	static void HashBytes(uint64_t& hash, const char* data, size_t size) {
+		for (size_t n{}; n < size; n++) {
+			hash ^= static_cast<unsigned char>(data[n]);
+			hash *= fnvPrime;
+		}
+	}
+
+	static void HashString(uint64_t& hash, const std::string& text) {
+		//the terminator keeps "ab","c" apart from "a","bc"
+		HashBytes(hash, text.c_str(), text.size() + 1);
+	}
+
+	//path of the file from the base folder, two scripts with the same name in
+	//different folders give different keys
+	static std::string RelativeKey(const std::filesystem::path& file, const std::filesystem::path& base) {
+		std::error_code ec;
+		const std::filesystem::path absolute = std::filesystem::absolute(file, ec).lexically_normal();
+		if (ec) return file.generic_string();
+
+		const std::filesystem::path relative = absolute.lexically_relative(base);
+		return relative.empty() ? absolute.generic_string() : relative.generic_string();
+	}
+
+	//a bare name is left to the PATH lookup of the process launch
+	static bool CompilerExists(const std::filesystem::path& compiler) {
+		if (!compiler.has_parent_path()) return true;
+
+		std::error_code ec;
+		for (const char* extension : { "", ".bat", ".cmd", ".exe" }) {
+			std::filesystem::path candidate = compiler;
+			candidate += extension;
+			if (std::filesystem::is_regular_file(candidate, ec)) return true;
+		}
+		return false;
+	}
+
+	bool ScriptCompiler::m_HashFile(const std::filesystem::path& path, uint64_t& hash)
+	{
+		std::error_code ec;
+		const std::filesystem::path absolute = std::filesystem::absolute(path, ec);
+		const auto writeTime = std::filesystem::last_write_time(absolute, ec);
+		if (ec) return false;
+		const std::uintmax_t size = std::filesystem::file_size(absolute, ec);
+		if (ec) return false;
+
+		const std::string key = absolute.lexically_normal().string();
+		const auto& cached = m_fileHashes.find(key);
+		if (cached != m_fileHashes.end() && cached->second.m_writeTime == writeTime && cached->second.m_size == size) {
+			hash = cached->second.m_hash;
+			return true;
+		}
+
+		std::ifstream file(absolute, std::ios::binary);
+		if (!file) return false;
+
+		uint64_t contentHash = fnvOffset;
+		std::array<char, 64 * 1024> buffer;
+		while (file) {
+			file.read(buffer.data(), buffer.size());
+			HashBytes(contentHash, buffer.data(), static_cast<size_t>(file.gcount()));
+		}
+
+		m_fileHashes[key] = FileHash{ writeTime, size, contentHash };
+		hash = contentHash;
+		return true;
+	}
+
+	std::string ScriptCompiler::m_GetKey(const CompileJob& job)
+	{
+		uint64_t key = fnvOffset;
+		HashString(key, job.m_compiler.string());
+		for (const std::string& option : job.m_options) {
+			HashString(key, option);
+		}
+
+		//files are named from the output folder, so moving the whole project keeps the key
+		const std::filesystem::path base = std::filesystem::absolute(job.m_output).parent_path().lexically_normal();
+
+		//sorted, so the order the assets are found in does not matter
+		const auto hashFiles = [this, &key, &base](std::vector<std::filesystem::path> files) {
+			std::sort(files.begin(), files.end());
+			for (const auto& file : files) {
+				uint64_t hash{};
+				if (!m_HashFile(file, hash)) {
+					LOGGING_WARN("Unable to read {} for the script cache", file.string());
+					return false;
+				}
+				HashString(key, RelativeKey(file, base));
+				HashBytes(key, reinterpret_cast<const char*>(&hash), sizeof(hash));
+			}
+			return true;
+		};
+
+		HashString(key, "sources");
+		if (!hashFiles(job.m_sources)) return {};
+		HashString(key, "references");
+		if (!hashFiles(job.m_references)) return {};
+
+		return std::format("{:016x}", key);
+	}
+
+	std::filesystem::path ScriptCompiler::m_GetStampPath(const std::filesystem::path& output)
+	{
+		std::filesystem::path stamp = output;
+		stamp += ".hash";
+		return stamp;
+	}
+
+	ScriptCompiler::CompileResult ScriptCompiler::m_Compile(const CompileJob& job)
+	{
+		const std::string name = job.m_output.filename().stem().string();
+		const std::filesystem::path stampPath = m_GetStampPath(job.m_output);
+
+		const std::string key = m_GetKey(job);
+		if (!key.empty() && std::filesystem::exists(job.m_output)) {
+			std::string stamp;
+			std::ifstream stampFile(stampPath);
+			if (stampFile && std::getline(stampFile, stamp) && stamp == key) {
+				LOGGING_INFO("{}.dll is up to date, compile skipped", name);
+				return UPTODATE;
+			}
+		}
+
+		if (!CompilerExists(job.m_compiler)) {
+			LOGGING_ERROR("C# compiler not found at {}, install Mono or copy its bin folder into C#Mono/CompilerCSC", job.m_compiler.string());
+			return FAILED;
+		}
+
+		std::vector<std::string> args = job.m_options;
+		args.push_back("/out:" + job.m_output.string());
+		for (const auto& reference : job.m_references) {
+			args.push_back("/reference:" + reference.string());
+		}
+		for (const auto& source : job.m_sources) {
+			args.push_back(source.string());
+		}
+
+		LOGGING_INFO("Compiling {}.dll from {} files", name, job.m_sources.size());
+
+		const auto start = std::chrono::steady_clock::now();
+		const int result = m_RunProcess(job.m_compiler, args);
+		const std::chrono::duration<float, std::milli> duration = std::chrono::steady_clock::now() - start;
+
+		if (result != 0) {
+			LOGGING_ERROR("Compilation failed! {} exited with {}", job.m_compiler.string(), result);
+			return FAILED;
+		}
+
+		LOGGING_INFO("Compilation successful: {}.dll, {} ms", name, duration.count());
+
+		//an unreadable input leaves no stamp, the next compile is not skipped
+		if (key.empty()) {
+			std::error_code ec;
+			std::filesystem::remove(stampPath, ec);
+			return COMPILED;
+		}
+
+		std::ofstream stampFile(stampPath, std::ios::trunc);
+		stampFile << key << '\n';
+		return COMPILED;
+	}
+
+#ifdef _WIN32
+	//quotes an argument the way CommandLineToArgvW splits it
+	static void AppendArgument(std::wstring& commandLine, const std::wstring& arg) {
+		if (!commandLine.empty()) {
+			commandLine += L' ';
+		}
+
+		if (!arg.empty() && arg.find_first_of(L" \t\"") == std::wstring::npos) {
+			commandLine += arg;
+			return;
+		}
+
+		commandLine += L'"';
+		size_t backslashes{};
+		for (const wchar_t c : arg) {
+			if (c == L'\\') {
+				backslashes++;
+				continue;
+			}
+			//backslashes are only escaped in front of a quote
+			commandLine.append(c == L'"' ? backslashes * 2 + 1 : backslashes, L'\\');
+			backslashes = 0;
+			commandLine += c;
+		}
+		commandLine.append(backslashes * 2, L'\\');
+		commandLine += L'"';
+	}
+#endif
+
+	int ScriptCompiler::m_RunProcess(const std::filesystem::path& program, const std::vector<std::string>& args)
+	{
+#ifdef _WIN32
+		std::wstring commandLine;
+		AppendArgument(commandLine, program.wstring());
+		for (const std::string& arg : args) {
+			AppendArgument(commandLine, std::filesystem::path(arg).wstring());
+		}
+
+		//csc in a Mono install is csc.bat, which only cmd can run. With /s cmd
+		//strips the outer quotes and runs the rest as written
+		std::wstring shellLine = L"cmd.exe /d /s /c \"" + commandLine + L"\"";
+
+		STARTUPINFOW startupInfo{};
+		startupInfo.cb = sizeof(startupInfo);
+		PROCESS_INFORMATION processInfo{};
+
+		if (!CreateProcessW(nullptr, shellLine.data(), nullptr, nullptr, FALSE, 0, nullptr, nullptr, &startupInfo, &processInfo)) {
+			LOGGING_ERROR("Fail to run {}, error {}", program.string(), static_cast<unsigned long>(GetLastError()));
+			return -1;
+		}
+
+		WaitForSingleObject(processInfo.hProcess, INFINITE);
+
+		DWORD exitCode{};
+		GetExitCodeProcess(processInfo.hProcess, &exitCode);
+		CloseHandle(processInfo.hThread);
+		CloseHandle(processInfo.hProcess);
+		return static_cast<int>(exitCode);
+#else
+		const std::string programName = program.string();
+		std::vector<char*> argv;
+		argv.push_back(const_cast<char*>(programName.c_str()));
+		for (const std::string& arg : args) {
+			argv.push_back(const_cast<char*>(arg.c_str()));
+		}
+		argv.push_back(nullptr);
+
+		//searches the PATH when the program has no directory
+		pid_t pid{};
+		const int error = posix_spawnp(&pid, programName.c_str(), nullptr, nullptr, argv.data(), environ);
+		if (error != 0) {
+			LOGGING_ERROR("Fail to run {}, error {}", programName, error);
+			return -1;
+		}
+
+		int status{};
+		while (waitpid(pid, &status, 0) == -1) {
+			if (errno != EINTR) return -1;
+		}
+		return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+#endif
+	}
+
+	std::filesystem::path ScriptCompiler::m_GetCompilerPath(const std::filesystem::path& engineDirectory)
+	{
+#ifdef _WIN32
+		return engineDirectory / "C#Mono" / "CompilerCSC" / "bin" / "csc";
+#else
+		(void)engineDirectory;
+		return "csc";
+#endif
+	}
+
+}
@@ -0,0 +1,111 @@
+/******************************************************************/
+/*!
+\file      ScriptCompiler.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      April 02, 2025
+\brief     This file contains the ScriptCompiler class, which runs the
+		   C# compiler only when the input of an assembly changed.
+
+		   The key of an assembly is a hash of the compiler options,
+		   the content of every source and the content of every
+		   referenced DLL, each named by its path from the output
+		   folder. It is written next to the output DLL after
+		   a successful compile, an assembly whose stamp holds the same
+		   key is not compiled again. A failed compile leaves the last
+		   stamp alone, it still describes the DLL on disk.
+
+		   Files are only read again when their size or write time
+		   changed since they were last hashed.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#ifndef SCRIPTCOMPILER_H
+#define SCRIPTCOMPILER_H
+
+#include "../Config/pch.h"
+
+namespace script {
+
+	class ScriptCompiler {
+
+	public:
+
+		enum CompileResult {
+			UPTODATE,
+			COMPILED,
+			FAILED
+		};
+
+		struct CompileJob {
+			std::filesystem::path m_compiler;
+			//passed before the output, references and sources
+			std::vector<std::string> m_options;
+			std::vector<std::filesystem::path> m_sources;
+			std::vector<std::filesystem::path> m_references;
+			std::filesystem::path m_output;
+		};
+
+		/******************************************************************/
+		/*!
+			\fn        CompileResult m_Compile(const CompileJob& job)
+			\brief     Compiles the sources into the output DLL, unless the
+					   DLL was already compiled from the same input.
+		*/
+		/******************************************************************/
+		CompileResult m_Compile(const CompileJob& job);
+
+		/******************************************************************/
+		/*!
+			\fn        std::string m_GetKey(const CompileJob& job)
+			\brief     Hash of everything the output DLL is built from, the
+					   order of the sources and references does not matter.
+			\return    Empty if a source or reference cannot be read.
+		*/
+		/******************************************************************/
+		std::string m_GetKey(const CompileJob& job);
+
+		/******************************************************************/
+		/*!
+			\fn        static int m_RunProcess(const std::filesystem::path& program, const std::vector<std::string>& args)
+			\brief     Runs a program with the arguments and waits for it to
+					   exit. On Windows it runs through cmd, so batch files
+					   such as the csc of Mono can be run.
+			\return    Exit code of the program, -1 if it could not be run.
+		*/
+		/******************************************************************/
+		static int m_RunProcess(const std::filesystem::path& program, const std::vector<std::string>& args);
+
+		/******************************************************************/
+		/*!
+			\fn        static std::filesystem::path m_GetCompilerPath(const std::filesystem::path& engineDirectory)
+			\brief     The csc.bat of the Mono copied into C#Mono/CompilerCSC
+					   on Windows, the csc installed with Mono on other
+					   platforms. m_Compile fails with an error naming the
+					   path if it is missing.
+		*/
+		/******************************************************************/
+		static std::filesystem::path m_GetCompilerPath(const std::filesystem::path& engineDirectory);
+
+	private:
+
+		struct FileHash {
+			std::filesystem::file_time_type m_writeTime{};
+			std::uintmax_t m_size{};
+			uint64_t m_hash{};
+		};
+
+		bool m_HashFile(const std::filesystem::path& path, uint64_t& hash);
+
+		static std::filesystem::path m_GetStampPath(const std::filesystem::path& output);
+
+		//last hash of each file read, by absolute path
+		std::unordered_map<std::string, FileHash> m_fileHashes;
+	};
+
+}
+
+#endif SCRIPTCOMPILER_H
@@ -80,11 +80,14 @@ namespace script {
 
         //load gamescript assembly location
         m_AddScripts("../Engine/scriptLibrary/GameScript/ScriptCoreDLL/GameScript.dll");
+
+        m_LoadScheduler();
     }
 
     void ScriptHandler::m_UnloadSecondaryDomain()
     {
         if (m_AppDomain == nullptr)return;
+        m_ReleaseScheduler();
         //reset any references to the MonoAssembly
         mono_domain_set(m_rootDomain, false);
         mono_domain_unload(m_AppDomain);
@@ -113,6 +116,8 @@ namespace script {
         // Free methods and image
         auto& scriptData = scriptEntry->second;
         m_methodMap.clear();
+        //class IDs are kept, the tables are filled again when the DLL is reloaded
+        std::fill(m_methodTables.begin(), m_methodTables.end(), ScriptMethodTable{});
         if (scriptData.m_image) {
             mono_image_close(scriptData.m_image);
             scriptData.m_image = nullptr;
@@ -183,6 +188,15 @@ namespace script {
         //}
         //Add method into container
         m_methodMap[className][methodName] = method;
+
+        static const char* const tableMethods[TOTALSCRIPTMETHOD] = { "Awake", "Start", "Update", "LateUpdate" };
+        const auto& tableMethod = std::find(std::begin(tableMethods), std::end(tableMethods), methodName);
+        if (tableMethod != std::end(tableMethods)) {
+            ScriptMethodTable& table = m_methodTables[m_GetClassID(className)];
+            const size_t index = std::distance(std::begin(tableMethods), tableMethod);
+            table.m_methods[index] = method;
+            table.m_thunks[index] = mono_method_get_unmanaged_thunk(method);
+        }
         method = nullptr;
 
         return true;
@@ -262,6 +276,149 @@ namespace script {
         
     }
 
+    int ScriptHandler::m_GetClassID(const std::string& className)
+    {
+        const auto& it = m_classIDs.find(className);
+        if (it != m_classIDs.end()) return it->second;
+
+        const int classID = static_cast<int>(m_methodTables.size());
+        m_methodTables.emplace_back();
+        m_classIDs[className] = classID;
+        return classID;
+    }
+
+    void ScriptHandler::m_InvokeMethod(int classID, ScriptMethod method, MonoObject* objInstance, void** args) {
+
+        if (objInstance == nullptr) return;
+        if (classID < 0 || classID >= static_cast<int>(m_methodTables.size())) return;
+
+        void* thunk = m_methodTables[classID].m_thunks[method];
+        if (!thunk) return;
+
+        MonoException* exception = nullptr;
+
+        try {
+            if (method == METHODAWAKE) {
+                reinterpret_cast<void(SCRIPT_THUNK_CALL*)(MonoObject*, uint32_t, MonoException**)>(thunk)(objInstance, *static_cast<uint32_t*>(args[0]), &exception);
+            }
+            else {
+                reinterpret_cast<void(SCRIPT_THUNK_CALL*)(MonoObject*, MonoException**)>(thunk)(objInstance, &exception);
+            }
+
+            if (exception) {
+
+                LOGGING_WARN("Script Exception Occured");
+                mono_print_unhandled_exception(reinterpret_cast<MonoObject*>(exception));
+            }
+        }
+        catch (...) {
+            throw 1;
+        }
+    }
+
+    void ScriptHandler::m_LoadScheduler()
+    {
+        const auto& core = m_loadedDLLMap.find("GameScript");
+        if (core == m_loadedDLLMap.end() || !core->second.m_image) return;
+
+        MonoClass* scheduler = mono_class_from_name(core->second.m_image, "", "ScriptScheduler");
+        MonoMethod* run = scheduler ? mono_class_get_method_from_name(scheduler, "Run", 5) : nullptr;
+        if (!run) {
+            LOGGING_WARN("ScriptScheduler not found, scripts are invoked one at a time");
+            return;
+        }
+
+        m_schedulerRun = mono_method_get_unmanaged_thunk(run);
+    }
+
+    void ScriptHandler::m_ReleaseScheduler()
+    {
+        if (m_scheduleCapacity) {
+            mono_gchandle_free(m_scheduleScriptsHandle);
+            mono_gchandle_free(m_scheduleStartHandle);
+        }
+
+        m_schedulerRun = nullptr;
+        m_scheduleScriptsHandle = 0;
+        m_scheduleStartHandle = 0;
+        m_scheduleCapacity = 0;
+        m_scheduleScripts.clear();
+        m_scheduleFlags = nullptr;
+    }
+
+    bool ScriptHandler::m_SetScripts(MonoObject* const* scripts, const uint8_t* start, size_t count)
+    {
+        if (!m_schedulerRun) return false;
+
+        if (count > m_scheduleCapacity) {
+            if (m_scheduleCapacity) {
+                mono_gchandle_free(m_scheduleScriptsHandle);
+                mono_gchandle_free(m_scheduleStartHandle);
+            }
+
+            m_scheduleCapacity = std::max<size_t>(count * 2, 64);
+            MonoArray* flags = mono_array_new(m_AppDomain, mono_get_byte_class(), m_scheduleCapacity);
+            m_scheduleScriptsHandle = mono_gchandle_new(reinterpret_cast<MonoObject*>(mono_array_new(m_AppDomain, mono_get_object_class(), m_scheduleCapacity)), false);
+            m_scheduleStartHandle = mono_gchandle_new(reinterpret_cast<MonoObject*>(flags), true);
+            m_scheduleFlags = mono_array_addr(flags, uint8_t, 0);
+
+            //the new array is empty
+            m_scheduleScripts.assign(m_scheduleCapacity, nullptr);
+        }
+
+        //the collector may move the object array, only its handle stays the same
+        MonoArray* scriptArray = reinterpret_cast<MonoArray*>(mono_gchandle_get_target(m_scheduleScriptsHandle));
+
+        //the scripts of a frame are mostly the ones of the last frame, in the same order.
+        //instances are pinned, the array holds the ones it keeps so their address is not reused
+        for (size_t n{}; n < m_scheduleScripts.size(); n++) {
+            //the handles of skipped scripts may already be freed, entries past the frame do not keep deleted scripts alive
+            MonoObject* script = (n < count && start[n] != m_scheduleSkip) ? scripts[n] : nullptr;
+            if (m_scheduleScripts[n] == script) continue;
+
+            mono_array_setref(scriptArray, n, script);
+            m_scheduleScripts[n] = script;
+        }
+
+        return true;
+    }
+
+    bool ScriptHandler::m_RunScripts(size_t first, const uint8_t* start, size_t count, uint8_t phase)
+    {
+        if (!m_schedulerRun || first + count > m_scheduleCapacity) return false;
+
+        MonoArray* scriptArray = reinterpret_cast<MonoArray*>(mono_gchandle_get_target(m_scheduleScriptsHandle));
+        MonoArray* startArray = reinterpret_cast<MonoArray*>(mono_gchandle_get_target(m_scheduleStartHandle));
+
+        //flags change during the frame, skipped scripts of later groups are only in start
+        if (count) {
+            std::memcpy(m_scheduleFlags + first, start, count);
+        }
+
+        m_scheduleFirst = first;
+        m_scheduleCount = count;
+
+        MonoException* exception = nullptr;
+        reinterpret_cast<void(SCRIPT_THUNK_CALL*)(MonoArray*, MonoArray*, int, int, int, MonoException**)>(m_schedulerRun)(scriptArray, startArray, static_cast<int>(first), static_cast<int>(count), static_cast<int>(phase), &exception);
+
+        m_scheduleFirst = 0;
+        m_scheduleCount = 0;
+
+        if (exception) {
+            LOGGING_WARN("Script Exception Occured");
+            mono_print_unhandled_exception(reinterpret_cast<MonoObject*>(exception));
+        }
+
+        return true;
+    }
+
+    void ScriptHandler::m_SkipScripts(size_t first, size_t count)
+    {
+        if (first < m_scheduleFirst || first >= m_scheduleFirst + m_scheduleCount) return;
+
+        std::fill_n(m_scheduleFlags + first, std::min(count, m_scheduleFirst + m_scheduleCount - first), m_scheduleSkip);
+    }
+
     void ScriptHandler::m_ReloadAllDLL()
     {
         //reload all .dll file
@@ -329,38 +486,15 @@ namespace script {
         //IF COMPILE ERROR, MAKE SURE TO UNLOAD ASSEMBLY AND APPDOMAIN
         std::filesystem::path projectBasePath = std::filesystem::current_path();
 
-        std::string compilepath = "\"" + projectBasePath.string() + "\\C#Mono\\CompilerCSC\\bin\\csc\"";
-
-        std::filesystem::path referenceDLL = projectBasePath / "ScriptLibrary" / "GameScript" / "ScriptCoreDLL" / "GameScript.dll";
-
-        std::string test = filePath.filename().stem().string();
-
-        std::filesystem::path outputDLL = projectBasePath / "Assets" / "Scripts" / "ScriptsDLL" / (filePath.filename().stem().string() + ".dll");
+        ScriptCompiler::CompileJob job;
+        job.m_compiler = ScriptCompiler::m_GetCompilerPath(projectBasePath);
+        job.m_options = { "/target:library" };
+        job.m_sources = { filePath };
+        job.m_references = { projectBasePath / "ScriptLibrary" / "GameScript" / "ScriptCoreDLL" / "GameScript.dll" };
+        job.m_output = projectBasePath / "Assets" / "Scripts" / "ScriptsDLL" / (filePath.filename().stem().string() + ".dll");
 
-        std::string command = compilepath + " /target:library \"/out:" + outputDLL.string() + "\" \"/reference:" + referenceDLL.string() + "\" \"" + filePath.string() + "\"";
-        
-        // Write the command to a batch file
-        std::ofstream batchFile("run_command.bat");
-        batchFile << command << std::endl;
-        batchFile.close();
-
-        LOGGING_INFO("Generated command: {}", command.c_str());
-
-        //// Execute the command
-        int result = system("run_command.bat");
-            
-        //remove bat file
-        std::remove("run_command.bat");
-
-        // Check the result of the command
-        if (result == 0)
-        {
-            LOGGING_INFO("Compilation successful: {}.dll", filePath.filename().stem().string().c_str());
-        }
-        else
-        {
-            LOGGING_ERROR("Compilation failed!");
-        }
+        // compiled only if the script or GameScript changed, logs the result
+        m_compiler.m_Compile(job);
     }
 
     void ScriptHandler::m_CompileAllCSharptoSingleDLL()
@@ -374,40 +508,15 @@ namespace script {
         //IF COMPILE ERROR, MAKE SURE TO UNLOAD ASSEMBLY AND APPDOMAIN
         std::filesystem::path projectBasePath = std::filesystem::current_path().parent_path() / "Engine";
 
-        std::string compilepath = "\"" + projectBasePath.string() + "\\C#Mono\\CompilerCSC\\bin\\csc\"" + " /unsafe";
-
-        std::filesystem::path referenceDLL = projectBasePath / "ScriptLibrary" / "GameScript" / "ScriptCoreDLL" / "GameScript.dll";
-
-        std::string Accfile;
-
-        std::for_each(m_CSScripts.begin(), m_CSScripts.end(), [&Accfile](const std::pair<std::string, std::filesystem::path>& file_path) { Accfile += ("\"" + file_path.second.string() + "\" ");});
+        ScriptCompiler::CompileJob job;
+        job.m_compiler = ScriptCompiler::m_GetCompilerPath(projectBasePath);
+        job.m_options = { "/unsafe", "/target:library" };
+        std::for_each(m_CSScripts.begin(), m_CSScripts.end(), [&job](const std::pair<std::string, std::filesystem::path>& file_path) { job.m_sources.push_back(file_path.second); });
+        job.m_references = { projectBasePath / "ScriptLibrary" / "GameScript" / "ScriptCoreDLL" / "GameScript.dll" };
+        job.m_output = projectBasePath.parent_path() / "Assets" / "Scripts" / "ScriptsDLL" / (m_outputdll + ".dll");
 
-        std::filesystem::path outputDLL = projectBasePath.parent_path() / "Assets" / "Scripts" / "ScriptsDLL" / (m_outputdll + ".dll");
-
-        std::string command = compilepath + " /target:library \"/out:" + outputDLL.string() + "\" \"/reference:" + referenceDLL.string() + "\" " + Accfile;
-
-        // Write the command to a batch file
-        std::ofstream batchFile("run_command.bat");
-        batchFile << command << std::endl;
-        batchFile.close();
-
-        LOGGING_INFO("Generated command: {}", command.c_str());
-
-        //// Execute the command
-        int result = system("run_command.bat");
-
-        //remove bat file
-        std::remove("run_command.bat");
-
-        // Check the result of the command
-        if (result == 0)
-        {
-            LOGGING_INFO("Compilation successful: {}.dll", m_outputdll);
-        }
-        else
-        {
-            LOGGING_ERROR("Compilation failed!");
-        }
+        // pressing play again without editing a script does not run csc, logs the result
+        m_compiler.m_Compile(job);
 
     }
 
@@ -540,4 +649,53 @@ namespace script {
     }
 
 
+
+    void ScriptHandler::m_storeVariablesFromScript(ecs::ScriptComponent* sc, const std::string& script)
+    {
+        const auto& instance = sc->m_scriptInstances.find(script);
+        if (instance == sc->m_scriptInstances.end() || instance->second.first == nullptr) return;
+
+        const auto& it = std::find_if(sc->m_scripts.begin(), sc->m_scripts.end(), [&](auto& x) {return std::get<0>(x) == script; });
+        if (it == sc->m_scripts.end()) return;
+
+        MonoObject* object = instance->second.first;
+        MonoClass* scriptclass = mono_object_get_class(object);
+
+        void* iter = nullptr;
+        MonoClassField* field;
+        while ((field = mono_class_get_fields(scriptclass, &iter)) != nullptr) {
+            // only public, non static fields are serialized
+            if ((mono_field_get_flags(field) & 0x0010) || (mono_field_get_flags(field) & 0x0006) != 0x0006) continue;
+
+            const char* fieldName = mono_field_get_name(field);
+            int fieldTypeCode = mono_type_get_type(mono_field_get_type(field));
+
+            // same encoding the editor writes into the field map
+            if (fieldTypeCode == MONO_TYPE_I4) {
+                int integer{};
+                mono_field_get_value(object, field, &integer);
+                std::get<2>(*it)[fieldName] = Serialization::Serialize::m_EncodeBase64(&integer, sizeof(integer));
+            }
+            else if (fieldTypeCode == MONO_TYPE_R4) {
+                float _float{};
+                mono_field_get_value(object, field, &_float);
+                std::get<2>(*it)[fieldName] = Serialization::Serialize::m_EncodeBase64(&_float, sizeof(_float));
+            }
+            else if (fieldTypeCode == MONO_TYPE_BOOLEAN) {
+                bool _bool{};
+                mono_field_get_value(object, field, &_bool);
+                std::get<2>(*it)[fieldName] = Serialization::Serialize::m_EncodeBase64(&_bool, sizeof(_bool));
+            }
+            else if (fieldTypeCode == MONO_TYPE_STRING) {
+                MonoString* monoString = nullptr;
+                mono_field_get_value(object, field, &monoString);
+                if (!monoString) continue;
+
+                char* nativeString = mono_string_to_utf8(monoString);
+                std::get<2>(*it)[fieldName] = nativeString;
+                mono_free(nativeString);
+            }
+        }
+    }
+
 }
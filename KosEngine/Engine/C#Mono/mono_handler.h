@@ -36,10 +36,35 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include <mono/metadata/debug-helpers.h>
 
 #include "../ECS/ECS.h"
+#include "ScriptCompiler.h"
 
 
+//calling convention of mono_method_get_unmanaged_thunk
+#ifdef _WIN32
+#define SCRIPT_THUNK_CALL __stdcall
+#else
+#define SCRIPT_THUNK_CALL
+#endif
+
 namespace script {
 
+	//callbacks every script class may define, invoked through its method table
+	enum ScriptMethod {
+		METHODAWAKE,
+		METHODSTART,
+		METHODUPDATE,
+		METHODLATEUPDATE,
+
+		TOTALSCRIPTMETHOD
+	};
+
+	// one per script class, indexed by the class ID
+	struct ScriptMethodTable {
+		MonoMethod* m_methods[TOTALSCRIPTMETHOD]{};
+		//unmanaged entry points of m_methods, called without mono_runtime_invoke
+		void* m_thunks[TOTALSCRIPTMETHOD]{};
+	};
+
 	// 1 struct, 1 dll
 	struct ScriptMonoInfo {
 		std::filesystem::path m_scriptPath;
@@ -120,6 +145,8 @@ namespace script {
 		\brief   Compiles all C# scripts into a single DLL file for Mono execution.
 		\details This function aggregates and compiles multiple C# script files into a single DLL,
 				 simplifying the process of loading and managing C# assemblies within the application.
+				 The compiler is not run when the scripts and GameScript.dll are the same as the
+				 last successful compile.
 		*/
 		/******************************************************************/
 		void m_CompileAllCSharptoSingleDLL();
@@ -178,6 +205,81 @@ namespace script {
 		/******************************************************************/
 		void m_InvokeMethod(const std::string& scriptName, const std::string& methodName, MonoObject* objInstance, void** args);
 
+		/******************************************************************/
+		/*!
+			\fn        void m_InvokeMethod(int classID, ScriptMethod method, MonoObject* objInstance, void** args)
+			\brief     Invokes a callback through the class's method table,
+					   without any string lookup. Awake takes the entity ID
+					   in args[0], the other callbacks take no arguments.
+			\param[in] classID ID from m_GetClassID.
+		*/
+		/******************************************************************/
+		void m_InvokeMethod(int classID, ScriptMethod method, MonoObject* objInstance, void** args);
+
+		/******************************************************************/
+		/*!
+			\fn        int m_GetClassID(const std::string& className)
+			\brief     Integer ID of a script class, given out the first time
+					   the class is asked for. The ID stays the same when the
+					   scripts are reloaded, only its method table changes.
+		*/
+		/******************************************************************/
+		int m_GetClassID(const std::string& className);
+
+		/******************************************************************/
+		/*!
+			\fn        bool m_SetScripts(MonoObject* const* scripts, const uint8_t* start, size_t count)
+			\brief     Hands the scripts of the frame to the scheduler.
+					   The managed array is kept between frames, only the
+					   entries that differ from the last frame are written.
+			\param[in] scripts Script instances of the frame, pinned.
+			\param[in] start   Start flags of the scripts, skipped ones
+					   are not written.
+			\return    False if the ScriptCore DLL has no scheduler.
+		*/
+		/******************************************************************/
+		bool m_SetScripts(MonoObject* const* scripts, const uint8_t* start, size_t count);
+
+		/******************************************************************/
+		/*!
+			\fn        bool m_RunScripts(size_t first, const uint8_t* start, size_t count, uint8_t phase)
+			\brief     Runs Start, or Update once started, of the scripts
+					   in the range of the ones given to m_SetScripts, or
+					   their LateUpdate, all in one call to
+					   ScriptScheduler.Run in ScriptCore. An exception
+					   stops only the callback that threw it.
+			\param[in] first   Position of the first script to run.
+			\param[in] start   Flags of the scripts in the range, non zero
+					   for the scripts that run Start instead of Update.
+			\param[in] phase   m_phaseUpdate or m_phaseLateUpdate.
+			\return    False if the ScriptCore DLL has no scheduler, no
+					   script is run.
+		*/
+		/******************************************************************/
+		bool m_RunScripts(size_t first, const uint8_t* start, size_t count, uint8_t phase);
+
+		/******************************************************************/
+		/*!
+			\fn        void m_SkipScripts(size_t first, size_t count)
+			\brief     Called during m_RunScripts when scripts of the frame
+					   are destroyed, the scheduler skips the ones it has
+					   not run yet.
+			\param[in] first Position of the first script in the scripts
+					   passed to m_SetScripts, ignored outside the range
+					   that is running.
+		*/
+		/******************************************************************/
+		void m_SkipScripts(size_t first, size_t count);
+
+		//values of the start flags passed to m_RunScripts, same as ScriptScheduler
+		static constexpr uint8_t m_scheduleUpdate = 0;
+		static constexpr uint8_t m_scheduleStart = 1;
+		static constexpr uint8_t m_scheduleSkip = 2;
+
+		//callbacks run by one m_RunScripts, same as ScriptScheduler
+		static constexpr uint8_t m_phaseUpdate = 0;
+		static constexpr uint8_t m_phaseLateUpdate = 1;
+
 		/******************************************************************/
 		/*!
 			\fn        void m_HotReloadCompileAllCsharpFile()
@@ -200,6 +302,16 @@ namespace script {
 
 		void m_assignVaraiblestoScript(ecs::ScriptComponent* sc, const std::string& script);
 
+		/******************************************************************/
+		/*!
+			\fn        void m_storeVariablesFromScript(ecs::ScriptComponent* sc, const std::string& script)
+			\brief     Reads the public fields of a live script instance back
+					   into the component's field map, the reverse of
+					   m_assignVaraiblestoScript.
+		*/
+		/******************************************************************/
+		void m_storeVariablesFromScript(ecs::ScriptComponent* sc, const std::string& script);
+
 		/******************************************************************/
 		/*!
 		\var     std::vector<std::pair<std::string, std::filesystem::path>> m_CSScripts
@@ -227,6 +339,18 @@ namespace script {
 		/******************************************************************/
 		std::unordered_map<std::string, std::unordered_map<std::string, MonoMethod*>> m_methodMap;
 
+		/******************************************************************/
+		/*!
+		\var     std::vector<ScriptMethodTable> m_methodTables
+		\brief   Callbacks of each script class, indexed by the class ID.
+		\details Resolved once when the DLL is loaded, so a frame's updates
+				 do not look up any method by name.
+		*/
+		/******************************************************************/
+		std::vector<ScriptMethodTable> m_methodTables;
+
+		std::unordered_map<std::string, int> m_classIDs;
+
 		/******************************************************************/
 		/*!
 		\fn      MonoDomain* m_GetDomain()
@@ -251,6 +375,29 @@ namespace script {
 		MonoDomain* m_rootDomain = nullptr;
 
 		MonoDomain* m_AppDomain = nullptr;
+
+		void m_LoadScheduler();
+
+		void m_ReleaseScheduler();
+
+		//skips the compile of DLLs whose sources did not change
+		ScriptCompiler m_compiler;
+
+		//unmanaged entry point of ScriptScheduler.Run
+		void* m_schedulerRun{};
+
+		//handles to the object[] and byte[] passed to m_schedulerRun, reused every frame
+		uint32_t m_scheduleScriptsHandle{};
+		uint32_t m_scheduleStartHandle{};
+		size_t m_scheduleCapacity{};
+
+		//contents of the object[], entries are only written when they change
+		std::vector<MonoObject*> m_scheduleScripts;
+
+		//the byte[] is pinned, written by m_SkipScripts while the scheduler runs
+		uint8_t* m_scheduleFlags{};
+		size_t m_scheduleFirst{};
+		size_t m_scheduleCount{};
 	};
 
 	/*--------------------------------------------------------------
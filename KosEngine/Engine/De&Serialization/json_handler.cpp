@@ -51,6 +51,8 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "../Helper/Helper.h"
 #include "../Debugging/Logging.h"
 #include "../Asset Manager/Prefab.h"
+#include "../Asset Manager/PrefabIndex.h"
+#include "../Asset Manager/VirtualFileSystem.h"
 #include "../Graphics/GraphicsPipe.h"
 #include "json_handler.h"
 
@@ -95,6 +97,10 @@ namespace Serialization {
 			if (temp == "WindowWidth:") str2 >> help->m_windowWidth;
 			if (temp == "FpsCap:") str2 >> help->m_fpsCap;
 			if (temp == "StartScene:")std::getline(str2, help->m_startScene);
+			if (temp == "RecordInput:") str2 >> help->m_recordInputPath;
+			if (temp == "ReplayInput:") str2 >> help->m_replayInputPath;
+			if (temp == "Headless:") help->m_headless = static_cast<bool>(str2 >> help->m_headlessFrames);
+			if (temp == "HeadlessReport:") str2 >> help->m_headlessReportPath;
 			// Remove leading whitespace
 			help->m_startScene.erase(0, help->m_startScene.find_first_not_of(' '));
 		}
@@ -200,16 +206,14 @@ namespace Serialization {
 	{
 
 
-		// Open the JSON file for reading
-		std::ifstream inputFile(jsonFilePath.string());
-
-		if (!inputFile) {
+		// Open the JSON file for reading, loose file or packed archive
+		assetmanager::FileData filedata;
+		if (!assetmanager::VirtualFileSystem::m_GetInstance()->m_ReadFile(jsonFilePath, filedata)) {
 			LOGGING_ERROR("Failed to open JSON file for reading: {}", jsonFilePath.string().c_str());
 			return;
 		}
 
-		std::string fileContent((std::istreambuf_iterator<char>(inputFile)), std::istreambuf_iterator<char>());
-		inputFile.close();
+		std::string fileContent(filedata.m_View());
 
 		// Parse the JSON content
 		rapidjson::Document doc;
@@ -219,6 +223,28 @@ namespace Serialization {
 		
 
 		// Load Global Setting
+		m_LoadGlobalSettings(doc);
+
+		/*******************INSERT INTO FUNCTION*****************************/
+
+		// Iterate through each component entry in the JSON array
+		for (rapidjson::SizeType i = 0; i < doc.Size(); i++) {
+			const rapidjson::Value& entityData = doc[i];
+
+			if (entityData.HasMember("GlobalSettings") || entityData.HasMember("CursorSettings")) {
+				continue;
+			}
+
+
+			m_LoadEntity(entityData, std::nullopt, scenename);
+		}
+
+
+		LOGGING_INFO("Load Json Successful");
+	}
+
+	void Serialize::m_LoadGlobalSettings(const rapidjson::Document& doc)
+	{
 		//reset global settings
 		Helper::Helpers* helper = Helper::Helpers::GetInstance();
 		helper->m_colour = {0.f,0.f,0.f};
@@ -255,23 +281,6 @@ namespace Serialization {
 				}
 			}
 		}
-
-		/*******************INSERT INTO FUNCTION*****************************/
-
-		// Iterate through each component entry in the JSON array
-		for (rapidjson::SizeType i = 0; i < doc.Size(); i++) {
-			const rapidjson::Value& entityData = doc[i];
-
-			if (entityData.HasMember("GlobalSettings") || entityData.HasMember("CursorSettings")) {
-				continue;
-			}
-
-
-			m_LoadEntity(entityData, std::nullopt, scenename);
-		}
-
-
-		LOGGING_INFO("Load Json Successful");
 	}
 
 	void Serialize::m_SaveComponentsJson(const std::filesystem::path& scene)
@@ -288,29 +297,7 @@ namespace Serialization {
 
 		std::unordered_set<ecs::EntityID> savedEntities;  //track saved entities
 
-		rapidjson::Value globalSettings(rapidjson::kObjectType);
-		globalSettings.AddMember("globalIllumination",
-			graphicpipe::GraphicsPipe::m_funcGetInstance()->m_globalLightIntensity, allocator);
-
-		rapidjson::Value backgroundColor(rapidjson::kObjectType);
-		Helper::Helpers* helper = Helper::Helpers::GetInstance();
-		backgroundColor.AddMember("r", helper->m_colour.m_x, allocator);
-		backgroundColor.AddMember("g", helper->m_colour.m_y, allocator);
-		backgroundColor.AddMember("b", helper->m_colour.m_z, allocator);
-		globalSettings.AddMember("backgroundColor", backgroundColor, allocator);
-
-		rapidjson::Value settingsWrapper(rapidjson::kObjectType);
-		settingsWrapper.AddMember("GlobalSettings", globalSettings, allocator);
-		doc.PushBack(settingsWrapper, allocator);
-
-		// Save Cursor Settings
-		rapidjson::Value cursorSettings(rapidjson::kObjectType);
-		cursorSettings.AddMember("cursorImage", rapidjson::Value(helper->m_currMousePicture.c_str(), allocator), allocator);
-		cursorSettings.AddMember("isCursorCentered", helper->m_isMouseCentered, allocator);
-
-		rapidjson::Value cursorWrapper(rapidjson::kObjectType);
-		cursorWrapper.AddMember("CursorSettings", cursorSettings, allocator);
-		doc.PushBack(cursorWrapper, allocator);
+		m_SaveGlobalSettings(doc, allocator);
 
 		//Start saving the entities
 		std::vector<ecs::EntityID> entities = ecs->m_ECS_SceneMap.find(scene.filename().string())->second.m_sceneIDs;
@@ -335,6 +322,33 @@ namespace Serialization {
 		LOGGING_INFO("Save Json Successful");
 	}
 
+	void Serialize::m_SaveGlobalSettings(rapidjson::Value& parentArray, rapidjson::Document::AllocatorType& allocator)
+	{
+		rapidjson::Value globalSettings(rapidjson::kObjectType);
+		globalSettings.AddMember("globalIllumination",
+			graphicpipe::GraphicsPipe::m_funcGetInstance()->m_globalLightIntensity, allocator);
+
+		rapidjson::Value backgroundColor(rapidjson::kObjectType);
+		Helper::Helpers* helper = Helper::Helpers::GetInstance();
+		backgroundColor.AddMember("r", helper->m_colour.m_x, allocator);
+		backgroundColor.AddMember("g", helper->m_colour.m_y, allocator);
+		backgroundColor.AddMember("b", helper->m_colour.m_z, allocator);
+		globalSettings.AddMember("backgroundColor", backgroundColor, allocator);
+
+		rapidjson::Value settingsWrapper(rapidjson::kObjectType);
+		settingsWrapper.AddMember("GlobalSettings", globalSettings, allocator);
+		parentArray.PushBack(settingsWrapper, allocator);
+
+		// Save Cursor Settings
+		rapidjson::Value cursorSettings(rapidjson::kObjectType);
+		cursorSettings.AddMember("cursorImage", rapidjson::Value(helper->m_currMousePicture.c_str(), allocator), allocator);
+		cursorSettings.AddMember("isCursorCentered", helper->m_isMouseCentered, allocator);
+
+		rapidjson::Value cursorWrapper(rapidjson::kObjectType);
+		cursorWrapper.AddMember("CursorSettings", cursorSettings, allocator);
+		parentArray.PushBack(cursorWrapper, allocator);
+	}
+
 	void Serialize::m_SaveEntity(ecs::EntityID entityId, rapidjson::Value& parentArray, rapidjson::Document::AllocatorType& allocator, std::unordered_set<ecs::EntityID>& savedEntities) {
 		auto* ecs = ecs::ECS::m_GetInstance();
 		auto& signature = ecs->m_ECS_EntityMap.find(entityId)->second;
@@ -359,6 +373,9 @@ namespace Serialization {
 				name.AddMember("isprefab", nc->m_isPrefab, allocator);
 				tagValue.SetString(nc->m_entityTag.c_str(), allocator);
 				name.AddMember("tagstr", tagValue, allocator);
+				if (nc->m_fullTickRate) {
+					name.AddMember("fulltickrate", nc->m_fullTickRate, allocator);
+				}
 				if (nc->m_isPrefab) {
 					prefabValue.SetString(nc->m_prefabName.c_str(), allocator);
 					name.AddMember("prefabname", prefabValue, allocator);
@@ -889,7 +906,7 @@ namespace Serialization {
 		}
 	}
 
-	void Serialize::m_LoadEntity(const rapidjson::Value& entityData, std::optional<ecs::EntityID> parentID, const std::string& sceneName)
+	ecs::EntityID Serialize::m_LoadEntity(const rapidjson::Value& entityData, std::optional<ecs::EntityID> parentID, const std::string& sceneName, bool loadChildren)
 	{
 		ecs::ECS* ecs = ecs::ECS::m_GetInstance();
 		ecs::EntityID newEntityId = ecs->m_CreateEntity(sceneName);
@@ -912,6 +929,10 @@ namespace Serialization {
 			}
 			if (name.HasMember("tagstr") && name["tagstr"].IsString()) {
 				nc->m_entityTag = name["tagstr"].GetString();
+				ecs->m_UpdateTag(newEntityId);
+			}
+			if (name.HasMember("fulltickrate") && name["fulltickrate"].IsBool()) {
+				nc->m_fullTickRate = name["fulltickrate"].GetBool();
 			}
 			if (nc->m_isPrefab) {
 				if (name.HasMember("prefabname") && name["prefabname"].IsString()) {
@@ -920,6 +941,7 @@ namespace Serialization {
 				if (name.HasMember("issync") && name["issync"].IsBool()) {
 					nc->m_syncPrefab = name["issync"].GetBool();
 				}
+				prefab::PrefabIndex::m_GetInstance()->m_Register(newEntityId);
 			}
 
 		}
@@ -1533,12 +1555,14 @@ namespace Serialization {
 		}
 
 		// Load children 
-		if (entityData.HasMember("children") && entityData["children"].IsArray()) {
+		if (loadChildren && entityData.HasMember("children") && entityData["children"].IsArray()) {
 			const rapidjson::Value& childrenArray = entityData["children"];
 			for (rapidjson::SizeType i = 0; i < childrenArray.Size(); i++) {
 				m_LoadEntity(childrenArray[i], newEntityId, sceneName);
 			}
 		}
+
+		return newEntityId;
 	}
 	void Serialization::Serialize::m_SavePhysicsLayerMatrix() {
 		std::ofstream file(layerFilePath);
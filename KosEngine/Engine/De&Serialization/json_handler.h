@@ -86,16 +86,36 @@ namespace Serialization {
 
 		/******************************************************************/
 		/*!
-			\fn        Serialize::m_LoadEntity(const rapidjson::Value& entityData, std::optional<ecs::EntityID> parentID, const std::string& sceneName)
+			\fn        Serialize::m_LoadEntity(const rapidjson::Value& entityData, std::optional<ecs::EntityID> parentID, const std::string& sceneName, bool loadChildren)
 			\brief     Loads an individual entity's component data from a JSON structure.
 			\param[in] entityData     The JSON value containing the entity data.
 			\param[in] parentID       The optional ID of the parent entity, used to maintain parent-child relationships.
 			\param[in] sceneName      The name of the scene to which this entity belongs.
+			\param[in] loadChildren   False to leave the children to the caller, used when streaming a scene.
+			\return    The ID of the created entity.
 			\details   This function parses component data from a JSON object and assigns it to the entity in the ECS. Components such as
 					   `TransformComponent`, `CameraComponent`, `ScriptComponent`, `TextComponent`, `SpriteComponent`, etc., are reconstructed.
 		*/
 		/******************************************************************/
-		static void m_LoadEntity(const rapidjson::Value& entityData, std::optional<ecs::EntityID> parentID, const std::string& sceneName);
+		static ecs::EntityID m_LoadEntity(const rapidjson::Value& entityData, std::optional<ecs::EntityID> parentID, const std::string& sceneName, bool loadChildren = true);
+
+		/******************************************************************/
+		/*!
+			\fn        Serialize::m_LoadGlobalSettings(const rapidjson::Document& doc)
+			\brief     Applies the global lighting, background colour and cursor
+					   settings stored in a scene document.
+		*/
+		/******************************************************************/
+		static void m_LoadGlobalSettings(const rapidjson::Document& doc);
+
+		/******************************************************************/
+		/*!
+			\fn        Serialize::m_SaveGlobalSettings(rapidjson::Value& parentArray, rapidjson::Document::AllocatorType& allocator)
+			\brief     Appends the global settings and cursor settings entries
+					   that start every scene file.
+		*/
+		/******************************************************************/
+		static void m_SaveGlobalSettings(rapidjson::Value& parentArray, rapidjson::Document::AllocatorType& allocator);
 
 		/******************************************************************/
 		/*!
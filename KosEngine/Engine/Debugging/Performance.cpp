@@ -76,6 +76,10 @@ namespace performancetracker {
 			return "Lighting System";
 		case ecs::TypeSystem::TYPEVIDEOSYSTEM:
 			return "Video System";
+		case ecs::TypeSystem::TYPEUIRENDERSYSTEM:
+			return "UI Render System";
+		case ecs::TypeSystem::TYPEPARTICLESYSTEM:
+			return "Particle System";
 		case ecs::TypeSystem::TOTALTYPESYSTEM:
 			return "ImGui System";
 		default:
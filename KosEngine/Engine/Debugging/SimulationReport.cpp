@@ -0,0 +1,107 @@
+/******************************************************************/
+/*!
+\file      SimulationReport.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      April 14, 2025
+\brief     This file contains the definitions of the SimulationReport
+		   class.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include "../Config/pch.h"
+#include "SimulationReport.h"
+#include "Performance.h"
+
+namespace performancetracker {
+
+	//value below which the given share of the frames fall, frames must be sorted
+	static float Percentile(const std::vector<float>& sorted, float share)
+	{
+		if (sorted.empty()) return 0.f;
+
+		const size_t index = static_cast<size_t>(share * static_cast<float>(sorted.size() - 1) + 0.5f);
+		return sorted[(std::min)(index, sorted.size() - 1)];
+	}
+
+	void SimulationReport::m_Begin(size_t frames)
+	{
+		m_frameTimes.clear();
+		m_frameTimes.reserve(frames);
+		m_systems.fill(SystemTime{});
+		m_simulatedTime = 0.0;
+	}
+
+	void SimulationReport::m_EndFrame(float frameTime, float simulatedTime)
+	{
+		m_frameTimes.push_back(frameTime);
+		m_simulatedTime += simulatedTime;
+
+		for (size_t n{}; n < m_systems.size(); n++) {
+			const ecs::TypeSystem system = static_cast<ecs::TypeSystem>(n);
+			const float time = Performance::m_GetSystemTime(system);
+			m_systems[n].m_total += time;
+			m_systems[n].m_max = (std::max)(m_systems[n].m_max, time);
+
+			//systems skipped while the game is not running keep their last time
+			Performance::m_UpdateSystemTime(system, 0.f);
+		}
+	}
+
+	std::string SimulationReport::m_ToString(std::uint64_t stateHash) const
+	{
+		std::vector<float> sorted = m_frameTimes;
+		std::sort(sorted.begin(), sorted.end());
+
+		double wallTime{};
+		for (float frameTime : m_frameTimes) {
+			wallTime += frameTime;
+		}
+		const double meanTime = m_frameTimes.empty() ? 0.0 : wallTime / static_cast<double>(m_frameTimes.size());
+
+		double systemsTime{};
+		for (const SystemTime& system : m_systems) {
+			systemsTime += system.m_total;
+		}
+
+		std::ostringstream out;
+		out << std::fixed;
+		out << "Frames: " << m_frameTimes.size() << '\n';
+		out << std::setprecision(3);
+		out << "Simulated: " << m_simulatedTime << " s\n";
+		out << "Wall: " << wallTime << " s";
+		if (wallTime > 0.0) {
+			out << " (" << std::setprecision(1) << m_simulatedTime / wallTime << "x real time)" << std::setprecision(3);
+		}
+		out << '\n';
+		out << "Frame ms: mean " << meanTime * 1000.0
+			<< ", p50 " << Percentile(sorted, 0.5f) * 1000.f
+			<< ", p95 " << Percentile(sorted, 0.95f) * 1000.f
+			<< ", p99 " << Percentile(sorted, 0.99f) * 1000.f
+			<< ", max " << (sorted.empty() ? 0.f : sorted.back()) * 1000.f << '\n';
+
+		out << std::left << std::setw(28) << "System" << std::right
+			<< std::setw(12) << "total ms"
+			<< std::setw(12) << "mean us"
+			<< std::setw(12) << "max us"
+			<< std::setw(8) << "share" << '\n';
+		for (size_t n{}; n < m_systems.size(); n++) {
+			const SystemTime& system = m_systems[n];
+			if (system.m_total <= 0.0) continue;
+
+			const double mean = system.m_total / static_cast<double>(m_frameTimes.size());
+			out << std::left << std::setw(28) << Performance::m_GetSystemString(static_cast<ecs::TypeSystem>(n)) << std::right
+				<< std::setw(12) << std::setprecision(3) << system.m_total * 1000.0
+				<< std::setw(12) << std::setprecision(2) << mean * 1000000.0
+				<< std::setw(12) << system.m_max * 1000000.f
+				<< std::setw(7) << std::setprecision(1) << system.m_total / systemsTime * 100.0 << "%\n";
+		}
+
+		out << "State hash: " << stateHash << '\n';
+		return out.str();
+	}
+
+}
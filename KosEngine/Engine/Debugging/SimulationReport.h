@@ -0,0 +1,78 @@
+/******************************************************************/
+/*!
+\file      SimulationReport.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      April 14, 2025
+\brief     This file contains the SimulationReport, the frame and
+		   system timings of a headless run.
+
+		   The report keeps the wall time of every frame and adds up
+		   the time the ECS stored in the Performance tracker for each
+		   system. Once the run is over it is written as plain text
+		   with the frame time percentiles, the time of each system
+		   and the state hash the run ended on, so two runs of the
+		   same scene and input can be compared line by line.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#ifndef SIMULATIONREPORT_H
+#define SIMULATIONREPORT_H
+
+#include "../ECS/System/SystemType.h"
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace performancetracker {
+
+	class SimulationReport {
+
+	public:
+
+		//clears the last run, frames is only a hint
+		void m_Begin(size_t frames);
+
+		/******************************************************************/
+		/*!
+			\fn        void m_EndFrame(float frameTime, float simulatedTime)
+			\brief     Keeps the wall time of the frame and adds the time
+					   each system took in the ECS update of the frame.
+			\param[in] frameTime      Wall time of the whole frame, in
+									  seconds.
+			\param[in] simulatedTime  Game time the fixed steps of the
+									  frame advanced.
+		*/
+		/******************************************************************/
+		void m_EndFrame(float frameTime, float simulatedTime);
+
+		/******************************************************************/
+		/*!
+			\fn        std::string m_ToString(std::uint64_t stateHash) const
+			\brief     Formats the frame statistics, the time of every
+					   system that ran and the state hash.
+		*/
+		/******************************************************************/
+		std::string m_ToString(std::uint64_t stateHash) const;
+
+		size_t m_GetFrameCount() const { return m_frameTimes.size(); }
+
+	private:
+
+		struct SystemTime {
+			double m_total{};
+			float m_max{};
+		};
+
+		std::vector<float> m_frameTimes;
+		std::array<SystemTime, ecs::TOTALTYPESYSTEM> m_systems{};
+		double m_simulatedTime{};
+	};
+
+}
+
+#endif SIMULATIONREPORT_H
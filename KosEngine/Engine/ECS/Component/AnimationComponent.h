@@ -30,6 +30,8 @@ namespace ecs {
 		bool m_isAnimating{ true };
 		int m_stripCount{ 1 };
 
+		bool operator==(const AnimationComponent&) const = default;
+
 		REFLECTABLE(AnimationComponent, m_frameNumber, m_framesPerSecond, m_frameTimer, m_isAnimating, m_stripCount)
 	};
 
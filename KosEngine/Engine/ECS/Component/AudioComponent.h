@@ -17,6 +17,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #define AUDIOCOM_H
 
 #include "Component.h"
+#include "../Asset Manager/AudioVoices.h"
 #include <string>
 
 namespace ecs {
@@ -37,12 +38,20 @@ namespace ecs {
         float m_LastVolume{ -1.0f };
         bool m_LastLoopState{ false };
 
+        //resolved from m_Name and the voice last played, not serialized
+        assetmanager::AssetHandle m_soundHandle{};
+        fmodaudio::VoiceHandle m_voice{};
+
+        bool operator==(const AudioFile&) const = default;
+
         REFLECTABLE(AudioFile, m_FilePath, m_Volume, m_Loop, m_PlayOnStart, m_HasPlayed, m_Pan, m_IsBGM, m_IsSFX)
     };
 
     class AudioComponent : public Component {
     public:
         std::vector<AudioFile> m_AudioFiles;
+        bool operator==(const AudioComponent&) const = default;
+
         REFLECTABLE(AudioComponent, m_AudioFiles)
     };
 }
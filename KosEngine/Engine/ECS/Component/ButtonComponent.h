@@ -29,6 +29,8 @@ namespace ecs {
 
 		bool m_EnableHover = true;
 		bool m_IsHover = false;
+		bool operator==(const ButtonComponent&) const = default;
+
 		REFLECTABLE(ButtonComponent, m_Position, m_Scale, m_IsClick, m_EnableHover, m_IsHover);
 	};
 
@@ -30,6 +30,8 @@ namespace ecs {
 		float m_bottom;
 		float m_aspectRatio;
 
+		bool operator==(const CameraComponent&) const = default;
+
 		REFLECTABLE(CameraComponent, m_left, m_right, m_top, m_bottom, m_aspectRatio)
 	};
 
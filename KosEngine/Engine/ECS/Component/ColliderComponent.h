@@ -65,6 +65,8 @@ namespace ecs {
 
 		mat3x3::Mat3x3 m_collider_Transformation{};
 
+		bool operator==(const ColliderComponent&) const = default;
+
 		REFLECTABLE(ColliderComponent, m_collisionResponse, m_collisionCheck, m_drawDebug, m_type, m_OffSet, m_radius , m_Size )
 	};
 
@@ -20,6 +20,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "../ECS/Component/ComponentList.h"
 #include "../ECS/ECSList.h"
 #include "../Asset Manager/Reflection.h"
+#include "../Asset Manager/AssetHandle.h"
 
 
 namespace ecs {
@@ -42,6 +43,9 @@ namespace ecs {
 		//store entity's scene
 		std::string m_scene{};
 
+		//lets prefab propagation find what changed in a component
+		bool operator==(const Component&) const = default;
+
 
 
 	};
@@ -47,6 +47,43 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 
 namespace ecs {
+/******************************************************************/
+/*!
+\struct   ComponentTypeID
+\brief    Maps a component class to its ComponentType at compile time,
+		  lets the typed ECS functions and views find the pool without
+		  the caller passing the enum.
+*/
+/******************************************************************/
+	template <typename T>
+	struct ComponentTypeID;
+
+#define ECS_COMPONENT_TYPE(Component, Type) \
+	template <> struct ComponentTypeID<Component> { static constexpr ComponentType m_type = Type; };
+
+	ECS_COMPONENT_TYPE(NameComponent, TYPENAMECOMPONENT)
+	ECS_COMPONENT_TYPE(TransformComponent, TYPETRANSFORMCOMPONENT)
+	ECS_COMPONENT_TYPE(SpriteComponent, TYPESPRITECOMPONENT)
+	ECS_COMPONENT_TYPE(UISpriteComponent, TYPEUISPRITECOMPONENT)
+	ECS_COMPONENT_TYPE(ColliderComponent, TYPECOLLIDERCOMPONENT)
+	ECS_COMPONENT_TYPE(RigidBodyComponent, TYPERIGIDBODYCOMPONENT)
+	ECS_COMPONENT_TYPE(EnemyComponent, TYPEENEMYCOMPONENT)
+	ECS_COMPONENT_TYPE(TextComponent, TYPETEXTCOMPONENT)
+	ECS_COMPONENT_TYPE(AnimationComponent, TYPEANIMATIONCOMPONENT)
+	ECS_COMPONENT_TYPE(CameraComponent, TYPECAMERACOMPONENT)
+	ECS_COMPONENT_TYPE(ScriptComponent, TYPESCRIPTCOMPONENT)
+	ECS_COMPONENT_TYPE(ButtonComponent, TYPEBUTTONCOMPONENT)
+	ECS_COMPONENT_TYPE(TilemapComponent, TYPETILEMAPCOMPONENT)
+	ECS_COMPONENT_TYPE(AudioComponent, TYPEAUDIOCOMPONENT)
+	ECS_COMPONENT_TYPE(LightingComponent, TYPELIGHTINGCOMPONENT)
+	ECS_COMPONENT_TYPE(GridComponent, TYPEGRIDCOMPONENT)
+	ECS_COMPONENT_TYPE(RaycastComponent, TYPERAYCASTINGCOMPONENT)
+	ECS_COMPONENT_TYPE(PathfindingComponent, TYPEPATHFINDINGCOMPONENT)
+	ECS_COMPONENT_TYPE(ParticleComponent, TYPEPARTICLECOMPONENT)
+	ECS_COMPONENT_TYPE(VideoComponent, TYPEVIDEOCOMPONENT)
+
+#undef ECS_COMPONENT_TYPE
+
 /******************************************************************/
 /*!
 \enum     IComponentPool
@@ -105,6 +142,68 @@ namespace ecs {
 		/******************************************************************/
 		virtual void* m_DuplicateComponent(EntityID, EntityID) = 0;
 
+		/******************************************************************/
+		/*!
+		\fn        m_CopyComponents(const std::vector<EntityID>&)
+		\brief     Copies the components of the given entities, in the
+					same order, into one contiguous block
+		\return    the copied block, read back by m_RestoreComponents
+		*/
+		/******************************************************************/
+		virtual std::shared_ptr<void> m_CopyComponents(const std::vector<EntityID>&) = 0;
+
+		/******************************************************************/
+		/*!
+		\fn        m_RestoreComponents(const std::shared_ptr<void>&, const std::vector<EntityID>&)
+		\brief     Writes a block from m_CopyComponents over the components
+					of the given entities, the n-th copy goes to the n-th
+					entity. The entities must already own the component.
+		*/
+		/******************************************************************/
+		virtual void m_RestoreComponents(const std::shared_ptr<void>&, const std::vector<EntityID>&) = 0;
+
+		/******************************************************************/
+		/*!
+		\fn        m_DiffComponents(const std::shared_ptr<void>&, const std::vector<EntityID>&)
+		\brief     Compares the components of the given entities with a
+					block from m_CopyComponents, the n-th entity against
+					the n-th copy.
+		\return    one mask per entity, 0 if the component is unchanged.
+					Bit i is set when the i-th reflected member changed,
+					m_otherMembers when anything that is not reflected
+					changed as well.
+		*/
+		/******************************************************************/
+		virtual std::vector<uint64_t> m_DiffComponents(const std::shared_ptr<void>&, const std::vector<EntityID>&) = 0;
+
+		/******************************************************************/
+		/*!
+		\fn        m_CopyMembers(EntityID SourceID, EntityID TargetID, uint64_t Members)
+		\brief     Copies the reflected members set in a mask from
+					m_DiffComponents, the rest of the target is kept
+		*/
+		/******************************************************************/
+		virtual void m_CopyMembers(EntityID, EntityID, uint64_t) = 0;
+
+		static constexpr uint64_t m_otherMembers = 1ull << 63;
+
+		/******************************************************************/
+		/*!
+		\fn        m_GetEntities()
+		\brief     Entities that currently own a component in this pool,
+					packed with no gaps, order changes when a component
+					is deleted.
+		\return    reference to the packed entity list
+		*/
+		/******************************************************************/
+		const std::vector<EntityID>& m_GetEntities() const { return m_entities; }
+
+		virtual ~IComponentPool() = default;
+
+	protected:
+
+		std::vector<EntityID> m_entities;
+
 	};
 
 	/******************************************************************/
@@ -137,7 +236,83 @@ namespace ecs {
 
 		void* m_DuplicateComponent(EntityID DuplicatesID, EntityID NewID) override;
 
+		std::shared_ptr<void> m_CopyComponents(const std::vector<EntityID>& IDs) override;
+
+		void m_RestoreComponents(const std::shared_ptr<void>& copies, const std::vector<EntityID>& IDs) override;
+
+		std::vector<uint64_t> m_DiffComponents(const std::shared_ptr<void>& copies, const std::vector<EntityID>& IDs) override;
+
+		void m_CopyMembers(EntityID SourceID, EntityID TargetID, uint64_t Members) override;
+
+		/******************************************************************/
+		/*!
+		\fn        m_GetComponent(EntityID)
+		\brief     Typed lookup used by views, does not assert when the
+					entity has no component.
+		\return    pointer to the component, NULL if there is none
+		*/
+		/******************************************************************/
+		T* m_GetComponent(EntityID ID) { return m_FindSlot(ID); }
+
+		/******************************************************************/
+		/*!
+		\fn        m_GetDense()
+		\brief     Components of the entities in m_GetEntities, in the
+					same order, so a view reads them without a lookup.
+		*/
+		/******************************************************************/
+		const std::vector<T*>& m_GetDense() const { return m_dense; }
+
+		//m_GetComponent without reloading the pool's arrays, both are sized once in the constructor
+		struct Finder {
+			const size_t* m_sparse;
+			size_t m_size;
+			T* m_pool;
+
+			T* operator()(EntityID ID) const {
+				const EntityID index = m_GetEntityIndex(ID);
+				if (index >= m_size || m_sparse[index] == m_invalidSlot) return NULL;
+
+				T* Component = m_pool + m_sparse[index];
+				return (Component->m_Entity == ID && Component->m_IsLive) ? Component : NULL;
+			}
+		};
+
+		/******************************************************************/
+		/*!
+		\fn        m_GetFinder()
+		\brief     Lookup a view keeps for the whole loop, so the pool's
+					arrays are not read again for every entity.
+		*/
+		/******************************************************************/
+		Finder m_GetFinder() { return Finder{ m_sparse.data(), m_sparse.size(), m_Pool.data() }; }
+
 		std::vector<T> m_Pool;
+
+	private:
+	/******************************************************************/
+	/*!
+	\fn        m_FindSlot(EntityID)
+	\brief     Looks up the pool slot of the entity's component, the slot
+				must hold the exact ID so a stale ID whose index has been
+				recycled does not match the new entity.
+	\return    pointer to the component, NULL if there is none
+	*/
+	/******************************************************************/
+		T* m_FindSlot(EntityID);
+
+		static constexpr size_t m_invalidSlot = (std::numeric_limits<size_t>::max)();
+
+		//entity index to pool slot
+		std::vector<size_t> m_sparse;
+
+		std::vector<size_t> m_freeSlots;
+
+		//pool slot to position in m_entities
+		std::vector<size_t> m_entityPosition;
+
+		//component of each entity in m_entities, m_Pool is never resized after construction
+		std::vector<T*> m_dense;
 	};
 
 
@@ -145,31 +320,57 @@ namespace ecs {
 	ComponentPool<T>::ComponentPool() {
 
 		m_Pool.resize(MaxEntity);
-
+		m_sparse.resize(MaxEntity, m_invalidSlot);
+		m_entityPosition.resize(MaxEntity, m_invalidSlot);
+		m_entities.reserve(MaxEntity);
+		m_dense.reserve(MaxEntity);
+
+		//last component is kept as the default to reset with, hand out from the front
+		m_freeSlots.reserve(MaxEntity);
+		for (size_t n = MaxEntity - 1; n > 0; n--) {
+			m_freeSlots.push_back(n - 1);
+		}
 
 	}
 
 	template <typename T>
-	void* ComponentPool<T>::m_AssignComponent(EntityID ID) {
+	T* ComponentPool<T>::m_FindSlot(EntityID ID) {
 
+		const EntityID index = m_GetEntityIndex(ID);
+		if (index >= m_sparse.size() || m_sparse[index] == m_invalidSlot) return NULL;
 
-		for (auto& Component : m_Pool) {
-			if (Component.m_IsLive == false) {
-				Component.m_IsLive = true;
-				Component.m_Entity = ID;
+		T& Component = m_Pool[m_sparse[index]];
+		if (Component.m_Entity != ID || !Component.m_IsLive) return NULL;
 
-				// reset component data if reused
-				m_ResetComponent(ID);
-				
-				return &Component;
-			}
-		}
+		return &Component;
+	}
 
+	template <typename T>
+	void* ComponentPool<T>::m_AssignComponent(EntityID ID) {
 
+		const EntityID index = m_GetEntityIndex(ID);
 
 		// return NULL if all component is stored
 		// SAY COMPONENT POOL IS FULL
-		return NULL;
+		if (m_freeSlots.empty() || index >= m_sparse.size()) {
+			return NULL;
+		}
+
+		const size_t slot = m_freeSlots.back();
+		m_freeSlots.pop_back();
+		m_sparse[index] = slot;
+		m_entityPosition[slot] = m_entities.size();
+		m_entities.push_back(ID);
+		m_dense.push_back(&m_Pool[slot]);
+
+		T& Component = m_Pool[slot];
+		Component.m_IsLive = true;
+		Component.m_Entity = ID;
+
+		// reset component data if reused
+		m_ResetComponent(ID);
+
+		return &Component;
 
 	}
 
@@ -198,16 +399,94 @@ namespace ecs {
 		return NewComponent;
 	}
 
+	template <typename T>
+	std::shared_ptr<void> ComponentPool<T>::m_CopyComponents(const std::vector<EntityID>& IDs) {
+
+		auto copies = std::make_shared<std::vector<T>>();
+		copies->reserve(IDs.size());
+		for (EntityID ID : IDs) {
+			T* Component = m_FindSlot(ID);
+			copies->push_back(Component ? *Component : T{});
+		}
+
+		return copies;
+	}
+
+	template <typename T>
+	void ComponentPool<T>::m_RestoreComponents(const std::shared_ptr<void>& copies, const std::vector<EntityID>& IDs) {
 
+		const std::vector<T>& Components = *std::static_pointer_cast<const std::vector<T>>(copies);
+		for (size_t n{}; n < IDs.size() && n < Components.size(); n++) {
+			T* Component = m_FindSlot(IDs[n]);
+			if (!Component) continue;
+
+			*Component = Components[n];//copies everything INCLUDING ID
+			Component->m_Entity = IDs[n];
+			Component->m_IsLive = true;
+		}
+	}
 
+	//components listing their members with REFLECTABLE
 	template <typename T>
-	void* ComponentPool<T>::m_GetEntityComponent(EntityID ID) {
+	concept ReflectedComponent = requires (T component) { component.member(); };
+
+	//copies the members set in the mask, or every differing member when collecting
+	template <typename Tuple, size_t... N>
+	uint64_t CopyReflectedMembers(Tuple to, Tuple from, uint64_t mask, bool collect, std::index_sequence<N...>) {
+		static_assert(sizeof...(N) < 63, "too many reflected members for a change mask");
+		uint64_t changed{};
+		((((collect && !(std::get<N>(to) == std::get<N>(from))) || (!collect && (mask & (1ull << N))))
+			? (changed |= 1ull << N, void(std::get<N>(to) = std::get<N>(from))) : void()), ...);
+		return changed;
+	}
 
-		for (auto& Component : m_Pool) {
-			if (Component.m_Entity == ID && Component.m_IsLive) {
-				return &Component;
+	template <typename T>
+	std::vector<uint64_t> ComponentPool<T>::m_DiffComponents(const std::shared_ptr<void>& copies, const std::vector<EntityID>& IDs) {
+
+		const std::vector<T>& Components = *std::static_pointer_cast<const std::vector<T>>(copies);
+		std::vector<uint64_t> changes(IDs.size());
+		for (size_t n{}; n < IDs.size() && n < Components.size(); n++) {
+			T* Component = m_FindSlot(IDs[n]);
+			if (!Component || *Component == Components[n]) continue;
+
+			if constexpr (ReflectedComponent<T>) {
+				//replay the changed members on the copy, whatever still differs is not reflected
+				T replay = Components[n];
+				auto members = Component->member();
+				changes[n] = CopyReflectedMembers(replay.member(), members, 0, true, std::make_index_sequence<std::tuple_size_v<decltype(members)>>{});
+				if (!(replay == *Component)) {
+					changes[n] |= m_otherMembers;
+				}
+			}
+			else {
+				changes[n] = m_otherMembers;
 			}
 		}
+		return changes;
+	}
+
+	template <typename T>
+	void ComponentPool<T>::m_CopyMembers(EntityID SourceID, EntityID TargetID, uint64_t Members) {
+
+		if constexpr (ReflectedComponent<T>) {
+			T* Source = m_FindSlot(SourceID);
+			T* Target = m_FindSlot(TargetID);
+			if (!Source || !Target) return;
+
+			auto members = Source->member();
+			CopyReflectedMembers(Target->member(), members, Members, false, std::make_index_sequence<std::tuple_size_v<decltype(members)>>{});
+		}
+	}
+
+
+
+	template <typename T>
+	void* ComponentPool<T>::m_GetEntityComponent(EntityID ID) {
+
+		T* Component = m_FindSlot(ID);
+		if (Component) {
+			return Component;
+		}
 
 		//auto it = std::find_if(m_Pool.begin(), m_Pool.end(), [ID](const auto& obj) { return (obj.m_Entity == ID && obj.m_IsLive); });
 		//if (it != m_Pool.end()) {
@@ -226,13 +505,29 @@ namespace ecs {
 	bool ComponentPool<T>::m_DeleteEntityComponent(EntityID ID) {
 
 		//TODO delete component from system vector
-		for (auto& Component : m_Pool) {
-			if (Component.m_Entity == ID && Component.m_IsLive) {
-
-				// set component to false
-				Component.m_IsLive = false;
-				return true;
-			}
+		T* Component = m_FindSlot(ID);
+		if (Component) {
+
+			// set component to false
+			Component->m_IsLive = false;
+
+			// slot can be handed to another entity
+			const EntityID index = m_GetEntityIndex(ID);
+			const size_t slot = m_sparse[index];
+
+			// move the last entity into the hole
+			const size_t position = m_entityPosition[slot];
+			const EntityID lastID = m_entities.back();
+			m_entities[position] = lastID;
+			m_dense[position] = m_dense.back();
+			m_entityPosition[m_sparse[m_GetEntityIndex(lastID)]] = position;
+			m_entities.pop_back();
+			m_dense.pop_back();
+			m_entityPosition[slot] = m_invalidSlot;
+
+			m_freeSlots.push_back(slot);
+			m_sparse[index] = m_invalidSlot;
+			return true;
 		}
 
 
@@ -243,10 +538,8 @@ namespace ecs {
 	template <typename T>
 	bool ComponentPool<T>::m_HasComponent(EntityID ID) { //contained any stored data
 
-		for (auto& Component : m_Pool) {
-			if (Component.m_Entity == ID) {
-				return Component.m_IsLive;
-			}
+		if (m_FindSlot(ID)) {
+			return true;
 		}
 
 		//if (std::find_if(m_Pool.begin(), m_Pool.end(), [ID](const auto& obj) { return obj.m_Entity == ID; }) != m_Pool.end()) {
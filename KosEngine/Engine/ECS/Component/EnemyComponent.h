@@ -38,6 +38,8 @@ namespace ecs {
 		int m_enemyRoamBehaviourInt{-1};
 
 
+		bool operator==(const EnemyComponent&) const = default;
+
 		REFLECTABLE(EnemyComponent, m_enemyTag, m_enemyTypeInt, m_enemyRoamBehaviourInt);
 
 	};
@@ -33,6 +33,8 @@ namespace ecs {
 		int m_GridKey;                     
 		std::vector<std::vector<int>> m_IsWall;
 
+		bool operator==(const GridComponent&) const = default;
+
 		REFLECTABLE(GridComponent,m_Anchor, m_GridRowLength, m_GridColumnLength, m_SetCollidable, m_GridKey)
 	};
 }
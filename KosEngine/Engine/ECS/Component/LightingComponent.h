@@ -36,6 +36,8 @@ namespace ecs
 		vector2::Vec2 m_light_scale{ 1.f,1.f };
 		float m_light_rotation{};
 
+		bool operator==(const LightingComponent&) const = default;
+
 		REFLECTABLE(LightingComponent,m_innerOuterRadius, m_intensity, m_light_OffSet, m_light_scale, m_light_rotation, m_colour, m_lightType);
 	};
 
@@ -43,6 +43,12 @@ namespace ecs {
 		
 		bool m_syncPrefab{false};
 		std::string m_prefabName{};
+
+		//updated every frame even far from the camera, see TickLOD
+		bool m_fullTickRate{ false };
+
+		bool operator==(const NameComponent&) const = default;
+
 		REFLECTABLE(NameComponent, m_entityName, m_Layer, m_entityTag, m_isPrefab, m_prefabName, m_entityTag);
 	};
 
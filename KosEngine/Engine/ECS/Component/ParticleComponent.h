@@ -47,6 +47,11 @@ namespace ecs
 
 		vector2::Vec2 m_particleSize{ 1.f,1.f };
 
+		//resolved from m_imageFile, not serialized
+		assetmanager::AssetHandle m_imageHandle{};
+
+		bool operator==(const ParticleComponent&) const = default;
+
 		REFLECTABLE(ParticleComponent, m_willSpawn, m_noOfParticles, m_lifeSpan, m_particleSize, m_velocity, m_acceleration,
 										m_coneRotation, m_coneAngle, m_randomFactor, m_stripCount, m_frameNumber, 
 										m_layer, m_friction, m_fps, m_loopAnimation);
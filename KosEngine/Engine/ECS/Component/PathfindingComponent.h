@@ -32,6 +32,8 @@ namespace ecs {
         //uint m_WaypointID;          // Calculated path
 
 
+        bool operator==(const PathfindingComponent&) const = default;
+
         REFLECTABLE(PathfindingComponent, m_StartPos, m_TargetPos, m_GridKey)
     };
 }
@@ -46,12 +46,16 @@ namespace ecs {
 
 			vector2::Vec2 m_hitposition{};
 
+			bool operator==(const Raycast&) const = default;
+
 			REFLECTABLE(Raycast, m_rayID, m_isRaycasting, m_targetPosition, m_Layers, m_distance, m_targetReached, m_hitposition);
 		};
 		
 		std::vector<Raycast> m_raycast{};
 
 
+		bool operator==(const RaycastComponent&) const = default;
+
 		REFLECTABLE(RaycastComponent, m_raycast);
 
 	};
@@ -51,6 +51,8 @@ namespace ecs {
 
 		std::vector<int> m_scriptHandler;
 
+		bool operator==(const ScriptComponent&) const = default;
+
 
 		//REFLECTABLE(ScriptComponent, m_scripts)
 
@@ -36,6 +36,12 @@ namespace ecs {
 		vector3::Vec3 m_color{ 1.f,1.f,1.f };
 		float m_alpha{ 1.f };
 		bool m_isIlluminated{true};
+
+		//resolved from m_imageFile, not serialized
+		assetmanager::AssetHandle m_imageHandle{};
+
+		bool operator==(const SpriteComponent&) const = default;
+
 		REFLECTABLE(SpriteComponent, m_imageFile, m_isIlluminated,m_alpha ,m_layer);
 	};
 
@@ -38,6 +38,11 @@ namespace ecs {
 
 		vector3::Vec3 m_color;
 
+		//resolved from m_fileName, not serialized
+		assetmanager::AssetHandle m_fontHandle{};
+
+		bool operator==(const TextComponent&) const = default;
+
 		REFLECTABLE(TextComponent, m_fontLayer, m_isCentered);
 	};
 
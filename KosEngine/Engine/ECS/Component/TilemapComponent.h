@@ -35,6 +35,11 @@ namespace ecs {
 		int m_pictureColumnLength{ 1 };
 		std::vector<std::vector<int>> m_tilePictureIndex;
 
+		//resolved from m_tilemapFile, not serialized
+		assetmanager::AssetHandle m_tilemapHandle{};
+
+		bool operator==(const TilemapComponent&) const = default;
+
 		REFLECTABLE(TilemapComponent, m_tileIndex,m_tileLayer, m_rowLength, m_columnLength, m_pictureRowLength, m_pictureColumnLength);
 	};
 
@@ -47,6 +47,8 @@ namespace ecs {
 		
 		bool m_haveParent{false};
 
+		bool operator==(const TransformComponent&) const = default;
+
 		REFLECTABLE(TransformComponent, m_position, m_rotation, m_scale)
 		
 	};
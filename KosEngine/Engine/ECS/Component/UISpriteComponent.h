@@ -36,6 +36,12 @@ namespace ecs {
 		vector3::Vec3 m_color{ 1.f,1.f,1.f };
 		float m_alpha{ 1.f };
 		///bool m_isIlluminated{true}; alwasy false
+
+		//resolved from m_imageFile, not serialized
+		assetmanager::AssetHandle m_imageHandle{};
+
+		bool operator==(const UISpriteComponent&) const = default;
+
 		REFLECTABLE(UISpriteComponent, m_imageFile, m_color, m_alpha);
 	};
 
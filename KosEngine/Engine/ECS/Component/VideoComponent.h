@@ -35,6 +35,8 @@ namespace ecs {
 
 	public:
 
+		bool operator==(const VideoComponent&) const = default;
+
 		REFLECTABLE(VideoComponent, filename, pause, loop, layer);
 
 	};
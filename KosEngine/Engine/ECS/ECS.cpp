@@ -20,8 +20,12 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "../Debugging/Performance.h"
 #include "../Debugging/Logging.h"
 #include "../Asset Manager/SceneManager.h"
+#include "../Asset Manager/PrefabIndex.h"
+#include "../Asset Manager/AssetManager.h"
 #include "Hierachy.h"
+#include "TickLOD.h"
 #include "../Helper/Helper.h"
+#include "../Events/EventsEventBus.h"
 
 //ECS Varaible
 
@@ -139,8 +143,13 @@ namespace ecs{
 
 		if (ecs->m_state == RUNNING) {
 			help->m_gameRunTime += help->m_deltaTime;
+			TickLOD::m_GetInstance()->m_NewFrame(help->m_deltaTime, help->currentNumberOfSteps);
 		}
 
+		//events queued since the last frame, by input, the editor and scene loading
+		events::EventBus* bus = events::EventBus::m_GetInstance();
+		bus->m_FlushAll();
+
 
 
 		//loops through all the system
@@ -189,7 +198,8 @@ namespace ecs{
 					auto start = std::chrono::steady_clock::now();
 					System.second->m_Update(key);
 					auto end = std::chrono::steady_clock::now();
-					duration = end - start;
+					//a system runs once per active scene
+					duration += end - start;
 				}
 			}
 
@@ -198,6 +208,15 @@ namespace ecs{
 		
 
 		}
+
+		//voices are ranked once the systems set their emitters and the listener
+		assetmanager::AssetManager::m_funcGetInstance()->m_audioManager.m_Update(help->m_deltaTime);
+
+		//events the systems queued, listeners can still queue deletes
+		bus->m_FlushAll();
+
+		//safe point, no system is iterating
+		ecs->m_FlushDeleteQueue();
 		
 	}
 
@@ -208,6 +227,13 @@ namespace ecs{
 		//delete ecs;
 	}
 
+	const std::vector<EntityID>* ECS::m_GetSceneEntities(const std::string& scene)
+	{
+		ECS* ecs = ECS::m_GetInstance();
+		const auto sceneIt = ecs->m_ECS_SceneMap.find(scene);
+		return sceneIt == ecs->m_ECS_SceneMap.end() ? nullptr : &sceneIt->second.m_sceneIDs;
+	}
+
 	template<typename T>
 	void ECS::m_AddComponentToECS(ComponentType type)
 	{
@@ -241,6 +267,7 @@ namespace ecs{
 		}
 
 		ecs->m_ECS_EntityMap.find(ID)->second.set(Type);
+		ecs->m_MarkDirty(ID);
 
 		//checks if new component fufils any of the system requirements
 		m_RegisterSystems(ID);
@@ -258,15 +285,18 @@ namespace ecs{
 			return false;
 		}
 
-		ecs->m_ECS_CombinedComponentPool[Type]->m_DeleteEntityComponent(ID);
-
-		//deregister everthing
-		m_DeregisterSystem(ID);
+		compSignature& signature = ecs->m_ECS_EntityMap.find(ID)->second;
+		signature.reset(Type);
+		ecs->m_MarkDirty(ID);
 
-		ecs->m_ECS_EntityMap.find(ID)->second.reset(Type);
+		//only systems that needed the component lose the entity
+		for (auto& system : ecs->m_ECS_SystemMap) {
+			if (system.second->m_HasEntity(ID) && (signature & system.second->m_SystemSignature) != system.second->m_SystemSignature) {
+				system.second->m_DeregisterSystem(ID);
+			}
+		}
 
-		//register everything
-		m_RegisterSystems(ID);
+		ecs->m_ECS_CombinedComponentPool[Type]->m_DeleteEntityComponent(ID);
 
 		return true;
 	}
@@ -274,8 +304,16 @@ namespace ecs{
 	void ECS::m_RegisterSystems(EntityID ID) {
 
 		ECS* ecs = ECS::m_GetInstance();
+
+		//registered together when the batch ends
+		if (ecs->m_registrationBatchDepth > 0) {
+			ecs->m_pendingRegistration.push_back(ID);
+			return;
+		}
+
+		const compSignature& signature = ecs->m_ECS_EntityMap.find(ID)->second;
 		for (auto& system : ecs->m_ECS_SystemMap) {
-			if ((ecs->m_ECS_EntityMap.find(ID)->second & system.second->m_SystemSignature) == system.second->m_SystemSignature) {
+			if (!system.second->m_HasEntity(ID) && (signature & system.second->m_SystemSignature) == system.second->m_SystemSignature) {
 
 				system.second->m_RegisterSystem(ID);
 
@@ -287,7 +325,7 @@ namespace ecs{
 
 		ECS* ecs = ECS::m_GetInstance();
 		for (auto& system : ecs->m_ECS_SystemMap) {
-			if ((ecs->m_ECS_EntityMap.find(ID)->second & system.second->m_SystemSignature) == system.second->m_SystemSignature) {
+			if (system.second->m_HasEntity(ID)) {
 
 				system.second->m_DeregisterSystem(ID);
 
@@ -296,23 +334,67 @@ namespace ecs{
 
 	}
 
+	void ECS::m_BeginRegistrationBatch() {
+
+		ECS* ecs = ECS::m_GetInstance();
+		ecs->m_registrationBatchDepth++;
+	}
+
+	void ECS::m_EndRegistrationBatch() {
+
+		ECS* ecs = ECS::m_GetInstance();
+		if (ecs->m_registrationBatchDepth <= 0 || --ecs->m_registrationBatchDepth > 0) return;
+
+		//an entity is queued once per component added
+		std::vector<EntityID> pending;
+		pending.swap(ecs->m_pendingRegistration);
+		std::sort(pending.begin(), pending.end());
+		pending.erase(std::unique(pending.begin(), pending.end()), pending.end());
+
+		for (auto& system : ecs->m_ECS_SystemMap) {
+			for (const auto& ID : pending) {
+				const auto& entity = ecs->m_ECS_EntityMap.find(ID);
+				if (entity == ecs->m_ECS_EntityMap.end()) continue; //deleted during the batch
+
+				if (!system.second->m_HasEntity(ID) && (entity->second & system.second->m_SystemSignature) == system.second->m_SystemSignature) {
+					system.second->m_RegisterSystem(ID);
+				}
+			}
+		}
+	}
+
 	EntityID ECS::m_CreateEntity(std::string scene) {
 
 		ECS* ecs = ECS::m_GetInstance();
 
-		//TODO change to sth other than assert
-		//if (ecs->m_EntityCount >= (MaxEntity - 1)) {// -1 so as to keep all the last component pool as default to reset
-		//	LOGGING_ASSERT_WITH_MSG("Max Entity Count has been reached");
-		//}
-		//assert(ecs->m_EntityCount < MaxEntity, "Max Entity Count has been reached");
+		EntityID index{};
+		if (!ecs->m_freeEntityIndex.empty()) {
+			index = ecs->m_freeEntityIndex.front();
+			ecs->m_freeEntityIndex.pop_front();
+			ecs->m_deletedentity[index].reset();
+		}
+		else {
+			// -1 so as to keep all the last component pool as default to reset
+			if (ecs->m_EntityCount >= (MaxEntity - 1)) {
+				LOGGING_ASSERT_WITH_MSG("Max Entity Count has been reached");
+			}
 
-		EntityID ID = ecs->m_EntityCount;
+			index = ecs->m_EntityCount;
+			ecs->m_entityGenerations.push_back(0);
+			ecs->m_deletedentity.emplace_back();
+			ecs->m_entityScene.emplace_back();
+			ecs->m_pendingDelete.push_back(false);
+			ecs->m_destroyMark.push_back(false);
+			ecs->m_entityVersion.push_back(0);
 
-		// set bitflag to 0
-		ecs->m_ECS_EntityMap[ID] = 0;
+			ecs->m_EntityCount++;
+		}
 
+		EntityID ID = m_MakeEntityID(index, ecs->m_entityGenerations[index]);
 
-		ecs->m_EntityCount++;
+		// set bitflag to 0
+		ecs->m_ECS_EntityMap[ID] = 0;
+		ecs->m_entityVersion[index]++;
 
 
 		//assign entity to default layer
@@ -320,6 +402,7 @@ namespace ecs{
 
 		//assign entity to scenes
 		ecs->m_ECS_SceneMap.find(scene)->second.m_sceneIDs.push_back(ID);
+		ecs->m_entityScene[index] = scene;
 
 		//add transform component and name component as default
 		m_AddComponent(TYPENAMECOMPONENT, ID);
@@ -363,6 +446,10 @@ namespace ecs{
 
 		ecs->m_ECS_EntityMap.find(NewEntity)->second = DuplicateSignature;
 		m_RegisterSystems(NewEntity);
+		m_UpdateTag(NewEntity);
+
+		//copies of prefab instances are instances too
+		prefab::PrefabIndex::m_GetInstance()->m_Register(NewEntity);
 
 		//checks if duplicates entity has parent and assign it
 		if (Hierachy::m_GetParent(DuplicatesID).has_value()) {
@@ -389,8 +476,6 @@ namespace ecs{
 
 	bool ECS::m_DeleteEntity(EntityID ID) {
 
-		
-
 		ECS* ecs = ECS::m_GetInstance();
 		//check if id is a thing
 		if (ecs->m_ECS_EntityMap.find(ID) == ecs->m_ECS_EntityMap.end()) {
@@ -398,113 +483,446 @@ namespace ecs{
 			return false;
 		}
 
-		//Hierachy::m_RemoveParent(ID);
+		m_DeleteEntities({ ID });
+
+		return true;
+	}
+
+	void ECS::m_QueueDeleteEntity(EntityID ID) {
+
+		if (!m_IsValidEntity(ID) || m_pendingDelete[m_GetEntityIndex(ID)]) return;
 
-		if (Hierachy::m_GetParent(ID).has_value()) {
-			EntityID parent = Hierachy::m_GetParent(ID).value();
-			// if parent id is deleted, no need to remove its child
-			if (ecs->m_ECS_EntityMap.find(parent) != ecs->m_ECS_EntityMap.end()) {
-				TransformComponent* parentTransform = (TransformComponent*)ecs->m_ECS_CombinedComponentPool[TYPETRANSFORMCOMPONENT]->m_GetEntityComponent(parent);
-				size_t pos{};
-				for (EntityID& id : parentTransform->m_childID) {
-					if (ID == id) {
-						parentTransform->m_childID.erase(parentTransform->m_childID.begin() + pos);
-						break;
+		//mark the hierachy, clearing the component scene hides it from every system
+		//children are queued too, in case they are detached before the flush
+		std::vector<EntityID> stack{ ID };
+		while (!stack.empty()) {
+			EntityID id = stack.back();
+			stack.pop_back();
+			if (!m_IsValidEntity(id) || m_pendingDelete[m_GetEntityIndex(id)]) continue;
+
+			m_pendingDelete[m_GetEntityIndex(id)] = true;
+			m_deleteQueue.push_back(id);
+
+			const compSignature& signature = m_ECS_EntityMap.find(id)->second;
+			for (size_t n{}; n < TOTALTYPECOMPONENT; n++) {
+				if (signature.test(n)) {
+					Component* comp = static_cast<Component*>(m_ECS_CombinedComponentPool[(ComponentType)n]->m_GetEntityComponent(id));
+					if (comp) {
+						comp->m_scene.clear();
 					}
-					pos++;
 				}
 			}
+
+			const auto& child = Hierachy::m_GetChild(id);
+			if (child.has_value()) {
+				stack.insert(stack.end(), child.value().begin(), child.value().end());
+			}
 		}
+	}
+
+	void ECS::m_FlushDeleteQueue() {
+
+		if (m_deleteQueue.empty()) return;
+
+		//scripts called from the flush may queue more
+		std::vector<EntityID> queue;
+		queue.swap(m_deleteQueue);
+
+		m_DeleteEntities(queue);
+	}
 
+	bool ECS::m_IsPendingDelete(EntityID id) const {
+		return m_IsValidEntity(id) && m_pendingDelete[m_GetEntityIndex(id)];
+	}
+
+	void ECS::m_DeleteEntities(const std::vector<EntityID>& roots) {
 
+		ECS* ecs = ECS::m_GetInstance();
 
-		// refector
-		m_DeregisterSystem(ID);
+		//gather the roots and their children once, skipping stale and repeated ids
+		std::vector<EntityID> dying;
+		std::vector<EntityID> stack(roots.rbegin(), roots.rend());
+		while (!stack.empty()) {
+			EntityID id = stack.back();
+			stack.pop_back();
+			if (!m_IsValidEntity(id) || m_destroyMark[m_GetEntityIndex(id)]) continue;
 
+			m_destroyMark[m_GetEntityIndex(id)] = true;
+			dying.push_back(id);
+
+			const auto& child = Hierachy::m_GetChild(id);
+			if (child.has_value()) {
+				stack.insert(stack.end(), child.value().rbegin(), child.value().rend());
+			}
+		}
 
+		if (dying.empty()) return;
 
-		// remove entity from scene
-		const auto& result = scenes::SceneManager::GetSceneByEntityID(ID);
-		auto& entityList = ecs->m_ECS_SceneMap.find(result.value())->second.m_sceneIDs;
-		auto it = std::find(entityList.begin(), entityList.end(), ID);
-		ecs->m_ECS_SceneMap.find(result.value())->second.m_sceneIDs.erase(it);
+		//walk the pools in index order
+		std::sort(dying.begin(), dying.end(), [](EntityID lhs, EntityID rhs) { return m_GetEntityIndex(lhs) < m_GetEntityIndex(rhs); });
 
+		//kept for m_RestoreEntity while editing, the game never copies
+		std::shared_ptr<DeletedBatch> batch;
+		if (m_state == STOP) {
+			batch = std::make_shared<DeletedBatch>();
+			batch->m_IDs = dying;
+			for (EntityID ID : dying) {
+				batch->m_signatures.push_back(m_ECS_EntityMap.find(ID)->second);
+				batch->m_scenes.push_back(m_entityScene[m_GetEntityIndex(ID)]);
+			}
 
+			for (size_t n{}; n < TOTALTYPECOMPONENT; n++) {
+				DeletedBatch::ComponentBlock& block = batch->m_components[n];
 
+				std::vector<EntityID> owners;
+				for (uint32_t position{}; position < dying.size(); position++) {
+					if (batch->m_signatures[position].test(n)) {
+						block.m_owners.push_back(position);
+						owners.push_back(dying[position]);
+					}
+				}
 
+				if (!owners.empty()) {
+					block.m_copies = m_ECS_CombinedComponentPool[(ComponentType)n]->m_CopyComponents(owners);
+				}
+			}
 
-		//get child
-		if (Hierachy::m_GetChild(ID).has_value()) {
-			std::vector<EntityID> childs = Hierachy::m_GetChild(ID).value();
-			for (auto& x : childs) {
-				m_DeleteEntity(x);
+			//script instances are created again by the logic system
+			if (batch->m_components[TYPESCRIPTCOMPONENT].m_copies) {
+				for (ScriptComponent& sc : *std::static_pointer_cast<std::vector<ScriptComponent>>(batch->m_components[TYPESCRIPTCOMPONENT].m_copies)) {
+					sc.m_scriptInstances.clear();
+					sc.m_scriptHandler.clear();
+				}
 			}
 		}
 
-		// reset all components
-		for (size_t n{}; n < TOTALTYPECOMPONENT; n++) {
-			if (ecs->m_ECS_EntityMap.find(ID)->second.test(n)) {
-				ecs->m_ECS_CombinedComponentPool[(ComponentType)n]->m_DeleteEntityComponent(ID);
+		auto isDying = [this](EntityID id) {
+			const EntityID index = m_GetEntityIndex(id);
+			return index < m_destroyMark.size() && m_destroyMark[index] && m_IsValidEntity(id);
+		};
+
+		std::vector<std::string> scenes;
+		for (EntityID ID : dying) {
+
+			// only parents that survive the batch lose the child
+			if (Hierachy::m_GetParent(ID).has_value()) {
+				EntityID parent = Hierachy::m_GetParent(ID).value();
+				if (m_IsValidEntity(parent) && !isDying(parent)) {
+					TransformComponent* parentTransform = m_GetComponent<TransformComponent>(parent);
+					const auto& it = std::find(parentTransform->m_childID.begin(), parentTransform->m_childID.end(), ID);
+					if (it != parentTransform->m_childID.end()) {
+						parentTransform->m_childID.erase(it);
+					}
+				}
+			}
+
+			// refector
+			m_DeregisterSystem(ID);
+
+			const std::string& scene = m_entityScene[m_GetEntityIndex(ID)];
+			if (std::find(scenes.begin(), scenes.end(), scene) == scenes.end()) {
+				scenes.push_back(scene);
 			}
 		}
 
-		//store delete entity
-		m_deletedentity.push_back(std::make_pair(ID, ecs->m_ECS_EntityMap.find(ID)->second));
-		ecs->m_ECS_EntityMap.erase(ID);
+		// remove entities from their scene, parked pool instances have no scene
+		for (const auto& scene : scenes) {
+			const auto& sceneIt = ecs->m_ECS_SceneMap.find(scene);
+			if (sceneIt == ecs->m_ECS_SceneMap.end()) continue;
 
+			auto& entityList = sceneIt->second.m_sceneIDs;
+			entityList.erase(std::remove_if(entityList.begin(), entityList.end(), isDying), entityList.end());
+		}
 
-		return true;
+		//remove from default layer
+		auto& layerIDs = ecs->m_layersStack.m_layerMap[layer::DEFAULT].second;
+		layerIDs.erase(std::remove_if(layerIDs.begin(), layerIDs.end(), isDying), layerIDs.end());
+
+		for (EntityID ID : dying) {
+
+			// reset all components
+			const compSignature signature = ecs->m_ECS_EntityMap.find(ID)->second;
+			for (size_t n{}; n < TOTALTYPECOMPONENT; n++) {
+				if (signature.test(n)) {
+					ecs->m_ECS_CombinedComponentPool[(ComponentType)n]->m_DeleteEntityComponent(ID);
+				}
+			}
+
+			//store delete entity
+			const EntityID index = m_GetEntityIndex(ID);
+			m_deletedentity[index] = batch;
+			ecs->m_ECS_EntityMap.erase(ID);
+			m_tagIndex.m_Remove(ID);
+			m_entityScene[index].clear();
+			m_pendingDelete[index] = false;
+			m_destroyMark[index] = false;
+
+			//stale IDs no longer match, recycle the index
+			m_entityGenerations[index] = (m_entityGenerations[index] + 1) & EntityGenerationMask;
+			m_freeEntityIndex.push_back(index);
+		}
 	}
 
 	bool ECS::m_RestoreEntity(EntityID id)
 	{
-		ECS* ecs = ECS::m_GetInstance();
+		//queued and not flushed yet, the entity is still alive
+		if (m_IsPendingDelete(id)) {
+			std::vector<EntityID> stack{ id };
+			while (!stack.empty()) {
+				EntityID entity = stack.back();
+				stack.pop_back();
+				if (!m_IsPendingDelete(entity)) continue;
+
+				const EntityID index = m_GetEntityIndex(entity);
+				m_pendingDelete[index] = false;
+
+				//give the components back their scene, the queue cleared it
+				const compSignature& signature = m_ECS_EntityMap.find(entity)->second;
+				for (size_t n{}; n < TOTALTYPECOMPONENT; n++) {
+					if (signature.test(n)) {
+						Component* comp = static_cast<Component*>(m_ECS_CombinedComponentPool[(ComponentType)n]->m_GetEntityComponent(entity));
+						if (comp) {
+							comp->m_scene = m_entityScene[index];
+						}
+					}
+				}
+				m_MarkDirty(entity);
+
+				const auto& child = Hierachy::m_GetChild(entity);
+				if (child.has_value()) {
+					stack.insert(stack.end(), child.value().begin(), child.value().end());
+				}
+			}
+
+			m_deleteQueue.erase(std::remove_if(m_deleteQueue.begin(), m_deleteQueue.end(), [this](EntityID queued) { return !m_IsPendingDelete(queued); }), m_deleteQueue.end());
+			return true;
+		}
+
+		//return if entity id is alive, was not kept or its index has been reused
+		const EntityID index = m_GetEntityIndex(id);
+		if (index >= m_deletedentity.size() || !m_deletedentity[index] || m_ECS_EntityMap.count(id)) return false;
 
-		const auto& it = std::find_if(m_deletedentity.begin(), m_deletedentity.end(), [id](const auto& pair) {return pair.first == id;});
-		if (it == m_deletedentity.end()) return false; //return if entiy id has not been deleted
+		const std::shared_ptr<DeletedBatch> batch = m_deletedentity[index];
+		const auto byIndex = [](EntityID lhs, EntityID rhs) { return m_GetEntityIndex(lhs) < m_GetEntityIndex(rhs); };
+		const auto& position = [&batch, &byIndex](EntityID entity) -> size_t {
+			const auto& it = std::lower_bound(batch->m_IDs.begin(), batch->m_IDs.end(), entity, byIndex);
+			return (it != batch->m_IDs.end() && *it == entity) ? it - batch->m_IDs.begin() : batch->m_IDs.size();
+		};
 
-		//get entity scene
-		auto* tc = static_cast<TransformComponent*>(m_ECS_CombinedComponentPool[TYPETRANSFORMCOMPONENT]->m_GetEntityComponent(id));
-		const auto& scene = tc->m_scene;
+		const size_t root = position(id);
+		if (root == batch->m_IDs.size()) return false;
 
 		//see if scene still exist in the engine
-		const auto& sceneit = ecs->m_ECS_SceneMap.find(scene);
-		if (sceneit == ecs->m_ECS_SceneMap.end()) return false;// scene no longer loaded
-		sceneit->second.m_sceneIDs.push_back(id);
+		const auto& sceneIt = m_ECS_SceneMap.find(batch->m_scenes[root]);
+		if (sceneIt == m_ECS_SceneMap.end()) return false;
+
+		const DeletedBatch::ComponentBlock& transformBlock = batch->m_components[TYPETRANSFORMCOMPONENT];
+		const auto& transforms = *std::static_pointer_cast<const std::vector<TransformComponent>>(transformBlock.m_copies);
+
+		//the entity and the children deleted with it, parents first
+		std::vector<size_t> restoring;
+		std::vector<char> isRestoring(batch->m_IDs.size(), false);
+		std::vector<size_t> stack{ root };
+		while (!stack.empty()) {
+			const size_t current = stack.back();
+			stack.pop_back();
+			if (current == batch->m_IDs.size() || isRestoring[current]) continue;
+
+			const EntityID entity = batch->m_IDs[current];
+			if (m_deletedentity[m_GetEntityIndex(entity)] != batch || batch->m_scenes[current] != sceneIt->first) continue;
+
+			isRestoring[current] = true;
+			restoring.push_back(current);
+
+			const auto& owner = std::lower_bound(transformBlock.m_owners.begin(), transformBlock.m_owners.end(), static_cast<uint32_t>(current));
+			if (owner == transformBlock.m_owners.end() || *owner != current) continue;
 
+			for (EntityID child : transforms[owner - transformBlock.m_owners.begin()].m_childID) {
+				stack.push_back(position(child));
+			}
+		}
+
+		m_BeginRegistrationBatch();
 
-		// if id has parent, assign it back to the parent
-		if (Hierachy::m_GetParent(id).has_value()) {
-			Hierachy::m_SetParent(Hierachy::m_GetParent(id).value(), id);
+		//take the indices back from the free list under the old generation
+		for (size_t current : restoring) {
+			const EntityID entity = batch->m_IDs[current];
+			const EntityID entityIndex = m_GetEntityIndex(entity);
 
+			const auto& freeit = std::find(m_freeEntityIndex.begin(), m_freeEntityIndex.end(), entityIndex);
+			if (freeit != m_freeEntityIndex.end()) {
+				m_freeEntityIndex.erase(freeit);
+			}
+			m_entityGenerations[entityIndex] = m_GetEntityGeneration(entity);
+			m_deletedentity[entityIndex].reset();
+
+			m_ECS_EntityMap[entity] = 0;
+			m_entityVersion[entityIndex]++;
+			m_layersStack.m_layerMap[layer::DEFAULT].second.push_back(entity);
+			sceneIt->second.m_sceneIDs.push_back(entity);
+			m_entityScene[entityIndex] = sceneIt->first;
+
+			for (size_t n{}; n < TOTALTYPECOMPONENT; n++) {
+				if (batch->m_signatures[current].test(n)) {
+					m_AddComponent((ComponentType)n, entity);
+				}
+			}
 		}
 
-		//add entity back to entitymap
-		ecs->m_ECS_EntityMap[id] = it->second;
+		//an ID no pool slot matches stands in for the entities left deleted
+		const EntityID skipped = m_MakeEntityID(EntityIndexMask, 0);
+		for (size_t n{}; n < TOTALTYPECOMPONENT; n++) {
+			const DeletedBatch::ComponentBlock& block = batch->m_components[n];
+			if (!block.m_copies) continue;
+
+			std::vector<EntityID> owners(block.m_owners.size(), skipped);
+			for (size_t k{}; k < block.m_owners.size(); k++) {
+				if (isRestoring[block.m_owners[k]]) {
+					owners[k] = batch->m_IDs[block.m_owners[k]];
+				}
+			}
+			m_ECS_CombinedComponentPool[(ComponentType)n]->m_RestoreComponents(block.m_copies, owners);
+		}
 
+		for (size_t current : restoring) {
+			const EntityID entity = batch->m_IDs[current];
 
+			for (size_t n{}; n < TOTALTYPECOMPONENT; n++) {
+				if (batch->m_signatures[current].test(n)) {
+					static_cast<Component*>(m_ECS_CombinedComponentPool[(ComponentType)n]->m_GetEntityComponent(entity))->m_scene = sceneIt->first;
+				}
+			}
 
+			// if id has parent, assign it back to the parent
+			TransformComponent* tc = m_GetComponent<TransformComponent>(entity);
+			if (tc->m_haveParent) {
+				if (m_IsValidEntity(tc->m_parentID)) {
+					std::vector<EntityID>& siblings = m_GetComponent<TransformComponent>(tc->m_parentID)->m_childID;
+					if (std::find(siblings.begin(), siblings.end(), entity) == siblings.end()) {
+						siblings.push_back(entity);
+					}
+				}
+				else {
+					tc->m_haveParent = false;
+					tc->m_parentID = 0;
+				}
+			}
 
-		m_RegisterSystems(id);
+			//children that were not brought back
+			std::erase_if(tc->m_childID, [this](EntityID child) { return !m_IsValidEntity(child); });
+		}
 
+		m_EndRegistrationBatch();
 
-		
+		for (size_t current : restoring) {
+			prefab::PrefabIndex::m_GetInstance()->m_Register(batch->m_IDs[current]);
+			m_MarkDirty(batch->m_IDs[current]);
+		}
 
+		return true;
+	}
+
+	bool ECS::m_IsValidEntity(EntityID id) const
+	{
+		const EntityID index = m_GetEntityIndex(id);
+		if (index >= m_entityGenerations.size() || m_entityGenerations[index] != m_GetEntityGeneration(id)) return false;
+
+		return m_ECS_EntityMap.find(id) != m_ECS_EntityMap.end();
+	}
+
+	const std::string* ECS::m_GetEntityScene(EntityID id) const
+	{
+		if (!m_IsValidEntity(id)) return nullptr;
+
+		return &m_entityScene[m_GetEntityIndex(id)];
+	}
+
+	void ECS::m_SetEntityScene(EntityID id, const std::string& scene)
+	{
+		if (!m_IsValidEntity(id)) return;
+
+		m_entityScene[m_GetEntityIndex(id)] = scene;
+		m_MarkDirty(id);
+	}
+
+	void ECS::m_MarkDirty(EntityID id)
+	{
+		if (!m_IsValidEntity(id)) return;
+
+		m_entityVersion[m_GetEntityIndex(id)]++;
+		m_UpdateTag(id);
+	}
+
+	void ECS::m_MarkAllDirty()
+	{
+		m_dirtyEpoch++;
+	}
+
+	void ECS::m_UpdateTag(EntityID id)
+	{
+		if (!m_IsValidEntity(id)) return;
+
+		NameComponent* nc = m_GetComponent<NameComponent>(id);
+		if (nc) {
+			m_tagIndex.m_Update(id, nc->m_entityTag);
+		}
+		else {
+			m_tagIndex.m_Remove(id);
+		}
+	}
+
+	uint32_t ECS::m_GetEntityVersion(EntityID id) const
+	{
+		if (!m_IsValidEntity(id)) return 0;
 
-		//restore all child
-		if (Hierachy::m_GetChild(id).has_value()) {
-			std::vector<EntityID> childs = Hierachy::m_GetChild(id).value();
-			for (auto& x : childs) {
-				m_RestoreEntity(x);
+		return m_entityVersion[m_GetEntityIndex(id)];
+	}
+
+	uint64_t ECS::m_ComputeStateHash()
+	{
+		uint64_t hash = 14695981039346656037ull;
+		auto add = [&hash](const void* data, size_t size) {
+			const unsigned char* bytes = static_cast<const unsigned char*>(data);
+			for (size_t n{}; n < size; n++) {
+				hash ^= bytes[n];
+				hash *= 1099511628211ull;
 			}
+		};
+
+		//the entity map is unordered, the hash must not depend on its buckets
+		std::vector<EntityID> ids;
+		ids.reserve(m_ECS_EntityMap.size());
+		for (const auto& [id, signature] : m_ECS_EntityMap) {
+			ids.push_back(id);
 		}
+		std::sort(ids.begin(), ids.end());
+
+		for (EntityID id : ids) {
+			add(&id, sizeof(id));
 
+			const compSignature& signature = m_ECS_EntityMap.find(id)->second;
+			for (size_t n{}; n < TOTALTYPECOMPONENT; n++) {
+				const bool set = signature.test(n);
+				add(&set, sizeof(set));
+			}
+
+			const std::string& scene = m_entityScene[m_GetEntityIndex(id)];
+			add(scene.data(), scene.size());
 
+			if (TransformComponent* tc = m_GetComponent<TransformComponent>(id)) {
+				add(&tc->m_position, sizeof(tc->m_position));
+				add(&tc->m_rotation, sizeof(tc->m_rotation));
+				add(&tc->m_scale, sizeof(tc->m_scale));
+				add(&tc->m_parentID, sizeof(tc->m_parentID));
+			}
 
-		//remove entity from vector
-		m_deletedentity.erase(it);
+			if (RigidBodyComponent* rb = m_GetComponent<RigidBodyComponent>(id)) {
+				add(&rb->m_Velocity, sizeof(rb->m_Velocity));
+				add(&rb->m_AngularVelocity, sizeof(rb->m_AngularVelocity));
+			}
+		}
 
-		return false;
+		return hash;
 	}
 
 	
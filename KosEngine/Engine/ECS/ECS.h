@@ -23,6 +23,8 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 #include "../ECS/System/System.h"
 #include "Layers.h"
+#include "TagIndex.h"
+#include "View.h"
 
 #include "ECSList.h"
 #include "../ECS/System/SystemList.h"
@@ -103,16 +105,143 @@ namespace ecs {
 		/******************************************************************/
 		bool m_DeleteEntity(EntityID);
 
+		/******************************************************************/
+		/*!
+		\fn      void ECS::m_DeleteEntities(const std::vector<EntityID>& roots)
+		\brief   Deletes the entities and all of their children at once.
+				 Scene and layer lists are compacted once for the whole
+				 batch instead of once per entity. Stale and repeated IDs
+				 are skipped.
+		*/
+		/******************************************************************/
+		void m_DeleteEntities(const std::vector<EntityID>& roots);
+
+		/******************************************************************/
+		/*!
+		\fn      void ECS::m_QueueDeleteEntity(EntityID)
+		\brief   Marks the entity and its children dead without touching any
+				 container, safe to call from system updates and scripts.
+				 The entity is hidden from systems, views and tag lookups,
+				 its components stay readable until the queue is flushed at
+				 the end of m_Update.
+		*/
+		/******************************************************************/
+		void m_QueueDeleteEntity(EntityID);
+
+		/******************************************************************/
+		/*!
+		\fn      void ECS::m_FlushDeleteQueue()
+		\brief   Deletes every queued entity in one batch.
+		*/
+		/******************************************************************/
+		void m_FlushDeleteQueue();
+
+		/******************************************************************/
+		/*!
+		\fn      bool ECS::m_IsPendingDelete(EntityID id) const
+		\brief   Checks if the entity is queued for deletion.
+		*/
+		/******************************************************************/
+		bool m_IsPendingDelete(EntityID id) const;
+
 		/******************************************************************/
 		/*!
 		\fn      bool ECS::m_RestoreEntity(EntityID)
-		\brief   Restores a previously deleted entity.
+		\brief   Restores a previously deleted entity and the children
+				 deleted with it, under the same IDs. A queued entity has
+				 its deletion cancelled instead.
+		\details Entities are only kept for restoring while the game is
+				 stopped, until their index is recycled.
 		\param   EntityID - The ID of the entity to be restored.
 		\return  True if the entity was successfully restored, false otherwise.
 		*/
 		/******************************************************************/
 		bool m_RestoreEntity(EntityID);
 
+		/******************************************************************/
+		/*!
+		\fn      bool ECS::m_IsValidEntity(EntityID id) const
+		\brief   Checks that the ID refers to a live entity and not to a
+				 deleted one whose index has since been recycled.
+		\param   id - The entity ID to check.
+		\return  True if the entity is alive.
+		*/
+		/******************************************************************/
+		bool m_IsValidEntity(EntityID id) const;
+
+		/******************************************************************/
+		/*!
+		\fn      const std::string* ECS::m_GetEntityScene(EntityID id) const
+		\brief   Looks up the scene an entity belongs to without searching
+				 the scenes.
+		\param   id - The entity ID.
+		\return  The scene name, nullptr if the entity is not alive.
+		*/
+		/******************************************************************/
+		const std::string* m_GetEntityScene(EntityID id) const;
+
+		/******************************************************************/
+		/*!
+		\fn      void ECS::m_SetEntityScene(EntityID id, const std::string& scene)
+		\brief   Records the scene an entity belongs to, called whenever
+				 the entity is moved to another scene's entity list.
+		*/
+		/******************************************************************/
+		void m_SetEntityScene(EntityID id, const std::string& scene);
+
+		/******************************************************************/
+		/*!
+		\fn      void ECS::m_MarkDirty(EntityID id)
+		\brief   Records that the entity's saved data changed since the
+				 scene was last saved. Creating the entity, adding or
+				 removing components and moving it between scenes mark
+				 it on their own, anything writing component fields
+				 directly marks it itself.
+		*/
+		/******************************************************************/
+		void m_MarkDirty(EntityID id);
+
+		/******************************************************************/
+		/*!
+		\fn      void ECS::m_MarkAllDirty()
+		\brief   Marks every entity dirty, for edits that cannot tell
+				 which entities they touched.
+		*/
+		/******************************************************************/
+		void m_MarkAllDirty();
+
+		/******************************************************************/
+		/*!
+		\fn      uint32_t ECS::m_GetEntityVersion(EntityID id) const
+		\brief   Counter bumped every time the entity is marked dirty,
+				 compared by the scene writer against the version it
+				 last serialised.
+		\return  0 if the entity is not alive.
+		*/
+		/******************************************************************/
+		uint32_t m_GetEntityVersion(EntityID id) const;
+
+		uint32_t m_GetDirtyEpoch() const { return m_dirtyEpoch; }
+
+		/******************************************************************/
+		/*!
+		\fn      uint64_t ECS::m_ComputeStateHash()
+		\brief   Hashes the entities alive, their components, scenes,
+				 transforms and rigidbodies in id order. Two runs of the
+				 same scene with the same inputs end on the same hash.
+		*/
+		/******************************************************************/
+		uint64_t m_ComputeStateHash();
+
+		/******************************************************************/
+		/*!
+		\fn      void ECS::m_UpdateTag(EntityID id)
+		\brief   Moves the entity to the tag its name component holds in
+				 m_tagIndex. Marking the entity dirty does it too.
+		*/
+		/******************************************************************/
+		void m_UpdateTag(EntityID id);
+
 
 		/******************************************************************/
 		/*!
@@ -126,6 +255,51 @@ namespace ecs {
 		void m_AddComponentToECS(ComponentType);
 
 
+		/******************************************************************/
+		/*!
+		\fn      template <typename T> ComponentPool<T>* ECS::m_GetPool()
+		\brief   Returns the typed pool of a component class.
+		*/
+		/******************************************************************/
+		template <typename T>
+		ComponentPool<T>* m_GetPool() {
+			return static_cast<ComponentPool<T>*>(m_ECS_CombinedComponentPool[ComponentTypeID<T>::m_type].get());
+		}
+
+		/******************************************************************/
+		/*!
+		\fn      template <typename T> T* ECS::m_GetComponent(EntityID)
+		\brief   Typed component lookup, replaces casting the result of
+				 m_GetEntityComponent.
+		\return  pointer to the component, nullptr if the entity has none
+		*/
+		/******************************************************************/
+		template <typename T>
+		T* m_GetComponent(EntityID ID) {
+			return m_GetPool<T>()->m_GetComponent(ID);
+		}
+
+		/******************************************************************/
+		/*!
+		\fn      template <typename... T> View<T...> ECS::m_View()
+		\brief   Creates a view over every entity owning all of T...
+				 ecs->m_View<TransformComponent, LightingComponent>().m_InScene(scene).m_Each(...)
+		*/
+		/******************************************************************/
+		template <typename... T>
+		View<T...> m_View() {
+			return View<T...>(m_ECS_CombinedComponentPool, m_layersStack, &ECS::m_GetSceneEntities);
+		}
+
+		/******************************************************************/
+		/*!
+		\fn      static const std::vector<EntityID>* ECS::m_GetSceneEntities(const std::string& scene)
+		\brief   Entities of the scene, used by views to filter on a scene
+		\return  nullptr if the scene is not loaded
+		*/
+		/******************************************************************/
+		static const std::vector<EntityID>* m_GetSceneEntities(const std::string& scene);
+
 		/******************************************************************/
 		/*!
 		\def       m_AddComponent()
@@ -164,6 +338,24 @@ namespace ecs {
 		/******************************************************************/
 		void m_DeregisterSystem(EntityID);
 
+		/******************************************************************/
+		/*!
+		\def       m_BeginRegistrationBatch()
+		\brief     Defers system registration, entities that gain components
+				   are only queued until m_EndRegistrationBatch. Used while
+				   loading a scene, batches can be nested.
+		*/
+		/******************************************************************/
+		void m_BeginRegistrationBatch();
+		/******************************************************************/
+		/*!
+		\def       m_EndRegistrationBatch()
+		\brief     Ends the batch and registers the queued entities, system
+				   by system
+		*/
+		/******************************************************************/
+		void m_EndRegistrationBatch();
+
 		/******************************************************************/
 		/*!
 		\var     std::unordered_map<ComponentType, std::shared_ptr<IComponentPool>> m_ECS_CombinedComponentPool
@@ -221,6 +413,21 @@ namespace ecs {
 		/******************************************************************/
 		layer::LayerStack m_layersStack;
 
+		/******************************************************************/
+		/*!
+		\var     TagIndex m_tagIndex
+		\brief   Interned entity tags and the entities under each of them.
+		*/
+		/******************************************************************/
+		TagIndex m_tagIndex;
+
+		/******************************************************************/
+		/*!
+		\var     EntityID m_EntityCount
+		\brief   Number of entity indices handed out so far, indices below
+				 it are recycled through the free list once deleted.
+		*/
+		/******************************************************************/
 		EntityID m_EntityCount{};
 
 		float m_DeltaTime{};
@@ -236,14 +443,88 @@ namespace ecs {
 		//modify from set next state
 		GAMESTATE m_state{ STOP };
 
+		//components of a batch of deleted entities, see m_deletedentity
+		struct DeletedBatch {
+			struct ComponentBlock {
+				//positions in m_IDs of the owners, in the order of the copies
+				std::vector<uint32_t> m_owners;
+				std::shared_ptr<void> m_copies;
+			};
+
+			//in index order
+			std::vector<EntityID> m_IDs;
+			std::vector<compSignature> m_signatures;
+			std::vector<std::string> m_scenes;
+			std::array<ComponentBlock, TOTALTYPECOMPONENT> m_components;
+		};
+
+		/******************************************************************/
+		/*!
+		\var     std::vector<std::shared_ptr<DeletedBatch>> m_deletedentity
+		\brief   Stores, for each index, the batch that last deleted it.
+		\details Allows for restoration of deleted entities if needed,
+				 until the index is recycled. Only filled while the game
+				 is stopped, so play mode and the game never copy.
+		*/
+		/******************************************************************/
+		std::vector<std::shared_ptr<DeletedBatch>> m_deletedentity;
+
+		/******************************************************************/
+		/*!
+		\var     std::vector<EntityID> m_entityGenerations
+		\brief   Current generation of each entity index.
+		*/
+		/******************************************************************/
+		std::vector<EntityID> m_entityGenerations;
+
+		/******************************************************************/
+		/*!
+		\var     std::deque<EntityID> m_freeEntityIndex
+		\brief   Deleted entity indices, reused oldest first so a stale ID
+				 takes as long as possible to meet its index again.
+		*/
+		/******************************************************************/
+		std::deque<EntityID> m_freeEntityIndex;
+
 		/******************************************************************/
 		/*!
-		\var     std::vector<std::pair<ecs::EntityID, std::bitset<TOTALTYPECOMPONENT>>> m_deletedentity
-		\brief   Stores deleted entities and their associated component bitsets.
-		\details Allows for restoration of deleted entities if needed.
+		\var     std::vector<std::string> m_entityScene
+		\brief   Scene of each entity index, kept in step with the scenes'
+				 entity lists.
 		*/
 		/******************************************************************/
-		std::vector<std::pair<ecs::EntityID, std::bitset<TOTALTYPECOMPONENT>>> m_deletedentity;
+		std::vector<std::string> m_entityScene;
+
+		/******************************************************************/
+		/*!
+		\var     std::vector<EntityID> m_pendingRegistration
+		\brief   Entities waiting to be registered to systems while a
+				 registration batch is open.
+		*/
+		/******************************************************************/
+		std::vector<EntityID> m_pendingRegistration;
+
+		/******************************************************************/
+		/*!
+		\var     std::vector<EntityID> m_deleteQueue
+		\brief   Entities queued by m_QueueDeleteEntity.
+		*/
+		/******************************************************************/
+		std::vector<EntityID> m_deleteQueue;
+
+		//per entity index, queued for deletion
+		std::vector<char> m_pendingDelete;
+
+		//per entity index, part of the batch being destroyed
+		std::vector<char> m_destroyMark;
+
+		//per entity index, see m_GetEntityVersion
+		std::vector<uint32_t> m_entityVersion;
+
+		//bumped by m_MarkAllDirty
+		uint32_t m_dirtyEpoch{};
+
+		int m_registrationBatchDepth{};
 
 	};
 }
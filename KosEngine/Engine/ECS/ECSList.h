@@ -19,11 +19,30 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 namespace ecs {
 
+	/******************************************************************/
+	/*!
+	\brief     An entity ID is a handle, the low bits are the index into
+			   the component pools and the bits above are a generation
+			   that is bumped whenever the index is recycled. The top bit
+			   is never used so IDs stay positive when returned to C# as
+			   int. A new index starts at generation 0, so its ID is the
+			   same as the old sequential IDs.
+	*/
+	/******************************************************************/
 	using EntityID = unsigned int;
 	using compSignature = std::bitset<TOTALTYPECOMPONENT>;
 
-	// Max number of entities allowed to be created
-	static EntityID MaxEntity = 2000;
+	constexpr unsigned int EntityIndexBits = 20;
+	constexpr EntityID EntityIndexMask = (1u << EntityIndexBits) - 1;
+	constexpr EntityID EntityGenerationMask = 0x7FF;
+
+	inline EntityID m_GetEntityIndex(EntityID id) { return id & EntityIndexMask; }
+	inline EntityID m_GetEntityGeneration(EntityID id) { return (id >> EntityIndexBits) & EntityGenerationMask; }
+	inline EntityID m_MakeEntityID(EntityID index, EntityID generation) { return (index & EntityIndexMask) | ((generation & EntityGenerationMask) << EntityIndexBits); }
+
+	// Max number of entities alive at once, deleted indices are recycled.
+	// Read when the component pools are created, one value for the whole program
+	inline EntityID MaxEntity = 2000;
 
 	enum GAMESTATE {
 		START,
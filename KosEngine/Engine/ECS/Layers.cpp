@@ -122,6 +122,7 @@ namespace layer {
 		//assign ecs layer
 		ecs::NameComponent* nc = (ecs::NameComponent*)(ecs::ECS::m_GetInstance()->m_ECS_CombinedComponentPool[ecs::TYPENAMECOMPONENT]->m_GetEntityComponent(id));
 		nc->m_Layer = newlayer;
+		ecs::ECS::m_GetInstance()->m_MarkDirty(id);
 
 		return true;
 	}
@@ -26,6 +26,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "../Graphics/GraphicsPipe.h"
 #include "../Asset Manager/AssetManager.h"
 #include "AnimationSystem.h"
+#include "../TickLOD.h"
 #include "../Debugging/Logging.h"
 
 
@@ -37,8 +38,8 @@ namespace ecs {
 
 		//Checks if system already has stored the entity
 
-		if (std::find_if(m_vecAnimationComponentPtr.begin(), m_vecAnimationComponentPtr.end(), [ID](const auto& obj) { return obj->m_Entity == ID; })
-			== m_vecAnimationComponentPtr.end()) {
+		if (!m_HasEntity(ID)) {
+			m_AddEntity(ID);
 			m_vecTransformComponentPtr.push_back((TransformComponent*)ecs->m_ECS_CombinedComponentPool[TYPETRANSFORMCOMPONENT]->m_GetEntityComponent(ID));
 			m_vecAnimationComponentPtr.push_back((AnimationComponent*)ecs->m_ECS_CombinedComponentPool[TYPEANIMATIONCOMPONENT]->m_GetEntityComponent(ID));
 			m_vecSpriteComponentPtr.push_back((SpriteComponent*)ecs->m_ECS_CombinedComponentPool[TYPESPRITECOMPONENT]->m_GetEntityComponent(ID));
@@ -47,14 +48,9 @@ namespace ecs {
 	}
 
 	void AnimationSystem::m_DeregisterSystem(EntityID ID) {
-		//search element location for the entity
-		size_t IndexID{};
-		for (auto& ComponentPtr : m_vecAnimationComponentPtr) {
-			if (ComponentPtr->m_Entity == ID) {
-				break;
-			}
-			IndexID++;
-		}
+		//element location for the entity
+		size_t IndexID = m_RemoveEntity(ID);
+		if (IndexID == m_invalidPosition) return;
 
 		//index to the last element
 		size_t IndexLast = m_vecAnimationComponentPtr.size() - 1;
@@ -88,6 +84,7 @@ namespace ecs {
 		}
 		assetmanager::AssetManager* assetmanager = assetmanager::AssetManager::m_funcGetInstance();
 		Helper::Helpers* helper = Helper::Helpers::GetInstance();
+		TickLOD* tickLOD = TickLOD::m_GetInstance();
 		for (int n{}; n < m_vecAnimationComponentPtr.size(); n++) {
 
 			AnimationComponent* AniComp = m_vecAnimationComponentPtr[n];
@@ -97,15 +94,18 @@ namespace ecs {
 			//skip component not of the scene
 			if ((AniComp->m_scene != scene) || !ecs->m_layersStack.m_layerBitSet.test(NameComp->m_Layer) || NameComp->m_hide ) continue;
 
+			//off screen sprites are animated less often, with the steps since their last update
+			TickTime time;
+			if (!tickLOD->m_ShouldTick(TICKANIMATION, AniComp->m_Entity, tickLOD->m_GetInterval(AniComp->m_Entity, m_vecTransformComponentPtr[n], NameComp), time)) continue;
+
 			if (m_vecAnimationComponentPtr[n]->m_isAnimating && m_vecAnimationComponentPtr[n]->m_framesPerSecond)
 			{
-				for (int i = 0; i < helper->currentNumberOfSteps; ++i) //Fixed DT with Accumulation for Animations
+				for (int i = 0; i < time.m_steps; ++i) //Fixed DT with Accumulation for Animations
 				{
 					m_vecAnimationComponentPtr[n]->m_frameTimer += helper->m_fixedDeltaTime;
 				}
 				float frameTime = 1.f / m_vecAnimationComponentPtr[n]->m_framesPerSecond;
-				const auto& image = assetmanager->m_imageManager.m_imageMap.find(SpriteComp->m_imageFile);
-				if (image == assetmanager->m_imageManager.m_imageMap.end()) continue;
+				if (!assetmanager->m_imageManager.m_imageHandles.m_Resolve(SpriteComp->m_imageFile, SpriteComp->m_imageHandle)) continue;
 				float spriteTotalTime = frameTime * m_vecAnimationComponentPtr[n]->m_stripCount;
 				if (m_vecAnimationComponentPtr[n]->m_frameTimer > spriteTotalTime)
 				{
@@ -24,8 +24,8 @@ namespace ecs {
     void AudioSystem::m_RegisterSystem(EntityID ID) {
         ECS* ecs = ECS::m_GetInstance();
 
-        if (std::find_if(m_vecAudioComponentPtr.begin(), m_vecAudioComponentPtr.end(),
-            [ID](const auto& obj) { return obj->m_Entity == ID; }) == m_vecAudioComponentPtr.end()) {
+        if (!m_HasEntity(ID)) {
+            m_AddEntity(ID);
             m_vecTransformComponentPtr.push_back((TransformComponent*)ecs->m_ECS_CombinedComponentPool[TYPETRANSFORMCOMPONENT]->m_GetEntityComponent(ID));
             m_vecAudioComponentPtr.push_back((AudioComponent*)ecs->m_ECS_CombinedComponentPool[TYPEAUDIOCOMPONENT]->m_GetEntityComponent(ID));
             m_vecNameComponentPtr.push_back((NameComponent*)ecs->m_ECS_CombinedComponentPool[TYPENAMECOMPONENT]->m_GetEntityComponent(ID));
@@ -33,13 +33,9 @@ namespace ecs {
     }
 
     void AudioSystem::m_DeregisterSystem(EntityID ID) {
-        size_t IndexID = 0;
-        for (auto& audioCompPtr : m_vecAudioComponentPtr) {
-            if (audioCompPtr->m_Entity == ID) {
-                break;
-            }
-            IndexID++;
-        }
+        //element location for the entity
+        size_t IndexID = m_RemoveEntity(ID);
+        if (IndexID == m_invalidPosition) return;
 
         size_t IndexLast = m_vecAudioComponentPtr.size() - 1;
         std::swap(m_vecAudioComponentPtr[IndexID], m_vecAudioComponentPtr[IndexLast]);
@@ -57,23 +53,11 @@ namespace ecs {
 
     void AudioSystem::m_Update(const std::string& scene) {
         assetmanager::AssetManager* assetManager = assetmanager::AssetManager::m_funcGetInstance();
+        fmodaudio::AudioManager& audioManager = assetManager->m_audioManager;
         ECS* ecs = ECS::m_GetInstance();
         if (m_vecAudioComponentPtr.empty()) return;
 
-        // Calculate delta time for smooth fading
-        static auto lastUpdateTime = std::chrono::steady_clock::now();
-        auto currentTime = std::chrono::steady_clock::now();
-        float deltaTime = std::chrono::duration<float>(currentTime - lastUpdateTime).count();
-        lastUpdateTime = currentTime;
-
-        // Update all FModAudio instances to process fading
-        for (auto& soundPair : assetManager->m_audioManager.getSoundMap()) {
-            fmodaudio::FModAudio* audio = soundPair.second.get();
-            if (audio) {
-                audio->Update(deltaTime);
-            }
-        }
-
+        //fades and channels are updated once a frame by AudioManager::m_Update
         int n{ 0 };
         for (auto& audioCompPtr : m_vecAudioComponentPtr) {
             TransformComponent* transform = m_vecTransformComponentPtr[n];
@@ -81,28 +65,24 @@ namespace ecs {
             n++;
             if ((transform->m_scene != scene) || !ecs->m_layersStack.m_layerBitSet.test(NameComp->m_Layer) || NameComp->m_hide) continue;
 
-            std::string entityIDStr = std::to_string(audioCompPtr->m_Entity);
+            const vector2::Vec2 position{ transform->m_transformation.m_e20, transform->m_transformation.m_e21 };
             for (auto& audioFile : audioCompPtr->m_AudioFiles) {
-                auto it = assetManager->m_audioManager.getSoundMap().find(audioFile.m_Name);
-                if (it == assetManager->m_audioManager.getSoundMap().end()) continue;
-                auto& sound = it->second;
-
-                float adjustedVolume = audioFile.m_Volume;
-                if (audioFile.m_IsBGM) {
-                    adjustedVolume *= assetManager->m_audioManager.m_GlobalBGMVolume;
-                }
-                else if (audioFile.m_IsSFX) {
-                    adjustedVolume *= assetManager->m_audioManager.m_GlobalSFXVolume;
-                }
-                if (adjustedVolume < 0) {
-                    adjustedVolume = 0;
+                //a miss loads the sound on demand through the residency manager
+                if (!audioManager.m_soundHandles.m_Resolve(audioFile.m_Name, audioFile.m_soundHandle)) {
+                    //still loading, played once it is loaded ahead of the other sounds
+                    if (audioFile.m_PlayOnStart) {
+                        audioManager.m_PrefetchAudio(audioFile.m_Name);
+                    }
+                    continue;
                 }
 
-                sound->m_SetVolume(entityIDStr, adjustedVolume);
-                sound->m_SetLooping(entityIDStr, audioFile.m_Loop);
-
-                if (audioFile.m_PlayOnStart && !sound->m_IsPlaying(entityIDStr)) {
-                    sound->m_PlaySound(entityIDStr);
+                if (audioManager.m_voices.m_IsPlaying(audioFile.m_voice)) {
+                    audioManager.m_voices.m_SetVolume(audioFile.m_voice, audioManager.m_GetAdjustedVolume(audioFile, audioFile.m_Volume));
+                    audioManager.m_voices.m_SetLoop(audioFile.m_voice, audioFile.m_Loop);
+                    audioManager.m_voices.m_SetPosition(audioFile.m_voice, fmodaudio::AudioManager::m_IsPositional(audioCompPtr->m_Entity, audioFile), position);
+                }
+                else if (audioFile.m_PlayOnStart) {
+                    audioManager.m_PlayAudioFile(audioCompPtr->m_Entity, audioFile, audioFile.m_Volume);
                     audioFile.m_PlayOnStart = false;
                 }
             }
@@ -31,8 +31,8 @@ namespace ecs {
 
 		//Checks if system already has stored the entity
 
-		if (std::find_if(m_vecButtonComponentPtr.begin(), m_vecButtonComponentPtr.end(), [ID](const auto& obj) { return obj->m_Entity == ID; })
-			== m_vecButtonComponentPtr.end()) {
+		if (!m_HasEntity(ID)) {
+			m_AddEntity(ID);
 			m_vecTransformComponentPtr.push_back((TransformComponent*)ecs->m_ECS_CombinedComponentPool[TYPETRANSFORMCOMPONENT]->m_GetEntityComponent(ID));
 			m_vecButtonComponentPtr.push_back((ButtonComponent*)ecs->m_ECS_CombinedComponentPool[TYPEBUTTONCOMPONENT]->m_GetEntityComponent(ID));
 			m_vecNameComponentPtr.push_back((NameComponent*)ecs->m_ECS_CombinedComponentPool[TYPENAMECOMPONENT]->m_GetEntityComponent(ID));
@@ -40,14 +40,9 @@ namespace ecs {
 	}
 
 	void ButtonSystem::m_DeregisterSystem(EntityID ID) {
-		//search element location for the entity
-		size_t IndexID{};
-		for (auto& ComponentPtr : m_vecButtonComponentPtr) {
-			if (ComponentPtr->m_Entity == ID) {
-				break;
- 			}
-			IndexID++;
-		}
+		//element location for the entity
+		size_t IndexID = m_RemoveEntity(ID);
+		if (IndexID == m_invalidPosition) return;
 
 		//index to the last element
 		size_t IndexLast = m_vecButtonComponentPtr.size() - 1;
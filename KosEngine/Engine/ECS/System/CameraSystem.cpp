@@ -19,6 +19,8 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "../ECS.h"
 
 #include "CameraSystem.h"
+#include "../TickLOD.h"
+#include "../Asset Manager/AssetManager.h"
 #include "../Graphics/GraphicsPipe.h"
 #include "../Graphics/GraphicsCamera.h"
 
@@ -30,8 +32,8 @@ namespace ecs {
 
 		//Checks if system already has stored the entity
 
-		if (std::find_if(m_vecCameraComponentPtr.begin(), m_vecCameraComponentPtr.end(), [ID](const auto& obj) { return obj->m_Entity == ID; })
-			== m_vecCameraComponentPtr.end()) {
+		if (!m_HasEntity(ID)) {
+			m_AddEntity(ID);
 			m_vecTransformComponentPtr.push_back((TransformComponent*)ecs->m_ECS_CombinedComponentPool[TYPETRANSFORMCOMPONENT]->m_GetEntityComponent(ID));
 			m_vecCameraComponentPtr.push_back((CameraComponent*)ecs->m_ECS_CombinedComponentPool[TYPECAMERACOMPONENT]->m_GetEntityComponent(ID));
 			m_vecNameComponentPtr.push_back((NameComponent*)ecs->m_ECS_CombinedComponentPool[TYPENAMECOMPONENT]->m_GetEntityComponent(ID));
@@ -39,14 +41,9 @@ namespace ecs {
 	}
 
 	void CameraSystem::m_DeregisterSystem(EntityID ID) {
-		//search element location for the entity
-		size_t IndexID{};
-		for (auto& ComponentPtr : m_vecCameraComponentPtr) {
-			if (ComponentPtr->m_Entity == ID) {
-				break;
-			}
-			IndexID++;
-		}
+		//element location for the entity
+		size_t IndexID = m_RemoveEntity(ID);
+		if (IndexID == m_invalidPosition) return;
 
 		//index to the last element
 		size_t IndexLast = m_vecCameraComponentPtr.size() - 1;
@@ -99,6 +96,14 @@ namespace ecs {
 			graphicpipe::GraphicsCamera::m_currCameraTranslateX = transform->m_transformation.m_e20;
 			graphicpipe::GraphicsCamera::m_currCameraTranslateY = transform->m_transformation.m_e21;
 
+			//same view as the buttons, a rotated view is covered by its circle
+			vector2::Vec2 halfExtents{ std::fabs(transform->m_scale.m_x) * (1.f / graphicpipe::GraphicsCamera::m_aspectRatio), std::fabs(transform->m_scale.m_y) };
+			if (transform->m_rotation != 0.f) {
+				halfExtents.m_x = halfExtents.m_y = std::sqrt(halfExtents.m_x * halfExtents.m_x + halfExtents.m_y * halfExtents.m_y);
+			}
+			TickLOD::m_GetInstance()->m_SetCamera({ transform->m_transformation.m_e20, transform->m_transformation.m_e21 }, halfExtents);
+			assetmanager::AssetManager::m_funcGetInstance()->m_audioManager.m_SetListener({ transform->m_transformation.m_e20, transform->m_transformation.m_e21 }, halfExtents);
+
 			mat3x3::Mat3x3 debugTransformation = mat3x3::Mat3Transform(vector2::Vec2{ transform->m_transformation.m_e20, transform->m_transformation.m_e21 }, vector2::Vec2{ transform->m_scale.m_x * 2 * (1.f / graphicpipe::GraphicsCamera::m_aspectRatio), transform->m_scale.m_y * 2 }, transform->m_rotation);
 			//change camera debug box tobe of different colour
 			graphicsPipe->m_debugBoxData.push_back({ glm::mat3{debugTransformation.m_e00,debugTransformation.m_e01,debugTransformation.m_e02,
@@ -30,42 +30,16 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 namespace ecs {
 
 	void CollisionResponseSystem::m_RegisterSystem(EntityID ID) {
-		ECS* ecs = ECS::m_GetInstance();
-
-		//Checks if system already has stored the entity
 
-		if (std::find_if(m_vecRigidBodyComponentPtr.begin(), m_vecRigidBodyComponentPtr.end(), [ID](const auto& obj) { return obj->m_Entity == ID; })
-			== m_vecRigidBodyComponentPtr.end()) {
-			m_vecTransformComponentPtr.push_back((TransformComponent*)ecs->m_ECS_CombinedComponentPool[TYPETRANSFORMCOMPONENT]->m_GetEntityComponent(ID));
-			m_vecColliderComponentPtr.push_back((ColliderComponent*)ecs->m_ECS_CombinedComponentPool[TYPECOLLIDERCOMPONENT]->m_GetEntityComponent(ID));
-			m_vecRigidBodyComponentPtr.push_back((RigidBodyComponent*)ecs->m_ECS_CombinedComponentPool[TYPERIGIDBODYCOMPONENT]->m_GetEntityComponent(ID));
-			m_vecNameComponentPtr.push_back((NameComponent*)ecs->m_ECS_CombinedComponentPool[TYPENAMECOMPONENT]->m_GetEntityComponent(ID));
+		//components are read through a view, only membership is tracked
+		if (!m_HasEntity(ID)) {
+			m_AddEntity(ID);
 		}
 	}
 
 	void CollisionResponseSystem::m_DeregisterSystem(EntityID ID) {
-		//search element location for the entity
-		size_t IndexID{};
-		for (auto& ComponentPtr : m_vecRigidBodyComponentPtr) {
-			if (ComponentPtr->m_Entity == ID) {
-				break;
-			}
-			IndexID++;
-		}
 
-		//index to the last element
-		size_t IndexLast = m_vecRigidBodyComponentPtr.size() - 1;
-
-		std::swap(m_vecColliderComponentPtr[IndexID],  m_vecColliderComponentPtr[IndexLast]);
-		std::swap(m_vecRigidBodyComponentPtr[IndexID], m_vecRigidBodyComponentPtr[IndexLast]);
-		std::swap(m_vecTransformComponentPtr[IndexID], m_vecTransformComponentPtr[IndexLast]);
-		std::swap(m_vecNameComponentPtr[IndexID], m_vecNameComponentPtr[IndexLast]);
-
-		//popback the vector;
-		m_vecColliderComponentPtr.pop_back();
-		m_vecRigidBodyComponentPtr.pop_back();
-		m_vecTransformComponentPtr.pop_back();
-		m_vecNameComponentPtr.pop_back();
+		m_RemoveEntity(ID);
 	}
 
 	void CollisionResponseSystem::m_Init() {
@@ -82,11 +56,6 @@ namespace ecs {
 		ECS* ecs = ECS::m_GetInstance();
 		//Helper::Helpers* help = Helper::Helpers::GetInstance();
 
-		if (m_vecRigidBodyComponentPtr.size() != m_vecTransformComponentPtr.size()) {
-			LOGGING_ERROR("Error: Vecotrs container size does not Match");
-			return;
-		}
-
 		//TODO instead of retrieving every loop, just get the address of the vector in the physics pipeline
 		physicspipe::Physics* PhysicsPipeline = physicspipe::Physics::m_GetInstance();
 
@@ -98,23 +67,19 @@ namespace ecs {
 		std::vector < std::pair < std::pair<std::shared_ptr<physicspipe::PhysicsData>, std::shared_ptr<physicspipe::PhysicsData>>, std::pair<vector2::Vec2, float>>> vecCollisionEntityPairWithVector = PhysicsPipeline->m_RetrievePhysicsDataPairWithVector();
 		std::unordered_set<ecs::EntityID> ids;
 
-		std::vector<ecs::EntityID> respondedids;
-
-		for (int n{}; n < m_vecRigidBodyComponentPtr.size(); n++)
+		//collisions of the last frame are cleared for every rigid body, not only the ones of the scene
+		ecs->m_View<RigidBodyComponent, ColliderComponent, TransformComponent>().m_Each([](EntityID, RigidBodyComponent&, ColliderComponent& collider, TransformComponent&)
 		{
-			NameComponent* NameComp = m_vecNameComponentPtr[n];
-			RigidBodyComponent* rigidComp = m_vecRigidBodyComponentPtr[n];
-			ColliderComponent* ColComp = m_vecColliderComponentPtr[n];
-			TransformComponent* transform = m_vecTransformComponentPtr[n];
-
-
-			respondedids.push_back(NameComp->m_Entity);
-
-			ColComp->m_collidedWith.clear();
-			ColComp->m_blockedFlag = -1;
-			//skip component not of the scene
-			if ((rigidComp->m_scene != scene) || !ecs->m_layersStack.m_layerBitSet.test(NameComp->m_Layer) || NameComp->m_hide) continue;
+			collider.m_collidedWith.clear();
+			collider.m_blockedFlag = -1;
+		});
 
+		//rigid bodies of the scene on an active layer that are not hidden
+		ecs->m_View<RigidBodyComponent, ColliderComponent, TransformComponent, NameComponent>().m_InScene(scene).m_InActiveLayer().m_Each([&](EntityID, RigidBodyComponent& rigid, ColliderComponent& collider, TransformComponent& trans, NameComponent&)
+		{
+			RigidBodyComponent* rigidComp = &rigid;
+			ColliderComponent* ColComp = &collider;
+			TransformComponent* transform = &trans;
 
 			EntityID obj1_EntityID = rigidComp->m_Entity;
 
@@ -199,8 +164,7 @@ namespace ecs {
 				}
 
 
-				if (std::find_if(m_vecRigidBodyComponentPtr.begin(), m_vecRigidBodyComponentPtr.end(), [obj1_EntityID](const auto& obj) { return obj->m_Entity == obj1_EntityID; })
-					!= m_vecRigidBodyComponentPtr.end()) {
+				if (m_HasEntity(obj1_EntityID)) {
 					if (ColComp->m_collisionResponse) {
 						vector2::Vec2 toMove{};
 						if (swap) {
@@ -239,7 +203,7 @@ namespace ecs {
 			//	ColComp->m_blockedFlag = iterator->first->m_collisionFlags;
 			//}
 
-		}
+		});
 		//if (!vecCollisionEntityPairWithVector.empty()) {
 		//	for (int i{}; i < vecCollisionEntityPairWithVector.size(); ++i) {
 		//		std::pair < std::pair<std::shared_ptr<physicspipe::PhysicsData>, std::shared_ptr<physicspipe::PhysicsData> >, std::pair<vector2::Vec2, float>> val = vecCollisionEntityPairWithVector[i];
@@ -70,43 +70,6 @@ namespace ecs {
 		void m_Update(const std::string&) override;
 
 
-	private:
-		/******************************************************************/
-		/*!
-		\var     std::vector<TransformComponent*> m_vecTransformComponentPtr
-		\brief   Stores pointers to TransformComponent instances for registered entities.
-		\details Used to efficiently access and update the transform data of entities involved in collisions.
-		*/
-		/******************************************************************/
-		std::vector<TransformComponent*> m_vecTransformComponentPtr;
-
-		/******************************************************************/
-		/*!
-		\var     std::vector<ColliderComponent*> m_vecColliderComponentPtr
-		\brief   Stores pointers to ColliderComponent instances for registered entities.
-		\details Used to manage and update the collider data of entities in the system.
-		*/
-		/******************************************************************/
-		std::vector<ColliderComponent*> m_vecColliderComponentPtr;
-
-		/******************************************************************/
-		/*!
-		\var     std::vector<RigidBodyComponent*> m_vecRigidBodyComponentPtr
-		\brief   Stores pointers to RigidBodyComponent instances for registered entities.
-		\details Used to manage and update the physical properties and dynamics of entities in the system.
-		*/
-		/******************************************************************/
-		std::vector<RigidBodyComponent*> m_vecRigidBodyComponentPtr;
-
-		/******************************************************************/
-		/*!
-		\var     std::vector<NameComponent*> m_vecNameComponentPtr
-		\brief   Stores pointers to NameComponent instances for registered entities.
-		\details Used to identify entities by name within the collision response system, aiding in debugging and tracking.
-		*/
-		/******************************************************************/
-		std::vector<NameComponent*> m_vecNameComponentPtr;
-
 	};
 
 }
@@ -33,40 +33,16 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 namespace ecs {
 
 	void CollisionSystem::m_RegisterSystem(EntityID ID) {
-		ECS* ecs = ECS::m_GetInstance();
-
-		//Checks if system already has stored the entity
 
-		if (std::find_if(m_vecTransformComponentPtr.begin(), m_vecTransformComponentPtr.end(), [ID](const auto& obj) { return obj->m_Entity == ID; })
-			== m_vecTransformComponentPtr.end()) {
-			m_vecTransformComponentPtr.push_back((TransformComponent*)ecs->m_ECS_CombinedComponentPool[TYPETRANSFORMCOMPONENT]->m_GetEntityComponent(ID));
-			m_vecColliderComponentPtr.push_back((ColliderComponent*)ecs->m_ECS_CombinedComponentPool[TYPECOLLIDERCOMPONENT]->m_GetEntityComponent(ID));
-			m_vecNameComponentPtr.push_back((NameComponent*)ecs->m_ECS_CombinedComponentPool[TYPENAMECOMPONENT]->m_GetEntityComponent(ID));
-			
+		//components are read through a view, only membership is tracked
+		if (!m_HasEntity(ID)) {
+			m_AddEntity(ID);
 		}
 	}
 
 	void CollisionSystem::m_DeregisterSystem(EntityID ID) {
-		//search element location for the entity
-		size_t IndexID{};
-		for (auto& ComponentPtr : m_vecColliderComponentPtr) {
-			if (ComponentPtr->m_Entity == ID) {
-				break;
-			}
-			IndexID++;
-		}
 
-		//index to the last element
-		size_t IndexLast = m_vecColliderComponentPtr.size() - 1;
-
-		std::swap(m_vecColliderComponentPtr[IndexID], m_vecColliderComponentPtr[IndexLast]);
-		std::swap(m_vecTransformComponentPtr[IndexID], m_vecTransformComponentPtr[IndexLast]);
-		std::swap(m_vecNameComponentPtr[IndexID], m_vecNameComponentPtr[IndexLast]);
-
-		//popback the vector;
-		m_vecColliderComponentPtr.pop_back();
-		m_vecTransformComponentPtr.pop_back();
-		m_vecNameComponentPtr.pop_back();
+		m_RemoveEntity(ID);
 	}
 
 	void CollisionSystem::m_Init() {
@@ -79,36 +55,23 @@ namespace ecs {
 
 		ECS* ecs = ECS::m_GetInstance();
 
-		if (m_vecColliderComponentPtr.size() != m_vecTransformComponentPtr.size()) {
-			//std::cout << "Error: Vecotrs container size does not Match" << std::endl;
-			LOGGING_ERROR("Error: Vecotrs container size does not Match");
-			return;
-		}
-		
 		//TODO find better way to fill up data
-		for (int n{}; n < m_vecColliderComponentPtr.size(); n++)
+		ecs->m_View<ColliderComponent>().m_Each([](EntityID, ColliderComponent& collider)
 		{
-			ColliderComponent* ColComp = m_vecColliderComponentPtr[n];
-			ColComp->m_isCollided = false;
-		}
+			collider.m_isCollided = false;
+		});
 
 		//create physics;
 		physicspipe::Physics* PhysicsPipeline = physicspipe::Physics::m_GetInstance();
 		PhysicsPipeline->m_ClearEntites();
 		PhysicsPipeline->m_ClearPair();
 
-		for (int n{}; n < m_vecTransformComponentPtr.size(); n++) {
-			//std::cout << "Entity: " << n << "Movement System is getting Updated";
-			
-			ColliderComponent* ColComp = m_vecColliderComponentPtr[n];
-			TransformComponent* TransComp = m_vecTransformComponentPtr[n];
-			NameComponent* NameComp = m_vecNameComponentPtr[n];
-			EntityID id = ColComp->m_Entity;
-
-			//skip component not of the scene
-			if ((ColComp->m_scene != scene) || !ecs->m_layersStack.m_layerBitSet.test(NameComp->m_Layer) || NameComp->m_hide) continue;
-			
-
+		//colliders of the scene on an active layer that are not hidden
+		ecs->m_View<ColliderComponent, TransformComponent, NameComponent>().m_InScene(scene).m_InActiveLayer().m_Each([&](EntityID id, ColliderComponent& collider, TransformComponent& transform, NameComponent& name)
+		{
+			ColliderComponent* ColComp = &collider;
+			TransformComponent* TransComp = &transform;
+			NameComponent* NameComp = &name;
 
 			//if movement component is present, do dynamic collision
 			vector2::Vec2 velocity{};
@@ -138,9 +101,9 @@ namespace ecs {
 				TransformComponent* parentComp{ static_cast<TransformComponent*>(ecs->m_ECS_CombinedComponentPool[TYPETRANSFORMCOMPONENT]->m_GetEntityComponent(parentID)) };
 
 				if (!parentComp) {
-					continue;
+					return;
 				}
-				if (!parentComp) continue;
+				if (!parentComp) return;
 							
 				if (ColComp->m_type == physicspipe::EntityType::CIRCLE) {
 					mat3x3::Mat3x3 debugTransformation = mat3x3::Mat3Transform(TransComp->m_position, vector2::Vec2{ 1.f, 1.f }, 0);
@@ -169,7 +132,7 @@ namespace ecs {
 
 
 					//dont pass data if collision check is false
-					if (!ColComp->m_collisionCheck) continue;
+					if (!ColComp->m_collisionCheck) return;
 					PhysicsPipeline->m_SendPhysicsData(ColComp->m_radius, pos,prevPos, scale, velocity, id, NameComp->m_Layer);
 				}
 				else if (ColComp->m_type == physicspipe::EntityType::RECTANGLE) {
@@ -204,7 +167,7 @@ namespace ecs {
 					ColComp->m_collider_Transformation = debugTransformation;
 
 					//dont pass data if collision check is false
-					if (!ColComp->m_collisionCheck) continue;
+					if (!ColComp->m_collisionCheck) return;
 					mat3x3::Mat3Decompose(ColComp->m_collider_Transformation, pos, scale, rot);
 					PhysicsPipeline->m_SendPhysicsData(scale.m_y, scale.m_x, rot, pos,  prevPos , scale, velocity, id, NameComp->m_Layer);
 				}
@@ -230,7 +193,7 @@ namespace ecs {
 
 
 					//dont pass data if collision check is false
-					if (!ColComp->m_collisionCheck) continue;
+					if (!ColComp->m_collisionCheck) return;
 					mat3x3::Mat3Decompose(ColComp->m_collider_Transformation, pos, scale, rot);
 					PhysicsPipeline->m_SendPhysicsData(ColComp->m_radius, pos,prevPos, scale, velocity, id, NameComp->m_Layer);
 				}
@@ -249,7 +212,7 @@ namespace ecs {
 					ColComp->m_collider_Transformation = debugTransformation;
 
 					//dont pass data if collision check is false
-					if (!ColComp->m_collisionCheck) continue;
+					if (!ColComp->m_collisionCheck) return;
 					mat3x3::Mat3Decompose(ColComp->m_collider_Transformation, pos, scale, rot);
 					PhysicsPipeline->m_SendPhysicsData(scale.m_y, scale.m_x, rot, pos,  prevPos , scale, velocity, id, NameComp->m_Layer);
 				}
@@ -257,7 +220,7 @@ namespace ecs {
 					LOGGING_ERROR("NO ENTITY TYPE");
 				}
 			}
-		}
+		});
 	}
 		
 
@@ -26,8 +26,8 @@ namespace ecs {
 	void GridSystem::m_RegisterSystem(EntityID ID) {
 		ECS* ecs = ECS::m_GetInstance();
 
-		if (std::find_if(m_vecTransformComponentPtr.begin(), m_vecTransformComponentPtr.end(), [ID](const auto& obj) { return obj->m_Entity == ID; })
-			== m_vecTransformComponentPtr.end()) {
+		if (!m_HasEntity(ID)) {
+			m_AddEntity(ID);
 			m_vecTransformComponentPtr.push_back((TransformComponent*)ecs->m_ECS_CombinedComponentPool[TYPETRANSFORMCOMPONENT]->m_GetEntityComponent(ID));
 			m_vecGridComponentPtr.push_back((GridComponent*)ecs->m_ECS_CombinedComponentPool[TYPEGRIDCOMPONENT]->m_GetEntityComponent(ID));
 			m_vecNameComponentPtr.push_back((NameComponent*)ecs->m_ECS_CombinedComponentPool[TYPENAMECOMPONENT]->m_GetEntityComponent(ID));
@@ -37,14 +37,11 @@ namespace ecs {
 
 	void GridSystem::m_DeregisterSystem(EntityID ID) {
 
-		//search element location for the entity
-		size_t IndexID{};
-		for (auto& GridComponentPtr : m_vecGridComponentPtr) {
-			if (GridComponentPtr->m_Entity == ID) {
-				break;
-			}
-			IndexID++;
-		}
+		//element location for the entity
+
+		size_t IndexID = m_RemoveEntity(ID);
+
+		if (IndexID == m_invalidPosition) return;
 
 		//index to the last element
 		size_t IndexLast = m_vecGridComponentPtr.size() - 1;
@@ -22,38 +22,17 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 namespace ecs {
 
 	void LightingSystem::m_RegisterSystem(EntityID ID) {
-		ECS* ecs = ECS::m_GetInstance();
 
-		if (std::find_if(m_vecTransformComponentPtr.begin(), m_vecTransformComponentPtr.end(), [ID](const auto& obj) { return obj->m_Entity == ID; })
-			== m_vecTransformComponentPtr.end()) {
-			m_vecTransformComponentPtr.push_back((TransformComponent*)ecs->m_ECS_CombinedComponentPool[TYPETRANSFORMCOMPONENT]->m_GetEntityComponent(ID));
-			m_vecLightingComponentPtr.push_back((LightingComponent*)ecs->m_ECS_CombinedComponentPool[TYPELIGHTINGCOMPONENT]->m_GetEntityComponent(ID));
-			m_vecNameComponentPtr.push_back((NameComponent*)ecs->m_ECS_CombinedComponentPool[TYPENAMECOMPONENT]->m_GetEntityComponent(ID));
+		//components are read through a view, only membership is tracked
+		if (!m_HasEntity(ID)) {
+			m_AddEntity(ID);
 		}
 
 	}
 
 	void LightingSystem::m_DeregisterSystem(EntityID ID) {
 
-		//search element location for the entity
-		size_t IndexID{};
-		for (auto& LightingComponentPtr : m_vecLightingComponentPtr) {
-			if (LightingComponentPtr->m_Entity == ID) {
-				break;
-			}
-			IndexID++;
-		}
-
-		//index to the last element
-		size_t IndexLast = m_vecLightingComponentPtr.size() - 1;
-		std::swap(m_vecLightingComponentPtr[IndexID], m_vecLightingComponentPtr[IndexLast]);
-		std::swap(m_vecTransformComponentPtr[IndexID], m_vecTransformComponentPtr[IndexLast]);
-		std::swap(m_vecNameComponentPtr[IndexID], m_vecNameComponentPtr[IndexLast]);
-
-		//popback the vector;
-		m_vecLightingComponentPtr.pop_back();
-		m_vecTransformComponentPtr.pop_back();
-		m_vecNameComponentPtr.pop_back();
+		m_RemoveEntity(ID);
 	}
 
 	void LightingSystem::m_Init()
@@ -67,19 +46,11 @@ namespace ecs {
 		ECS* ecs = ECS::m_GetInstance();
 		graphicpipe::GraphicsPipe* graphicsPipe = graphicpipe::GraphicsPipe::m_funcGetInstance();
 
-		if (m_vecLightingComponentPtr.size() != m_vecTransformComponentPtr.size()) {
-			LOGGING_ERROR("Error: Vectors container size does not Match");
-			return;
-		}
-
-		//loops through all vecoters pointing to component
-		for (int n{}; n < m_vecLightingComponentPtr.size(); n++) 
+		//loops through the lights of the scene on an active layer, hidden lights still shine
+		ecs->m_View<LightingComponent, TransformComponent>().m_InScene(scene).m_InActiveLayer(false).m_Each([&](EntityID, LightingComponent& lc, TransformComponent& tc)
 		{
-			TransformComponent* transform = m_vecTransformComponentPtr[n];
-			LightingComponent* light = m_vecLightingComponentPtr[n];
-			NameComponent* nc = m_vecNameComponentPtr[n];
-			//skip component not of the scene
-			if ((light->m_scene != scene) || !ecs->m_layersStack.m_layerBitSet.test(nc->m_Layer)) continue;
+			TransformComponent* transform = &tc;
+			LightingComponent* light = &lc;
 
 			//Clamp between 0.f and 1.f
 			light->m_innerOuterRadius.m_x = light->m_innerOuterRadius.m_x > 1.f ? 1.f : light->m_innerOuterRadius.m_x < 0.f ? 0.f : light->m_innerOuterRadius.m_x;
@@ -115,10 +86,10 @@ namespace ecs {
 			//transform->m_transformation = final_Matrix;
 			if (transform->m_haveParent) {
 				EntityID parentID = ecs::Hierachy::m_GetParent(transform->m_Entity).value();
-				TransformComponent* parentComp{ static_cast<TransformComponent*>(ecs->m_ECS_CombinedComponentPool[TYPETRANSFORMCOMPONENT]->m_GetEntityComponent(parentID)) };
+				TransformComponent* parentComp{ ecs->m_GetComponent<TransformComponent>(parentID) };
 
 				if (!parentComp) {
-					continue;
+					return;
 				}
 
 				vector2::Vec2 parentScale, parentTranslate;
@@ -220,7 +191,7 @@ namespace ecs {
 			//										   light->m_intensity, light->m_lightType });
 		
 
-		}
+		});
 
 
 	}
@@ -87,15 +87,6 @@ namespace ecs {
         /******************************************************************/
         void m_Update(const std::string&) override;
 
-    private:
-        //! Vector storing pointers to the TransformComponent of registered entities
-        std::vector<TransformComponent*> m_vecTransformComponentPtr;
-        //! Vector storing pointers to the ColliderComponent of registered entities
-       // std::vector<ColliderComponent*> m_vecColliderComponentPtr;
-       // std::vector<NameComponent*>m_vecNameComponentPtr;
-        std::vector<LightingComponent*> m_vecLightingComponentPtr;
-        std::vector<NameComponent*> m_vecNameComponentPtr;
-
     };
 
 }
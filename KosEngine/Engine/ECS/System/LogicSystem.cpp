@@ -16,6 +16,8 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "../ECS.h"
 
 #include "LogicSystem.h"
+#include "../TickLOD.h"
+#include "../Helper/Helper.h"
 #include "../Asset Manager/AssetManager.h"
 
 
@@ -24,22 +26,31 @@ namespace ecs {
 
 	void LogicSystem::m_RegisterSystem(EntityID ID) {
 		ECS* ecs = ECS::m_GetInstance();
-		if (std::find_if(m_vecScriptComponentPtr.begin(), m_vecScriptComponentPtr.end(), [ID](const auto& obj) { return obj->m_Entity == ID; })
-			== m_vecScriptComponentPtr.end()) {
+		if (!m_HasEntity(ID)) {
+			m_AddEntity(ID);
 			m_vecScriptComponentPtr.push_back((ScriptComponent*)ecs->m_ECS_CombinedComponentPool[TYPESCRIPTCOMPONENT]->m_GetEntityComponent(ID));
 			m_vecNameComponentPtr.push_back((NameComponent*)ecs->m_ECS_CombinedComponentPool[TYPENAMECOMPONENT]->m_GetEntityComponent(ID));
+			m_vecTransformComponentPtr.push_back((TransformComponent*)ecs->m_ECS_CombinedComponentPool[TYPETRANSFORMCOMPONENT]->m_GetEntityComponent(ID));
+			m_vecScriptSlots.emplace_back();
 		}
 
 	}
 
 	void LogicSystem::m_DeregisterSystem(EntityID ID) {
-		//search element location for the entity
-		size_t IndexID{};
-		for (auto& ComponentPtr : m_vecScriptComponentPtr) {
-			if (ComponentPtr->m_Entity == ID) {
-				break;
+		//element location for the entity
+		size_t IndexID = m_RemoveEntity(ID);
+		if (IndexID == m_invalidPosition) return;
+
+		//scripts of the entity still waiting to run this frame are skipped, their handles are freed below
+		const EntityID index = m_GetEntityIndex(ID);
+		if (m_running && index < m_frameRanges.size() && m_frameRanges[index].m_frame == m_frame) {
+			const FrameRange& range = m_frameRanges[index];
+			std::fill_n(m_frameStart.begin() + range.m_first, range.m_count, script::ScriptHandler::m_scheduleSkip);
+
+			//the scheduler only reads the flags of the group that is running, later groups copy m_frameStart
+			if (range.m_first >= m_runningFirst && range.m_first < m_runningFirst + m_runningCount) {
+				assetmanager::AssetManager::m_funcGetInstance()->m_scriptManager.m_SkipScripts(range.m_first, range.m_count);
 			}
-			IndexID++;
 		}
 
 
@@ -65,9 +76,13 @@ namespace ecs {
 		size_t IndexLast = m_vecScriptComponentPtr.size() - 1;
 		std::swap(m_vecScriptComponentPtr[IndexID], m_vecScriptComponentPtr[IndexLast]);
 		std::swap(m_vecNameComponentPtr[IndexID], m_vecNameComponentPtr[IndexLast]);
+		std::swap(m_vecTransformComponentPtr[IndexID], m_vecTransformComponentPtr[IndexLast]);
+		std::swap(m_vecScriptSlots[IndexID], m_vecScriptSlots[IndexLast]);
 		//popback the vector;
 		m_vecScriptComponentPtr.pop_back();
 		m_vecNameComponentPtr.pop_back();
+		m_vecTransformComponentPtr.pop_back();
+		m_vecScriptSlots.pop_back();
 	}
 
 	void LogicSystem::m_Init() {
@@ -84,13 +99,15 @@ namespace ecs {
 		//reset all script instance
 		std::shared_ptr<ComponentPool<ScriptComponent>> pool = std::dynamic_pointer_cast<ComponentPool<ScriptComponent>>(ecs->m_ECS_CombinedComponentPool[ecs::TYPESCRIPTCOMPONENT]);
 		std::for_each(pool->m_Pool.begin(), pool->m_Pool.end(), [](auto& x) {x.m_scriptInstances.clear(); });
+		std::for_each(m_vecScriptSlots.begin(), m_vecScriptSlots.end(), [](auto& x) {x.m_valid = false; });
 		
 		//loops through all vecoters pointing to component
 		for (int n{}; n < m_vecScriptComponentPtr.size(); n++) {
 			ScriptComponent* scriptComp = m_vecScriptComponentPtr[n];
 
-			//skip prefab
-			if (ecs->m_ECS_SceneMap.find(scriptComp->m_scene)->second.m_isPrefab)continue;
+			//skip prefab, and pooled entities parked without a scene, they get their instance when spawned
+			const auto& sceneIt = ecs->m_ECS_SceneMap.find(scriptComp->m_scene);
+			if (scriptComp->m_scene.empty() || sceneIt == ecs->m_ECS_SceneMap.end() || sceneIt->second.m_isPrefab) continue;
 
 			CreateandStartScriptInstance(scriptComp);
 
@@ -122,34 +139,64 @@ namespace ecs {
 			assetManager->m_scriptManager.m_assignVaraiblestoScript(scriptComp, std::get<0>(_script));
 		}
 
+		//instances were replaced, the slots are resolved again
+		const size_t position = m_GetEntityPosition(scriptComp->m_Entity);
+		if (position != m_invalidPosition) {
+			m_vecScriptSlots[position].m_valid = false;
+		}
+
 		// invoke start function
 		for (auto& instance : scriptComp->m_scriptInstances) {
 
 			void* params[1];
 			params[0] = &scriptComp->m_Entity; // Pass the entity ID
 
-			assetManager->m_scriptManager.m_InvokeMethod(instance.first, "Awake", instance.second.first, params);
+			assetManager->m_scriptManager.m_InvokeMethod(assetManager->m_scriptManager.m_GetClassID(instance.first), script::METHODAWAKE, instance.second.first, params);
 			
 
 		}
 	}
 
+	bool LogicSystem::m_ResolveScriptSlots(size_t position) {
+
+		ScriptComponent* scriptComp = m_vecScriptComponentPtr[position];
+		ScriptSlots& slots = m_vecScriptSlots[position];
+
+		const uint32_t version = ECS::m_GetInstance()->m_GetEntityVersion(scriptComp->m_Entity);
+		if (slots.m_valid && slots.m_version == version) return true;
+
+		script::ScriptHandler& scriptManager = assetmanager::AssetManager::m_funcGetInstance()->m_scriptManager;
+
+		slots.m_valid = false;
+		slots.m_slots.clear();
+		for (size_t n{}; n < scriptComp->m_scripts.size(); n++) {
+			const std::string& scriptName = std::get<0>(scriptComp->m_scripts[n]);
+
+			auto instance = scriptComp->m_scriptInstances.find(scriptName);
+			if (instance == scriptComp->m_scriptInstances.end()) return false;
+
+			slots.m_slots.push_back({ n, scriptManager.m_GetClassID(scriptName), &instance->second });
+		}
+
+		slots.m_valid = true;
+		slots.m_version = version;
+		return true;
+	}
+
 	void LogicSystem::m_Update(const std::string& scene) {
 
 		ECS* ecs = ECS::m_GetInstance();
-		assetmanager::AssetManager* assetManager = assetmanager::AssetManager::m_funcGetInstance();
-		//if (m_vecMovementComponentPtr.size() != m_vecTransformComponentPtr.size()) {
-		//	//std::cout << "Error: Vectors container size does not Match" << std::endl;
-		//	LOGGING_ERROR("Error: Vectors container size does not Match");
-		//	return;
-		//}
+		TickLOD* tickLOD = TickLOD::m_GetInstance();
 
-		
+		m_frame++;
+		m_frameScripts.clear();
+		m_frameStart.clear();
+		m_frameClassIDs.clear();
+		m_frameGroups.clear();
+		m_frameEntities.clear();
 
-
-		//loops through all vecoters pointing to component
+		//loops through all vecoters pointing to component, only finding the entities that update this frame
 		for (int n{}; n < m_vecScriptComponentPtr.size(); n++) {
-			//std::cout << "Entity: " << n << "Movement System is getting Updated";
 
 			ScriptComponent* scriptComp = m_vecScriptComponentPtr[n];
 			NameComponent* NameComp = m_vecNameComponentPtr[n];
@@ -158,83 +205,126 @@ namespace ecs {
 
 
 			//check if scriptcomponent have instance
-			for (auto& scriptstring : scriptComp->m_scripts) {
-
-				if (std::find_if(scriptComp->m_scriptInstances.begin(), scriptComp->m_scriptInstances.end(), [&](auto& x){return x.first == std::get<0>(scriptstring);}) == scriptComp->m_scriptInstances.end()) {
-					CreateandStartScriptInstance(scriptComp);
-					LOGGING_INFO("Script Instance Created");
-					break;
-				}
+			if (!m_ResolveScriptSlots(n)) {
+				CreateandStartScriptInstance(scriptComp);
+				LOGGING_INFO("Script Instance Created");
+				if (!m_ResolveScriptSlots(n)) continue;
 			}
 
+			//a script that has not started runs this frame
+			const bool starting = std::any_of(m_vecScriptSlots[n].m_slots.begin(), m_vecScriptSlots[n].m_slots.end(), [](const ScriptSlot& script) { return script.m_instance->second == false; });
+			const int interval = starting ? 1 : tickLOD->m_GetInterval(scriptComp->m_Entity, m_vecTransformComponentPtr[n], NameComp);
 
-			for (auto& scriptname : scriptComp->m_scripts) {
+			TickTime time;
+			if (!tickLOD->m_ShouldTick(TICKSCRIPT, scriptComp->m_Entity, interval, time)) continue;
 
-				auto script = scriptComp->m_scriptInstances.find(std::get<0>(scriptname));
-				try {
-					// run the scripts update fuction
-					const auto& scriptIsEnabled = std::find_if(scriptComp->m_scripts.begin(), scriptComp->m_scripts.end(), [&](auto& x) {return std::get<0>(x) == script->first;});
-					if (scriptIsEnabled == scriptComp->m_scripts.end()) continue;
+			//entities that cover the same time share a group
+			size_t group{};
+			while (group < m_frameGroups.size() && !(m_frameGroups[group].m_time == time)) {
+				group++;
+			}
+			if (group == m_frameGroups.size()) {
+				m_frameGroups.push_back({ time });
+			}
 
-					if (std::get<1>(*scriptIsEnabled)){
+			m_frameEntities.push_back({ static_cast<uint32_t>(n), static_cast<uint32_t>(group) });
+		}
 
-						if (script->second.second == false) {
-							assetManager->m_scriptManager.m_InvokeMethod(script->first, "Start", script->second.first, nullptr);
-							script->second.second = true;
-						}
+		//scripts of a group are next to each other, the groups in the order they were found
+		for (size_t group{}; group < m_frameGroups.size(); group++) {
+			m_frameGroups[group].m_first = static_cast<uint32_t>(m_frameScripts.size());
 
+			for (const auto& [n, entityGroup] : m_frameEntities) {
+				if (entityGroup != group) continue;
 
-						else if (script->second.first) {
+				ScriptComponent* scriptComp = m_vecScriptComponentPtr[n];
 
-							// Call the Update function
-							assetManager->m_scriptManager.m_InvokeMethod(script->first, "Update", script->second.first, nullptr);
-							
-						} 
+				const uint32_t first = static_cast<uint32_t>(m_frameScripts.size());
+				for (const ScriptSlot& script : m_vecScriptSlots[n].m_slots) {
+					if (!std::get<1>(scriptComp->m_scripts[script.m_script])) continue;
 
-					}
-					
+					//start runs in place of the first update
+					const bool start = script.m_instance->second == false;
+					script.m_instance->second = true;
+					if (!script.m_instance->first) continue;
+
+					m_frameScripts.push_back(script.m_instance->first);
+					m_frameStart.push_back(start ? script::ScriptHandler::m_scheduleStart : script::ScriptHandler::m_scheduleUpdate);
+					m_frameClassIDs.push_back(script.m_classID);
 				}
-				catch (...) {
-					return;
 
+				const EntityID index = m_GetEntityIndex(scriptComp->m_Entity);
+				if (index >= m_frameRanges.size()) {
+					m_frameRanges.resize(index + 1);
 				}
+				m_frameRanges[index] = { m_frame, first, static_cast<uint32_t>(m_frameScripts.size()) - first };
+			}
+
+			m_frameGroups[group].m_count = static_cast<uint32_t>(m_frameScripts.size()) - m_frameGroups[group].m_first;
+		}
+
+		Helper::Helpers* help = Helper::Helpers::GetInstance();
+		const float frameDeltaTime = help->m_deltaTime;
+		const int frameSteps = help->currentNumberOfSteps;
 
+		//the scheduler keeps the scripts between frames, only the ones that changed are written
+		m_scheduled = assetmanager::AssetManager::m_funcGetInstance()->m_scriptManager.m_SetScripts(m_frameScripts.data(), m_frameStart.data(), m_frameScripts.size());
 
+		m_running = true;
+
+		//every Update of the frame runs before any LateUpdate, whatever group the script is in
+		for (const uint8_t phase : { script::ScriptHandler::m_phaseUpdate, script::ScriptHandler::m_phaseLateUpdate }) {
+			for (const FrameGroup& group : m_frameGroups) {
+				if (group.m_count == 0) continue;
+
+				//scripts read the time through the helper, a slower group sees the time since its last update
+				help->m_deltaTime = group.m_time.m_deltaTime;
+				help->currentNumberOfSteps = group.m_time.m_steps;
+
+				m_RunGroup(group.m_first, group.m_count, phase);
 			}
 		}
 
-		for (int n{}; n < m_vecScriptComponentPtr.size(); n++) { 
-			//std::cout << "Entity: " << n << "Movement System is getting Updated";
+		help->m_deltaTime = frameDeltaTime;
+		help->currentNumberOfSteps = frameSteps;
 
-			ScriptComponent* scriptComp = m_vecScriptComponentPtr[n];
-			NameComponent* NameComp = m_vecNameComponentPtr[n];
-			//skip component not of the scene
-			if ((scriptComp->m_scene != scene) || !ecs->m_layersStack.m_layerBitSet.test(NameComp->m_Layer) || NameComp->m_hide) continue;
+		m_running = false;
+		m_runningFirst = 0;
+		m_runningCount = 0;
+	}
 
+	void LogicSystem::m_RunGroup(uint32_t first, uint32_t count, uint8_t phase) {
 
-			for (auto& scriptname : scriptComp->m_scripts) {
+		m_runningFirst = first;
+		m_runningCount = count;
 
-				auto script = scriptComp->m_scriptInstances.find(std::get<0>(scriptname));
-				if (script == scriptComp->m_scriptInstances.end()) continue;
-				try {
-					// run the scripts update fuction
-					const auto& scriptIsEnabled = std::find_if(scriptComp->m_scripts.begin(), scriptComp->m_scripts.end(), [&](auto& x) {return std::get<0>(x) == script->first; });
-					if (scriptIsEnabled == scriptComp->m_scripts.end()) continue;
+		//one call into C# for every script of the group
+		script::ScriptHandler& scriptManager = assetmanager::AssetManager::m_funcGetInstance()->m_scriptManager;
+		if (!m_scheduled || !scriptManager.m_RunScripts(first, m_frameStart.data() + first, count, phase)) {
+			m_InvokeEachScript(first, count, phase);
+		}
+	}
 
-					if (std::get<1>(*scriptIsEnabled)) {
-						assetManager->m_scriptManager.m_InvokeMethod(script->first, "LateUpdate", script->second.first, nullptr);
+	void LogicSystem::m_InvokeEachScript(uint32_t first, uint32_t count, uint8_t phase) {
 
-					}
+		script::ScriptHandler& scriptManager = assetmanager::AssetManager::m_funcGetInstance()->m_scriptManager;
 
-				}
-				catch (...) {
-					return;
-				}
+		//indexed every call, a destroyed entity marks its scripts skipped
+		for (size_t n{ first }; n < first + count; n++) {
+			if (m_frameStart[n] == script::ScriptHandler::m_scheduleSkip) continue;
 
+			script::ScriptMethod method = script::METHODLATEUPDATE;
+			if (phase == script::ScriptHandler::m_phaseUpdate) {
+				method = m_frameStart[n] == script::ScriptHandler::m_scheduleStart ? script::METHODSTART : script::METHODUPDATE;
+			}
 
+			try {
+				scriptManager.m_InvokeMethod(m_frameClassIDs[n], method, m_frameScripts[n], nullptr);
+			}
+			catch (...) {
+				return;
 			}
 		}
-
 	}
 
 
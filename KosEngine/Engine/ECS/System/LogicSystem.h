@@ -19,6 +19,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "System.h"
 #include "../ECS/Component/ScriptComponent.h"
 #include "../ECS/ECSList.h"
+#include "../ECS/TickLOD.h"
 
 namespace ecs {
 
@@ -88,6 +89,111 @@ namespace ecs {
         std::vector<ScriptComponent*> m_vecScriptComponentPtr;
 
         std::vector<NameComponent*> m_vecNameComponentPtr;
+
+        std::vector<TransformComponent*> m_vecTransformComponentPtr;
+
+        //a script of a component, resolved so the update does not search by name
+        struct ScriptSlot {
+            //position in ScriptComponent::m_scripts
+            size_t m_script{};
+            int m_classID{ -1 };
+            //entry in ScriptComponent::m_scriptInstances
+            std::pair<MonoObject*, bool>* m_instance{};
+        };
+
+        struct ScriptSlots {
+            bool m_valid{ false };
+            //entity version the slots were resolved at
+            uint32_t m_version{};
+            std::vector<ScriptSlot> m_slots;
+        };
+
+        /******************************************************************/
+        /*!
+        \var     std::vector<ScriptSlots> m_vecScriptSlots
+        \brief   Resolved scripts of each component, in the same order as
+                 m_vecScriptComponentPtr.
+        \details Resolved again when the entity's version changes, which
+                 covers edits to its scripts and copies over the component,
+                 or when its instances are created again.
+        */
+        /******************************************************************/
+        std::vector<ScriptSlots> m_vecScriptSlots;
+
+        /******************************************************************/
+        /*!
+        \fn      bool LogicSystem::m_ResolveScriptSlots(size_t position)
+        \brief   Makes sure the slots at a position match its component.
+        \return  False if a script of the component has no instance yet.
+        */
+        /******************************************************************/
+        bool m_ResolveScriptSlots(size_t position);
+
+        /******************************************************************/
+        /*!
+        \var     std::vector<MonoObject*> m_frameScripts
+        \brief   Script instances run by the current m_Update, passed to
+                 the managed scheduler in one call.
+        \details m_frameStart and m_frameClassIDs are in the same order.
+        */
+        /******************************************************************/
+        std::vector<MonoObject*> m_frameScripts;
+
+        std::vector<uint8_t> m_frameStart;
+
+        std::vector<int> m_frameClassIDs;
+
+        //scripts of an entity in m_frameScripts
+        struct FrameRange {
+            uint32_t m_frame{};
+            uint32_t m_first{};
+            uint32_t m_count{};
+        };
+
+        //by entity index, valid when m_frame matches
+        std::vector<FrameRange> m_frameRanges;
+
+        //scripts of the entities that cover the same time, run with the time set in the helper
+        struct FrameGroup {
+            TickTime m_time{};
+            uint32_t m_first{};
+            uint32_t m_count{};
+        };
+
+        std::vector<FrameGroup> m_frameGroups;
+
+        //position and group of the entities updated this frame
+        std::vector<std::pair<uint32_t, uint32_t>> m_frameEntities;
+
+        //scripts of m_frameScripts held by the scheduler
+        uint32_t m_runningFirst{};
+        uint32_t m_runningCount{};
+
+        uint32_t m_frame{};
+
+        //set while the scripts of the frame run
+        bool m_running{ false };
+
+        //set when the scheduler holds the scripts of the frame
+        bool m_scheduled{ false };
+
+        /******************************************************************/
+        /*!
+        \fn      void LogicSystem::m_RunGroup(uint32_t first, uint32_t count, uint8_t phase)
+        \brief   Runs the Start or Update, or the LateUpdate, of the
+                 scripts of m_frameScripts in the range.
+        */
+        /******************************************************************/
+        void m_RunGroup(uint32_t first, uint32_t count, uint8_t phase);
+
+        /******************************************************************/
+        /*!
+        \fn      void LogicSystem::m_InvokeEachScript(uint32_t first, uint32_t count, uint8_t phase)
+        \brief   Runs the gathered scripts in the range with one call into
+                 C# per callback, used when ScriptCore has no scheduler.
+        */
+        /******************************************************************/
+        void m_InvokeEachScript(uint32_t first, uint32_t count, uint8_t phase);
         /******************************************************************/
         /*!
         \fn      void LogicSystem::CreateandStartScriptInstance(ecs::ScriptComponent* scriptComp)
@@ -24,8 +24,8 @@ namespace ecs {
 	void ParticleSystem::m_RegisterSystem(EntityID ID) {
 		ECS* ecs = ECS::m_GetInstance();
 
-		if (std::find_if(m_vecTransformComponentPtr.begin(), m_vecTransformComponentPtr.end(), [ID](const auto& obj) { return obj->m_Entity == ID; })
-			== m_vecTransformComponentPtr.end()) {
+		if (!m_HasEntity(ID)) {
+			m_AddEntity(ID);
 			m_vecTransformComponentPtr.push_back((TransformComponent*)ecs->m_ECS_CombinedComponentPool[TYPETRANSFORMCOMPONENT]->m_GetEntityComponent(ID));
 			m_vecParticleComponentPtr.push_back((ParticleComponent*)ecs->m_ECS_CombinedComponentPool[TYPEPARTICLECOMPONENT]->m_GetEntityComponent(ID));
 			m_vecNameComponentPtr.push_back((NameComponent*)ecs->m_ECS_CombinedComponentPool[TYPENAMECOMPONENT]->m_GetEntityComponent(ID));
@@ -35,14 +35,11 @@ namespace ecs {
 
 	void ParticleSystem::m_DeregisterSystem(EntityID ID) {
 
-		//search element location for the entity
-		size_t IndexID{};
-		for (auto& ParticleComponentPtr : m_vecParticleComponentPtr) {
-			if (ParticleComponentPtr->m_Entity == ID) {
-				break;
-			}
-			IndexID++;
-		}
+		//element location for the entity
+
+		size_t IndexID = m_RemoveEntity(ID);
+
+		if (IndexID == m_invalidPosition) return;
 
 		//index to the last element
 		size_t IndexLast = m_vecParticleComponentPtr.size() - 1;
@@ -84,13 +81,14 @@ namespace ecs {
 			if ((particle->m_scene != scene) || !ecs->m_layersStack.m_layerBitSet.test(nc->m_Layer)) continue;
 
 			unsigned int textureid{};
-			if (assetmanager->m_imageManager.m_imageMap.find(particle->m_imageFile) == assetmanager->m_imageManager.m_imageMap.end())
+			const image::Image* image = assetmanager->m_imageManager.m_imageHandles.m_Resolve(particle->m_imageFile, particle->m_imageHandle);
+			if (!image)
 			{
 				textureid = 300;
 			}
 			else
 			{
-				textureid = assetmanager->m_imageManager.m_imageMap.find(particle->m_imageFile)->second.m_imageID;
+				textureid = image->m_imageID;
 			}
 			
 		
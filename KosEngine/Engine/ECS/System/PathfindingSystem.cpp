@@ -1,6 +1,7 @@
 #include "../Config/pch.h"
 #include "../ECS.h"
 #include "PathfindingSystem.h"
+#include "../TickLOD.h"
 #include "../Pathfinding/AStarPathfinding.h"
 #include "../Graphics/GraphicsPipe.h"
 #include "../Asset Manager/AssetManager.h"
@@ -10,8 +11,8 @@ namespace ecs {
     void PathfindingSystem::m_RegisterSystem(EntityID ID) {
         ECS* ecs = ECS::m_GetInstance();
 
-        if (std::find_if(m_vecTransformComponentPtr.begin(), m_vecTransformComponentPtr.end(),
-            [ID](const auto& obj) { return obj->m_Entity == ID; }) == m_vecTransformComponentPtr.end()) {
+        if (!m_HasEntity(ID)) {
+            m_AddEntity(ID);
 
             m_vecTransformComponentPtr.push_back(
                 static_cast<TransformComponent*>(ecs->m_ECS_CombinedComponentPool[TYPETRANSFORMCOMPONENT]->m_GetEntityComponent(ID))
@@ -24,14 +25,9 @@ namespace ecs {
     }
 
     void PathfindingSystem::m_DeregisterSystem(EntityID ID) {
-        size_t IndexID = 0;
-
-        for (auto& pathfindingComponent : m_vecPathfindingComponentPtr) {
-            if (pathfindingComponent->m_Entity == ID) {
-                break;
-            }
-            IndexID++;
-        }
+        //element location for the entity
+        size_t IndexID = m_RemoveEntity(ID);
+        if (IndexID == m_invalidPosition) return;
 
         size_t IndexLast = m_vecPathfindingComponentPtr.size() - 1;
 
@@ -58,6 +54,7 @@ namespace ecs {
 
         AStarPathfinding pathfinder;
         ECS* ecs = ECS::m_GetInstance();
+        TickLOD* tickLOD = TickLOD::m_GetInstance();
         for (size_t n = 0; n < m_vecPathfindingComponentPtr.size(); ++n) {
             TransformComponent* transform = m_vecTransformComponentPtr[n];
             PathfindingComponent* pathfinding = m_vecPathfindingComponentPtr[n];
@@ -67,6 +64,10 @@ namespace ecs {
             // Skip components not of the scene
             if ((pathfinding->m_scene != scene) || !ecs->m_layersStack.m_layerBitSet.test(NameComp->m_Layer) || NameComp->m_hide) continue;
 
+            // Agents far from the camera look for their grid less often
+            TickTime time;
+            if (!tickLOD->m_ShouldTick(TICKPATHFINDING, pathfinding->m_Entity, tickLOD->m_GetInterval(pathfinding->m_Entity, transform, NameComp), time)) continue;
+
             const auto& ids = ecs->m_ECS_SceneMap.find(pathfinding->m_scene);
             if (ids != ecs->m_ECS_SceneMap.end()) {
                 for (auto x : ids->second.m_sceneIDs) {
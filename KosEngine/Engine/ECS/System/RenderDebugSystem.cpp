@@ -28,39 +28,16 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 namespace ecs {
 
 	void DebugDrawingSystem::m_RegisterSystem(EntityID ID) {
-		ECS* ecs = ECS::m_GetInstance();
-
-		//Checks if system already has stored the entity
 
-		if (std::find_if(m_vecTransformComponentPtr.begin(), m_vecTransformComponentPtr.end(), [ID](const auto& obj) { return obj->m_Entity == ID; })
-			== m_vecTransformComponentPtr.end()) {
-			m_vecTransformComponentPtr.push_back((TransformComponent*)ecs->m_ECS_CombinedComponentPool[TYPETRANSFORMCOMPONENT]->m_GetEntityComponent(ID));
-			m_vecColliderComponentPtr.push_back((ColliderComponent*)ecs->m_ECS_CombinedComponentPool[TYPECOLLIDERCOMPONENT]->m_GetEntityComponent(ID));
-			m_vecNameComponentPtr.push_back((NameComponent*)ecs->m_ECS_CombinedComponentPool[TYPENAMECOMPONENT]->m_GetEntityComponent(ID));
+		//components are read through a view, only membership is tracked
+		if (!m_HasEntity(ID)) {
+			m_AddEntity(ID);
 		}
 	}
 
 	void DebugDrawingSystem::m_DeregisterSystem(EntityID ID) {
-		//search element location for the entity
-		size_t IndexID{};
-		for (auto& ComponentPtr : m_vecColliderComponentPtr) {
-			if (ComponentPtr->m_Entity == ID) {
-				break;
-			}
-			IndexID++;
-		}
-
-		//index to the last element
-		size_t IndexLast = m_vecColliderComponentPtr.size() - 1;
 
-		std::swap(m_vecColliderComponentPtr[IndexID], m_vecColliderComponentPtr[IndexLast]);
-		std::swap(m_vecTransformComponentPtr[IndexID], m_vecTransformComponentPtr[IndexLast]);
-		std::swap(m_vecNameComponentPtr[IndexID], m_vecNameComponentPtr[IndexLast]);
-
-		//popback the vector;
-		m_vecColliderComponentPtr.pop_back();
-		m_vecTransformComponentPtr.pop_back();
-		m_vecNameComponentPtr.pop_back();
+		m_RemoveEntity(ID);
 	}
 
 	void DebugDrawingSystem::m_Init() {
@@ -74,21 +51,12 @@ namespace ecs {
 
 		ECS* ecs = ECS::m_GetInstance();
 
-		if (m_vecTransformComponentPtr.size() != m_vecColliderComponentPtr.size()) {
-			LOGGING_ERROR("Error: Vecotrs container size does not Match");
-			return;
-		}
-	
-
 		graphicpipe::GraphicsPipe * graphicsPipe = graphicpipe::GraphicsPipe::m_funcGetInstance();
-		for (int n{}; n < m_vecTransformComponentPtr.size(); n++) {
-
-			//TransformComponent* transform = m_vecTransformComponentPtr[n];
-			ColliderComponent* collider = m_vecColliderComponentPtr[n];
-			NameComponent* NameComp = m_vecNameComponentPtr[n];
-			//skip component not of the scene
-			if ((collider->m_scene != scene) || !ecs->m_layersStack.m_layerBitSet.test(NameComp->m_Layer) || NameComp->m_hide) continue;
 
+		//colliders of the scene on an active layer that are not hidden
+		ecs->m_View<ColliderComponent, TransformComponent, NameComponent>().m_InScene(scene).m_InActiveLayer().m_Each([&](EntityID, ColliderComponent& col, TransformComponent&, NameComponent&)
+		{
+			ColliderComponent* collider = &col;
 
 			mat3x3::Mat3x3 translateMatrix;
 			mat3x3::Mat3x3 translateBackMatrix;
@@ -318,7 +286,7 @@ namespace ecs {
 			//}
 
 			
-		}
+		});
 	}
 
 
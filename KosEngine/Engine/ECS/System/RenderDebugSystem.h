@@ -66,26 +66,6 @@ namespace ecs {
 		void m_Update(const std::string&) override;
 
 
-	private:
-		/******************************************************************/
-		/*!
-		\var     std::vector<TransformComponent*> m_vecTransformComponentPtr
-		\brief   Stores pointers to TransformComponent instances for registered entities.
-		\details Used to efficiently access and update the transform data for debugging visual representation.
-		*/
-		/******************************************************************/
-		std::vector<TransformComponent*> m_vecTransformComponentPtr;
-
-		/******************************************************************/
-		/*!
-		\var     std::vector<ColliderComponent*> m_vecColliderComponentPtr
-		\brief   Stores pointers to ColliderComponent instances for registered entities.
-		\details Used to visualize collider data for entities, aiding in debugging collision-related issues.
-		*/
-		/******************************************************************/
-		std::vector<ColliderComponent*> m_vecColliderComponentPtr;
-
-		std::vector<NameComponent*> m_vecNameComponentPtr;
 	};
 
 }
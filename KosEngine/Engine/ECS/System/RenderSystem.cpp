@@ -29,8 +29,8 @@ namespace ecs {
 	void RenderSystem::m_RegisterSystem(EntityID ID) {
 		ECS* ecs = ECS::m_GetInstance();
 
-		if (std::find_if(m_vecTransformComponentPtr.begin(), m_vecTransformComponentPtr.end(), [ID](const auto& obj) { return obj->m_Entity == ID; })
-			== m_vecTransformComponentPtr.end()) {
+		if (!m_HasEntity(ID)) {
+			m_AddEntity(ID);
 			m_vecTransformComponentPtr.push_back((TransformComponent*)ecs->m_ECS_CombinedComponentPool[TYPETRANSFORMCOMPONENT]->m_GetEntityComponent(ID));
 			m_vecSpriteComponentPtr.push_back((SpriteComponent*)ecs->m_ECS_CombinedComponentPool[TYPESPRITECOMPONENT]->m_GetEntityComponent(ID));
 			m_vecNameComponentPtr.push_back((NameComponent*)ecs->m_ECS_CombinedComponentPool[TYPENAMECOMPONENT]->m_GetEntityComponent(ID));
@@ -40,14 +40,11 @@ namespace ecs {
 
 	void RenderSystem::m_DeregisterSystem(EntityID ID) {
 
-		//search element location for the entity
-		size_t IndexID{};
-		for (auto& SpriteComponentPtr : m_vecSpriteComponentPtr) {
-			if (SpriteComponentPtr->m_Entity == ID) {
-				break;
-			}
-			IndexID++;
-		}
+		//element location for the entity
+
+		size_t IndexID = m_RemoveEntity(ID);
+
+		if (IndexID == m_invalidPosition) return;
 
 		//index to the last element
 		size_t IndexLast = m_vecSpriteComponentPtr.size() - 1;
@@ -89,9 +86,10 @@ namespace ecs {
 
 			//ECS* ecs = ECS::m_GetInstance();
 
-			if (assetmanager->m_imageManager.m_imageMap.find(sprite->m_imageFile) == assetmanager->m_imageManager.m_imageMap.end()) continue;
+			const image::Image* image = assetmanager->m_imageManager.m_imageHandles.m_Resolve(sprite->m_imageFile, sprite->m_imageHandle);
+			if (!image) continue;
 
-			unsigned int textureid = assetmanager->m_imageManager.m_imageMap.find(sprite->m_imageFile)->second.m_imageID;
+			unsigned int textureid = image->m_imageID;
 			
 			if (ecs->m_ECS_EntityMap[sprite->m_Entity].test(TYPEANIMATIONCOMPONENT)) 
 			{
@@ -28,8 +28,8 @@ namespace ecs {
 	void RenderTextSystem::m_RegisterSystem(EntityID ID) {
 		ECS* ecs = ECS::m_GetInstance();
 
-		if (std::find_if(m_vecTextComponentPtr.begin(), m_vecTextComponentPtr.end(), [ID](const auto& obj) { return obj->m_Entity == ID; })
-			== m_vecTextComponentPtr.end()) {
+		if (!m_HasEntity(ID)) {
+			m_AddEntity(ID);
 			m_vecTransformComponentPtr.push_back((TransformComponent*)ecs->m_ECS_CombinedComponentPool[TYPETRANSFORMCOMPONENT]->m_GetEntityComponent(ID));
 			m_vecTextComponentPtr.push_back((TextComponent*)ecs->m_ECS_CombinedComponentPool[TYPETEXTCOMPONENT]->m_GetEntityComponent(ID));
 			m_vecNameComponentPtr.push_back((NameComponent*)ecs->m_ECS_CombinedComponentPool[TYPENAMECOMPONENT]->m_GetEntityComponent(ID));
@@ -40,14 +40,13 @@ namespace ecs {
 	void RenderTextSystem::m_DeregisterSystem(EntityID ID) {
 
 
-		//search element location for the entity
-		size_t IndexID{};
-		for (auto& SpriteComponentPtr : m_vecTextComponentPtr) {
-			if (SpriteComponentPtr->m_Entity == ID) {
-				break;
-			}
-			IndexID++;
-		}
+		//element location for the entity
+
+
+		size_t IndexID = m_RemoveEntity(ID);
+
+
+		if (IndexID == m_invalidPosition) return;
 
 		//index to the last element
 		size_t IndexLast = m_vecTextComponentPtr.size() - 1;
@@ -79,7 +78,7 @@ namespace ecs {
 		}
 		//loops through all vecoters pointing to component
 
-		//assetmanager::AssetManager* assetmanager = assetmanager::AssetManager::m_funcGetInstance();
+		assetmanager::AssetManager* assetmanager = assetmanager::AssetManager::m_funcGetInstance();
 
 		for (int n{}; n < m_vecTextComponentPtr.size(); n++) {
 
@@ -90,6 +89,9 @@ namespace ecs {
 			//skip component not of the scene
 			if ((NameComp->m_scene != scene) || !ecs->m_layersStack.m_layerBitSet.test(NameComp->m_Layer) || NameComp->m_hide) continue;
 
+			const text::FontManager::FontMap* font = assetmanager->m_fontManager.m_fontHandles.m_Resolve(text->m_fileName, text->m_fontHandle);
+			if (!font) continue;
+
 			float red = text->m_color.m_x;
 			float green = text->m_color.m_y;
 			float blue = text->m_color.m_z;
@@ -98,7 +100,7 @@ namespace ecs {
 			vector2::Vec2 scale{};
 			float rotate{};
 			mat3x3::Mat3Decompose(transform->m_transformation, translate, scale, rotate);
-			graphicsPipe->m_textData.push_back(graphicpipe::TextData{ text->m_text, transform->m_transformation.m_e20, transform->m_transformation.m_e21, rotate, text->m_fontSize * help->m_windowScalar , {scale.m_x , scale.m_y}, text->m_fontLayer, {red, green, blue}, text->m_fileName, text->m_isCentered});
+			graphicsPipe->m_textData.push_back(graphicpipe::TextData{ text->m_text, transform->m_transformation.m_e20, transform->m_transformation.m_e21, rotate, text->m_fontSize * help->m_windowScalar , {scale.m_x , scale.m_y}, text->m_fontLayer, {red, green, blue}, text->m_fileName, text->m_isCentered, font});
 		
 
 		}
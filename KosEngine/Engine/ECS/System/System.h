@@ -58,7 +58,76 @@ namespace ecs {
 		/******************************************************************/
 		virtual void m_Update(const std::string&) = 0;
 
+		/******************************************************************/
+		/*!
+		\def       m_HasEntity(EntityID)
+		\brief     Checks if the entity is registered in the system, O(1)
+		*/
+		/******************************************************************/
+		bool m_HasEntity(EntityID ID) const {
+			const EntityID index = m_GetEntityIndex(ID);
+			return index < m_entityPosition.size() && m_entityPosition[index] != m_invalidPosition && m_entities[m_entityPosition[index]] == ID;
+		}
+
+		static constexpr size_t m_invalidPosition = (std::numeric_limits<size_t>::max)();
+
+		/******************************************************************/
+		/*!
+		\def       m_GetEntityPosition(EntityID)
+		\brief     Position of the entity in the system's component vectors
+		\return    m_invalidPosition if the entity is not registered
+		*/
+		/******************************************************************/
+		size_t m_GetEntityPosition(EntityID ID) const {
+			return m_HasEntity(ID) ? m_entityPosition[m_GetEntityIndex(ID)] : m_invalidPosition;
+		}
+
+	protected:
+		/******************************************************************/
+		/*!
+		\def       m_AddEntity(EntityID)
+		\brief     Records the entity at the back of the system's component
+				   vectors, called when the pointers are pushed back.
+		*/
+		/******************************************************************/
+		void m_AddEntity(EntityID ID) {
+			const EntityID index = m_GetEntityIndex(ID);
+			if (index >= m_entityPosition.size()) {
+				m_entityPosition.resize(index + 1, m_invalidPosition);
+			}
+			m_entityPosition[index] = m_entities.size();
+			m_entities.push_back(ID);
+		}
+
+		/******************************************************************/
+		/*!
+		\def       m_RemoveEntity(EntityID)
+		\brief     Forgets the entity, the last entity takes its position.
+				   The system swaps its component vectors the same way.
+		\return    Position of the entity, m_invalidPosition if it was not
+				   registered
+		*/
+		/******************************************************************/
+		size_t m_RemoveEntity(EntityID ID) {
+			if (!m_HasEntity(ID)) return m_invalidPosition;
+
+			const size_t position = m_entityPosition[m_GetEntityIndex(ID)];
+			const EntityID last = m_entities.back();
+
+			m_entities[position] = last;
+			m_entityPosition[m_GetEntityIndex(last)] = position;
+			m_entities.pop_back();
+			m_entityPosition[m_GetEntityIndex(ID)] = m_invalidPosition;
+
+			return position;
+		}
+
+	private:
+		//entity of each position in the component vectors
+		std::vector<EntityID> m_entities;
 
+		//entity index to position in the component vectors
+		std::vector<size_t> m_entityPosition;
 	};
 
 }
@@ -29,8 +29,8 @@ namespace ecs {
 	void TilemapSystem::m_RegisterSystem(EntityID ID) {
 		ECS* ecs = ECS::m_GetInstance();
 
-		if (std::find_if(m_vecTransformComponentPtr.begin(), m_vecTransformComponentPtr.end(), [ID](const auto& obj) { return obj->m_Entity == ID; })
-			== m_vecTransformComponentPtr.end()) {
+		if (!m_HasEntity(ID)) {
+			m_AddEntity(ID);
 			m_vecTransformComponentPtr.push_back((TransformComponent*)ecs->m_ECS_CombinedComponentPool[TYPETRANSFORMCOMPONENT]->m_GetEntityComponent(ID));
 			m_vecTilemapComponentPtr.push_back((TilemapComponent*)ecs->m_ECS_CombinedComponentPool[TYPETILEMAPCOMPONENT]->m_GetEntityComponent(ID));
 			m_vecNameComponentPtr.push_back((NameComponent*)ecs->m_ECS_CombinedComponentPool[TYPENAMECOMPONENT]->m_GetEntityComponent(ID));
@@ -40,14 +40,11 @@ namespace ecs {
 
 	void TilemapSystem::m_DeregisterSystem(EntityID ID) {
 
-		//search element location for the entity
-		size_t IndexID{};
-		for (auto& TilemapComponentPtr : m_vecTilemapComponentPtr) {
-			if (TilemapComponentPtr->m_Entity == ID) {
-				break;
-			}
-			IndexID++;
-		}
+		//element location for the entity
+
+		size_t IndexID = m_RemoveEntity(ID);
+
+		if (IndexID == m_invalidPosition) return;
 
 		//index to the last element
 		size_t IndexLast = m_vecTilemapComponentPtr.size() - 1;
@@ -92,7 +89,8 @@ namespace ecs {
 
 			//ECS* ecs = ECS::m_GetInstance();
 
-			if (assetmanager->m_imageManager.m_imageMap.find(tile->m_tilemapFile) == assetmanager->m_imageManager.m_imageMap.end()) continue;
+			const image::Image* image = assetmanager->m_imageManager.m_imageHandles.m_Resolve(tile->m_tilemapFile, tile->m_tilemapHandle);
+			if (!image) continue;
 
 
 			transform->m_position.m_x = floor(transform->m_position.m_x);
@@ -102,11 +100,11 @@ namespace ecs {
 			transform->m_transformation.m_e21 = floor(transform->m_transformation.m_e21) + 0.5f;
 
 			//float imageWidth = assetmanager->m_imageManager.m_imageMap.find(tile->m_tilemapFile)->second.m_width / 2.f;
-			float imageHeight = static_cast<float>(assetmanager->m_imageManager.m_imageMap.find(tile->m_tilemapFile)->second.m_height);
+			float imageHeight = static_cast<float>(image->m_height);
 
 			transform->m_scale = vector2::Vec2{ static_cast<float>(pipe->m_unitHeight) / imageHeight , static_cast<float>(pipe->m_unitHeight) / imageHeight };
 
-			unsigned int textureid = assetmanager->m_imageManager.m_imageMap.find(tile->m_tilemapFile)->second.m_imageID;
+			unsigned int textureid = image->m_imageID;
 			graphicsPipe->m_tilemapData.push_back({ glm::mat3{transform->m_transformation.m_e00,transform->m_transformation.m_e01,transform->m_transformation.m_e02,
 																transform->m_transformation.m_e10,transform->m_transformation.m_e11, transform->m_transformation.m_e12,
 															transform->m_transformation.m_e20, transform->m_transformation.m_e21, transform->m_transformation.m_e22},textureid, glm::ivec2{tile->m_rowLength,tile->m_columnLength}, glm::ivec2{tile->m_pictureRowLength, tile->m_pictureColumnLength }, tile->m_tileIndex
@@ -16,6 +16,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "VideoSystem.h"
 #include "../ECS.h"
 #include "../Graphics/GraphicsPipe.h"
+#include "../Helper/Helper.h"
 
 
 namespace ecs {
@@ -25,8 +26,8 @@ namespace ecs {
 
 		//Checks if system already has stored the entity
 
-		if (std::find_if(m_vecVideoComponentPtr.begin(), m_vecVideoComponentPtr.end(), [ID](const auto& obj) { return obj->m_Entity == ID; })
-			== m_vecVideoComponentPtr.end()) {
+		if (!m_HasEntity(ID)) {
+			m_AddEntity(ID);
 			m_vecTransformComponentPtr.push_back((TransformComponent*)ecs->m_ECS_CombinedComponentPool[TYPETRANSFORMCOMPONENT]->m_GetEntityComponent(ID));
 			m_vecNameComponentPtr.push_back((NameComponent*)ecs->m_ECS_CombinedComponentPool[TYPENAMECOMPONENT]->m_GetEntityComponent(ID));
 			m_vecVideoComponentPtr.push_back((VideoComponent*)ecs->m_ECS_CombinedComponentPool[TYPEVIDEOCOMPONENT]->m_GetEntityComponent(ID));
@@ -34,14 +35,9 @@ namespace ecs {
 	}
 
 	void VideoSystem::m_DeregisterSystem(EntityID ID) {
-		//search element location for the entity
-		size_t IndexID{};
-		for (auto& ComponentPtr : m_vecVideoComponentPtr) {
-			if (ComponentPtr->m_Entity == ID) {
-				break;
-			}
-			IndexID++;
-		}
+		//element location for the entity
+		size_t IndexID = m_RemoveEntity(ID);
+		if (IndexID == m_invalidPosition) return;
 
 		//index to the last element
 		size_t IndexLast = m_vecVideoComponentPtr.size() - 1;
@@ -94,6 +90,12 @@ namespace ecs {
 				continue;
 			}
 
+			//decoding uploads every frame to a texture, headless runs skip to the end
+			if (Helper::Helpers::GetInstance()->m_headless) {
+				VideoComp->play = false;
+				continue;
+			}
+
 
 			if (videomap.find(VideoComp->m_Entity) == videomap.end()) {
 
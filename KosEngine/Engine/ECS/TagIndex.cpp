@@ -0,0 +1,79 @@
+/******************************************************************/
+/*!
+\file      TagIndex.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      March 30, 2025
+\brief     This file contains the definitions of the TagIndex class.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include "../Config/pch.h"
+#include "TagIndex.h"
+
+namespace ecs {
+
+	int TagIndex::m_Intern(const std::string& tag)
+	{
+		const auto& it = m_tagIDs.find(tag);
+		if (it != m_tagIDs.end()) return it->second;
+
+		const int id = static_cast<int>(m_tagNames.size());
+		m_tagIDs.emplace(tag, id);
+		m_tagNames.push_back(tag);
+		m_tagEntities.emplace_back();
+		return id;
+	}
+
+	int TagIndex::m_Find(const std::string& tag) const
+	{
+		const auto& it = m_tagIDs.find(tag);
+		return it == m_tagIDs.end() ? -1 : it->second;
+	}
+
+	void TagIndex::m_Update(EntityID id, const std::string& tag)
+	{
+		const EntityID index = m_GetEntityIndex(id);
+		if (index >= m_entries.size()) {
+			m_entries.resize(index + 1);
+		}
+
+		Entry& entry = m_entries[index];
+		if (entry.m_tag >= 0 && m_tagNames[entry.m_tag] == tag) return;
+
+		m_Remove(id);
+
+		entry.m_tag = m_Intern(tag);
+		entry.m_position = static_cast<uint32_t>(m_tagEntities[entry.m_tag].size());
+		m_tagEntities[entry.m_tag].push_back(id);
+	}
+
+	void TagIndex::m_Remove(EntityID id)
+	{
+		const EntityID index = m_GetEntityIndex(id);
+		if (index >= m_entries.size() || m_entries[index].m_tag < 0) return;
+
+		Entry& entry = m_entries[index];
+		auto& entities = m_tagEntities[entry.m_tag];
+
+		//swap with the last entity of the tag
+		const EntityID last = entities.back();
+		entities[entry.m_position] = last;
+		m_entries[m_GetEntityIndex(last)].m_position = entry.m_position;
+		entities.pop_back();
+
+		entry = {};
+	}
+
+	const std::vector<EntityID>& TagIndex::m_GetEntities(int tag) const
+	{
+		static const std::vector<EntityID> empty;
+		if (tag < 0 || tag >= static_cast<int>(m_tagEntities.size())) return empty;
+
+		return m_tagEntities[tag];
+	}
+
+}
@@ -0,0 +1,97 @@
+/******************************************************************/
+/*!
+\file      TagIndex.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      March 30, 2025
+\brief     This file contains the TagIndex class, which interns the tag
+		   strings of the name components into integer IDs and keeps
+		   the entities of each tag, so scripts looking up every
+		   "Enemy" do not compare the tag of every entity.
+
+		   The ECS updates the index when an entity is created,
+		   duplicated, deleted or marked dirty. Code that writes
+		   NameComponent::m_entityTag directly calls
+		   ECS::m_UpdateTag afterwards.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#ifndef TAGINDEX_H
+#define TAGINDEX_H
+
+#include "../Config/pch.h"
+#include "ECSList.h"
+
+namespace ecs {
+
+	class TagIndex {
+
+	public:
+
+		/******************************************************************/
+		/*!
+			\fn        int m_Intern(const std::string& tag)
+			\brief     ID of the tag, a new ID is given to a tag seen for
+					   the first time. IDs are never reused.
+		*/
+		/******************************************************************/
+		int m_Intern(const std::string& tag);
+
+		/******************************************************************/
+		/*!
+			\fn        int m_Find(const std::string& tag) const
+			\brief     ID of the tag, -1 if no entity ever had it.
+		*/
+		/******************************************************************/
+		int m_Find(const std::string& tag) const;
+
+		/******************************************************************/
+		/*!
+			\fn        void m_Update(EntityID id, const std::string& tag)
+			\brief     Moves the entity to the tag, does nothing if it is
+					   already under it.
+		*/
+		/******************************************************************/
+		void m_Update(EntityID id, const std::string& tag);
+
+		/******************************************************************/
+		/*!
+			\fn        void m_Remove(EntityID id)
+			\brief     Drops a deleted entity from its tag.
+		*/
+		/******************************************************************/
+		void m_Remove(EntityID id);
+
+		/******************************************************************/
+		/*!
+			\fn        const std::vector<EntityID>& m_GetEntities(int tag) const
+			\brief     Entities under the tag in no particular order,
+					   including the ones in prefabs and inactive scenes.
+		*/
+		/******************************************************************/
+		const std::vector<EntityID>& m_GetEntities(int tag) const;
+
+	private:
+
+		struct Entry {
+			int m_tag{ -1 };
+			//position in m_tagEntities[m_tag]
+			uint32_t m_position{};
+		};
+
+		std::unordered_map<std::string, int> m_tagIDs;
+
+		std::vector<std::string> m_tagNames;
+
+		std::vector<std::vector<EntityID>> m_tagEntities;
+
+		//by entity index
+		std::vector<Entry> m_entries;
+	};
+
+}
+
+#endif TAGINDEX_H
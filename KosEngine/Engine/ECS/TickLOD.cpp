@@ -0,0 +1,108 @@
+/******************************************************************/
+/*!
+\file      TickLOD.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      April 04, 2025
+\brief     This file contains the definitions of the TickLOD class.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include "../Config/pch.h"
+#include "TickLOD.h"
+#include "ECS.h"
+
+namespace ecs {
+
+	std::unique_ptr<TickLOD> TickLOD::m_InstancePtr = nullptr;
+
+	void TickLOD::m_NewFrame(float deltaTime, int steps)
+	{
+		m_frame++;
+		m_frameTime = { deltaTime, steps };
+		m_totalTime += deltaTime;
+		m_totalSteps += steps;
+
+		m_ticked.fill(0);
+		m_skipped.fill(0);
+	}
+
+	void TickLOD::m_SetCamera(const vector2::Vec2& position, const vector2::Vec2& halfExtents)
+	{
+		m_cameraFrame = m_frame;
+		m_cameraPosition = position;
+		m_cameraHalfExtents = halfExtents;
+	}
+
+	int TickLOD::m_GetInterval(EntityID id, const TransformComponent* transform, const NameComponent* name) const
+	{
+		if (!m_enabled || !transform || (name && name->m_fullTickRate)) return 1;
+
+		//the camera of this or the last frame
+		if (m_cameraFrame == 0 || m_cameraFrame + 1 < m_frame) return 1;
+		if (m_cameraHalfExtents.m_x <= 0.f || m_cameraHalfExtents.m_y <= 0.f) return 1;
+
+		//only something drawn can be off screen
+		ECS* ecs = ECS::m_GetInstance();
+		const auto& signature = ecs->m_ECS_EntityMap.find(id);
+		if (signature == ecs->m_ECS_EntityMap.end() || !signature->second.test(TYPESPRITECOMPONENT)) return 1;
+
+		//bounds of the rotated unit quad
+		const mat3x3::Mat3x3& world = transform->m_transformation;
+		const float halfWidth = 0.5f * (std::fabs(world.m_e00) + std::fabs(world.m_e10));
+		const float halfHeight = 0.5f * (std::fabs(world.m_e01) + std::fabs(world.m_e11));
+
+		const float outsideX = (std::fabs(world.m_e20 - m_cameraPosition.m_x) - halfWidth - m_cameraHalfExtents.m_x) / m_cameraHalfExtents.m_x;
+		const float outsideY = (std::fabs(world.m_e21 - m_cameraPosition.m_y) - halfHeight - m_cameraHalfExtents.m_y) / m_cameraHalfExtents.m_y;
+		const float outside = std::max(outsideX, outsideY);
+
+		if (outside <= m_visibleMargin) return 1;
+		if (outside <= m_nearDistance) return m_nearInterval;
+		if (outside <= m_farDistance) return m_farInterval;
+		return m_dormantInterval;
+	}
+
+	bool TickLOD::m_ShouldTick(TickChannel channel, EntityID id, int interval, TickTime& time)
+	{
+		std::vector<TickState>& states = m_states[channel];
+		const EntityID index = m_GetEntityIndex(id);
+		if (index >= states.size()) {
+			states.resize(index + 1);
+		}
+
+		//an entity not updated last frame, or a new one at the index, starts from the previous frame
+		TickState& state = states[index];
+		if (!state.m_valid || state.m_id != id || state.m_seenFrame + 1 != m_frame) {
+			state.m_id = id;
+			state.m_valid = true;
+			state.m_tickFrame = m_frame - 1;
+			state.m_time = m_totalTime - m_frameTime.m_deltaTime;
+			state.m_steps = m_totalSteps - m_frameTime.m_steps;
+		}
+		state.m_seenFrame = m_frame;
+
+		if (interval > 1 && (m_frame + index) % static_cast<uint32_t>(interval) != 0) {
+			m_skipped[channel]++;
+			return false;
+		}
+
+		//exactly the frame's time when updated every frame, the script system groups updates by time
+		if (state.m_tickFrame + 1 == m_frame) {
+			time = m_frameTime;
+		}
+		else {
+			time.m_deltaTime = static_cast<float>(m_totalTime - state.m_time);
+			time.m_steps = static_cast<int>(m_totalSteps - state.m_steps);
+		}
+		state.m_tickFrame = m_frame;
+		state.m_time = m_totalTime;
+		state.m_steps = m_totalSteps;
+
+		m_ticked[channel]++;
+		return true;
+	}
+
+}
@@ -0,0 +1,169 @@
+/******************************************************************/
+/*!
+\file      TickLOD.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      April 04, 2025
+\brief     This file contains the TickLOD class, which lowers how often
+		   the scripts, animations and pathfinding of entities far from
+		   the camera are updated.
+
+		   An entity with a sprite that is inside the view of the game
+		   camera, grown by a margin, is updated every frame. Outside
+		   of it the entity is updated every 2, 4 or 8 frames by its
+		   distance to the view. The frame an entity is updated on is
+		   offset by its index, so the updates are spread across the
+		   frames.
+
+		   Every update receives the time and fixed steps that passed
+		   since the entity's last update, so a slower entity covers the
+		   same simulated time. Entities without a sprite, entities with
+		   NameComponent::m_fullTickRate set and every entity when the
+		   scene has no camera are updated every frame.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#ifndef TICKLOD_H
+#define TICKLOD_H
+
+#include "../Config/pch.h"
+#include "ECSList.h"
+
+namespace ecs {
+
+	class TransformComponent;
+	class NameComponent;
+
+	//systems that are updated at a lower rate, each keeps its own time
+	enum TickChannel {
+		TICKSCRIPT,
+		TICKANIMATION,
+		TICKPATHFINDING,
+
+		TOTALTICKCHANNEL
+	};
+
+	//time an update covers
+	struct TickTime {
+		float m_deltaTime{};
+		int m_steps{};
+
+		bool operator==(const TickTime&) const = default;
+	};
+
+	class TickLOD {
+
+	public:
+		static TickLOD* m_GetInstance() {
+			if (!m_InstancePtr) {
+				m_InstancePtr.reset(new TickLOD{});
+			}
+			return m_InstancePtr.get();
+		}
+
+		/******************************************************************/
+		/*!
+			\fn        void m_NewFrame(float deltaTime, int steps)
+			\brief     Called once a frame while the game runs, before the
+					   systems are updated.
+			\param[in] deltaTime Helpers::m_deltaTime of the frame.
+			\param[in] steps     Helpers::currentNumberOfSteps of the frame.
+		*/
+		/******************************************************************/
+		void m_NewFrame(float deltaTime, int steps);
+
+		/******************************************************************/
+		/*!
+			\fn        void m_SetCamera(const vector2::Vec2& position, const vector2::Vec2& halfExtents)
+			\brief     Called by the camera system with the view of the
+					   game camera. The view is used by the next frame, the
+					   LOD is off when no camera was set in the last frame.
+		*/
+		/******************************************************************/
+		void m_SetCamera(const vector2::Vec2& position, const vector2::Vec2& halfExtents);
+
+		/******************************************************************/
+		/*!
+			\fn        int m_GetInterval(EntityID id, const TransformComponent* transform, const NameComponent* name) const
+			\brief     Number of frames between two updates of the entity,
+					   1 to update it every frame.
+		*/
+		/******************************************************************/
+		int m_GetInterval(EntityID id, const TransformComponent* transform, const NameComponent* name) const;
+
+		/******************************************************************/
+		/*!
+			\fn        bool m_ShouldTick(TickChannel channel, EntityID id, int interval, TickTime& time)
+			\brief     Called every frame for every entity the system would
+					   update.
+			\param[out] time Time since the entity was last updated by the
+					   channel, or the frame's time when it was not updated
+					   in the last frame, set only when it returns true.
+			\return    False if the entity skips this frame.
+		*/
+		/******************************************************************/
+		bool m_ShouldTick(TickChannel channel, EntityID id, int interval, TickTime& time);
+
+		/******************************************************************/
+		/*!
+			\fn        TickTime m_GetFrameTime() const
+			\brief     Time of an update of an entity updated every frame.
+		*/
+		/******************************************************************/
+		TickTime m_GetFrameTime() const { return m_frameTime; }
+
+		//updates run and skipped by a channel this frame
+		size_t m_GetTicked(TickChannel channel) const { return m_ticked[channel]; }
+		size_t m_GetSkipped(TickChannel channel) const { return m_skipped[channel]; }
+
+		bool m_enabled{ true };
+
+		//how far outside the view an entity is, in view sizes
+		float m_visibleMargin{ 0.25f };
+		float m_nearDistance{ 1.f };
+		float m_farDistance{ 3.f };
+
+		int m_nearInterval{ 2 };
+		int m_farInterval{ 4 };
+		int m_dormantInterval{ 8 };
+
+	private:
+
+		struct TickState {
+			EntityID m_id{};
+			bool m_valid{ false };
+			//frame the system last asked for the entity
+			uint32_t m_seenFrame{};
+			uint32_t m_tickFrame{};
+			//totals at the entity's last update
+			double m_time{};
+			int64_t m_steps{};
+		};
+
+		static std::unique_ptr<TickLOD> m_InstancePtr;
+
+		//by entity index
+		std::array<std::vector<TickState>, TOTALTICKCHANNEL> m_states;
+
+		uint32_t m_frame{};
+		TickTime m_frameTime{};
+
+		//time and steps of every frame so far, an update covers the difference
+		double m_totalTime{};
+		int64_t m_totalSteps{};
+
+		//frame of the last m_SetCamera, 0 if none
+		uint32_t m_cameraFrame{};
+		vector2::Vec2 m_cameraPosition{};
+		vector2::Vec2 m_cameraHalfExtents{};
+
+		std::array<size_t, TOTALTICKCHANNEL> m_ticked{};
+		std::array<size_t, TOTALTICKCHANNEL> m_skipped{};
+	};
+
+}
+
+#endif TICKLOD_H
@@ -0,0 +1,235 @@
+/******************************************************************/
+/*!
+\file      View.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      March 18, 2025
+\brief     This file contains the View class, a typed query over the
+		   component pools. A view walks the dense component array of
+		   its smallest pool and looks up the other components of each
+		   entity in constant time, so a system does not need to keep
+		   its own vectors of component pointers.
+
+		   Components of the viewed types must not be added or removed
+		   while m_Each is running, deleting an entity should go through
+		   a list collected during the loop.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#ifndef VIEW_H
+#define VIEW_H
+
+#include "../Config/pch.h"
+#include "../ECS/Component/ComponentPool.h"
+#include "Layers.h"
+
+namespace ecs {
+
+	/******************************************************************/
+	/*!
+	\class   View
+	\brief   Iterates every entity that owns all of the components T...
+			 and passes the entity with references to its components.
+	*/
+	/******************************************************************/
+	template <typename... T>
+	class View {
+
+		static_assert(sizeof...(T) > 0, "View needs at least one component type");
+
+	public:
+
+		//entities of a scene, nullptr if there is no such scene
+		using SceneLookup = const std::vector<EntityID>* (*)(const std::string&);
+
+		View(std::unordered_map<ComponentType, std::shared_ptr<IComponentPool>>& pools, const layer::LayerStack& layers, SceneLookup findScene)
+			: m_pools{ static_cast<ComponentPool<T>*>(pools[ComponentTypeID<T>::m_type].get())... },
+			m_allPools(pools),
+			m_layers(layers),
+			m_findScene(findScene)
+		{
+		}
+
+		/******************************************************************/
+		/*!
+		\fn        View& m_Exclude()
+		\brief     Skips entities that own any of the components E...
+		*/
+		/******************************************************************/
+		template <typename... E>
+		View& m_Exclude() {
+			(m_exclude.push_back(m_allPools[ComponentTypeID<E>::m_type].get()), ...);
+			return *this;
+		}
+
+		/******************************************************************/
+		/*!
+		\fn        View& m_InScene(const std::string& scene)
+		\brief     Only visits entities listed in the scene. The list is
+				   turned into a bit per entity index once, so each
+				   entity is matched without comparing scene names.
+				   Entities queued for deletion are skipped.
+		*/
+		/******************************************************************/
+		View& m_InScene(const std::string& scene) {
+			m_sceneFilter = true;
+			m_sceneEntities = m_findScene(scene);
+			return *this;
+		}
+
+		/******************************************************************/
+		/*!
+		\fn        View& m_InActiveLayer(bool skipHidden)
+		\brief     Only visits entities whose layer is turned on, and that
+				   are not hidden unless skipHidden is false. The name
+				   component is read from the view when it is one of
+				   T..., and not read at all when every layer is on and
+				   hidden entities are visited.
+		*/
+		/******************************************************************/
+		View& m_InActiveLayer(bool skipHidden = true) {
+			m_skipHidden = skipHidden;
+			m_layerFilter = skipHidden || !m_layers.m_layerBitSet.all();
+			if constexpr (!m_hasName) {
+				m_namePool = static_cast<ComponentPool<NameComponent>*>(m_allPools[TYPENAMECOMPONENT].get());
+			}
+			return *this;
+		}
+
+		/******************************************************************/
+		/*!
+		\fn        void m_Each(Func&& func)
+		\brief     Calls func(EntityID, T&...) for every matching entity.
+		*/
+		/******************************************************************/
+		template <typename Func>
+		void m_Each(Func&& func) {
+
+			if (m_sceneFilter && !m_sceneEntities) return;
+
+			//walk the pool with the fewest entities
+			const std::array<size_t, sizeof...(T)> sizes{ std::get<ComponentPool<T>*>(m_pools)->m_GetEntities().size()... };
+			const size_t driver = static_cast<size_t>(std::min_element(sizes.begin(), sizes.end()) - sizes.begin());
+
+			if (m_sceneFilter) {
+				m_MarkScene();
+			}
+
+			m_Dispatch(driver, func, std::index_sequence_for<T...>{});
+		}
+
+	private:
+
+		static constexpr bool m_hasName = (std::is_same_v<T, NameComponent> || ...);
+
+		template <typename Func, size_t... I>
+		void m_Dispatch(size_t driver, Func& func, std::index_sequence<I...>) {
+			(void)((driver == I ? (m_EachFrom<I>(func), true) : false) || ...);
+		}
+
+		//the driving pool is read straight from its dense array, only the other pools are looked up
+		template <size_t Driver, typename Func>
+		void m_EachFrom(Func& func) {
+
+			auto* driverPool = std::get<Driver>(m_pools);
+			const EntityID* entities = driverPool->m_GetEntities().data();
+			const auto* dense = driverPool->m_GetDense().data();
+			const size_t count = driverPool->m_GetEntities().size();
+
+			//filters are read once, func may write through any component reference
+			const bool sceneFilter = m_sceneFilter;
+			const bool layerFilter = m_layerFilter;
+			const bool skipHidden = m_skipHidden;
+			const bool exclude = !m_exclude.empty();
+			const std::uint64_t* sceneBits = m_sceneBits.data();
+			const size_t sceneWords = m_sceneBits.size();
+			const std::tuple<typename ComponentPool<T>::Finder...> finders{ std::get<ComponentPool<T>*>(m_pools)->m_GetFinder()... };
+
+			for (size_t n{}; n < count; n++) {
+				const EntityID id = entities[n];
+
+				if (sceneFilter) {
+					const EntityID index = m_GetEntityIndex(id);
+					if (index / 64 >= sceneWords || !((sceneBits[index / 64] >> (index % 64)) & 1)) continue;
+
+					//entities queued for deletion stay in the scene list until the flush, their components have no scene
+					if (dense[n]->m_scene.empty()) continue;
+				}
+
+				std::tuple<T*...> components{ m_Find<T>(finders, dense[n], id)... };
+				if (!std::apply([](auto*... component) { return ((component != nullptr) && ...); }, components)) continue;
+
+				if (layerFilter) {
+					const NameComponent* nc = nullptr;
+					if constexpr (m_hasName) {
+						nc = std::get<NameComponent*>(components);
+					}
+					else {
+						nc = m_namePool->m_GetComponent(id);
+					}
+					if (!nc || (skipHidden && nc->m_hide) || !m_layers.m_layerBitSet.test(nc->m_Layer)) continue;
+				}
+
+				if (exclude && m_IsExcluded(id)) continue;
+
+				std::apply([&func, id](auto*... component) { func(id, *component...); }, components);
+			}
+		}
+
+		template <typename C, typename D, typename Finders>
+		static C* m_Find(const Finders& finders, D* driverComponent, EntityID id) {
+			if constexpr (std::is_same_v<C, D>) {
+				return driverComponent;
+			}
+			else {
+				return std::get<typename ComponentPool<C>::Finder>(finders)(id);
+			}
+		}
+
+		bool m_IsExcluded(EntityID id) const {
+			for (IComponentPool* pool : m_exclude) {
+				if (pool->m_HasComponent(id)) return true;
+			}
+			return false;
+		}
+
+		void m_MarkScene() {
+			m_sceneBits.assign((static_cast<size_t>(MaxEntity) + 63) / 64, 0);
+			for (EntityID id : *m_sceneEntities) {
+				const EntityID index = m_GetEntityIndex(id);
+				if (index / 64 < m_sceneBits.size()) {
+					m_sceneBits[index / 64] |= std::uint64_t{ 1 } << (index % 64);
+				}
+			}
+		}
+
+		std::tuple<ComponentPool<T>*...> m_pools;
+
+		std::unordered_map<ComponentType, std::shared_ptr<IComponentPool>>& m_allPools;
+
+		const layer::LayerStack& m_layers;
+
+		SceneLookup m_findScene;
+
+		std::vector<IComponentPool*> m_exclude;
+
+		bool m_sceneFilter{ false };
+
+		const std::vector<EntityID>* m_sceneEntities{ nullptr };
+
+		//bit per entity index, set for the entities of the scene
+		std::vector<std::uint64_t> m_sceneBits;
+
+		ComponentPool<NameComponent>* m_namePool{ nullptr };
+
+		bool m_layerFilter{ false };
+
+		bool m_skipHidden{ true };
+	};
+
+}
+
+#endif VIEW_H
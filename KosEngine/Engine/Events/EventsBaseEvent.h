@@ -96,36 +96,75 @@ namespace events {
 	template<typename T>
 	class EventDispatcher {
 	private:
-		std::unordered_map<T, std::vector<std::function<void(const BaseEvent<T>&)>>> m_listeners;
+		//listeners keep their ID, an iterator into the vector would not survive it growing
+		std::unordered_map<T, std::vector<std::pair<int, std::function<void(const BaseEvent<T>&)>>>> m_listeners;
+		//registered during a dispatch, moved to m_listeners once it is over
+		std::vector<std::pair<T, std::pair<int, std::function<void(const BaseEvent<T>&)>>>> m_added;
 		int m_nextID = 0;
-		std::map<int, std::pair<T, typename std::vector<std::function<void(const BaseEvent<T>&)>>::iterator>> m_listenerIDs;
+		std::unordered_map<int, T> m_listenerIDs;
+		int m_dispatching = 0;
+		bool m_removed = false;
+
+		//removed listeners have their ID set to -1 and are erased once no dispatch walks the vector
+		void m_EndDispatch() {
+			if (m_removed) {
+				m_removed = false;
+				for (auto& [type, listeners] : m_listeners) {
+					std::erase_if(listeners, [](const auto& listener) { return listener.first == -1; });
+				}
+				std::erase_if(m_added, [](const auto& listener) { return listener.second.first == -1; });
+			}
+
+			for (auto& [type, listener] : m_added) {
+				m_listeners[type].push_back(std::move(listener));
+			}
+			m_added.clear();
+		}
 	public:
 		int m_RegisterListener(T givenEvent, std::function<void(const BaseEvent<T>&)> givenCallback) {
-			m_listeners[givenEvent].emplace_back(givenCallback);
 			int retID = m_nextID++;
-			m_listenerIDs[retID] = { givenEvent, std::prev(m_listeners[givenEvent].end()) };
+			if (m_dispatching) {
+				m_added.emplace_back(givenEvent, std::make_pair(retID, givenCallback));
+			}
+			else {
+				m_listeners[givenEvent].emplace_back(retID, givenCallback);
+			}
+			m_listenerIDs[retID] = givenEvent;
 			return retID;
 		}
 
 		void m_DispatchToListeners(const BaseEvent<T>& givenEvent [[maybe_unused]] ) {
-			if (m_listeners.find(givenEvent.m_GetEventType()) == m_listeners.end()) {
+			auto listeners = m_listeners.find(givenEvent.m_GetEventType());
+			if (listeners == m_listeners.end()) {
 				return;
 			}
 
-			for (auto&& currListener : m_listeners.at(givenEvent.m_GetEventType())) {
-				if (!givenEvent.m_IsHandled()) {
-					currListener(givenEvent);
+			m_dispatching++;
+			for (auto&& currListener : listeners->second) {
+				if (currListener.first != -1 && !givenEvent.m_IsHandled()) {
+					currListener.second(givenEvent);
 				}
 			}
+			if (--m_dispatching == 0) m_EndDispatch();
 		}
 
 		void m_UnregisterListener(int ID) {
 			auto pairInMap = m_listenerIDs.find(ID);
-			if (pairInMap != m_listenerIDs.end()) {
-				auto& currListenerInfo = pairInMap->second;
-				m_listeners[currListenerInfo.first].erase(currListenerInfo.second);
-				m_listenerIDs.erase(pairInMap);
+			if (pairInMap == m_listenerIDs.end()) {
+				return;
+			}
+
+			//the callback may be the one running, the vector is compacted after the dispatch
+			for (auto& listener : m_listeners[pairInMap->second]) {
+				if (listener.first == ID) listener.first = -1;
+			}
+			for (auto& listener : m_added) {
+				if (listener.second.first == ID) listener.second.first = -1;
 			}
+			m_listenerIDs.erase(pairInMap);
+			m_removed = true;
+
+			if (!m_dispatching) m_EndDispatch();
 		}
 	};
 }
\ No newline at end of file
@@ -0,0 +1,67 @@
+/******************************************************************/
+/*!
+\file      EventsEventBus.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      April 12, 2025
+\brief     This file contains the definitions of the EventBus class.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include "../Config/pch.h"
+#include "EventsEventBus.h"
+
+namespace events {
+
+	std::unique_ptr<EventBus> EventBus::m_InstancePtr = nullptr;
+
+	void EventBus::m_Unsubscribe(ListenerHandle& handle)
+	{
+		if (!handle.m_IsValid()) return;
+
+		if (handle.m_type < m_queues.size() && m_queues[handle.m_type]) {
+			m_queues[handle.m_type]->m_Unsubscribe(handle.m_id);
+		}
+		handle = ListenerHandle{};
+	}
+
+	void EventBus::m_FlushAll()
+	{
+		//a listener can use a new event type, the vector may grow while flushing
+		for (size_t type{}; type < m_queues.size(); type++) {
+			if (m_queues[type]) {
+				m_queues[type]->m_Flush();
+			}
+		}
+	}
+
+	void EventBus::m_Clear()
+	{
+		for (auto& queue : m_queues) {
+			if (queue) {
+				queue->m_Clear();
+			}
+		}
+	}
+
+	size_t EventBus::m_GetPendingCount() const
+	{
+		size_t count{};
+		for (const auto& queue : m_queues) {
+			if (queue) {
+				count += queue->m_GetPendingCount();
+			}
+		}
+		return count;
+	}
+
+	std::uint32_t EventBus::m_NextTypeID()
+	{
+		static std::uint32_t nextID{};
+		return nextID++;
+	}
+
+}
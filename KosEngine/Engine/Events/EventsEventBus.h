@@ -0,0 +1,272 @@
+/******************************************************************/
+/*!
+\file      EventsEventBus.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      April 12, 2025
+\brief     This file contains the EventBus, a typed event queue.
+
+		   Any struct can be an event. Every event type has its own
+		   EventQueue: a contiguous vector of pending events and the
+		   listeners of the type. Queued events wait until the queue is
+		   flushed and are then handed to every listener in the order
+		   they were queued. The vectors are cleared, not freed, so a
+		   frame with as many events as the last one allocates nothing.
+		   m_Dispatch skips the queue and calls the listeners right
+		   away.
+
+		   The ECS flushes every queue at the start of m_Update, for
+		   the events the input, editor and scene loading queued
+		   between frames, and again after the systems ran. The order
+		   of events is only kept within a type, the queues are flushed
+		   one type at a time in the order the types were first used.
+
+		   A listener is removed through the ListenerHandle it was
+		   subscribed with, even while its own event is dispatched.
+		   Listeners added during a dispatch start once it is over,
+		   events queued during a flush wait for the next flush.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#ifndef EVENTBUS_H
+#define EVENTBUS_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace events {
+
+	struct ListenerHandle {
+		std::uint32_t m_type{};
+		//0 is never given to a listener
+		std::uint32_t m_id{};
+
+		bool m_IsValid() const { return m_id != 0; }
+	};
+
+	class IEventQueue {
+
+	public:
+
+		virtual ~IEventQueue() = default;
+
+		virtual void m_Flush() = 0;
+
+		virtual void m_Unsubscribe(std::uint32_t id) = 0;
+
+		//drops the pending events, the listeners stay
+		virtual void m_Clear() = 0;
+
+		virtual size_t m_GetPendingCount() const = 0;
+
+		virtual size_t m_GetListenerCount() const = 0;
+	};
+
+	template <typename E>
+	class EventQueue : public IEventQueue {
+
+	public:
+
+		using Callback = std::function<void(const E&)>;
+
+		std::uint32_t m_Subscribe(Callback callback) {
+			const std::uint32_t id = m_nextID++;
+			//growing the vector would move the running callback, new listeners wait for the dispatch to end
+			(m_dispatching ? m_added : m_listeners).push_back(Listener{ id, std::move(callback) });
+			return id;
+		}
+
+		void m_Unsubscribe(std::uint32_t id) override {
+			for (auto* listeners : { &m_listeners, &m_added }) {
+				for (Listener& listener : *listeners) {
+					if (listener.m_id == id) {
+						//the callback may be the one running, it is destroyed once no dispatch uses it
+						listener.m_id = 0;
+						m_removed = true;
+					}
+				}
+			}
+			if (!m_dispatching) m_EndDispatch();
+		}
+
+		template <typename... Args>
+		void m_Queue(Args&&... args) {
+			m_pending.emplace_back(std::forward<Args>(args)...);
+		}
+
+		void m_Dispatch(const E& event) {
+			m_dispatching++;
+			m_Call(event);
+			if (--m_dispatching == 0) m_EndDispatch();
+		}
+
+		void m_Flush() override {
+			//a listener flushing again finds nothing new to send
+			if (m_pending.empty() || !m_flushing.empty()) return;
+
+			std::swap(m_pending, m_flushing);
+			m_dispatching++;
+			for (const E& event : m_flushing) {
+				m_Call(event);
+			}
+			m_flushing.clear();
+			if (--m_dispatching == 0) m_EndDispatch();
+		}
+
+		void m_Clear() override {
+			m_pending.clear();
+		}
+
+		size_t m_GetPendingCount() const override {
+			return m_pending.size();
+		}
+
+		size_t m_GetListenerCount() const override {
+			size_t count{};
+			for (auto* listeners : { &m_listeners, &m_added }) {
+				for (const Listener& listener : *listeners) {
+					if (listener.m_id) count++;
+				}
+			}
+			return count;
+		}
+
+	private:
+
+		struct Listener {
+			std::uint32_t m_id{};
+			Callback m_callback;
+		};
+
+		void m_Call(const E& event) {
+			for (const Listener& listener : m_listeners) {
+				if (listener.m_id) {
+					listener.m_callback(event);
+				}
+			}
+		}
+
+		void m_EndDispatch() {
+			if (m_removed) {
+				m_removed = false;
+				std::erase_if(m_listeners, [](const Listener& listener) { return listener.m_id == 0; });
+				std::erase_if(m_added, [](const Listener& listener) { return listener.m_id == 0; });
+			}
+
+			for (Listener& listener : m_added) {
+				m_listeners.push_back(std::move(listener));
+			}
+			m_added.clear();
+		}
+
+		std::vector<Listener> m_listeners;
+		//subscribed during a dispatch
+		std::vector<Listener> m_added;
+		std::vector<E> m_pending;
+		std::vector<E> m_flushing;
+		std::uint32_t m_nextID{ 1 };
+		int m_dispatching{};
+		bool m_removed{ false };
+	};
+
+	class EventBus {
+
+	public:
+
+		static EventBus* m_GetInstance() {
+			if (!m_InstancePtr) {
+				m_InstancePtr.reset(new EventBus{});
+			}
+			return m_InstancePtr.get();
+		}
+
+		/******************************************************************/
+		/*!
+			\fn        template <typename E> ListenerHandle m_Subscribe(std::function<void(const E&)> callback)
+			\brief     Calls the callback for every event of type E, after
+					   the listeners subscribed before it.
+			\return    The handle that removes the listener.
+		*/
+		/******************************************************************/
+		template <typename E>
+		ListenerHandle m_Subscribe(std::function<void(const E&)> callback) {
+			return ListenerHandle{ m_TypeID<E>(), m_GetQueue<E>()->m_Subscribe(std::move(callback)) };
+		}
+
+		/******************************************************************/
+		/*!
+			\fn        void m_Unsubscribe(ListenerHandle& handle)
+			\brief     Removes the listener and invalidates the handle. A
+					   listener removed during a dispatch gets no further
+					   event, including the rest of the current batch.
+		*/
+		/******************************************************************/
+		void m_Unsubscribe(ListenerHandle& handle);
+
+		//builds the event in the queue of its type, sent at the next flush
+		template <typename E, typename... Args>
+		void m_Queue(Args&&... args) {
+			m_GetQueue<E>()->m_Queue(std::forward<Args>(args)...);
+		}
+
+		//sends the event now, before the queued ones
+		template <typename E>
+		void m_Dispatch(const E& event) {
+			m_GetQueue<E>()->m_Dispatch(event);
+		}
+
+		template <typename E>
+		void m_Flush() {
+			m_GetQueue<E>()->m_Flush();
+		}
+
+		/******************************************************************/
+		/*!
+			\fn        void m_FlushAll()
+			\brief     Sends the queued events of every type, one type at
+					   a time in the order the types were first used.
+		*/
+		/******************************************************************/
+		void m_FlushAll();
+
+		//drops every pending event, the listeners stay
+		void m_Clear();
+
+		size_t m_GetPendingCount() const;
+
+	private:
+
+		template <typename E>
+		static std::uint32_t m_TypeID() {
+			static const std::uint32_t id = m_NextTypeID();
+			return id;
+		}
+
+		static std::uint32_t m_NextTypeID();
+
+		template <typename E>
+		EventQueue<E>* m_GetQueue() {
+			const std::uint32_t type = m_TypeID<E>();
+			if (type >= m_queues.size()) {
+				m_queues.resize(type + 1);
+			}
+			if (!m_queues[type]) {
+				m_queues[type] = std::make_unique<EventQueue<E>>();
+			}
+			return static_cast<EventQueue<E>*>(m_queues[type].get());
+		}
+
+		//indexed by m_TypeID
+		std::vector<std::unique_ptr<IEventQueue>> m_queues;
+
+		static std::unique_ptr<EventBus> m_InstancePtr;
+	};
+
+}
+
+#endif EVENTBUS_H
@@ -16,6 +16,14 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 namespace messaging {
 
+	MessageSystem::MessageSystem() = default;
+
+	MessageSystem::~MessageSystem() {
+		if (m_busListener.m_IsValid()) {
+			events::EventBus::m_GetInstance()->m_Unsubscribe(m_busListener);
+		}
+	}
+
 	void MessageSystem::m_AddListener(MessageType listenToType, MessageCallback callback) {
 		m_listeners[listenToType].emplace_back(callback);
 	}
@@ -24,9 +32,19 @@ namespace messaging {
 	void MessageSystem::m_SendMessage(const Message& givenMsg) {
 		auto iter = m_listeners.find(givenMsg.m_GetType());
 		if (iter != m_listeners.end()) {
-			for (auto& callback : m_listeners[givenMsg.m_GetType()]) {
+			for (auto& callback : iter->second) {
 				callback(givenMsg);
 			}
 		}
 	}
+
+	void MessageSystem::m_QueueMessage(const Message& givenMsg) {
+		//only a system that queues needs the bus, the others never subscribe
+		if (!m_busListener.m_IsValid()) {
+			m_busListener = events::EventBus::m_GetInstance()->m_Subscribe<QueuedMessage>([this](const QueuedMessage& queued) {
+				if (queued.m_system == this) m_SendMessage(queued.m_message);
+			});
+		}
+		events::EventBus::m_GetInstance()->m_Queue<QueuedMessage>(QueuedMessage{ this, givenMsg });
+	}
 }
\ No newline at end of file
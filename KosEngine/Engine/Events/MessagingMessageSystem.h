@@ -13,11 +13,18 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 /********************************************************************/
 #pragma once
 #include "EventsBaseMessage.h"
+#include "EventsEventBus.h"
 
 namespace messaging {
 	class MessageSystem {
 	public:
 		using MessageCallback = void (*)(const Message&);
+
+		MessageSystem();
+		~MessageSystem();
+		MessageSystem(const MessageSystem&) = delete;
+		MessageSystem& operator=(const MessageSystem&) = delete;
+
 		/**
 		 \brief		this function adds a callback to a message type to the unordered map held by the message system
 		 **/
@@ -28,7 +35,20 @@ namespace messaging {
 		 **/
 		void m_SendMessage(const Message&);
 
+		/**
+		 \brief		this function queues the message on the event bus, it is sent to the listeners when the bus is flushed,
+		 			the first message subscribes the system to the bus
+		 **/
+		void m_QueueMessage(const Message&);
+
 	private:
+		//the bus is shared, a message only goes back to the system that queued it
+		struct QueuedMessage {
+			const MessageSystem* m_system;
+			Message m_message;
+		};
+
+		events::ListenerHandle m_busListener;
 		std::unordered_map<MessageType, std::vector<MessageCallback>> m_listeners;
 	};
 }
\ No newline at end of file
@@ -226,6 +226,8 @@ namespace graphicpipe
 
 		if (!m_textData.empty() && GraphicsCamera::m_windowHeight > 0 && GraphicsCamera::m_windowWidth > 0) {
 			for (auto& textData : m_textData) {
+				if (!textData.m_font) continue;
+
 				// Activate corresponding render state
 				glUseProgram(m_textShaderProgram);
 
@@ -255,7 +257,13 @@ namespace graphicpipe
 				glBindVertexArray(m_textMesh.m_vaoId);
 				float origin{ textData.m_x };
 
-				assetmanager::AssetManager* assetmanager = assetmanager::AssetManager::m_funcGetInstance();
+				const text::FontManager::FontMap& font = *textData.m_font;
+				//glyphs missing from the atlas are drawn as empty characters
+				const auto getCharacter = [&font](char c) -> text::CharacterData {
+					const auto& glyph = font.find(c);
+					return glyph != font.end() ? glyph->second : text::CharacterData{};
+				};
+
 				float originX{ textData.m_x };
 				float originY{ textData.m_y };
 
@@ -272,7 +280,7 @@ namespace graphicpipe
 					for (int i = 0; i < textData.m_text.size(); ++i) // To calculate the total width of the text
 					{
 						char c = textData.m_text[i];
-						text::CharacterData ch = assetmanager->m_fontManager.m_fonts[textData.m_fileName][c];
+						text::CharacterData ch = getCharacter(c);
 						if (i == textData.m_text.size() - 1) // If it's the last letter, add only the letter size
 						{
 							totalWidth += ((ch.m_size.x * textData.m_scale * textData.m_xyScale.x) / ((static_cast<float>(help->m_currWindowHeight))));
@@ -296,7 +304,7 @@ namespace graphicpipe
 
 				else
 				{
-					float xpos = (assetmanager->m_fontManager.m_fonts[textData.m_fileName][textData.m_text[0]].m_bearing.x / ((static_cast<float>(help->m_currWindowHeight))) * (textData.m_scale * textData.m_xyScale.x));
+					float xpos = (getCharacter(textData.m_text[0]).m_bearing.x / ((static_cast<float>(help->m_currWindowHeight))) * (textData.m_scale * textData.m_xyScale.x));
 					textData.m_x -= xpos;
 				}
 				
@@ -304,7 +312,7 @@ namespace graphicpipe
 				// Step 2: Render the text
 				for (const char& c : textData.m_text)
 				{
-					text::CharacterData ch = assetmanager->m_fontManager.m_fonts[textData.m_fileName][c];
+					text::CharacterData ch = getCharacter(c);
 
 					// Calculate position and size for each character quad
 					float xpos = (textData.m_x + ch.m_bearing.x / ((static_cast<float>(help->m_currWindowHeight))) * (textData.m_scale * textData.m_xyScale.x));
@@ -131,6 +131,9 @@ namespace graphicpipe {
 	GraphicsPipe::~GraphicsPipe()
 	{
 		//delete instancePtr;
+		//never initialised, headless runs have no context to delete from
+		if (!m_genericShaderProgram) return;
+
 		if (m_frameBufferObject)
 		{
 			glDeleteFramebuffers(1, &m_frameBufferObject);
@@ -149,9 +152,13 @@ namespace graphicpipe {
 
 	void GraphicsPipe::m_funcUpdate()
 	{
-		m_funcCalculateModelToWorldMatrix();
-		m_spawnParticles();
-		m_updateParticles();
+		//headless runs only keep the camera, scripts read it
+		const bool headless = Helper::Helpers::GetInstance()->m_headless;
+		if (!headless) {
+			m_funcCalculateModelToWorldMatrix();
+			m_spawnParticles();
+			m_updateParticles();
+		}
 		GraphicsCamera::m_CalculateAspectRatio();
 		
 		if (GraphicsCamera::m_cameras.size() > 0 && m_gameMode)
@@ -163,7 +170,7 @@ namespace graphicpipe {
 		GraphicsCamera::m_MultiplyViewMatrix();
 		GraphicsCamera::m_MultiplyOrthoMatrix();
 
-		if (!m_gameMode)
+		if (!m_gameMode && !headless)
 		{
 			
 			m_funcDrawWindow();
@@ -217,7 +224,8 @@ namespace graphicpipe {
 	void GraphicsPipe::m_funcRenderGameScene()
 	{
 		
-		if (m_gameMode)
+		//headless runs drop what the systems collected
+		if (m_gameMode && !Helper::Helpers::GetInstance()->m_headless)
 		{
 			glClearColor(0,0,0,1.f);
 			m_renderFinalPass();
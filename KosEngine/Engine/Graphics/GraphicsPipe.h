@@ -131,6 +131,7 @@ namespace graphicpipe {
         glm::vec3 m_color{};               ///< Text color (RGB).
         std::string m_fileName;            ///< Font file used for rendering.
         bool m_isCentered;
+        const text::FontManager::FontMap* m_font{}; ///< Font resolved from the text component's handle.
     };
 
     struct VideoData
@@ -19,6 +19,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 #include "../Math/Vector3.h"
 #include <memory>
+#include <random>
 #include <string>
 
 namespace Helper {
@@ -79,6 +80,22 @@ namespace Helper {
 		std::string m_currMousePicture{ "default" };
 
 		bool m_isMouseCentered{ false };
+
+		//input session recorded to, or replayed from, set in the config
+		std::string m_recordInputPath;
+
+		std::string m_replayInputPath;
+
+		//run without a window, GL context or audio device, set in the config
+		bool m_headless{ false };
+
+		//frames a headless run simulates, the replay decides when replaying
+		int m_headlessFrames{};
+
+		std::string m_headlessReportPath;
+
+		//random numbers of the scripts, a recording keeps the seed so its replay draws the same numbers
+		std::mt19937 m_random{ std::random_device{}() };
 		
 	private:
 		static std::unique_ptr<Helpers> InstancePtr;
@@ -42,6 +42,20 @@ namespace Input {
 	const std::string InputSystem::xboxMapping = "78696e70757401000000000000000000,XInput Gamepad (GLFW),platform:Windows,a:b0,b:b1,x:b2,y:b3,leftshoulder:b4,rightshoulder:b5,back:b6,start:b7,leftstick:b8,rightstick:b9,leftx:a0,lefty:a1,rightx:a2,righty:a3,lefttrigger:a4,righttrigger:a5,dpup:h0.1,dpright:h0.2,dpdown:h0.4,dpleft:h0.8,";
 
 	void InputSystem::KeyCallBack([[maybe_unused]] GLFWwindow* window, [[maybe_unused]] int key, [[maybe_unused]] int scancode, int action, [[maybe_unused]] int mods) {
+		//a replay only sees the recorded keys
+		if (m_recorder.m_IsReplaying()) return;
+
+		m_events.m_Push({ glfwGetTime(), m_frameCount, INPUTKEY, key, action, {} });
+		if (key >= 0 && key < keys::KEY_COUNT) {
+			if (action == GLFW_PRESS) {
+				m_keysDown.set(key);
+				m_keysTapped.set(key);
+			}
+			else if (action == GLFW_RELEASE) {
+				m_keysDown.reset(key);
+			}
+		}
+
 		if (action == GLFW_PRESS) {
 			InputSystem::m_keyString = "key pressed!";
 		}
@@ -55,7 +69,20 @@ namespace Input {
 
 
 	void InputSystem::MouseButtonCallBack([[maybe_unused]] GLFWwindow* pwin, [[maybe_unused]] int button, [[maybe_unused]] int action, [[maybe_unused]] int mod) {
-	
+		if (m_recorder.m_IsReplaying()) return;
+
+		//mouse buttons share the key set, no key uses codes below 32
+		m_events.m_Push({ glfwGetTime(), m_frameCount, INPUTMOUSEBUTTON, button, action, {} });
+		if (button >= 0 && button <= GLFW_MOUSE_BUTTON_LAST) {
+			if (action == GLFW_PRESS) {
+				m_keysDown.set(button);
+				m_keysTapped.set(button);
+			}
+			else if (action == GLFW_RELEASE) {
+				m_keysDown.reset(button);
+			}
+		}
+
 		if (action == GLFW_PRESS) {
 			// key is press
 			InputSystem::m_mouseString = "Mouse pressed!";
@@ -71,6 +98,8 @@ namespace Input {
 
 
 	void InputSystem::mousepos_cb(GLFWwindow* pwin, double xpos, double ypos) {
+		if (m_recorder.m_IsReplaying()) return;
+
 		int width{}, height{};
 		
 		glfwGetWindowSize(pwin, &width, &height);
@@ -79,6 +108,7 @@ namespace Input {
 
 		MousePosition.m_x = static_cast<float>(xpos);
 		MousePosition.m_y = static_cast<float>(ypos);
+		m_events.m_Push({ glfwGetTime(), m_frameCount, INPUTMOUSEMOVE, 0, 0, MousePosition });
 		//std::cout << xpos << " : " << ypos << std::endl;
 
 	}
@@ -139,216 +169,103 @@ namespace Input {
 	}
 
 	void InputSystem::m_inputUpdate() {
-		giveControllerMousePos();
-		for (int controlID = GLFW_JOYSTICK_1; controlID <= GLFW_JOYSTICK_LAST; controlID++) {
-			if (glfwJoystickPresent(controlID)) {
-				m_controllerConnected = true;
-				m_controllerID = controlID;
-				m_controllerName = glfwGetGamepadName(controlID);
-				//if (glfwJoystickIsGamepad(controlID)) {
-				//	std::cout << "yepcock" << std::endl;
-				//}
-				//if (m_controllerName == "XInput Gamepad (GLFW)") {
-				//	glfwUpdateGamepadMappings(xboxMapping.c_str());
-				//}
-				//else if (m_controllerName == "PS5 Controller") {
-				//	glfwUpdateGamepadMappings(ps5Mapping.c_str());
-				//}
-			}
-			
-		}
-		for (auto& currKey : m_wasTriggered) {
-			int state;
-			if (currKey.first == keys::LMB || currKey.first == keys::RMB || currKey.first == keys::MMB) {
-				state = glfwGetMouseButton(m_windowInput, currKey.first);
-			}
-			else {
-				state = glfwGetKey(m_windowInput, currKey.first);
+		Helper::Helpers* help = Helper::Helpers::GetInstance();
+		m_previousFrame = m_frame;
+		m_frameCount++;
+
+		if (m_recorder.m_IsReplaying() || help->m_headless) {
+			//headless runs have no devices, nothing is held unless replayed
+			if (!m_recorder.m_NextFrame(m_frame)) {
+				m_frame = InputFrame{};
+				m_frame.m_deltaTime = help->m_deltaTime;
+				m_frame.m_accumulatedTime = help->m_accumulatedTime;
+				m_frame.m_steps = help->currentNumberOfSteps;
 			}
 
-			if (!m_wasPressed[currKey.first] && state == GLFW_PRESS) {
-				m_wasPressed[currKey.first] = true;
-				m_wasTriggered[currKey.first] = true;
-			}
-			else if (m_wasPressed[currKey.first]) {
-				m_wasTriggered[currKey.first] = false;
-			}
-			if (state == GLFW_RELEASE) {
-				if (m_wasPressed[currKey.first] || m_wasTriggered[currKey.first]) {
-					m_wasReleased[currKey.first] = true;
-				}
-				else {
-					m_wasReleased[currKey.first] = false;
+			//the recorded clock replaces the real one, the same fixed steps run
+			help->m_deltaTime = m_frame.m_deltaTime;
+			help->m_accumulatedTime = m_frame.m_accumulatedTime;
+			help->currentNumberOfSteps = m_frame.m_steps;
+
+			MousePosition = m_frame.m_mousePosition;
+			m_controllerConnected = m_frame.m_controllerConnected;
+			controllerRightJoyStickRotation = m_frame.m_rightStickRotation;
+			m_controllerAxes.assign(m_frame.m_controllerAxes.begin(), m_frame.m_controllerAxes.end());
+		}
+		else {
+			giveControllerMousePos();
+			for (int controlID = GLFW_JOYSTICK_1; controlID <= GLFW_JOYSTICK_LAST; controlID++) {
+				if (glfwJoystickPresent(controlID)) {
+					m_controllerConnected = true;
+					m_controllerID = controlID;
+					m_controllerName = glfwGetGamepadName(controlID);
 				}
-				m_wasPressed[currKey.first] = false;
-				m_wasTriggered[currKey.first] = false;
 			}
-		}
-		
-		if(m_controllerConnected){
-			GLFWgamepadstate state;
-			if (glfwGetGamepadState(m_controllerID, &state))
-			{
-				int store = 0;
-				const float* axes = glfwGetJoystickAxes(m_controllerID, &store);
-				if (m_controllerName == "XInput Gamepad (GLFW)") {
-					for (int i = 0; i < store; ++i)  // GLFW_GAMEPAD_AXIS_LAST is 5
-					{
-
-						if (i == 4) {
-							if (axes[i] > 0.f) {
-								if (!m_controllerButtonsPress[keys::CONTROLLER_LEFT_TRIGGER]) {
-									m_controllerButtonsTriggered[keys::CONTROLLER_LEFT_TRIGGER] = true;
-									m_controllerButtonsPress[keys::CONTROLLER_LEFT_TRIGGER] = true;
-								}
-								else {
-									m_controllerButtonsTriggered[keys::CONTROLLER_LEFT_TRIGGER] = false;
-								}
-							}
-							else {
-								if (m_controllerButtonsPress[keys::CONTROLLER_LEFT_TRIGGER] || m_controllerButtonsTriggered[keys::CONTROLLER_LEFT_TRIGGER]) {
-									m_wasControllerReleased[keys::CONTROLLER_LEFT_TRIGGER] = true;
-								}
-								else {
-									m_wasControllerReleased[keys::CONTROLLER_LEFT_TRIGGER] = false;
-								}
-								m_controllerButtonsPress[keys::CONTROLLER_LEFT_TRIGGER] = false;
-								m_controllerButtonsTriggered[keys::CONTROLLER_LEFT_TRIGGER] = false;
-							}
+			m_pollController();
 
-						}
-						else if (i == 5) {
-							if (axes[i] > 0.f) {
-								if (!m_controllerButtonsPress[keys::CONTROLLER_RIGHT_TRIGGER]) {
-									m_controllerButtonsTriggered[keys::CONTROLLER_RIGHT_TRIGGER] = true;
-									m_controllerButtonsPress[keys::CONTROLLER_RIGHT_TRIGGER] = true;
-								}
-								else {
-									m_controllerButtonsTriggered[keys::CONTROLLER_RIGHT_TRIGGER] = false;
-								}
-							}
-							else {
-								if (m_controllerButtonsPress[keys::CONTROLLER_RIGHT_TRIGGER] || m_controllerButtonsTriggered[keys::CONTROLLER_RIGHT_TRIGGER]) {
-									m_wasControllerReleased[keys::CONTROLLER_RIGHT_TRIGGER] = true;
-								}
-								else {
-									m_wasControllerReleased[keys::CONTROLLER_RIGHT_TRIGGER] = false;
-								}
-								m_controllerButtonsPress[keys::CONTROLLER_RIGHT_TRIGGER] = false;
-								m_controllerButtonsTriggered[keys::CONTROLLER_RIGHT_TRIGGER] = false;
-							}
+			m_frame.m_keys = m_keysDown;
+			m_frame.m_taps = m_keysTapped;
+			m_keysTapped.reset();
 
-						}
-						else if (i == 1 || i == 3) {
-							m_controllerAxes[i] = -axes[i];
-						}
-						else {
-							m_controllerAxes[i] = axes[i];
-						}
-						if (m_controllerAxes[i] < 0.001f && m_controllerAxes[i] > -0.001f) {
-							m_controllerAxes[i] = 0.f;
-						}
-					}
-				}
-				else {
-					//i = 4 is right trigger
-					//i = 5 is right y axis
-					//i = 2 is right x axis
-					//i = 1 is left y axis
-					//i = 0 is left x axis
-				//	int store = 0;
-					//const float* axes = glfwGetJoystickAxes(m_controllerID, &store);
-					for (int i = 0; i < store; ++i)  // GLFW_GAMEPAD_AXIS_LAST is 5
-					{
-						if (i == 3) {
-							if (axes[i] > 0.f) {
-								if (!m_controllerButtonsPress[keys::CONTROLLER_LEFT_TRIGGER]) {
-									m_controllerButtonsTriggered[keys::CONTROLLER_LEFT_TRIGGER] = true;
-									m_controllerButtonsPress[keys::CONTROLLER_LEFT_TRIGGER] = true;
-								}
-								else {
-									m_controllerButtonsTriggered[keys::CONTROLLER_LEFT_TRIGGER] = false;
-								}
-							}
-							else {
-								if (m_controllerButtonsPress[keys::CONTROLLER_LEFT_TRIGGER] || m_controllerButtonsTriggered[keys::CONTROLLER_LEFT_TRIGGER]) {
-									m_wasControllerReleased[keys::CONTROLLER_LEFT_TRIGGER] = true;
-								}
-								else {
-									m_wasControllerReleased[keys::CONTROLLER_LEFT_TRIGGER] = false;
-								}
-								m_controllerButtonsPress[keys::CONTROLLER_LEFT_TRIGGER] = false;
-								m_controllerButtonsTriggered[keys::CONTROLLER_LEFT_TRIGGER] = false;
-							}
-						}
-						else if (i == 4) {
-							if (axes[i] > 0.f) {
-								if (!m_controllerButtonsPress[keys::CONTROLLER_RIGHT_TRIGGER]) {
-									m_controllerButtonsTriggered[keys::CONTROLLER_RIGHT_TRIGGER] = true;
-									m_controllerButtonsPress[keys::CONTROLLER_RIGHT_TRIGGER] = true;
-								}
-								else {
-									m_controllerButtonsTriggered[keys::CONTROLLER_RIGHT_TRIGGER] = false;
-								}
-							}
-							else {
-								if (m_controllerButtonsPress[keys::CONTROLLER_RIGHT_TRIGGER] || m_controllerButtonsTriggered[keys::CONTROLLER_RIGHT_TRIGGER]) {
-									m_wasControllerReleased[keys::CONTROLLER_RIGHT_TRIGGER] = true;
-								}
-								else {
-									m_wasControllerReleased[keys::CONTROLLER_RIGHT_TRIGGER] = false;
-								}
-								m_controllerButtonsPress[keys::CONTROLLER_RIGHT_TRIGGER] = false;
-								m_controllerButtonsTriggered[keys::CONTROLLER_RIGHT_TRIGGER] = false;
-							}
+			std::copy_n(m_controllerAxes.begin(), m_frame.m_controllerAxes.size(), m_frame.m_controllerAxes.begin());
+			m_frame.m_mousePosition = MousePosition;
+			m_frame.m_rightStickRotation = controllerRightJoyStickRotation;
+			m_frame.m_controllerConnected = m_controllerConnected;
+			m_frame.m_deltaTime = help->m_deltaTime;
+			m_frame.m_accumulatedTime = help->m_accumulatedTime;
+			m_frame.m_steps = help->currentNumberOfSteps;
 
-						}
-						else if (i == 5) {
-							m_controllerAxes[3] = -axes[i];
-						}
-						else if (i == 1) {
-							m_controllerAxes[i] = -axes[i];
-						}
-						else {
-							m_controllerAxes[i] = axes[i];
-						}
-						
-						
-						if (m_controllerAxes[i] < 0.001f && m_controllerAxes[i] > -0.001f) {
-							m_controllerAxes[i] = 0.f;
-						}
-					}
-				}
-				// Update button states
-				for (int i = 0; i < 15; ++i)  // GLFW_GAMEPAD_BUTTON_LAST is 14
-				{
-					if (state.buttons[i] == GLFW_PRESS)
-					{
-						if (!m_controllerButtonsPress[i]) {
-							m_controllerButtonsTriggered[i] = true;
-							m_controllerButtonsPress[i] = true;
-						}
-						else if (m_controllerButtonsPress[i]) {
-							m_controllerButtonsTriggered[i] = false;
-						}
-						//m_controllerButtonsPress[i] = true;
-					}
-					else
-					{
-						if (m_controllerButtonsPress[i] || m_controllerButtonsTriggered[i]) {
-							m_wasControllerReleased[i] = true;
-						}
-						else {
-							m_wasControllerReleased[i] = false;
-						}
-						m_controllerButtonsPress[i] = false;
-						m_controllerButtonsTriggered[i] = false;
-					}
-				}
+			m_recorder.m_Record(m_frame);
+		}
+
+		//a key pressed and let go between two frames is still triggered and released
+		m_wasTriggered = (m_frame.m_keys & ~m_previousFrame.m_keys) | m_frame.m_taps;
+		m_wasReleased = (m_previousFrame.m_keys & ~m_frame.m_keys) | (m_frame.m_taps & ~m_frame.m_keys);
+		m_controllerButtonsTriggered = m_frame.m_controllerButtons & ~m_previousFrame.m_controllerButtons;
+		m_wasControllerReleased = m_previousFrame.m_controllerButtons & ~m_frame.m_controllerButtons;
+	}
+
+	void InputSystem::m_pollController() {
+		GLFWgamepadstate state;
+		if (!m_controllerConnected || !glfwGetGamepadState(m_controllerID, &state)) {
+			m_frame.m_controllerButtons.reset();
+			return;
+		}
 
+		int store = 0;
+		const float* axes = glfwGetJoystickAxes(m_controllerID, &store);
+		const bool xbox = m_controllerName == "XInput Gamepad (GLFW)";
+		//the triggers are read as buttons, the xbox reports them on axes 4 and 5, the ps5 on 3 and 4
+		const int leftTrigger = xbox ? 4 : 3;
+		for (int i = 0; i < store && i < static_cast<int>(m_controllerAxes.size()); ++i)
+		{
+			if (i == leftTrigger) {
+				m_frame.m_controllerButtons[keys::CONTROLLER_LEFT_TRIGGER] = axes[i] > 0.f;
+			}
+			else if (i == leftTrigger + 1) {
+				m_frame.m_controllerButtons[keys::CONTROLLER_RIGHT_TRIGGER] = axes[i] > 0.f;
+			}
+			else if (!xbox && i == 5) {
+				//ps5 right y axis
+				m_controllerAxes[3] = -axes[i];
+			}
+			else if (i == 1 || (xbox && i == 3)) {
+				m_controllerAxes[i] = -axes[i];
+			}
+			else {
+				m_controllerAxes[i] = axes[i];
+			}
 
+			if (m_controllerAxes[i] < 0.001f && m_controllerAxes[i] > -0.001f) {
+				m_controllerAxes[i] = 0.f;
 			}
 		}
+
+		// Update button states
+		for (int i = 0; i <= GLFW_GAMEPAD_BUTTON_LAST; ++i)
+		{
+			m_frame.m_controllerButtons[i] = state.buttons[i] == GLFW_PRESS;
+		}
 	}
 
 	void InputSystem::giveControllerMousePos()
@@ -465,21 +382,13 @@ namespace Input {
 
 
 	bool InputSystem::m_isKeyTriggered(const keyCode givenKey) {
-		return m_wasTriggered[givenKey];
+		return givenKey < keys::KEY_COUNT && m_wasTriggered[givenKey];
 	}
 	bool InputSystem::m_isKeyPressed(const keyCode givenKey) {
-		int state;
-		if (givenKey == keys::LMB || givenKey == keys::RMB || givenKey == keys::MMB) {
-			state = glfwGetMouseButton(m_windowInput, givenKey);
-		}
-		else {
-			state = glfwGetKey(m_windowInput, givenKey);
-		}
-
-		return state == GLFW_PRESS ? true : false;
+		return givenKey < keys::KEY_COUNT && m_frame.m_keys[givenKey];
 	}
 	bool InputSystem::m_isKeyReleased(const keyCode givenKey) {
-		return m_wasReleased[givenKey];
+		return givenKey < keys::KEY_COUNT && m_wasReleased[givenKey];
 	}
 
 	vector2::Vec2 InputSystem::m_getMousePosition() {
@@ -487,17 +396,17 @@ namespace Input {
 	}
 
 	bool InputSystem::m_isControllerButtonTriggered(const keyCode givenKey) {
-		return m_controllerButtonsTriggered[givenKey];
+		return givenKey < keys::CONTROLLER_BUTTON_COUNT && m_controllerButtonsTriggered[givenKey];
 	}
 
 	bool InputSystem::m_isControllerButtonPressed(const keyCode givenKey)
 	{
-		return m_controllerButtonsPress[givenKey];
+		return givenKey < keys::CONTROLLER_BUTTON_COUNT && m_frame.m_controllerButtons[givenKey];
 	}
 
 	bool InputSystem::m_isControllerButtonReleased(const keyCode givenKey)
 	{
-		return m_wasControllerReleased[givenKey];
+		return givenKey < keys::CONTROLLER_BUTTON_COUNT && m_wasControllerReleased[givenKey];
 
 	}
 
@@ -510,4 +419,8 @@ namespace Input {
 		return m_controllerAxes;
 	}
 
+	const InputEventBuffer& InputSystem::m_getEvents() {
+		return m_events;
+	}
+
 }
\ No newline at end of file
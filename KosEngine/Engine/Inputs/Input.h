@@ -20,6 +20,8 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 
 #include <glfw3.h>
 #include "Keycodes.h"
+#include "InputEvents.h"
+#include "InputRecorder.h"
 #include "../Helper/Helper.h"
 
 namespace Input {
@@ -69,8 +71,16 @@ namespace Input {
 		static float m_getControllerAxis(const keyCode);
 		static std::vector<float> m_getControllerAxiss();
 
+		/*
+		\brief	Takes the snapshot every query of the frame reads. While a session is replayed the snapshot, and the frame's delta time and fixed steps, come from the recording instead of GLFW
+		*/
 		void m_inputUpdate();
 
+		/*
+		\brief	The last key, mouse button and cursor events the callbacks received, oldest first
+		*/
+		static const InputEventBuffer& m_getEvents();
+
 		static void giveControllerMousePos();
 		
 		static vector2::Vec2 MousePosition;
@@ -93,14 +103,25 @@ namespace Input {
 		static std::string m_controllerName;
 		static const std::string ps5Mapping;
 		static const std::string xboxMapping;
-	private:
-		inline static std::unordered_map<int, bool> m_wasTriggered;
-		inline static std::unordered_map<int, bool> m_wasPressed;
-		inline static std::unordered_map<int, bool> m_wasReleased;
-		inline static std::unordered_map<int, bool> m_controllerButtonsPress;
-		inline static std::unordered_map<int, bool> m_controllerButtonsTriggered;
-		inline static std::unordered_map<int, bool> m_wasControllerReleased;
 
+		inline static InputRecorder m_recorder;
+	private:
+		static void m_pollController();
+
+		//kept by the callbacks between two snapshots
+		inline static std::bitset<keys::KEY_COUNT> m_keysDown;
+		inline static std::bitset<keys::KEY_COUNT> m_keysTapped;
+
+		//snapshot of this frame and the last, the queries only read these
+		inline static InputFrame m_frame;
+		inline static InputFrame m_previousFrame;
+		inline static std::bitset<keys::KEY_COUNT> m_wasTriggered;
+		inline static std::bitset<keys::KEY_COUNT> m_wasReleased;
+		inline static std::bitset<keys::CONTROLLER_BUTTON_COUNT> m_controllerButtonsTriggered;
+		inline static std::bitset<keys::CONTROLLER_BUTTON_COUNT> m_wasControllerReleased;
+
+		inline static InputEventBuffer m_events;
+		inline static std::uint32_t m_frameCount{};
 
 	};
 
@@ -0,0 +1,89 @@
+/******************************************************************/
+/*!
+\file      InputEvents.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      April 10, 2025
+\brief     This file contains the InputEvent struct and the
+		   InputEventBuffer, a fixed size ring buffer the GLFW
+		   callbacks write every key, mouse button and cursor event
+		   into with the time and frame it arrived on.
+
+		   The buffer never allocates, once full the oldest event is
+		   overwritten. Cursor moves arriving on the same frame are
+		   merged so they do not push the button events out.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#ifndef INPUTEVENTS_H
+#define INPUTEVENTS_H
+
+#include "../Math/vector2.h"
+#include <array>
+#include <cstdint>
+
+namespace Input {
+
+	enum InputEventType : std::uint8_t {
+		INPUTKEY,
+		INPUTMOUSEBUTTON,
+		INPUTMOUSEMOVE
+	};
+
+	struct InputEvent {
+		//glfwGetTime when the event arrived
+		double m_time{};
+		//frame of the input update that takes the event
+		std::uint32_t m_frame{};
+		InputEventType m_type{ INPUTKEY };
+		//key or mouse button, GLFW_PRESS, GLFW_RELEASE or GLFW_REPEAT
+		int m_code{};
+		int m_action{};
+		vector2::Vec2 m_position{};
+	};
+
+	class InputEventBuffer {
+
+	public:
+
+		static constexpr size_t m_capacity = 256;
+
+		void m_Push(const InputEvent& event) {
+			if (event.m_type == INPUTMOUSEMOVE && m_count) {
+				InputEvent& last = m_events[(m_head + m_capacity - 1) % m_capacity];
+				if (last.m_type == INPUTMOUSEMOVE && last.m_frame == event.m_frame) {
+					last = event;
+					return;
+				}
+			}
+
+			m_events[m_head] = event;
+			m_head = (m_head + 1) % m_capacity;
+			if (m_count < m_capacity) m_count++;
+		}
+
+		size_t m_Size() const { return m_count; }
+
+		//0 is the oldest event kept
+		const InputEvent& operator[](size_t index) const {
+			return m_events[(m_head + m_capacity - m_count + index) % m_capacity];
+		}
+
+		void m_Clear() {
+			m_head = 0;
+			m_count = 0;
+		}
+
+	private:
+
+		std::array<InputEvent, m_capacity> m_events{};
+		size_t m_head{};
+		size_t m_count{};
+	};
+
+}
+
+#endif INPUTEVENTS_H
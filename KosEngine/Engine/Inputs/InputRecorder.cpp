@@ -0,0 +1,275 @@
+/******************************************************************/
+/*!
+\file      InputRecorder.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      April 10, 2025
+\brief     This file contains the definitions of the InputRecorder
+		   class and the file format of a recorded session.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include "../Config/pch.h"
+#include "InputRecorder.h"
+#include "../Debugging/Logging.h"
+
+namespace Input {
+
+	//"KINP", the version is bumped whenever InputFrame or the header changes
+	static constexpr std::uint32_t recordingMagic = 0x504E494B;
+	static constexpr std::uint32_t recordingVersion = 2;
+
+	//header: magic, version, seed, frame count, state hash, scene length, scene
+	static constexpr std::streamoff frameCountOffset = 12;
+	//frame count of a recording that was never stopped
+	static constexpr std::uint32_t unfinishedFrames = 0xFFFFFFFF;
+
+	//frames between two flushes of the file, a second at 60 frames a second
+	static constexpr std::uint32_t flushInterval = 60;
+
+	static constexpr size_t WordBytes(size_t bits)
+	{
+		return (bits + 63) / 64 * sizeof(std::uint64_t);
+	}
+
+	//size of a frame in the file, every frame is the same size
+	static constexpr size_t frameBytes = WordBytes(keys::KEY_COUNT) * 2 + WordBytes(keys::CONTROLLER_BUTTON_COUNT)
+		+ sizeof(std::array<float, 6>) + sizeof(float) * 3 + sizeof(std::uint8_t) + sizeof(float) * 2 + sizeof(std::int32_t);
+
+	template <typename T>
+	static void Write(std::ofstream& file, const T& value)
+	{
+		file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+	}
+
+	template <typename T>
+	static bool Read(std::ifstream& file, T& value)
+	{
+		return static_cast<bool>(file.read(reinterpret_cast<char*>(&value), sizeof(T)));
+	}
+
+	//bitsets are written as 64 bit words, the layout of std::bitset is up to the compiler
+	template <size_t N>
+	static void WriteBits(std::ofstream& file, const std::bitset<N>& bits)
+	{
+		for (size_t word{}; word < (N + 63) / 64; word++) {
+			std::uint64_t value{};
+			for (size_t bit{}; bit < 64 && word * 64 + bit < N; bit++) {
+				if (bits.test(word * 64 + bit)) value |= std::uint64_t{ 1 } << bit;
+			}
+			Write(file, value);
+		}
+	}
+
+	template <size_t N>
+	static bool ReadBits(std::ifstream& file, std::bitset<N>& bits)
+	{
+		for (size_t word{}; word < (N + 63) / 64; word++) {
+			std::uint64_t value{};
+			if (!Read(file, value)) return false;
+			for (size_t bit{}; bit < 64 && word * 64 + bit < N; bit++) {
+				bits.set(word * 64 + bit, (value >> bit) & 1);
+			}
+		}
+		return true;
+	}
+
+	static void WriteFrame(std::ofstream& file, const InputFrame& frame)
+	{
+		WriteBits(file, frame.m_keys);
+		WriteBits(file, frame.m_taps);
+		WriteBits(file, frame.m_controllerButtons);
+		Write(file, frame.m_controllerAxes);
+		Write(file, frame.m_mousePosition.m_x);
+		Write(file, frame.m_mousePosition.m_y);
+		Write(file, frame.m_rightStickRotation);
+		Write(file, static_cast<std::uint8_t>(frame.m_controllerConnected));
+		Write(file, frame.m_deltaTime);
+		Write(file, frame.m_accumulatedTime);
+		Write(file, static_cast<std::int32_t>(frame.m_steps));
+	}
+
+	static bool ReadFrame(std::ifstream& file, InputFrame& frame)
+	{
+		std::uint8_t connected{};
+		std::int32_t steps{};
+		const bool read = ReadBits(file, frame.m_keys)
+			&& ReadBits(file, frame.m_taps)
+			&& ReadBits(file, frame.m_controllerButtons)
+			&& Read(file, frame.m_controllerAxes)
+			&& Read(file, frame.m_mousePosition.m_x)
+			&& Read(file, frame.m_mousePosition.m_y)
+			&& Read(file, frame.m_rightStickRotation)
+			&& Read(file, connected)
+			&& Read(file, frame.m_deltaTime)
+			&& Read(file, frame.m_accumulatedTime)
+			&& Read(file, steps);
+		frame.m_controllerConnected = connected != 0;
+		frame.m_steps = steps;
+		return read;
+	}
+
+	bool InputRecorder::m_StartRecording(const std::string& path, const std::string& startScene, std::uint32_t seed)
+	{
+		m_frames.clear();
+		m_cursor = 0;
+		m_recordedFrames = 0;
+		m_path = path;
+		m_startScene = startScene;
+		m_seed = seed;
+		m_recordedHash = 0;
+		m_hasHash = false;
+		m_replaying = false;
+		m_recording = false;
+
+		m_file.close();
+		m_file.clear();
+		m_file.open(path, std::ios::binary | std::ios::trunc);
+
+		Write(m_file, recordingMagic);
+		Write(m_file, recordingVersion);
+		Write(m_file, m_seed);
+		Write(m_file, unfinishedFrames);
+		Write(m_file, m_recordedHash);
+		Write(m_file, static_cast<std::uint32_t>(m_startScene.size()));
+		m_file.write(m_startScene.data(), m_startScene.size());
+		m_file.flush();
+
+		if (!m_file) {
+			LOGGING_ERROR("Failed to write input recording: {}", path);
+			m_file.close();
+			return false;
+		}
+
+		m_recording = true;
+		LOGGING_INFO("Recording input to {}, seed {}", path, m_seed);
+		return true;
+	}
+
+	void InputRecorder::m_Record(const InputFrame& frame)
+	{
+		if (!m_recording) return;
+
+		WriteFrame(m_file, frame);
+		m_recordedFrames++;
+
+		if (m_recordedFrames % flushInterval == 0) {
+			m_file.flush();
+		}
+	}
+
+	bool InputRecorder::m_StopRecording(std::uint64_t stateHash)
+	{
+		if (!m_recording) return false;
+		m_recording = false;
+		m_recordedHash = stateHash;
+		m_hasHash = true;
+
+		//the frames are already in the file, only the header is left
+		m_file.seekp(frameCountOffset);
+		Write(m_file, m_recordedFrames);
+		Write(m_file, m_recordedHash);
+		m_file.close();
+
+		if (m_file.fail()) {
+			LOGGING_ERROR("Failed to write input recording: {}", m_path);
+			return false;
+		}
+
+		LOGGING_INFO("Recorded {} frames of input to {}, state hash {}", m_recordedFrames, m_path, m_recordedHash);
+		return true;
+	}
+
+	bool InputRecorder::m_StartReplay(const std::string& path)
+	{
+		m_recording = false;
+		m_replaying = false;
+		m_frames.clear();
+		m_cursor = 0;
+		m_path = path;
+		m_hasHash = false;
+
+		std::ifstream file(path, std::ios::binary | std::ios::ate);
+		const std::streamoff fileSize = file ? static_cast<std::streamoff>(file.tellg()) : 0;
+		file.seekg(0);
+
+		std::uint32_t magic{}, version{}, frameCount{}, sceneLength{};
+		if (!file || !Read(file, magic) || !Read(file, version) || magic != recordingMagic || version != recordingVersion) {
+			LOGGING_ERROR("Not an input recording: {}", path);
+			return false;
+		}
+
+		if (!Read(file, m_seed) || !Read(file, frameCount) || !Read(file, m_recordedHash) || !Read(file, sceneLength)) {
+			LOGGING_ERROR("Input recording is truncated: {}", path);
+			return false;
+		}
+
+		//the sizes are checked against the file before anything is allocated
+		std::uint64_t remaining = static_cast<std::uint64_t>(fileSize - static_cast<std::streamoff>(file.tellg()));
+		if (sceneLength > remaining) {
+			LOGGING_ERROR("Input recording is corrupt, scene name of {} bytes in {} bytes: {}", sceneLength, remaining, path);
+			return false;
+		}
+		remaining -= sceneLength;
+
+		if (frameCount == unfinishedFrames) {
+			//a crash left the header unfinished, the last frame may be cut short
+			frameCount = static_cast<std::uint32_t>(remaining / frameBytes);
+			LOGGING_WARN("Input recording {} was not stopped, replaying its {} whole frames", path, frameCount);
+		}
+		else if (static_cast<std::uint64_t>(frameCount) * frameBytes > remaining) {
+			LOGGING_ERROR("Input recording is corrupt, {} frames in {} bytes: {}", frameCount, remaining, path);
+			return false;
+		}
+		else {
+			m_hasHash = true;
+		}
+
+		m_startScene.resize(sceneLength);
+		file.read(m_startScene.data(), sceneLength);
+
+		m_frames.resize(frameCount);
+		for (InputFrame& frame : m_frames) {
+			if (!ReadFrame(file, frame)) {
+				LOGGING_ERROR("Input recording is truncated: {}", path);
+				m_frames.clear();
+				return false;
+			}
+		}
+
+		m_replaying = true;
+		LOGGING_INFO("Replaying {} frames of input from {}, seed {}", m_frames.size(), path, m_seed);
+		return true;
+	}
+
+	bool InputRecorder::m_NextFrame(InputFrame& frame)
+	{
+		if (!m_replaying || m_cursor >= m_frames.size()) return false;
+
+		frame = m_frames[m_cursor++];
+		return true;
+	}
+
+	bool InputRecorder::m_StopReplay(std::uint64_t stateHash)
+	{
+		if (!m_replaying) return false;
+		m_replaying = false;
+
+		if (!m_hasHash) {
+			LOGGING_WARN("Replay of {} finished after {} frames, the recording has no state hash to compare", m_path, m_cursor);
+			return true;
+		}
+
+		if (stateHash != m_recordedHash) {
+			LOGGING_ERROR("Replay of {} diverged after {} frames, state hash {} but recorded {}", m_path, m_cursor, stateHash, m_recordedHash);
+			return false;
+		}
+
+		LOGGING_INFO("Replay of {} matched the recording after {} frames, state hash {}", m_path, m_cursor, stateHash);
+		return true;
+	}
+
+}
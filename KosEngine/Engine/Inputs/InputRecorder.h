@@ -0,0 +1,155 @@
+/******************************************************************/
+/*!
+\file      InputRecorder.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      April 10, 2025
+\brief     This file contains the InputFrame, the snapshot of the
+		   input the InputSystem takes once a frame, and the
+		   InputRecorder that saves those snapshots to a file and plays
+		   them back.
+
+		   A frame holds the keys held and the frame's clock, so a
+		   replay runs the same fixed steps with the same input as the
+		   recording, without a window or a device. The file also keeps
+		   the start scene, the seed of the engine's random numbers and
+		   the ECS state hash the recording ended on, a replay that
+		   ends on another hash diverged.
+
+		   The header is written when the recording starts and every
+		   frame is appended as it is recorded, so a session that
+		   crashed can still be replayed up to its last flushed frame.
+		   Only the frame count and the state hash are filled in when
+		   the recording stops.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#ifndef INPUTRECORDER_H
+#define INPUTRECORDER_H
+
+#include "Keycodes.h"
+#include "../Math/vector2.h"
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace Input {
+
+	struct InputFrame {
+		//keys and mouse buttons held when the frame started
+		std::bitset<keys::KEY_COUNT> m_keys{};
+		//pressed since the last frame, even if let go before it
+		std::bitset<keys::KEY_COUNT> m_taps{};
+		std::bitset<keys::CONTROLLER_BUTTON_COUNT> m_controllerButtons{};
+		std::array<float, 6> m_controllerAxes{};
+		vector2::Vec2 m_mousePosition{};
+		float m_rightStickRotation{ -1.f };
+		bool m_controllerConnected{ false };
+
+		//clock of the frame
+		float m_deltaTime{};
+		float m_accumulatedTime{};
+		int m_steps{};
+	};
+
+	class InputRecorder {
+
+	public:
+
+		/******************************************************************/
+		/*!
+			\fn        bool m_StartRecording(const std::string& path, const std::string& startScene, std::uint32_t seed)
+			\brief     Writes the header of the session to the path, the
+					   frames given to m_Record are appended after it.
+			\param[in] seed  Seed the engine's random numbers started
+							 from, a replay starts from the same one.
+			\return    False if the file could not be created.
+		*/
+		/******************************************************************/
+		bool m_StartRecording(const std::string& path, const std::string& startScene, std::uint32_t seed);
+
+		//appends the frame, the file is flushed every second of frames
+		void m_Record(const InputFrame& frame);
+
+		/******************************************************************/
+		/*!
+			\fn        bool m_StopRecording(std::uint64_t stateHash)
+			\brief     Fills in the frame count and the state hash the
+					   session ended on, and closes the file.
+			\return    False if the file could not be written.
+		*/
+		/******************************************************************/
+		bool m_StopRecording(std::uint64_t stateHash);
+
+		/******************************************************************/
+		/*!
+			\fn        bool m_StartReplay(const std::string& path)
+			\brief     Reads a recorded session, its frames are then
+					   handed out by m_NextFrame. A session that was never
+					   stopped is replayed up to its last whole frame.
+			\return    False if the file is missing, not a recording, or
+					   its sizes do not fit the file.
+		*/
+		/******************************************************************/
+		bool m_StartReplay(const std::string& path);
+
+		//false once every recorded frame was handed out
+		bool m_NextFrame(InputFrame& frame);
+
+		/******************************************************************/
+		/*!
+			\fn        bool m_StopReplay(std::uint64_t stateHash)
+			\brief     Ends the replay and compares the state hash it
+					   ended on with the recorded one.
+			\return    True if the replay ended on the recorded state, or
+					   the recording was never stopped and has no state
+					   to compare.
+		*/
+		/******************************************************************/
+		bool m_StopReplay(std::uint64_t stateHash);
+
+		bool m_IsRecording() const { return m_recording; }
+
+		bool m_IsReplaying() const { return m_replaying; }
+
+		//every frame was replayed, the state can be compared
+		bool m_IsReplayFinished() const { return m_replaying && m_cursor >= m_frames.size(); }
+
+		const std::string& m_GetStartScene() const { return m_startScene; }
+
+		std::uint32_t m_GetSeed() const { return m_seed; }
+
+		std::uint64_t m_GetRecordedHash() const { return m_recordedHash; }
+
+		size_t m_GetFrameCount() const { return m_frames.size(); }
+
+	private:
+
+		//frames of the replay
+		std::vector<InputFrame> m_frames;
+		size_t m_cursor{};
+
+		//open while recording
+		std::ofstream m_file;
+		std::uint32_t m_recordedFrames{};
+
+		std::string m_path;
+		std::string m_startScene;
+		std::uint32_t m_seed{};
+		std::uint64_t m_recordedHash{};
+		//false for a recording that was never stopped
+		bool m_hasHash{ false };
+
+		bool m_recording{ false };
+		bool m_replaying{ false };
+	};
+
+}
+
+#endif INPUTRECORDER_H
@@ -123,5 +123,9 @@ namespace keys {
 		RightControl = 345,
 		RightAlt = 346,
 
+		//sizes of the key and controller button sets, KEY_COUNT is GLFW_KEY_LAST + 1
+		KEY_COUNT = 349,
+		CONTROLLER_BUTTON_COUNT = 17,
+
     };
 }
\ No newline at end of file
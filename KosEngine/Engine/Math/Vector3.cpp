@@ -57,6 +57,9 @@ namespace vector3 {
     Vec3 Vec3::operator -() const {
         return Vec3(-m_x,-m_y,-m_z);
     }
+    bool Vec3::operator ==(const Vec3& rhs) const {
+        return m_x == rhs.m_x && m_y == rhs.m_y && m_z == rhs.m_z;
+    }
     void Vec3::m_Vec3Normalize(Vec3& pResult, const Vec3& pVec0) {
         float distance = m_Vec3Length(pVec0);
         pResult.m_x = pVec0.m_x / distance;
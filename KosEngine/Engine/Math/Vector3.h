@@ -43,6 +43,7 @@ namespace vector3 {
         Vec3& operator *= (float rhs);
         Vec3& operator /= (float rhs);
         Vec3  operator -() const;
+        bool operator ==(const Vec3& rhs) const;
         static void m_Vec3Normalize(Vec3& pResult, const Vec3& pVec0);
         static float m_Vec3Length(const Vec3& pVec0);
         static float m_Vec3SquareLength(const Vec3& pVec0);
@@ -77,6 +77,13 @@ namespace vector2 {
         Vec2 operator -() const;
         /******************************************************************/
         /*!
+        \fn        bool Vec2::operator == (const Vec2& rhs) const
+        \brief     Compares both components exactly.
+        */
+        /******************************************************************/
+        bool operator ==(const Vec2& rhs) const = default;
+        /******************************************************************/
+        /*!
         \fn        static void Vec2::m_funcVec2Normalize(Vec2& pResult, const Vec2& pVec0)
         \brief     Normalizes the given vector and stores the result in pResult.
         \param[out] pResult  The vector to store the normalized result.
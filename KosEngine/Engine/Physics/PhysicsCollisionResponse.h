@@ -35,6 +35,8 @@ namespace physicspipe {
 			m_contactPointEnt.second = inID;
 			m_numOfContacts = inNum;
 		}
+
+		bool operator==(const CollisionResponseData&) const = default;
 	};
 
 	/******************************************************************/
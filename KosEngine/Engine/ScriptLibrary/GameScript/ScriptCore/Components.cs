@@ -58,6 +58,15 @@ public class TransformComponent
     public Vector2 m_scale;
 }
 
+// blittable, matches script::TransformData so arrays are passed to the engine without copying
+[StructLayout(LayoutKind.Sequential)]
+public struct TransformData
+{
+    public Vector2 m_position;
+    public Vector2 m_scale;
+    public float m_rotation;
+}
+
 public class RigidBodyComponent
 {
     public Vector2 m_Velocity;
@@ -17,6 +17,12 @@ public static class InternalCall
     [MethodImpl(MethodImplOptions.InternalCall)]
     public extern static bool m_InternalSetTransformComponent(uint entity, in Vector2 pos, in Vector2 scale, in float rotate);
 
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public extern static int m_InternalGetTransformComponents(uint[] entities, TransformData[] transforms, int count);
+
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public extern static int m_InternalSetTransformComponents(uint[] entities, TransformData[] transforms, int count);
+
     [MethodImpl(MethodImplOptions.InternalCall)]
     public extern static bool m_InternalGetTranslate(uint entity, out Vector2 pos);
 
@@ -95,9 +101,18 @@ public static class InternalCall
     [MethodImpl(MethodImplOptions.InternalCall)]
     public extern static int[] m_InternalCallGetTagIDs(string tag);
 
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public extern static int m_InternalCallGetTagHandle(string tag);
+
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public extern static int m_InternalCallGetTagIDsNonAlloc(int tag, int[] results);
+
     [MethodImpl(MethodImplOptions.InternalCall)]
     public extern static int[] m_InternalCallGetCollidedEntities(uint entity);
 
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public extern static int m_InternalCallGetCollidedEntitiesNonAlloc(uint entity, int[] results);
+
     [MethodImpl(MethodImplOptions.InternalCall)]
     public extern static string m_InternalCallGetTag(uint entity);
 
@@ -110,12 +125,37 @@ public static class InternalCall
     [MethodImpl(MethodImplOptions.InternalCall)]
     public extern static void m_InternalCallLoadScene(string path);
 
+    // loads the scene over several frames, poll the progress to know when it is ready
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public extern static void m_InternalCallLoadSceneAsync(string path);
+
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public extern static float m_InternalCallGetSceneLoadProgress(string path);
+
     [MethodImpl(MethodImplOptions.InternalCall)]
     public extern static int m_InternalCallAddPrefab(string prefab, in float x, in float y, in float degree);
 
     [MethodImpl(MethodImplOptions.InternalCall)]
     public extern static void m_InternalCallDeleteEntity(uint id);
 
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public extern static int m_InternalCallPrewarmPrefab(string prefab, int count);
+
+    // reuses a released instance, Awake and Start run again but non serialized fields keep their values
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public extern static int m_InternalCallAcquirePrefab(string prefab, in float x, in float y, in float degree);
+
+    // parks an acquired instance, deletes any other entity
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public extern static bool m_InternalCallReleaseEntity(uint id);
+
+    // keeps the scene in memory, restoring it is much faster than loading its json again
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public extern static bool m_InternalCallSaveSnapshot(string name, string scene);
+
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    public extern static void m_InternalCallRestoreSnapshot(string name);
+
     [MethodImpl(MethodImplOptions.InternalCall)]
     public extern static bool m_InternalCallIsKeyPressed(keyCode key);
 
@@ -370,6 +410,9 @@ public static class InternalCall
     [MethodImpl(MethodImplOptions.InternalCall)]
     static public extern int m_GetRandomInt(int min, int max);
 
+    [MethodImpl(MethodImplOptions.InternalCall)]
+    static public extern void m_InternalCallLogError(string message);
+
     [MethodImpl(MethodImplOptions.InternalCall)]
     static public extern string m_GetScenefromID(uint id);
 
@@ -613,3 +656,91 @@ public static class SetComponent
         InternalCall.m_InternalSetTextComponent(id, text.m_text, text.m_fileName, in text.m_fontLayer, in text.m_fontSize, in text.m_color);
     }
 }
+
+// reads and writes the transforms of many entities with one call into the engine,
+// the buffers are kept between frames so a crowd does not allocate every update
+public class TransformBatch
+{
+    public uint[] m_entities;
+    public TransformData[] m_transforms;
+    public int m_count;
+
+    public TransformBatch(int capacity = 64)
+    {
+        m_entities = new uint[capacity];
+        m_transforms = new TransformData[capacity];
+    }
+
+    public void Clear()
+    {
+        m_count = 0;
+    }
+
+    public int Add(uint id)
+    {
+        if (m_count == m_entities.Length)
+        {
+            // a batch made with capacity 0 would otherwise stay empty
+            int capacity = Math.Max(4, m_count * 2);
+            Array.Resize(ref m_entities, capacity);
+            Array.Resize(ref m_transforms, capacity);
+        }
+
+        m_entities[m_count] = id;
+        return m_count++;
+    }
+
+    public int Read()
+    {
+        return InternalCall.m_InternalGetTransformComponents(m_entities, m_transforms, m_count);
+    }
+
+    public int Write()
+    {
+        return InternalCall.m_InternalSetTransformComponents(m_entities, m_transforms, m_count);
+    }
+}
+
+// entities with a tag, looked up by the interned tag ID into a buffer kept between frames
+public class TaggedEntities
+{
+    public int m_tag;
+    public int[] m_entities;
+    public int m_count;
+
+    public TaggedEntities(string tag, int capacity = 64)
+    {
+        m_tag = InternalCall.m_InternalCallGetTagHandle(tag);
+        m_entities = new int[capacity];
+    }
+
+    public int Refresh()
+    {
+        m_count = InternalCall.m_InternalCallGetTagIDsNonAlloc(m_tag, m_entities);
+        if (m_count > m_entities.Length)
+        {
+            m_entities = new int[m_count * 2];
+            m_count = InternalCall.m_InternalCallGetTagIDsNonAlloc(m_tag, m_entities);
+        }
+
+        return m_count;
+    }
+}
+
+public static class CollidedEntities
+{
+    // fills the buffer, growing it if it is too small, returns the number of entities
+    public static int Get(uint id, ref int[] buffer)
+    {
+        if (buffer == null) buffer = new int[8];
+
+        int count = InternalCall.m_InternalCallGetCollidedEntitiesNonAlloc(id, buffer);
+        if (count > buffer.Length)
+        {
+            buffer = new int[count * 2];
+            count = InternalCall.m_InternalCallGetCollidedEntitiesNonAlloc(id, buffer);
+        }
+
+        return count;
+    }
+}
@@ -9,4 +9,7 @@ public class ScriptBase
     public virtual void Awake(uint id) { }
     public virtual void Start() { }
     public virtual void Update() { }
+
+    // set by ScriptScheduler the first time it runs the script
+    internal ScriptScheduler.Callbacks m_schedulerCallbacks;
 }
\ No newline at end of file
@@ -0,0 +1,148 @@
+using System;
+using System.Collections.Generic;
+using System.Reflection;
+
+// runs the Start, Update and LateUpdate of every script with one call from the engine a frame,
+// instead of one call into C# per script per callback
+public static class ScriptScheduler
+{
+    // callbacks a script class declares, same lookup as the engine, which only takes
+    // methods declared by the class itself
+    internal class Callbacks
+    {
+        // overrides of ScriptBase are called directly
+        public bool m_virtualStart;
+        public bool m_virtualUpdate;
+
+        // null if the class does not declare the callback
+        public Action<object> m_start;
+        public Action<object> m_update;
+        public Action<object> m_lateUpdate;
+    }
+
+    static readonly Dictionary<Type, Callbacks> s_callbacks = new Dictionary<Type, Callbacks>();
+
+    const BindingFlags CallbackFlags = BindingFlags.Instance | BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.DeclaredOnly;
+
+    // values of the start flags other than 0 for Update, same as ScriptHandler
+    const byte StartFlag = 1;
+    // set by the engine while running when the script's entity is destroyed
+    const byte SkipFlag = 2;
+
+    // phases of Run, same as ScriptHandler. The engine runs the Update phase of every
+    // group of the frame before the LateUpdate phase of any of them
+    const int UpdatePhase = 0;
+    const int LateUpdatePhase = 1;
+
+    // called by the engine for the scripts from first to first + count, start[i] tells if
+    // the script runs Start or Update. The engine keeps the arrays between frames and only
+    // writes the entries that changed, so they are not cleared here
+    public static void Run(object[] scripts, byte[] start, int first, int count, int phase)
+    {
+        if (phase == LateUpdatePhase)
+        {
+            RunLateUpdate(scripts, start, first, first + count);
+        }
+        else
+        {
+            RunUpdate(scripts, start, first, first + count);
+        }
+    }
+
+    static void RunUpdate(object[] scripts, byte[] start, int first, int end)
+    {
+        for (int i = first; i < end; i++)
+        {
+            object script = scripts[i];
+            if (script == null || start[i] == SkipFlag) continue;
+
+            Callbacks callbacks = GetCallbacks(script);
+            try
+            {
+                if (start[i] == StartFlag)
+                {
+                    if (callbacks.m_virtualStart) ((ScriptBase)script).Start();
+                    else if (callbacks.m_start != null) callbacks.m_start(script);
+                }
+                else
+                {
+                    if (callbacks.m_virtualUpdate) ((ScriptBase)script).Update();
+                    else if (callbacks.m_update != null) callbacks.m_update(script);
+                }
+            }
+            catch (Exception e)
+            {
+                Report(script, start[i] == StartFlag ? "Start" : "Update", e);
+            }
+        }
+    }
+
+    static void RunLateUpdate(object[] scripts, byte[] start, int first, int end)
+    {
+        for (int i = first; i < end; i++)
+        {
+            object script = scripts[i];
+            if (script == null || start[i] == SkipFlag) continue;
+
+            Action<object> lateUpdate = GetCallbacks(script).m_lateUpdate;
+            if (lateUpdate == null) continue;
+
+            try
+            {
+                lateUpdate(script);
+            }
+            catch (Exception e)
+            {
+                Report(script, "LateUpdate", e);
+            }
+        }
+    }
+
+    static void Report(object script, string callback, Exception e)
+    {
+        InternalCall.m_InternalCallLogError($"Script Exception Occured in {script.GetType().Name}.{callback}: {e}");
+    }
+
+    static Callbacks GetCallbacks(object script)
+    {
+        ScriptBase scriptBase = script as ScriptBase;
+        if (scriptBase != null && scriptBase.m_schedulerCallbacks != null) return scriptBase.m_schedulerCallbacks;
+
+        Type type = script.GetType();
+        Callbacks callbacks;
+        if (!s_callbacks.TryGetValue(type, out callbacks))
+        {
+            callbacks = new Callbacks();
+            callbacks.m_start = Bind(type, "Start", out callbacks.m_virtualStart);
+            callbacks.m_update = Bind(type, "Update", out callbacks.m_virtualUpdate);
+
+            bool virtualLateUpdate;
+            callbacks.m_lateUpdate = Bind(type, "LateUpdate", out virtualLateUpdate);
+            s_callbacks.Add(type, callbacks);
+        }
+
+        if (scriptBase != null) scriptBase.m_schedulerCallbacks = callbacks;
+        return callbacks;
+    }
+
+    static Action<object> Bind(Type type, string name, out bool isVirtual)
+    {
+        isVirtual = false;
+
+        MethodInfo method = type.GetMethod(name, CallbackFlags, null, Type.EmptyTypes, null);
+        if (method == null || method.ReturnType != typeof(void) || type.IsValueType) return null;
+
+        // an override of ScriptBase's callback is reached through a virtual call
+        isVirtual = method.GetBaseDefinition().DeclaringType == typeof(ScriptBase);
+
+        // otherwise a typed delegate is called directly, without reflection every frame
+        MethodInfo bind = typeof(ScriptScheduler).GetMethod("BindTyped", BindingFlags.Static | BindingFlags.NonPublic).MakeGenericMethod(type);
+        return (Action<object>)bind.Invoke(null, new object[] { method });
+    }
+
+    static Action<object> BindTyped<T>(MethodInfo method) where T : class
+    {
+        Action<T> call = (Action<T>)Delegate.CreateDelegate(typeof(Action<T>), method);
+        return script => call((T)script);
+    }
+}
@@ -57,6 +57,9 @@ namespace Application {
         Serialization::Serialize::m_LoadConfig("../configs");
         LOGGING_INFO("Load Config Successful");
 
+        //the editor always draws, headless runs are for the game build
+        Helper::Helpers::GetInstance()->m_headless = false;
+
        /*--------------------------------------------------------------
           INITIALIZE OPENGL WINDOW
        --------------------------------------------------------------*/
@@ -80,6 +83,9 @@ namespace Application {
         scenemanager->m_LoadScene(Helper::Helpers::GetInstance()->m_startScene);
         LOGGING_INFO("Load Asset Successful");
 
+        //hot reload assets changed on disk
+        AstManager->m_assetWatcher.m_Start(filePath[1]);
+
 
         /*--------------------------------------------------------------
            INITIALIZE GRAPHICS PIPE
@@ -146,6 +152,21 @@ namespace Application {
                     ++help->currentNumberOfSteps;
                 }
                 
+                /*--------------------------------------------------------------
+                    FINISH SCENE SAVES
+                --------------------------------------------------------------*/
+                scenes::SceneManager::m_GetInstance()->m_UpdateSaving();
+
+                /*--------------------------------------------------------------
+                    HOT RELOAD ASSETS
+                --------------------------------------------------------------*/
+                AstManager->m_assetWatcher.m_ProcessChanges();
+
+                /*--------------------------------------------------------------
+                    STREAM SCENES
+                --------------------------------------------------------------*/
+                scenes::SceneManager::m_GetInstance()->m_UpdateStreaming();
+
                 /*--------------------------------------------------------------
                     UPDATE INPUT
                 --------------------------------------------------------------*/
@@ -217,6 +238,7 @@ namespace Application {
 
 
 	int Application::m_Cleanup() {
+        AstManager->m_assetWatcher.m_Stop();
         ecs::ECS::m_GetInstance()->m_Unload();
         Editor.m_Shutdown();
 
@@ -263,6 +263,7 @@ namespace gui {
 			if (ecs->m_ECS_EntityMap.find(m_clickedEntityId) == ecs->m_ECS_EntityMap.end()) {
 				m_clickedEntityId = -1;
 			}
+			const int selectedEntityId = m_clickedEntityId;
 
 
 			ImVec2 windowSize = ImGui::GetIO().DisplaySize;
@@ -289,6 +290,15 @@ namespace gui {
 				m_DrawPerformanceWindow(help->m_fps);
 			}
 
+			//the panels write component fields directly, the entity selected
+			//before and after this frame's edits are saved again
+			if (selectedEntityId >= 0) {
+				ecs->m_MarkDirty(static_cast<ecs::EntityID>(selectedEntityId));
+			}
+			if (m_clickedEntityId >= 0 && m_clickedEntityId != selectedEntityId) {
+				ecs->m_MarkDirty(static_cast<ecs::EntityID>(m_clickedEntityId));
+			}
+
 			
 			if (Input::InputSystem::m_isKeyPressed(keys::LeftControl) && Input::InputSystem::m_isKeyTriggered(keys::Z)) {
 				events::UndoLatest temp;
@@ -37,5 +37,21 @@ void gui::ImGuiHandler::m_DrawInputWindow() {
 	std::string mouseStatus = "MouseButton Status: " + Input::InputSystem::m_mouseString;
 	ImGui::Text(mouseStatus.c_str());
 
+	//newest events first
+	if (ImGui::CollapsingHeader("Events")) {
+		static const char* actions[] = { "released", "pressed", "repeated" };
+		const Input::InputEventBuffer& events = Input::InputSystem::m_getEvents();
+		for (size_t n = events.m_Size(); n > 0; n--) {
+			const Input::InputEvent& event = events[n - 1];
+			if (event.m_type == Input::INPUTMOUSEMOVE) {
+				ImGui::Text("%.3f  frame %u  mouse (%d, %d)", event.m_time, event.m_frame, static_cast<int>(event.m_position.m_x), static_cast<int>(event.m_position.m_y));
+			}
+			else {
+				const char* action = event.m_action >= 0 && event.m_action <= 2 ? actions[event.m_action] : "-";
+				ImGui::Text("%.3f  frame %u  %s %d %s", event.m_time, event.m_frame, event.m_type == Input::INPUTKEY ? "key" : "mouse button", event.m_code, action);
+			}
+		}
+	}
+
 	ImGui::End();
 }
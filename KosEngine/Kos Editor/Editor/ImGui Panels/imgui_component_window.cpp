@@ -618,6 +618,9 @@ void gui::ImGuiHandler::m_DrawComponentWindow()
                 }
 
             }
+            //gameplay critical entities are updated every frame far from the camera
+            ImGui::SameLine();
+            ImGui::Checkbox("Full Tick Rate", &nc->m_fullTickRate);
 
             //layer selector
             const char* layers[] = { ecs->m_layersStack.m_layerMap[layer::DEFAULT].first.c_str(), ecs->m_layersStack.m_layerMap[layer::LAYER1].first.c_str(),ecs->m_layersStack.m_layerMap[layer::LAYER2].first.c_str(),
@@ -657,6 +660,7 @@ void gui::ImGuiHandler::m_DrawComponentWindow()
             
             if (ImGui::Combo("Tag", &item, tag_Names.data(), static_cast<int>(tag_Names.size()))) {
                 nc->m_entityTag = m_tags[item];
+                ecs->m_UpdateTag(entityID);
                 events::ModifyName action(ecs::TYPENAMECOMPONENT, entityID, nc, oldValN);
                 ////DISPATCH_ACTION_EVENT(action);
                 oldValN = *nc;
@@ -2124,11 +2128,7 @@ void gui::ImGuiHandler::m_DrawComponentWindow()
                                 bool isPaused = false;
                                 auto& audioManager = assetManager->m_audioManager;
                                 if (audioManager.getSoundMap().find(it2->m_Name) != audioManager.getSoundMap().end()) {
-                                    auto& sound = audioManager.getSoundMap()[it2->m_Name];
-
-                                    if (sound->m_GetChannelForEntity(entityID)) {
-                                        sound->m_GetChannelForEntity(entityID)->getPaused(&isPaused);
-                                    }
+                                    isPaused = audioManager.m_IsPausedForEntity(entityID, it2->m_Name);
 
                                     if (ImGui::Checkbox("Pause Sound", &isPaused)) {
                                         if (isPaused) {
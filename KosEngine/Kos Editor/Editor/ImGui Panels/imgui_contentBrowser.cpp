@@ -90,7 +90,8 @@ namespace gui {
 		{
 			ImGui::BeginChild("ChildL", ImVec2(ImGui::GetContentRegionAvail().x * 0.2f, ImGui::GetContentRegionAvail().y), ImGuiChildFlags_Border);
 			static bool isSelected{ false };
-			for (auto& directoryPath : std::filesystem::directory_iterator(assetDirectory)) {
+			//cached index, updated by the asset watcher
+			for (auto& directoryPath : assetmanager->m_assetWatcher.m_GetDirectoryEntries(assetDirectory)) {
 				std::string directoryString = directoryPath.path().filename().string();
 				isSelected = ImGui::Selectable(directoryString.c_str());
 				MoveFolder(assetDirectory/directoryPath.path().filename());
@@ -149,6 +150,9 @@ namespace gui {
 				if (ImGui::MenuItem("Reload Browser")) {
 					assetmanager::AssetManager* AstManager = assetmanager::AssetManager::m_funcGetInstance();
 					AstManager->m_funcLoadAssets(assetDirectory.string());
+					//rebuild the index in case the watcher missed a change
+					AstManager->m_assetWatcher.m_Stop();
+					AstManager->m_assetWatcher.m_Start(assetDirectory);
 				}
 				ImGui::EndPopup();
 			}
@@ -196,7 +200,7 @@ namespace gui {
 
 
 
-			for (auto& directoryPath : std::filesystem::directory_iterator(currentDirectory)) {
+			for (auto& directoryPath : assetmanager->m_assetWatcher.m_GetDirectoryEntries(currentDirectory)) {
 				std::string directoryString = directoryPath.path().filename().string();
 
 				if (!searchString.empty() && !containsSubstring(directoryString, searchString)) {
@@ -444,8 +448,17 @@ namespace gui {
 							// Copy directory and all contents recursively
 							std::filesystem::copy(source, destination, std::filesystem::copy_options::recursive);
 
-							//load new asset
-							assetmanager->m_LoadAsset(destination/source.filename());
+							//load new asset, a directory was copied into destination itself
+							const std::filesystem::path copied = std::filesystem::is_directory(source) ? destination : destination / source.filename();
+							if (std::filesystem::is_directory(copied)) {
+								assetmanager->m_funcLoadAssets(copied.string());
+							}
+							else {
+								assetmanager->m_LoadAsset(copied);
+							}
+
+							//already loaded, the asset watcher must not load the copy again
+							assetmanager->m_assetWatcher.m_SuppressPath(copied);
 						}
 
 					}
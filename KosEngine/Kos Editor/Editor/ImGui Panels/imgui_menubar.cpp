@@ -22,6 +22,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "imgui_internal.h"
 
 #include "Asset Manager/SceneManager.h"
+#include "Asset Manager/AssetPack.h"
 #include "ECS/ECS.h"
 
 #include "Editor/WindowFile.h"
@@ -96,6 +97,12 @@ void gui::ImGuiHandler::m_DrawMainMenuBar() {
 
             }
 
+            if (ImGui::MenuItem("Pack Assets")) {
+                //shipped builds mount <asset directory>.kpak
+                std::string assetDirectory = Serialization::Serialize::m_LoadFilePath("../configs")[1];
+                assetmanager::AssetPacker::m_PackDirectory(assetDirectory, assetDirectory + ".kpak");
+            }
+
             ImGui::EndMenu();
         }
 
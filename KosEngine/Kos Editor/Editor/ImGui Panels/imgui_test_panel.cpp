@@ -39,8 +39,13 @@ void gui::ImGuiHandler::m_DrawTestWindow() {
 	//assetmanager::AssetManager* assetManager = assetmanager::AssetManager::m_funcGetInstance();
 	logging::Logger log;
 
-	messaging::MessageSystem MsgSys;
-	MsgSys.m_AddListener(messaging::MessageType::AUDIOPLAY, messaging::SoundPlayed);
+	//kept between frames, its listeners are added once
+	static messaging::MessageSystem MsgSys;
+	static bool msgListening = false;
+	if (!msgListening) {
+		MsgSys.m_AddListener(messaging::MessageType::AUDIOPLAY, messaging::SoundPlayed);
+		msgListening = true;
+	}
 	bool open = true;
 	ImGui::Begin("Test Window", &open);
 	ImGui::SeparatorText(" AUDIO ");
@@ -29,6 +29,7 @@ prior written consent of DigiPen Institute of Technology is prohibited.
 #include "Events/EventsEventHandler.h"
 #include "Actions/ActionManager.h"
 #include "Inputs/Input.h"
+#include "Debugging/SimulationReport.h"
 
 
 namespace Application {
@@ -59,11 +60,40 @@ namespace Application {
         Serialization::Serialize::m_LoadConfig("../configs");
         LOGGING_INFO("Load Config Successful");
 
+        /*--------------------------------------------------------------
+           RECORD OR REPLAY INPUT
+        --------------------------------------------------------------*/
+        Helper::Helpers* help = Helper::Helpers::GetInstance();
+        //headless runs always draw the same numbers, so two runs can be compared
+        std::uint32_t seed = help->m_headless ? 0u : std::random_device{}();
+        if (!help->m_replayInputPath.empty()) {
+            //a session is replayed from the scene and random numbers it was recorded with
+            if (Input.m_recorder.m_StartReplay(help->m_replayInputPath)) {
+                help->m_startScene = Input.m_recorder.m_GetStartScene();
+                seed = Input.m_recorder.m_GetSeed();
+            }
+        }
+        else if (!help->m_recordInputPath.empty() && !help->m_headless) {
+            Input.m_recorder.m_StartRecording(help->m_recordInputPath, help->m_startScene, seed);
+        }
+        help->m_random.seed(seed);
+
        /*--------------------------------------------------------------
           INITIALIZE OPENGL WINDOW
        --------------------------------------------------------------*/
-        lvWindow.init();
-        LOGGING_INFO("Load Window Successful");
+        if (help->m_headless) {
+            //no window, the systems read the config's size as if it were one
+            help->m_currWindowWidth = static_cast<int>(help->m_windowWidth);
+            help->m_currWindowHeight = static_cast<int>(help->m_windowHeight);
+            help->m_viewportOffsetX = 0;
+            help->m_viewportOffsetY = 0;
+            help->m_windowScalar = help->m_windowHeight / 1080.f;
+            LOGGING_INFO("Running Headless");
+        }
+        else {
+            lvWindow.init();
+            LOGGING_INFO("Load Window Successful");
+        }
 
         /*--------------------------------------------------------------
            INITIALIZE ECS
@@ -77,9 +107,25 @@ namespace Application {
            INITIALIZE Asset Manager
         --------------------------------------------------------------*/
         AstManager = assetmanager::AssetManager::m_funcGetInstance();
+
+        //shipped builds read from the packed archive, loose files still override it
+        std::filesystem::path assetPack = std::filesystem::path(filePath[1]).lexically_normal();
+        if (!assetPack.has_filename()) assetPack = assetPack.parent_path();
+        assetPack += ".kpak";
+        if (std::filesystem::exists(assetPack)) {
+            assetmanager::VirtualFileSystem::m_GetInstance()->m_Mount(assetPack, filePath[1]);
+        }
+
+        //headless runs play every sound on a backend without a device
+        if (help->m_headless) {
+            AstManager->m_audioManager.m_SetBackend(std::make_unique<fmodaudio::NullAudioBackend>());
+        }
+
+        //only load the assets the running scenes need
+        AstManager->m_residency.m_Enable(true);
         AstManager->m_funcLoadAssets(filePath[1]);
         scenes::SceneManager* scenemanager = scenes::SceneManager::m_GetInstance();
-        scenemanager->m_LoadScene(Helper::Helpers::GetInstance()->m_startScene);
+        scenemanager->m_LoadScene(help->m_startScene);
         LOGGING_INFO("Load Asset Successful");
 
 
@@ -87,15 +133,17 @@ namespace Application {
            INITIALIZE GRAPHICS PIPE
         --------------------------------------------------------------*/
         pipe = graphicpipe::GraphicsPipe::m_funcGetInstance();
-        pipe->m_funcInit();
-        LOGGING_INFO("Load Graphic Pipline Successful");
-
-        /*--------------------------------------------------------------
-           INITIALIZE Input
-        --------------------------------------------------------------*/
-        //call back must happen before imgui
-        Input.SetCallBack(lvWindow.m_window);
-        LOGGING_INFO("Set Input Call Back Successful");
+        if (!help->m_headless) {
+            pipe->m_funcInit();
+            LOGGING_INFO("Load Graphic Pipline Successful");
+
+            /*--------------------------------------------------------------
+               INITIALIZE Input
+            --------------------------------------------------------------*/
+            //call back must happen before imgui
+            Input.SetCallBack(lvWindow.m_window);
+            LOGGING_INFO("Set Input Call Back Successful");
+        }
 
         
 
@@ -149,6 +197,16 @@ namespace Application {
                 --------------------------------------------------------------*/
                 Input.m_inputUpdate();
 
+                /*--------------------------------------------------------------
+                    STREAM SCENES
+                --------------------------------------------------------------*/
+                scenes::SceneManager::m_GetInstance()->m_UpdateStreaming();
+
+                /*--------------------------------------------------------------
+                    FINISH SCENE SAVES
+                --------------------------------------------------------------*/
+                scenes::SceneManager::m_GetInstance()->m_UpdateSaving();
+
                 /*--------------------------------------------------------------
                     UPDATE ECS
                 --------------------------------------------------------------*/
@@ -156,6 +214,15 @@ namespace Application {
                 ecs->m_Update(help->m_fixedDeltaTime * help->m_timeScale);
                 //ecs->m_Update(Helper::Helpers::GetInstance()->m_deltaTime);
 
+                //evict assets the scenes no longer use
+                AstManager->m_residency.m_Update(help->m_deltaTime);
+
+                //a replay ends on its last recorded frame
+                if (Input.m_recorder.m_IsReplayFinished()) {
+                    Input.m_recorder.m_StopReplay(ecs->m_ComputeStateHash());
+                    glfwSetWindowShouldClose(lvWindow.m_window, GLFW_TRUE);
+                }
+
 
                 /*--------------------------------------------------------------
                     UPDATE Render Pipeline
@@ -193,11 +260,101 @@ namespace Application {
 
 
 
+    int Application::RunHeadless() {
+        Helper::Helpers* help = Helper::Helpers::GetInstance();
+        ecs::ECS* ecs = ecs::ECS::m_GetInstance();
+        scenes::SceneManager* scenemanager = scenes::SceneManager::m_GetInstance();
+        actions::ActionManager::m_GetManagerInstance();
+        const double fixedDeltaTime = 1.0 / 60.0;
+        help->m_fixedDeltaTime = static_cast<float>(fixedDeltaTime);
+        ecs->m_DeltaTime = static_cast<float>(fixedDeltaTime);
+        help->m_accumulatedTime = 0.0;
+
+        //a replay runs for as long as it was recorded
+        const size_t frames = Input.m_recorder.m_IsReplaying() ? Input.m_recorder.m_GetFrameCount()
+            : static_cast<size_t>((std::max)(help->m_headlessFrames, 0));
+        if (frames == 0) {
+            LOGGING_ERROR("Headless run has no frames to simulate, set Headless: <frames> or ReplayInput:");
+            return 1;
+        }
+
+        performancetracker::SimulationReport report;
+        report.m_Begin(frames);
+
+        /*--------------------------------------------------------------
+            SIMULATION LOOP
+        --------------------------------------------------------------*/
+        //frames run back to back, each as if 1/60 of a second had passed
+        for (size_t frame{}; frame < frames && !help->m_closeWindow; frame++)
+        {
+            try {
+                const auto frameStart = std::chrono::steady_clock::now();
+
+                help->m_deltaTime = static_cast<float>(fixedDeltaTime);
+                help->m_accumulatedTime += (help->m_deltaTime * help->m_timeScale);
+                help->currentNumberOfSteps = 0;
+                while (help->m_accumulatedTime >= fixedDeltaTime) {
+                    help->m_accumulatedTime -= static_cast<float>(fixedDeltaTime);
+                    ++help->currentNumberOfSteps;
+                }
+
+                //replays the recorded input and clock, otherwise nothing is held
+                Input.m_inputUpdate();
+
+                scenemanager->m_UpdateStreaming();
+                scenemanager->m_UpdateSaving();
+
+                ecs->m_Update(help->m_fixedDeltaTime * help->m_timeScale);
+
+                AstManager->m_residency.m_Update(help->m_deltaTime);
+
+                //camera only, the collected draw data is dropped
+                pipe->m_funcUpdate();
+                pipe->m_funcRenderGameScene();
+
+                const std::chrono::duration<float> frameTime = std::chrono::steady_clock::now() - frameStart;
+                report.m_EndFrame(frameTime.count(), help->currentNumberOfSteps * help->m_fixedDeltaTime);
+            }
+            catch (const std::exception& e) {
+                LOGGING_ERROR("Exception in headless loop: {}", e.what());
+            }
+        }
+
+        const std::uint64_t stateHash = ecs->m_ComputeStateHash();
+        bool matched = true;
+        if (Input.m_recorder.m_IsReplaying()) {
+            matched = Input.m_recorder.m_StopReplay(stateHash);
+        }
+
+        const std::string text = report.m_ToString(stateHash);
+        std::cout << text;
+        LOGGING_INFO("Headless run finished\n{}", text);
+
+        if (!help->m_headlessReportPath.empty()) {
+            std::ofstream file(help->m_headlessReportPath, std::ios::trunc);
+            file << text;
+            if (!file) {
+                LOGGING_ERROR("Failed to write headless report: {}", help->m_headlessReportPath);
+            }
+        }
+
+        //a diverged replay fails the run
+        return matched ? 0 : 1;
+    }
+
+
+
 	int Application::m_Cleanup() {
+        if (Input.m_recorder.m_IsRecording()) {
+            Input.m_recorder.m_StopRecording(ecs::ECS::m_GetInstance()->m_ComputeStateHash());
+        }
         ecs::ECS::m_GetInstance()->m_Unload();
+        assetmanager::VirtualFileSystem::m_GetInstance()->m_Unmount();
 
-        lvWindow.CleanUp();
-        glfwTerminate();
+        if (!Helper::Helpers::GetInstance()->m_headless) {
+            lvWindow.CleanUp();
+            glfwTerminate();
+        }
         LOGGING_INFO("Application Closed");
 
         return 0;
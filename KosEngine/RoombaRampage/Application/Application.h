@@ -58,6 +58,18 @@ namespace Application {
 		*/
 		/******************************************************************/
 		int Run();
+
+		/******************************************************************/
+		/*!
+		\fn        RunHeadless()
+		\brief     Runs the fixed step loop without a window, GL context or
+				   audio device for the frames set in the config, or the
+				   length of the replayed input, then prints the frame and
+				   system timings with the final state hash.
+		\return    1 if a replay diverged or there was nothing to run.
+		*/
+		/******************************************************************/
+		int RunHeadless();
 		/******************************************************************/
 		/*!
 		\fn        m_Cleanup()
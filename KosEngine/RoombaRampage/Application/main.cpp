@@ -32,12 +32,13 @@ int WINAPI WinMain([[maybe_unused]] HINSTANCE hInstance, [[maybe_unused]] HINSTA
         app.Init();
        
 
-        app.Run();
+        //headless runs exit with a failure when a replay diverged
+        const int result = Helper::Helpers::GetInstance()->m_headless ? app.RunHeadless() : app.Run();
 
         app.m_Cleanup();
 
 
 
 
-        return 0;
+        return result;
     } 
\ No newline at end of file
@@ -0,0 +1,101 @@
+/******************************************************************/
+/*!
+\file      AssetHandleTests.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      April 24, 2025
+\brief     This file contains the tests of the AssetHandleTable.
+
+		   A handle is looked up again only when the component's name
+		   changes or the asset is reloaded or unloaded. A name that
+		   is not loaded asks m_onMiss once, not every frame.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include "TestFramework.h"
+#include "Asset Manager/AssetHandle.h"
+
+using assetmanager::AssetHandle;
+using assetmanager::AssetHandleTable;
+
+TEST(AssetHandle_ResolvesAgainOnlyWhenTheNameOrAssetChanges)
+{
+	std::unordered_map<std::string, int> assets{ { "player.png", 1 }, { "enemy.png", 2 } };
+	AssetHandleTable<int> table;
+	table.m_Register("player.png", &assets["player.png"]);
+	table.m_Register("enemy.png", &assets["enemy.png"]);
+
+	int misses{};
+	table.m_onMiss = [&misses](const std::string&) { misses++; return false; };
+
+	std::string name = "player.png";
+	AssetHandle handle;
+	for (int frame{}; frame < 100; frame++) {
+		CHECK(table.m_Resolve(name, handle) == &assets["player.png"]);
+	}
+	const AssetHandle first = handle;
+
+	//edited in the inspector
+	name = "enemy.png";
+	CHECK(table.m_Resolve(name, handle) == &assets["enemy.png"]);
+	CHECK(handle != first);
+	CHECK(misses == 0);
+
+	//a reload makes the old handle stale, the same name finds the new slot generation
+	assets["enemy2.png"] = 3;
+	table.m_Register("enemy.png", &assets["enemy2.png"]);
+	CHECK(table.m_Resolve(name, handle) == &assets["enemy2.png"]);
+
+	//unloaded and not loadable, asked once however often it is drawn
+	table.m_Invalidate("enemy.png");
+	CHECK(table.m_Resolve(name, handle) == nullptr);
+	CHECK(table.m_Resolve(name, handle) == nullptr);
+	CHECK(misses == 1);
+}
+
+TEST(AssetHandle_MissesAreRemembered)
+{
+	std::unordered_map<std::string, int> assets{ { "font.ttf", 1 } };
+	AssetHandleTable<int> table;
+
+	std::vector<std::string> asked;
+	bool loadable = false;
+	table.m_onMiss = [&](const std::string& name) {
+		asked.push_back(name);
+		if (!loadable) return false;
+		table.m_Register(name, &assets[name]);
+		return true;
+	};
+
+	//a missing font asks once, then waits for the name or the table to change
+	AssetHandle handle;
+	for (int frame{}; frame < 100; frame++) {
+		CHECK(table.m_Resolve("missing.ttf", handle) == nullptr);
+	}
+	CHECK(asked.size() == 1);
+
+	//an empty name never asks
+	AssetHandle empty;
+	CHECK(table.m_Resolve("", empty) == nullptr);
+	CHECK(asked.size() == 1);
+
+	//another asset is registered, the miss is tried once more
+	table.m_Register("other.ttf", &assets["other.ttf"]);
+	CHECK(table.m_Resolve("missing.ttf", handle) == nullptr);
+	CHECK(table.m_Resolve("missing.ttf", handle) == nullptr);
+	CHECK(asked.size() == 2);
+
+	//a new name asks at once, and loads on demand
+	loadable = true;
+	CHECK(table.m_Resolve("font.ttf", handle) == &assets["font.ttf"]);
+	CHECK(table.m_Resolve("font.ttf", handle) == &assets["font.ttf"]);
+	CHECK(asked.size() == 3 && asked.back() == "font.ttf");
+
+	//unloaded by the residency manager, loaded again on the next access
+	table.m_Invalidate("font.ttf");
+	CHECK(table.m_Resolve("font.ttf", handle) != nullptr);
+	CHECK(asked.size() == 4);
+}
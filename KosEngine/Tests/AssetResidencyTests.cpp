@@ -0,0 +1,181 @@
+/******************************************************************/
+/*!
+\file      AssetResidencyTests.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      April 24, 2025
+\brief     This file contains the tests of the AssetResidency.
+
+		   An asset shared by two scenes stays loaded while either
+		   holds it. An asset no scene holds is evicted once the grace
+		   period has passed, not before, and an asset asked for
+		   again during its grace period is kept without being loaded
+		   a second time. The loads and evictions are counted through
+		   m_onLoad and m_onUnload instead of the asset manager.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include "TestFramework.h"
+#include "TestECS.h"
+#include "Asset Manager/AssetResidency.h"
+
+using namespace ecs;
+using assetmanager::AssetResidency;
+
+static const std::string ForestScene = "ResidencyForest.json";
+static const std::string CaveScene = "ResidencyCave.json";
+
+namespace {
+	struct Counted {
+		std::unordered_map<std::string, int> m_loads;
+		std::unordered_map<std::string, int> m_unloads;
+	};
+}
+
+//every image of the level is cataloged, loading and eviction are counted by name
+static void SetUp(AssetResidency& residency, Counted& counted)
+{
+	residency.m_onLoad = [&counted](assetmanager::AssetType, const std::string& name, const std::string&) {
+		counted.m_loads[name]++;
+		return true;
+	};
+	residency.m_onUnload = [&counted](assetmanager::AssetType, const std::string& name) { counted.m_unloads[name]++; };
+	residency.m_Enable(true);
+	residency.m_gracePeriod = 2.f;
+
+	for (const char* image : { "shared.png", "tree.png", "bat.png", "coin.png" }) {
+		CHECK(residency.m_Catalog(std::filesystem::path("Assets/Texture") / image));
+	}
+}
+
+static void AddSprites(const std::string& scene, std::initializer_list<const char*> images)
+{
+	ECS* ecs = test::GetTestECS();
+	ecs->m_ECS_SceneMap[scene];
+	for (const char* image : images) {
+		const EntityID id = ecs->m_CreateEntity(scene);
+		ecs->m_AddComponent(TYPESPRITECOMPONENT, id);
+		ecs->m_GetComponent<SpriteComponent>(id)->m_imageFile = image;
+	}
+}
+
+TEST(AssetResidency_SharedAssetStaysWhileAnySceneHoldsIt)
+{
+	AssetResidency residency;
+	Counted counted;
+	SetUp(residency, counted);
+
+	AddSprites(ForestScene, { "shared.png", "tree.png", "tree.png" });
+	AddSprites(CaveScene, { "shared.png", "bat.png" });
+	residency.m_AcquireScene(ForestScene);
+	residency.m_AcquireScene(CaveScene);
+
+	//nothing is loaded twice, nothing unused is loaded
+	CHECK(residency.m_GetResidentCount() == 3);
+	CHECK(counted.m_loads["shared.png"] == 1);
+	CHECK(counted.m_loads["tree.png"] == 1);
+	CHECK(counted.m_loads.count("coin.png") == 0);
+
+	//the forest is unloaded, the cave keeps the shared image
+	residency.m_ReleaseScene(ForestScene);
+	test::ClearTestScene(ForestScene);
+	residency.m_Update(residency.m_gracePeriod + 1.f);
+
+	CHECK(counted.m_unloads["tree.png"] == 1);
+	CHECK(counted.m_unloads.count("shared.png") == 0);
+	CHECK(counted.m_unloads.count("bat.png") == 0);
+	CHECK(residency.m_GetResidentCount() == 2);
+
+	//and gives it up with the cave
+	residency.m_ReleaseScene(CaveScene);
+	test::ClearTestScene(CaveScene);
+	residency.m_Update(residency.m_gracePeriod + 1.f);
+
+	CHECK(counted.m_unloads["shared.png"] == 1);
+	CHECK(counted.m_unloads["bat.png"] == 1);
+	CHECK(residency.m_GetResidentCount() == 0);
+	CHECK(residency.m_GetPeakResidentCount() == 3);
+}
+
+TEST(AssetResidency_EvictedOnlyAfterTheGracePeriod)
+{
+	AssetResidency residency;
+	Counted counted;
+	SetUp(residency, counted);
+
+	AddSprites(ForestScene, { "tree.png" });
+	residency.m_AcquireScene(ForestScene);
+
+	//held by a scene, never evicted however long it runs
+	for (int frame{}; frame < 600; frame++) {
+		residency.m_Update(1.f / 60.f);
+	}
+	CHECK(counted.m_unloads.empty());
+
+	residency.m_ReleaseScene(ForestScene);
+	test::ClearTestScene(ForestScene);
+
+	//a frame short of the grace period it is still resident
+	const int graceFrames = static_cast<int>(residency.m_gracePeriod * 10.f);
+	for (int frame{}; frame < graceFrames - 1; frame++) {
+		residency.m_Update(0.1f);
+	}
+	CHECK(counted.m_unloads.empty());
+	CHECK(residency.m_GetResidentCount() == 1);
+
+	residency.m_Update(0.15f);
+	CHECK(counted.m_unloads["tree.png"] == 1);
+	CHECK(residency.m_GetResidentCount() == 0);
+
+	//evicted once, later frames leave it alone
+	residency.m_Update(residency.m_gracePeriod + 1.f);
+	CHECK(counted.m_unloads["tree.png"] == 1);
+}
+
+TEST(AssetResidency_RequestedDuringTheGracePeriodIsKept)
+{
+	AssetResidency residency;
+	Counted counted;
+	SetUp(residency, counted);
+
+	AddSprites(ForestScene, { "tree.png", "coin.png" });
+	residency.m_AcquireScene(ForestScene);
+
+	//the forest is reloaded, the cave is running meanwhile
+	residency.m_ReleaseScene(ForestScene);
+	test::ClearTestScene(ForestScene);
+	AddSprites(CaveScene, { "bat.png" });
+	residency.m_AcquireScene(CaveScene);
+	residency.m_Update(residency.m_gracePeriod * 0.75f);
+
+	//a script of the cave swaps a sprite to the coin, the reloaded forest wants the tree
+	CHECK(residency.m_Request(assetmanager::ASSETIMAGE, "coin.png"));
+	AddSprites(ForestScene, { "tree.png" });
+	residency.m_AcquireScene(ForestScene);
+
+	residency.m_Update(residency.m_gracePeriod * 0.75f);
+	residency.m_Update(residency.m_gracePeriod + 1.f);
+	CHECK(counted.m_unloads.empty());
+	CHECK(counted.m_loads["coin.png"] == 1);
+	CHECK(counted.m_loads["tree.png"] == 1);
+	CHECK(residency.m_GetResidentCount() == 3);
+
+	//an asset that was never cataloged is not loaded
+	CHECK(!residency.m_Request(assetmanager::ASSETIMAGE, "missing.png"));
+
+	//the coin belongs to the scenes that were running when it was asked for
+	residency.m_ReleaseScene(ForestScene);
+	test::ClearTestScene(ForestScene);
+	residency.m_Update(residency.m_gracePeriod + 1.f);
+	CHECK(counted.m_unloads["tree.png"] == 1);
+	CHECK(counted.m_unloads.count("coin.png") == 0);
+
+	residency.m_ReleaseScene(CaveScene);
+	test::ClearTestScene(CaveScene);
+	residency.m_Update(residency.m_gracePeriod + 1.f);
+	CHECK(counted.m_unloads["coin.png"] == 1);
+	CHECK(residency.m_GetResidentCount() == 0);
+}
@@ -0,0 +1,86 @@
+/******************************************************************/
+/*!
+\file      AssetWatcherTests.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      April 24, 2025
+\brief     This file contains the tests of the AssetWatcher.
+
+		   A file rewritten inside the watched directory is reloaded
+		   once by m_ProcessChanges, after the debounce time and well
+		   within a second, and no other file of the directory is
+		   loaded or reloaded. The reloads are recorded through
+		   m_onLoad and m_onReload instead of the asset manager.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include "TestFramework.h"
+#include "Asset Manager/AssetWatcher.h"
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+static void WriteFile(const fs::path& path, const std::string& text)
+{
+	std::ofstream file(path, std::ios::trunc);
+	file << text;
+}
+
+TEST(AssetWatcher_ReloadsOnlyTheRewrittenFile)
+{
+	test::TempDirectory directory("asset_watcher");
+	const fs::path root = directory.m_Get();
+	fs::create_directories(root / "Scene");
+	WriteFile(root / "Scene" / "Level1.json", "{}");
+	WriteFile(root / "Scene" / "Level2.json", "{}");
+	WriteFile(root / "Player.prefab", "{}");
+
+	assetmanager::AssetWatcher watcher;
+	watcher.m_debounceTime = std::chrono::milliseconds(50);
+	watcher.m_pollInterval = std::chrono::milliseconds(50);
+
+	std::vector<fs::path> loaded;
+	std::vector<fs::path> reloaded;
+	std::chrono::milliseconds latency{};
+	watcher.m_onLoad = [&loaded](const fs::path& path) { loaded.push_back(path); };
+	watcher.m_onReload = [&reloaded, &latency](const fs::path& path, image::DecodedImage&, std::chrono::milliseconds time) {
+		reloaded.push_back(path);
+		latency = time;
+	};
+
+	watcher.m_Start(root);
+	CHECK(watcher.m_IsWatching());
+	CHECK(watcher.m_GetDirectoryEntries(root / "Scene").size() == 2);
+
+	//saved by an external editor, the write time moves on even on a coarse file system
+	const fs::path level = root / "Scene" / "Level1.json";
+	WriteFile(level, "{ \"edited\": true }");
+	fs::last_write_time(level, fs::last_write_time(level) + std::chrono::seconds(2));
+	const auto saved = std::chrono::steady_clock::now();
+
+	//one frame boundary after another until the change arrives
+	while (reloaded.empty() && std::chrono::steady_clock::now() - saved < std::chrono::seconds(5)) {
+		watcher.m_ProcessChanges();
+		std::this_thread::sleep_for(std::chrono::milliseconds(5));
+	}
+	const auto arrived = std::chrono::steady_clock::now();
+
+	//a few more debounce periods, nothing else may follow
+	while (std::chrono::steady_clock::now() - arrived < 4 * watcher.m_debounceTime) {
+		watcher.m_ProcessChanges();
+		std::this_thread::sleep_for(std::chrono::milliseconds(5));
+	}
+	watcher.m_Stop();
+
+	CHECK(reloaded.size() == 1);
+	CHECK(!reloaded.empty() && fs::equivalent(reloaded.front(), level));
+	CHECK(loaded.empty());
+
+	//debounced, then applied within a second of the save
+	CHECK(latency >= watcher.m_debounceTime);
+	CHECK(arrived - saved < std::chrono::seconds(1));
+	CHECK(watcher.m_GetDirectoryEntries(root / "Scene").size() == 2);
+}
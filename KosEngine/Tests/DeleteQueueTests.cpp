@@ -0,0 +1,285 @@
+/******************************************************************/
+/*!
+\file      DeleteQueueTests.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      April 22, 2025
+\brief     This file contains the tests of the ECS delete queue.
+
+		   Entities are queued for deletion while a component pool's
+		   entity list is walked, as a script killing enemies would.
+		   Until the flush the list must not change and views must
+		   not see them. After the flush no ID, component, scene
+		   list, layer list or entity map entry may be left.
+
+		   A deleted entity is restored by the editor's undo under the
+		   same ID, with its data, scene, children and parent link,
+		   until its index is recycled. Restoring a queued entity
+		   cancels its deletion.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include "TestFramework.h"
+#include "TestECS.h"
+#include "ECS/Hierachy.h"
+#include "Actions/ActionManager.h"
+
+using namespace ecs;
+using test::GetTestECS;
+using test::TestMaxEntity;
+
+static ECS* GetDeleteQueueECS()
+{
+	ECS* ecs = GetTestECS();
+	ecs->m_ECS_SceneMap["Level1.json"];
+	ecs->m_ECS_SceneMap["Level2.json"];
+	return ecs;
+}
+
+//enemies spread over two scenes, every third one a child of the one before
+static std::vector<EntityID> SpawnEnemies(ECS* ecs, int count)
+{
+	std::vector<EntityID> ids;
+	for (int n{}; n < count; n++) {
+		const EntityID id = ecs->m_CreateEntity(n % 2 ? "Level1.json" : "Level2.json");
+		ecs->m_AddComponent(TYPEENEMYCOMPONENT, id);
+		ids.push_back(id);
+
+		if (n % 3 == 2) {
+			Hierachy::m_SetParent(ids[n - 1], id);
+		}
+	}
+	return ids;
+}
+
+TEST(DeleteQueue_FiveThousandKillsLeaveNothingBehind)
+{
+	ECS* ecs = GetDeleteQueueECS();
+	const std::vector<EntityID> ids = SpawnEnemies(ecs, 5000);
+
+	//kill every enemy from inside the loop over the enemy pool
+	const std::vector<EntityID>& enemies = ecs->m_GetPool<EnemyComponent>()->m_GetEntities();
+	const size_t count = enemies.size();
+	CHECK(count == ids.size());
+	for (size_t n{}; n < enemies.size(); n++) {
+		ecs->m_QueueDeleteEntity(enemies[n]);
+	}
+
+	//nothing moves until the flush, the dying are only hidden
+	CHECK(enemies.size() == count);
+	CHECK(ecs->m_IsPendingDelete(ids.front()));
+	CHECK(ecs->m_GetComponent<EnemyComponent>(ids.back()) != nullptr);
+
+	size_t visible{};
+	ecs->m_View<EnemyComponent>().m_InScene("Level1.json").m_Each([&visible](EntityID, EnemyComponent&) { visible++; });
+	ecs->m_View<EnemyComponent>().m_InScene("Level2.json").m_Each([&visible](EntityID, EnemyComponent&) { visible++; });
+	CHECK(visible == 0);
+
+	ecs->m_FlushDeleteQueue();
+
+	size_t stale{};
+	for (EntityID id : ids) {
+		if (ecs->m_IsValidEntity(id) || ecs->m_IsPendingDelete(id) || ecs->m_GetEntityScene(id)
+			|| ecs->m_GetComponent<EnemyComponent>(id) || ecs->m_GetComponent<TransformComponent>(id) || ecs->m_GetComponent<NameComponent>(id)) {
+			stale++;
+		}
+	}
+	CHECK(stale == 0);
+
+	CHECK(enemies.empty());
+	CHECK(ecs->m_GetPool<NameComponent>()->m_GetEntities().empty());
+	CHECK(ecs->m_GetPool<TransformComponent>()->m_GetEntities().empty());
+	CHECK(ecs->m_ECS_EntityMap.empty());
+	CHECK(ecs->m_ECS_SceneMap["Level1.json"].m_sceneIDs.empty());
+	CHECK(ecs->m_ECS_SceneMap["Level2.json"].m_sceneIDs.empty());
+	CHECK(ecs->m_layersStack.m_layerMap[layer::DEFAULT].second.empty());
+
+	//the freed indices come back with a new generation, the old IDs stay dead
+	const std::vector<EntityID> respawned = SpawnEnemies(ecs, 5000);
+	size_t reused{};
+	for (size_t n{}; n < ids.size(); n++) {
+		if (ecs->m_IsValidEntity(ids[n])) reused++;
+	}
+	CHECK(reused == 0);
+	CHECK(ecs->m_EntityCount <= TestMaxEntity);
+
+	ecs->m_DeleteEntities(respawned);
+	CHECK(ecs->m_ECS_EntityMap.empty());
+
+	test::ClearTestScene("Level1.json");
+	test::ClearTestScene("Level2.json");
+}
+
+TEST(DeleteQueue_SurvivingParentLosesOnlyTheDeadChild)
+{
+	ECS* ecs = GetDeleteQueueECS();
+
+	const EntityID parent = ecs->m_CreateEntity("Level1.json");
+	const EntityID child = ecs->m_CreateEntity("Level1.json");
+	const EntityID grandChild = ecs->m_CreateEntity("Level1.json");
+	const EntityID sibling = ecs->m_CreateEntity("Level1.json");
+	Hierachy::m_SetParent(parent, child);
+	Hierachy::m_SetParent(child, grandChild);
+	Hierachy::m_SetParent(parent, sibling);
+
+	//queued twice, and once through its parent, the batch still deletes it once
+	ecs->m_QueueDeleteEntity(child);
+	ecs->m_QueueDeleteEntity(child);
+	ecs->m_QueueDeleteEntity(grandChild);
+	ecs->m_FlushDeleteQueue();
+
+	CHECK(!ecs->m_IsValidEntity(child));
+	CHECK(!ecs->m_IsValidEntity(grandChild));
+	CHECK(ecs->m_IsValidEntity(parent));
+	CHECK(ecs->m_IsValidEntity(sibling));
+
+	const std::vector<EntityID>& children = ecs->m_GetComponent<TransformComponent>(parent)->m_childID;
+	CHECK(children.size() == 1 && children.front() == sibling);
+	CHECK(ecs->m_ECS_SceneMap["Level1.json"].m_sceneIDs.size() == 2);
+
+	ecs->m_DeleteEntities({ parent });
+	CHECK(!ecs->m_IsValidEntity(sibling));
+	CHECK(ecs->m_ECS_EntityMap.empty());
+
+	test::ClearTestScene("Level1.json");
+}
+
+//a named enemy at a position, a child of the parent if there is one
+static EntityID SpawnNamed(ECS* ecs, const std::string& name, int tag, std::optional<EntityID> parent = {})
+{
+	const EntityID id = ecs->m_CreateEntity("Level1.json");
+	ecs->m_GetComponent<NameComponent>(id)->m_entityName = name;
+	ecs->m_GetComponent<TransformComponent>(id)->m_position = { static_cast<float>(tag), -2.f };
+	ecs->m_AddComponent(TYPEENEMYCOMPONENT, id);
+	ecs->m_GetComponent<EnemyComponent>(id)->m_enemyTag = tag;
+	if (parent.has_value()) {
+		Hierachy::m_SetParent(parent.value(), id);
+	}
+	return id;
+}
+
+static bool IsIntact(ECS* ecs, EntityID id, const std::string& name, int tag)
+{
+	if (!ecs->m_IsValidEntity(id) || ecs->m_IsPendingDelete(id)) return false;
+
+	const std::string* scene = ecs->m_GetEntityScene(id);
+	const EnemyComponent* enemy = ecs->m_GetComponent<EnemyComponent>(id);
+	const TransformComponent* transform = ecs->m_GetComponent<TransformComponent>(id);
+	return scene && *scene == "Level1.json" && enemy && enemy->m_enemyTag == tag && enemy->m_scene == *scene
+		&& ecs->m_GetComponent<NameComponent>(id)->m_entityName == name && transform->m_position.m_x == static_cast<float>(tag);
+}
+
+static size_t CountVisible(ECS* ecs)
+{
+	size_t visible{};
+	ecs->m_View<EnemyComponent>().m_InScene("Level1.json").m_Each([&visible](EntityID, EnemyComponent&) { visible++; });
+	return visible;
+}
+
+TEST(DeleteQueue_UndoRestoresTheDeletedEntityAndItsChildren)
+{
+	ECS* ecs = GetDeleteQueueECS();
+	actions::ActionManager manager;
+
+	const EntityID parent = SpawnNamed(ecs, "parent", 1);
+	const EntityID child = SpawnNamed(ecs, "child", 2, parent);
+	const EntityID grandChild = SpawnNamed(ecs, "grandChild", 3, child);
+	const EntityID sibling = SpawnNamed(ecs, "sibling", 4, parent);
+
+	//deleted from the hierarchy window, through the queue
+	ecs->m_QueueDeleteEntity(child);
+	ecs->m_FlushDeleteQueue();
+	manager.m_Push(new actions::RemoveEntityAction(child));
+	CHECK(!ecs->m_IsValidEntity(child) && !ecs->m_IsValidEntity(grandChild));
+	CHECK(CountVisible(ecs) == 2);
+
+	manager.m_Undo();
+	CHECK(IsIntact(ecs, child, "child", 2));
+	CHECK(IsIntact(ecs, grandChild, "grandChild", 3));
+	CHECK(IsIntact(ecs, sibling, "sibling", 4));
+	CHECK(Hierachy::m_GetParent(child) == parent);
+	CHECK(Hierachy::m_GetParent(grandChild) == child);
+	CHECK((ecs->m_GetComponent<TransformComponent>(child)->m_childID == std::vector<EntityID>{ grandChild }));
+
+	const std::vector<EntityID>& children = ecs->m_GetComponent<TransformComponent>(parent)->m_childID;
+	CHECK(children.size() == 2 && std::count(children.begin(), children.end(), child) == 1);
+	CHECK(ecs->m_ECS_SceneMap["Level1.json"].m_sceneIDs.size() == 4);
+	CHECK(CountVisible(ecs) == 4);
+
+	//brought back once, the second restore has nothing to do
+	CHECK(!ecs->m_RestoreEntity(child));
+
+	manager.m_Redo();
+	CHECK(!ecs->m_IsValidEntity(child) && !ecs->m_IsValidEntity(grandChild));
+	manager.m_Undo();
+	CHECK(IsIntact(ecs, grandChild, "grandChild", 3));
+
+	//an added entity is taken away and brought back
+	const EntityID added = SpawnNamed(ecs, "added", 5);
+	manager.m_Push(new actions::AddEntityAction(added));
+	manager.m_Undo();
+	CHECK(!ecs->m_IsValidEntity(added));
+	manager.m_Redo();
+	CHECK(IsIntact(ecs, added, "added", 5));
+	CHECK(CountVisible(ecs) == 5);
+
+	test::ClearTestScene("Level1.json");
+	test::ClearTestScene("Level2.json");
+	CHECK(ecs->m_ECS_EntityMap.empty());
+}
+
+TEST(DeleteQueue_RestoringAQueuedEntityCancelsItsDeletion)
+{
+	ECS* ecs = GetDeleteQueueECS();
+
+	const EntityID parent = SpawnNamed(ecs, "parent", 1);
+	const EntityID child = SpawnNamed(ecs, "child", 2, parent);
+	const EntityID other = SpawnNamed(ecs, "other", 3);
+
+	ecs->m_QueueDeleteEntity(parent);
+	ecs->m_QueueDeleteEntity(other);
+	CHECK(CountVisible(ecs) == 0);
+
+	CHECK(ecs->m_RestoreEntity(parent));
+	CHECK(CountVisible(ecs) == 2);
+	ecs->m_FlushDeleteQueue();
+
+	CHECK(IsIntact(ecs, parent, "parent", 1));
+	CHECK(IsIntact(ecs, child, "child", 2));
+	CHECK(!ecs->m_IsValidEntity(other));
+
+	test::ClearTestScene("Level1.json");
+	test::ClearTestScene("Level2.json");
+}
+
+TEST(DeleteQueue_RecycledIndexCannotBeRestored)
+{
+	ECS* ecs = GetDeleteQueueECS();
+
+	const EntityID dead = SpawnNamed(ecs, "dead", 1);
+	ecs->m_DeleteEntity(dead);
+
+	//the free list is used oldest first, spawn until the index comes round
+	std::vector<EntityID> spawned;
+	EntityID reused{};
+	for (EntityID n{}; n < TestMaxEntity - 1; n++) {
+		const EntityID id = SpawnNamed(ecs, "new", 7);
+		spawned.push_back(id);
+		if (m_GetEntityIndex(id) == m_GetEntityIndex(dead)) {
+			reused = id;
+			break;
+		}
+	}
+	CHECK(m_GetEntityIndex(reused) == m_GetEntityIndex(dead) && reused != dead);
+
+	CHECK(!ecs->m_RestoreEntity(dead));
+	CHECK(!ecs->m_IsValidEntity(dead));
+	CHECK(IsIntact(ecs, reused, "new", 7));
+	CHECK(ecs->m_ECS_SceneMap["Level1.json"].m_sceneIDs.size() == spawned.size());
+
+	test::ClearTestScene("Level1.json");
+	test::ClearTestScene("Level2.json");
+}
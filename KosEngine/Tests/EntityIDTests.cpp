@@ -0,0 +1,134 @@
+/******************************************************************/
+/*!
+\file      EntityIDTests.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      April 24, 2025
+\brief     This file contains the tests of the generational entity IDs.
+
+		   Entities are created and deleted over many cycles, as a
+		   level spawning and killing waves would. An ID must stay
+		   invalid once its index is handed out again, the index
+		   count must not grow past what is alive, and the
+		   generation of an index wraps to 0 after
+		   EntityGenerationMask without touching the index bits.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include "TestFramework.h"
+#include "TestECS.h"
+#include "ECS/Hierachy.h"
+#include <random>
+
+using namespace ecs;
+
+static const std::string SoakScene = "Soak.json";
+
+TEST(EntityID_SoakKeepsStaleIDsDead)
+{
+	ECS* ecs = test::GetTestECS();
+	ecs->m_ECS_SceneMap[SoakScene];
+
+	const EntityID startCount = ecs->m_EntityCount;
+	const size_t maxAlive = 300;
+
+	std::mt19937 random(2025u);
+	std::vector<EntityID> alive;
+	std::vector<EntityID> dead;
+	size_t staleValid{};
+	size_t aliveInvalid{};
+	size_t created{};
+
+	for (int cycle{}; cycle < 400; cycle++) {
+		//a wave spawns, some with an enemy component
+		const int spawn = std::uniform_int_distribution<int>(1, 64)(random);
+		for (int n{}; n < spawn && alive.size() < maxAlive; n++) {
+			const EntityID id = ecs->m_CreateEntity(SoakScene);
+			if (n % 3 == 0) ecs->m_AddComponent(TYPEENEMYCOMPONENT, id);
+			alive.push_back(id);
+			created++;
+		}
+
+		//and part of it dies, through the queue on odd cycles
+		std::shuffle(alive.begin(), alive.end(), random);
+		const size_t kill = std::uniform_int_distribution<size_t>(0, alive.size())(random);
+		const std::vector<EntityID> killed(alive.end() - kill, alive.end());
+		alive.resize(alive.size() - kill);
+
+		if (cycle % 2) {
+			for (EntityID id : killed) {
+				ecs->m_QueueDeleteEntity(id);
+			}
+			ecs->m_FlushDeleteQueue();
+		}
+		else {
+			ecs->m_DeleteEntities(killed);
+		}
+		dead.insert(dead.end(), killed.begin(), killed.end());
+
+		for (EntityID id : dead) {
+			if (ecs->m_IsValidEntity(id) || ecs->m_GetComponent<TransformComponent>(id)) staleValid++;
+		}
+		for (EntityID id : alive) {
+			if (!ecs->m_IsValidEntity(id)) aliveInvalid++;
+		}
+	}
+
+	CHECK(created > 5 * maxAlive);
+	CHECK(staleValid == 0);
+	CHECK(aliveInvalid == 0);
+
+	//freed indices are used before new ones
+	CHECK(ecs->m_EntityCount <= startCount + maxAlive);
+	CHECK(ecs->m_ECS_SceneMap[SoakScene].m_sceneIDs.size() == alive.size());
+
+	test::ClearTestScene(SoakScene);
+	CHECK(ecs->m_ECS_EntityMap.empty());
+}
+
+TEST(EntityID_GenerationsWrapAtTheMask)
+{
+	ECS* ecs = test::GetTestECS();
+	ecs->m_ECS_SceneMap[SoakScene];
+
+	//use up the freed indices, the last entity gets a new index and is the only one recycled below
+	std::vector<EntityID> filler;
+	EntityID id{};
+	while (true) {
+		const EntityID count = ecs->m_EntityCount;
+		id = ecs->m_CreateEntity(SoakScene);
+		if (ecs->m_EntityCount != count) break;
+		filler.push_back(id);
+	}
+
+	const EntityID first = id;
+	const EntityID index = m_GetEntityIndex(first);
+	CHECK(m_GetEntityGeneration(first) == 0);
+
+	size_t wrongIndex{};
+	size_t wrongGeneration{};
+	size_t staleValid{};
+	for (EntityID n = 1; n <= EntityGenerationMask + 1; n++) {
+		const EntityID previous = id;
+		ecs->m_DeleteEntities({ previous });
+		id = ecs->m_CreateEntity(SoakScene);
+
+		if (m_GetEntityIndex(id) != index) wrongIndex++;
+		if (m_GetEntityGeneration(id) != (n & EntityGenerationMask)) wrongGeneration++;
+		if (ecs->m_IsValidEntity(previous) || !ecs->m_IsValidEntity(id)) staleValid++;
+	}
+
+	CHECK(wrongIndex == 0);
+	CHECK(wrongGeneration == 0);
+	CHECK(staleValid == 0);
+
+	//a full turn comes back to the first ID, the bits above the generation stay clear
+	CHECK(id == first);
+	CHECK((id >> EntityIndexBits) <= EntityGenerationMask);
+
+	test::ClearTestScene(SoakScene);
+	CHECK(ecs->m_ECS_EntityMap.empty());
+}
@@ -0,0 +1,177 @@
+/******************************************************************/
+/*!
+\file      EventBusTests.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      April 24, 2025
+\brief     This file contains the tests of the EventBus and the
+		   EventDispatcher.
+
+		   Events of a type reach the listeners in the order they
+		   were queued, listeners in the order they subscribed. A
+		   listener removed while an event is dispatched, by itself
+		   or by another listener, gets nothing more. A listener
+		   added during a dispatch starts with the next event.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include "TestFramework.h"
+#include "Events/EventsEventBus.h"
+#include "Events/EventsBaseEvent.h"
+
+namespace {
+	struct HitEvent {
+		int m_value{};
+	};
+
+	struct ScoreEvent {
+		int m_value{};
+	};
+}
+
+TEST(EventBus_QueuedEventsKeepTheirOrder)
+{
+	events::EventBus bus;
+	std::vector<std::pair<char, int>> received;
+
+	bus.m_Subscribe<HitEvent>([&received](const HitEvent& event) { received.emplace_back('a', event.m_value); });
+	bus.m_Subscribe<HitEvent>([&received](const HitEvent& event) { received.emplace_back('b', event.m_value); });
+
+	for (int n{}; n < 3; n++) {
+		bus.m_Queue<HitEvent>(HitEvent{ n });
+	}
+	CHECK(received.empty());
+	CHECK(bus.m_GetPendingCount() == 3);
+
+	//sent now, ahead of the queued ones
+	bus.m_Dispatch(HitEvent{ 9 });
+	bus.m_FlushAll();
+
+	const std::vector<std::pair<char, int>> expected{ {'a', 9}, {'b', 9}, {'a', 0}, {'b', 0}, {'a', 1}, {'b', 1}, {'a', 2}, {'b', 2} };
+	CHECK(received == expected);
+	CHECK(bus.m_GetPendingCount() == 0);
+}
+
+TEST(EventBus_EventsQueuedDuringAFlushWaitForTheNext)
+{
+	events::EventBus bus;
+	std::vector<int> received;
+
+	bus.m_Subscribe<HitEvent>([&bus, &received](const HitEvent& event) {
+		received.push_back(event.m_value);
+		if (event.m_value < 3) bus.m_Queue<HitEvent>(HitEvent{ event.m_value + 1 });
+	});
+
+	bus.m_Queue<HitEvent>(HitEvent{ 0 });
+	bus.m_FlushAll();
+	CHECK(received == std::vector<int>{ 0 });
+
+	bus.m_FlushAll();
+	bus.m_FlushAll();
+	bus.m_FlushAll();
+	CHECK((received == std::vector<int>{ 0, 1, 2, 3 }));
+	CHECK(bus.m_GetPendingCount() == 0);
+}
+
+TEST(EventBus_RemovedDuringDispatchGetsNothingMore)
+{
+	events::EventBus bus;
+	std::vector<std::pair<char, int>> received;
+	events::ListenerHandle first, second, third, added;
+
+	//the first removes itself and the next one on the second event
+	first = bus.m_Subscribe<HitEvent>([&](const HitEvent& event) {
+		received.emplace_back('a', event.m_value);
+		if (event.m_value == 1) {
+			bus.m_Unsubscribe(first);
+			bus.m_Unsubscribe(second);
+			added = bus.m_Subscribe<HitEvent>([&received](const HitEvent& event) { received.emplace_back('d', event.m_value); });
+		}
+	});
+	second = bus.m_Subscribe<HitEvent>([&received](const HitEvent& event) { received.emplace_back('b', event.m_value); });
+	third = bus.m_Subscribe<HitEvent>([&received](const HitEvent& event) { received.emplace_back('c', event.m_value); });
+
+	for (int n{}; n < 3; n++) {
+		bus.m_Queue<HitEvent>(HitEvent{ n });
+	}
+	bus.m_FlushAll();
+
+	//the one added mid batch waits for the batch to end
+	bus.m_Dispatch(HitEvent{ 3 });
+
+	const std::vector<std::pair<char, int>> expected{ {'a', 0}, {'b', 0}, {'c', 0}, {'a', 1}, {'c', 1}, {'c', 2}, {'c', 3}, {'d', 3} };
+	CHECK(received == expected);
+	CHECK(!first.m_IsValid());
+	CHECK(!second.m_IsValid());
+	CHECK(third.m_IsValid() && added.m_IsValid());
+
+	//removing twice or through a stale handle does nothing
+	bus.m_Unsubscribe(first);
+	events::ListenerHandle stale = third;
+	bus.m_Unsubscribe(third);
+	bus.m_Unsubscribe(stale);
+	bus.m_Dispatch(HitEvent{ 4 });
+	CHECK(received.back() == std::make_pair('d', 4));
+	CHECK(received.size() == expected.size() + 1);
+}
+
+TEST(EventBus_TypesAreFlushedInFirstUseOrder)
+{
+	events::EventBus bus;
+	std::vector<int> received;
+
+	bus.m_Subscribe<HitEvent>([&received](const HitEvent& event) { received.push_back(event.m_value); });
+	bus.m_Subscribe<ScoreEvent>([&received](const ScoreEvent& event) { received.push_back(100 + event.m_value); });
+
+	bus.m_Queue<ScoreEvent>(ScoreEvent{ 1 });
+	bus.m_Queue<HitEvent>(HitEvent{ 1 });
+	bus.m_Queue<ScoreEvent>(ScoreEvent{ 2 });
+	bus.m_FlushAll();
+
+	//order is only kept within a type, hits were used first
+	CHECK((received == std::vector<int>{ 1, 101, 102 }));
+}
+
+TEST(EventDispatcher_RemovedDuringDispatchGetsNothingMore)
+{
+	using events::ButtonEvents;
+	events::EventDispatcher<ButtonEvents> dispatcher;
+	std::vector<std::pair<char, int>> received;
+	int count{};
+	int first{}, second{}, added{ -1 };
+
+	first = dispatcher.m_RegisterListener(ButtonEvents::EVENTBUTTONPRESS, [&](const events::BaseEvent<ButtonEvents>&) {
+		received.emplace_back('a', count);
+		if (count == 1) {
+			dispatcher.m_UnregisterListener(first);
+			dispatcher.m_UnregisterListener(second);
+			added = dispatcher.m_RegisterListener(ButtonEvents::EVENTBUTTONPRESS, [&](const events::BaseEvent<ButtonEvents>&) { received.emplace_back('d', count); });
+		}
+	});
+	second = dispatcher.m_RegisterListener(ButtonEvents::EVENTBUTTONPRESS, [&](const events::BaseEvent<ButtonEvents>&) { received.emplace_back('b', count); });
+	const int third = dispatcher.m_RegisterListener(ButtonEvents::EVENTBUTTONPRESS, [&](const events::BaseEvent<ButtonEvents>&) { received.emplace_back('c', count); });
+
+	//listeners of another event are left alone
+	int audio{};
+	dispatcher.m_RegisterListener(ButtonEvents::EVENTAUDIOFROMIMGUI, [&audio](const events::BaseEvent<ButtonEvents>&) { audio++; });
+
+	const events::BaseEvent<ButtonEvents> press(ButtonEvents::EVENTBUTTONPRESS);
+	for (; count < 3; count++) {
+		dispatcher.m_DispatchToListeners(press);
+	}
+
+	const std::vector<std::pair<char, int>> expected{ {'a', 0}, {'b', 0}, {'c', 0}, {'a', 1}, {'c', 1}, {'c', 2}, {'d', 2} };
+	CHECK(received == expected);
+	CHECK(added != -1 && added != first && added != second && added != third);
+
+	dispatcher.m_UnregisterListener(third);
+	dispatcher.m_UnregisterListener(third);
+	dispatcher.m_DispatchToListeners(press);
+	CHECK(received.size() == expected.size() + 1 && received.back().first == 'd');
+
+	dispatcher.m_DispatchToListeners(events::BaseEvent<ButtonEvents>(ButtonEvents::EVENTAUDIOFROMIMGUI));
+	CHECK(audio == 1);
+}
@@ -0,0 +1,282 @@
+/******************************************************************/
+/*!
+\file      InputRecorderTests.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      April 20, 2025
+\brief     This file contains the tests of the InputRecorder.
+
+		   A small level stands in for the game: every frame the held
+		   keys move the player's transform, taps spawn bullets with a
+		   spread drawn from the engine's random generator and enemies
+		   wander at random. A replay is a new run of the game, so the
+		   recording and the replay each run in a process of their own,
+		   started with --input-session, where the ECS hands out the
+		   same entity IDs. The replay must end on the ECS state hash
+		   the recording was stopped with.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include "TestFramework.h"
+#include "TestECS.h"
+#include "Inputs/InputRecorder.h"
+#include "Helper/Helper.h"
+#include "C#Mono/ScriptCompiler.h"
+#include <cstring>
+#include <fstream>
+
+namespace fs = std::filesystem;
+using namespace ecs;
+
+static const std::string SessionScene = "Level1.json";
+
+//input of a player that holds and taps a few keys
+static Input::InputFrame MakeFrame(int frame)
+{
+	Input::InputFrame input;
+	input.m_keys.set(keys::W, (frame / 20) % 2 == 0);
+	input.m_keys.set(keys::D, (frame / 7) % 3 == 0);
+	input.m_taps.set(keys::SPACE, frame % 45 == 0);
+	input.m_mousePosition = { static_cast<float>(frame % 640), static_cast<float>(frame % 360) };
+	input.m_deltaTime = 1.f / 60.f;
+	input.m_steps = 1;
+	return input;
+}
+
+struct Level {
+	EntityID m_player{};
+	std::vector<EntityID> m_enemies;
+	//bullets and the frames they have been alive
+	std::vector<std::pair<EntityID, int>> m_bullets;
+};
+
+static Level SpawnLevel()
+{
+	ECS* ecs = test::GetTestECS();
+	ecs->m_ECS_SceneMap[SessionScene];
+
+	Level level;
+	level.m_player = ecs->m_CreateEntity(SessionScene);
+	for (int n{}; n < 4; n++) {
+		const EntityID enemy = ecs->m_CreateEntity(SessionScene);
+		ecs->m_AddComponent(TYPEENEMYCOMPONENT, enemy);
+		ecs->m_GetComponent<TransformComponent>(enemy)->m_position = { 100.f * n, 50.f };
+		level.m_enemies.push_back(enemy);
+	}
+	return level;
+}
+
+//one frame of the game: moves with the keys, shoots with a random spread
+static void Simulate(Level& level, const Input::InputFrame& input)
+{
+	ECS* ecs = test::GetTestECS();
+	std::mt19937& random = Helper::Helpers::GetInstance()->m_random;
+
+	TransformComponent* player = ecs->m_GetComponent<TransformComponent>(level.m_player);
+	const float speed = 200.f * input.m_deltaTime;
+	player->m_position.m_y += input.m_keys.test(keys::W) * speed;
+	player->m_position.m_x += input.m_keys.test(keys::D) * speed;
+	player->m_rotation = input.m_mousePosition.m_x;
+
+	if (input.m_taps.test(keys::SPACE)) {
+		const EntityID bullet = ecs->m_CreateEntity(SessionScene);
+		TransformComponent* transform = ecs->m_GetComponent<TransformComponent>(bullet);
+		transform->m_position = player->m_position;
+		transform->m_rotation = player->m_rotation + std::uniform_int_distribution<int>(-15, 15)(random);
+		level.m_bullets.emplace_back(bullet, 0);
+	}
+
+	for (EntityID enemy : level.m_enemies) {
+		TransformComponent* transform = ecs->m_GetComponent<TransformComponent>(enemy);
+		transform->m_position.m_x += static_cast<float>(std::uniform_int_distribution<int>(-2, 2)(random));
+		transform->m_position.m_y += static_cast<float>(std::uniform_int_distribution<int>(-2, 2)(random));
+	}
+
+	for (auto it = level.m_bullets.begin(); it != level.m_bullets.end();) {
+		ecs->m_GetComponent<TransformComponent>(it->first)->m_position.m_x += 10.f * input.m_steps;
+		if (++it->second < 30) {
+			++it;
+			continue;
+		}
+		ecs->m_QueueDeleteEntity(it->first);
+		it = level.m_bullets.erase(it);
+	}
+	ecs->m_FlushDeleteQueue();
+}
+
+//records a session in this process, the hash stored is the ECS's at the end
+static std::uint64_t Record(const fs::path& path, int frames, std::uint32_t seed)
+{
+	Helper::Helpers::GetInstance()->m_random.seed(seed);
+
+	Input::InputRecorder recorder;
+	CHECK(recorder.m_StartRecording(path.string(), SessionScene, seed));
+
+	Level level = SpawnLevel();
+	for (int frame{}; frame < frames; frame++) {
+		const Input::InputFrame input = MakeFrame(frame);
+		recorder.m_Record(input);
+		Simulate(level, input);
+	}
+
+	const std::uint64_t hash = test::GetTestECS()->m_ComputeStateHash();
+	CHECK(recorder.m_StopRecording(hash));
+	test::ClearTestScene(SessionScene);
+	return hash;
+}
+
+//replays a session in this process, seeded from the recording unless a seed is given
+static std::uint64_t Replay(Input::InputRecorder& recorder, std::optional<std::uint32_t> seed = {})
+{
+	Helper::Helpers::GetInstance()->m_random.seed(seed.value_or(recorder.m_GetSeed()));
+
+	Level level = SpawnLevel();
+	Input::InputFrame input;
+	while (recorder.m_NextFrame(input)) {
+		Simulate(level, input);
+	}
+
+	const std::uint64_t hash = test::GetTestECS()->m_ComputeStateHash();
+	test::ClearTestScene(SessionScene);
+	return hash;
+}
+
+//record <path> <seed> or replay <path> [seed], a replay exits with 0 when it ends on the recorded hash
+int InputSessionMain(int argc, char** argv)
+{
+	if (argc < 2) return 2;
+	const std::string mode = argv[0];
+	const fs::path path = argv[1];
+
+	if (mode == "record" && argc > 2) {
+		Record(path, 600, static_cast<std::uint32_t>(std::stoul(argv[2])));
+		return test::GetFailures();
+	}
+
+	if (mode == "replay") {
+		//whatever the generator drew before the replay started
+		Helper::Helpers::GetInstance()->m_random.seed(1u);
+
+		Input::InputRecorder recorder;
+		if (!recorder.m_StartReplay(path.string())) return 2;
+
+		std::optional<std::uint32_t> seed;
+		if (argc > 2) {
+			seed = static_cast<std::uint32_t>(std::stoul(argv[2]));
+		}
+
+		const std::uint64_t replayed = Replay(recorder, seed);
+		if (!recorder.m_IsReplayFinished()) return 2;
+		return replayed == recorder.m_GetRecordedHash() && recorder.m_StopReplay(replayed) ? 0 : 1;
+	}
+
+	return 2;
+}
+
+static int RunSession(const std::vector<std::string>& args)
+{
+	std::vector<std::string> command{ "--input-session" };
+	command.insert(command.end(), args.begin(), args.end());
+	return script::ScriptCompiler::m_RunProcess(test::GetExecutablePath(), command);
+}
+
+TEST(InputRecorder_ReplayEndsOnRecordedHash)
+{
+	test::TempDirectory directory("input_replay");
+	const fs::path path = directory.m_Get() / "session.kinp";
+	CHECK(RunSession({ "record", path.string(), "20250420" }) == 0);
+
+	Input::InputRecorder recorder;
+	CHECK(recorder.m_StartReplay(path.string()));
+	CHECK(recorder.m_GetStartScene() == SessionScene);
+	CHECK(recorder.m_GetSeed() == 20250420u);
+	CHECK(recorder.m_GetFrameCount() == 600);
+	CHECK(recorder.m_GetRecordedHash() != 0);
+
+	CHECK(RunSession({ "replay", path.string() }) == 0);
+
+	//another seed draws other numbers, the replay diverges
+	CHECK(RunSession({ "replay", path.string(), "7" }) == 1);
+}
+
+TEST(InputRecorder_UnstoppedRecordingReplays)
+{
+	test::TempDirectory directory("input_crash");
+	const fs::path path = directory.m_Get() / "session.kinp";
+	const fs::path crashed = directory.m_Get() / "crashed.kinp";
+
+	{
+		Input::InputRecorder recorder;
+		CHECK(recorder.m_StartRecording(path.string(), "Level2.json", 5u));
+		for (int frame{}; frame < 130; frame++) {
+			recorder.m_Record(MakeFrame(frame));
+		}
+
+		//the file as a crash would leave it, only the flushed frames are in it
+		fs::copy_file(path, crashed);
+	}
+
+	Input::InputRecorder recorder;
+	CHECK(recorder.m_StartReplay(crashed.string()));
+	CHECK(recorder.m_GetStartScene() == "Level2.json");
+	CHECK(recorder.m_GetFrameCount() >= 120 && recorder.m_GetFrameCount() <= 130);
+
+	Input::InputFrame input;
+	int frame{};
+	while (recorder.m_NextFrame(input)) {
+		CHECK(input.m_keys == MakeFrame(frame).m_keys);
+		CHECK(input.m_taps == MakeFrame(frame).m_taps);
+		frame++;
+	}
+
+	//nothing to compare against, not a divergence
+	CHECK(recorder.m_StopReplay(0));
+}
+
+TEST(InputRecorder_CorruptSizesAreRejected)
+{
+	test::TempDirectory directory("input_corrupt");
+	const fs::path path = directory.m_Get() / "session.kinp";
+	Record(path, 90, 3u);
+
+	std::ifstream in(path, std::ios::binary);
+	const std::string valid{ std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>() };
+	in.close();
+
+	const auto writeWith = [&path, &valid](size_t offset, std::uint32_t value) {
+		std::string bytes = valid;
+		std::memcpy(bytes.data() + offset, &value, sizeof(value));
+		std::ofstream out(path, std::ios::binary | std::ios::trunc);
+		out << bytes;
+	};
+
+	Input::InputRecorder recorder;
+
+	//frame count at 12, scene length at 24
+	writeWith(12, 0x7FFFFFFFu);
+	CHECK(!recorder.m_StartReplay(path.string()));
+	CHECK(recorder.m_GetFrameCount() == 0);
+
+	writeWith(24, 0xFFFFFFF0u);
+	CHECK(!recorder.m_StartReplay(path.string()));
+
+	//one frame more than the file holds
+	writeWith(12, 91u);
+	CHECK(!recorder.m_StartReplay(path.string()));
+
+	{
+		std::ofstream out(path, std::ios::binary | std::ios::trunc);
+		out << valid.substr(0, valid.size() - 1);
+	}
+	CHECK(!recorder.m_StartReplay(path.string()));
+
+	{
+		std::ofstream out(path, std::ios::binary | std::ios::trunc);
+		out << valid;
+	}
+	CHECK(recorder.m_StartReplay(path.string()));
+	CHECK(recorder.m_GetFrameCount() == 90);
+}
@@ -0,0 +1,139 @@
+/******************************************************************/
+/*!
+\file      SceneStreamerTests.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      April 24, 2025
+\brief     This file contains the tests of the SceneStreamer.
+
+		   A scene streamed in one entity per frame must end up the
+		   same as the scene loaded in one go, the way
+		   SceneManager::m_LoadScene loads it. The state hash holds
+		   the entity IDs, so each load runs in a process of its
+		   own, started with --load-scene, and writes the hash and
+		   the component signature of every entity to a file.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include "TestFramework.h"
+#include "TestECS.h"
+#include "ECS/Hierachy.h"
+#include "Asset Manager/SceneStreamer.h"
+#include "De&Serialization/json_handler.h"
+#include "C#Mono/ScriptCompiler.h"
+#include <fstream>
+
+namespace fs = std::filesystem;
+using namespace ecs;
+
+static const std::string StreamScene = "StreamTest.json";
+
+//a level of roots with children and grandchildren, and a mix of components
+static void WriteScene(const fs::path& path)
+{
+	ECS* ecs = test::GetTestECS();
+	ecs->m_ECS_SceneMap[StreamScene];
+
+	const ComponentType extras[] = { TYPESPRITECOMPONENT, TYPECOLLIDERCOMPONENT, TYPERIGIDBODYCOMPONENT, TYPEENEMYCOMPONENT };
+	for (int n{}; n < 6; n++) {
+		const EntityID root = ecs->m_CreateEntity(StreamScene);
+		ecs->m_GetComponent<NameComponent>(root)->m_entityName = "root" + std::to_string(n);
+		ecs->m_GetComponent<TransformComponent>(root)->m_position = { 10.f * n, -3.f };
+		ecs->m_AddComponent(extras[n % 4], root);
+
+		for (int c{}; c < n % 3 + 1; c++) {
+			const EntityID child = ecs->m_CreateEntity(StreamScene);
+			ecs->m_GetComponent<TransformComponent>(child)->m_rotation = 15.f * c;
+			ecs->m_AddComponent(extras[(n + c + 1) % 4], child);
+			Hierachy::m_SetParent(root, child);
+
+			if (c == 0) {
+				const EntityID grandChild = ecs->m_CreateEntity(StreamScene);
+				ecs->m_AddComponent(TYPERIGIDBODYCOMPONENT, grandChild);
+				ecs->m_GetComponent<RigidBodyComponent>(grandChild)->m_Velocity = { 1.f * n, 2.f };
+				Hierachy::m_SetParent(child, grandChild);
+			}
+		}
+	}
+
+	Serialization::Serialize::m_SaveComponentsJson(path);
+	test::ClearTestScene(StreamScene);
+}
+
+//stream <scene> <output> or load <scene> <output>
+int LoadSceneMain(int argc, char** argv)
+{
+	if (argc < 3) return 2;
+	const std::string mode = argv[0];
+	const fs::path path = argv[1];
+	const std::string scene = path.filename().string();
+
+	ECS* ecs = test::GetTestECS();
+	if (mode == "load") {
+		//the calls SceneManager::m_LoadScene makes once the file is checked
+		ecs->m_ECS_SceneMap[scene];
+		ecs->m_BeginRegistrationBatch();
+		Serialization::Serialize::m_LoadComponentsJson(path);
+		ecs->m_EndRegistrationBatch();
+	}
+	else if (mode == "stream") {
+		scenes::SceneStreamer streamer;
+		//one entity a frame, so every entity is committed in a slice of its own
+		streamer.m_frameBudget = std::chrono::microseconds(0);
+		if (!streamer.m_Begin(path)) return 2;
+
+		size_t slices{};
+		while (true) {
+			const std::vector<std::string> finished = streamer.m_Update();
+			if (!finished.empty()) {
+				slices++;
+				break;
+			}
+			if (streamer.m_GetProgress(scene) > 0.f) slices++;
+			std::this_thread::yield();
+		}
+		if (slices < 2) return 3;
+	}
+	else {
+		return 2;
+	}
+
+	const auto& sceneIt = ecs->m_ECS_SceneMap.find(scene);
+	if (sceneIt == ecs->m_ECS_SceneMap.end() || !sceneIt->second.m_isActive) return 2;
+
+	std::ofstream output(argv[2], std::ios::trunc);
+	output << ecs->m_ComputeStateHash() << '\n';
+	for (EntityID id : sceneIt->second.m_sceneIDs) {
+		output << id << ' ' << ecs->m_ECS_EntityMap.find(id)->second.to_string() << '\n';
+	}
+	return output ? 0 : 2;
+}
+
+static std::string ReadFile(const fs::path& path)
+{
+	std::ifstream file(path, std::ios::binary);
+	return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+TEST(SceneStreamer_StreamedSceneMatchesLoadedScene)
+{
+	test::TempDirectory directory("scene_streamer");
+	const fs::path scene = directory.m_Get() / StreamScene;
+	const fs::path loaded = directory.m_Get() / "loaded.txt";
+	const fs::path streamed = directory.m_Get() / "streamed.txt";
+	WriteScene(scene);
+
+	const auto run = [&scene](const std::string& mode, const fs::path& output) {
+		return script::ScriptCompiler::m_RunProcess(test::GetExecutablePath(), { "--load-scene", mode, scene.string(), output.string() });
+	};
+	CHECK(run("load", loaded) == 0);
+	CHECK(run("stream", streamed) == 0);
+
+	//the hash line and one line for each of the 6 roots, 12 children and 6 grandchildren
+	const std::string loadedText = ReadFile(loaded);
+	CHECK(std::count(loadedText.begin(), loadedText.end(), '\n') == 1 + 24);
+	CHECK(loadedText == ReadFile(streamed));
+}
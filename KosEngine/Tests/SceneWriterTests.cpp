@@ -0,0 +1,108 @@
+/******************************************************************/
+/*!
+\file      SceneWriterTests.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      April 24, 2025
+\brief     This file contains the tests of the incremental scene save.
+
+		   SceneWriter reuses the text of every root entity whose
+		   subtree kept its ECS versions. After edits to selected
+		   and unselected entities, and through undo and redo, the
+		   file must still match the full save byte for byte.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include "TestFramework.h"
+#include "TestECS.h"
+#include "ECS/Hierachy.h"
+#include "Actions/ActionManager.h"
+#include "Asset Manager/SceneWriter.h"
+#include "De&Serialization/json_handler.h"
+
+using namespace ecs;
+
+static const std::string TestScene = "SaveTest.json";
+
+static std::string ReadFile(const std::filesystem::path& path)
+{
+	std::ifstream file(path, std::ios::binary);
+	return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+//writes the scene both ways and compares the files
+static bool SavesMatch(scenes::SceneWriter& writer, const std::filesystem::path& directory)
+{
+	const std::filesystem::path full = directory / "full" / TestScene;
+	const std::filesystem::path incremental = directory / "incremental" / TestScene;
+	std::filesystem::create_directories(full.parent_path());
+	std::filesystem::create_directories(incremental.parent_path());
+
+	Serialization::Serialize::m_SaveComponentsJson(full);
+	if (!writer.m_Save(incremental)) return false;
+	writer.m_Wait(TestScene);
+	writer.m_Update();
+
+	const std::string fullText = ReadFile(full);
+	return !fullText.empty() && fullText == ReadFile(incremental);
+}
+
+TEST(SceneWriter_IncrementalSaveMatchesFullSave)
+{
+	ECS* ecs = test::GetTestECS();
+	ecs->m_ECS_SceneMap[TestScene];
+
+	//roots with a child each, so an edit deep in a subtree is covered too
+	std::vector<EntityID> roots;
+	std::vector<EntityID> children;
+	for (int n{}; n < 8; n++) {
+		const EntityID root = ecs->m_CreateEntity(TestScene);
+		const EntityID child = ecs->m_CreateEntity(TestScene);
+		Hierachy::m_SetParent(root, child);
+		ecs->m_GetComponent<TransformComponent>(root)->m_position = { static_cast<float>(n), 1.f };
+		ecs->m_GetComponent<TransformComponent>(child)->m_position = { 2.f, static_cast<float>(n) };
+		roots.push_back(root);
+		children.push_back(child);
+	}
+	ecs->m_AddComponent(TYPEENEMYCOMPONENT, roots[3]);
+
+	test::TempDirectory directory("scene_writer");
+	scenes::SceneWriter writer;
+	CHECK(SavesMatch(writer, directory.m_Get()));
+
+	//the selected entity, marked by the editor as the inspector writes it
+	ecs->m_GetComponent<TransformComponent>(roots[0])->m_rotation = 45.f;
+	ecs->m_MarkDirty(roots[0]);
+	CHECK(SavesMatch(writer, directory.m_Get()));
+
+	//an unselected child moved by undo and redo, only the action marks it
+	actions::ActionManager manager;
+	TransformComponent* transform = ecs->m_GetComponent<TransformComponent>(children[5]);
+	const vector2::Vec2 oldPos = transform->m_position;
+	const float oldRot = transform->m_rotation;
+	const vector2::Vec2 oldScale = transform->m_scale;
+	const mat3x3::Mat3x3 oldTrans = transform->m_transformation;
+	transform->m_position = { -7.f, 9.f };
+	manager.m_Push(new actions::ModifyTransformAction(children[5], transform, oldPos, oldRot, oldScale, oldTrans));
+	ecs->m_MarkDirty(children[5]);
+	CHECK(SavesMatch(writer, directory.m_Get()));
+
+	manager.m_Undo();
+	CHECK(SavesMatch(writer, directory.m_Get()));
+
+	manager.m_Redo();
+	CHECK(SavesMatch(writer, directory.m_Get()));
+
+	//an unselected root losing a component and a root deleted outright
+	manager.m_DoAction(new actions::RemoveComponentAction(roots[3], TYPEENEMYCOMPONENT));
+	ecs->m_DeleteEntities({ roots[6] });
+	CHECK(SavesMatch(writer, directory.m_Get()));
+
+	manager.m_Undo();
+	CHECK(SavesMatch(writer, directory.m_Get()));
+
+	test::ClearTestScene(TestScene);
+}
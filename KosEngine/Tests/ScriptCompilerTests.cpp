@@ -0,0 +1,182 @@
+/******************************************************************/
+/*!
+\file      ScriptCompilerTests.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      April 20, 2025
+\brief     This file contains the tests of the ScriptCompiler cache.
+
+		   The compiler of these jobs is the test executable itself,
+		   started with --fake-csc. It writes the sources into the
+		   output and adds a line to compiles.txt next to it, so the
+		   tests can count how often the compiler really ran.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include "TestFramework.h"
+#include "C#Mono/ScriptCompiler.h"
+#include <fstream>
+#include <sstream>
+
+namespace fs = std::filesystem;
+
+//fails when a source holds #error, like a script that does not compile
+int FakeCompilerMain(int argc, char** argv)
+{
+	fs::path output;
+	std::vector<fs::path> sources;
+	for (int n{}; n < argc; n++) {
+		const std::string arg = argv[n];
+		if (arg.rfind("/out:", 0) == 0) {
+			output = arg.substr(5);
+		}
+		else if (fs::path(arg).extension() == ".cs") {
+			sources.push_back(arg);
+		}
+	}
+	if (output.empty()) return 2;
+
+	std::ofstream count(output.parent_path() / "compiles.txt", std::ios::app);
+	count << output.filename().string() << '\n';
+
+	std::ostringstream content;
+	for (const fs::path& source : sources) {
+		std::ifstream file(source);
+		content << file.rdbuf();
+	}
+	if (content.str().find("#error") != std::string::npos) return 1;
+
+	std::ofstream dll(output, std::ios::binary | std::ios::trunc);
+	dll << content.str();
+	return 0;
+}
+
+static void WriteFile(const fs::path& path, const std::string& content)
+{
+	fs::create_directories(path.parent_path());
+	std::ofstream file(path, std::ios::binary | std::ios::trunc);
+	file << content;
+}
+
+static int CountCompiles(const fs::path& directory)
+{
+	std::ifstream file(directory / "compiles.txt");
+	int lines{};
+	std::string line;
+	while (std::getline(file, line)) {
+		lines++;
+	}
+	return lines;
+}
+
+static script::ScriptCompiler::CompileJob MakeJob(const fs::path& directory)
+{
+	script::ScriptCompiler::CompileJob job;
+	job.m_compiler = test::GetExecutablePath();
+	job.m_options = { "--fake-csc", "/target:library" };
+	job.m_sources = { directory / "Scripts" / "Player.cs", directory / "Scripts" / "Enemy.cs" };
+	job.m_output = directory / "Game.dll";
+	WriteFile(job.m_sources[0], "class Player {}");
+	WriteFile(job.m_sources[1], "class Enemy {}");
+	return job;
+}
+
+TEST(ScriptCompiler_SecondCompileIsSkipped)
+{
+	test::TempDirectory directory("compiler_hit");
+	const auto job = MakeJob(directory.m_Get());
+
+	script::ScriptCompiler compiler;
+	CHECK(compiler.m_Compile(job) == script::ScriptCompiler::COMPILED);
+	CHECK(compiler.m_Compile(job) == script::ScriptCompiler::UPTODATE);
+
+	//a new compiler has no hashes in memory, the stamp on disk is enough
+	script::ScriptCompiler restarted;
+	CHECK(restarted.m_Compile(job) == script::ScriptCompiler::UPTODATE);
+	CHECK(CountCompiles(directory.m_Get()) == 1);
+}
+
+TEST(ScriptCompiler_EditedSourceIsCompiled)
+{
+	test::TempDirectory directory("compiler_edit");
+	const auto job = MakeJob(directory.m_Get());
+
+	script::ScriptCompiler compiler;
+	CHECK(compiler.m_Compile(job) == script::ScriptCompiler::COMPILED);
+
+	WriteFile(job.m_sources[1], "class Enemy : Player {}");
+	CHECK(compiler.m_Compile(job) == script::ScriptCompiler::COMPILED);
+	CHECK(compiler.m_Compile(job) == script::ScriptCompiler::UPTODATE);
+	CHECK(CountCompiles(directory.m_Get()) == 2);
+}
+
+TEST(ScriptCompiler_OptionsAndMissingOutputAreCompiled)
+{
+	test::TempDirectory directory("compiler_options");
+	auto job = MakeJob(directory.m_Get());
+
+	script::ScriptCompiler compiler;
+	CHECK(compiler.m_Compile(job) == script::ScriptCompiler::COMPILED);
+
+	job.m_options.push_back("/unsafe");
+	CHECK(compiler.m_Compile(job) == script::ScriptCompiler::COMPILED);
+
+	fs::remove(job.m_output);
+	CHECK(compiler.m_Compile(job) == script::ScriptCompiler::COMPILED);
+	CHECK(CountCompiles(directory.m_Get()) == 3);
+}
+
+TEST(ScriptCompiler_KeyIgnoresOrderButNotFolder)
+{
+	test::TempDirectory directory("compiler_key");
+	auto job = MakeJob(directory.m_Get());
+
+	script::ScriptCompiler compiler;
+	const std::string key = compiler.m_GetKey(job);
+	CHECK(!key.empty());
+
+	auto reversed = job;
+	std::reverse(reversed.m_sources.begin(), reversed.m_sources.end());
+	CHECK(compiler.m_GetKey(reversed) == key);
+
+	//same file name and content, moved into another folder
+	auto moved = job;
+	moved.m_sources[0] = directory.m_Get() / "Scripts" / "Old" / "Player.cs";
+	WriteFile(moved.m_sources[0], "class Player {}");
+	CHECK(compiler.m_GetKey(moved) != key);
+
+	moved.m_sources[0] = directory.m_Get() / "Scripts" / "Missing.cs";
+	CHECK(compiler.m_GetKey(moved).empty());
+}
+
+TEST(ScriptCompiler_FailedCompileKeepsLastStamp)
+{
+	test::TempDirectory directory("compiler_fail");
+	const auto job = MakeJob(directory.m_Get());
+
+	script::ScriptCompiler compiler;
+	CHECK(compiler.m_Compile(job) == script::ScriptCompiler::COMPILED);
+
+	WriteFile(job.m_sources[0], "class Player { #error }");
+	CHECK(compiler.m_Compile(job) == script::ScriptCompiler::FAILED);
+
+	//the DLL on disk was built from the original sources
+	WriteFile(job.m_sources[0], "class Player {}");
+	CHECK(compiler.m_Compile(job) == script::ScriptCompiler::UPTODATE);
+	CHECK(CountCompiles(directory.m_Get()) == 2);
+}
+
+TEST(ScriptCompiler_MissingCompilerFails)
+{
+	test::TempDirectory directory("compiler_missing");
+	auto job = MakeJob(directory.m_Get());
+	job.m_compiler = directory.m_Get() / "CompilerCSC" / "bin" / "csc";
+
+	script::ScriptCompiler compiler;
+	CHECK(compiler.m_Compile(job) == script::ScriptCompiler::FAILED);
+	CHECK(!fs::exists(job.m_output));
+	CHECK(CountCompiles(directory.m_Get()) == 0);
+}
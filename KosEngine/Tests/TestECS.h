@@ -0,0 +1,73 @@
+/******************************************************************/
+/*!
+\file      TestECS.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      April 24, 2025
+\brief     This file contains the ECS shared by the engine tests.
+
+		   The component pools are created as ECS::m_Load does, but
+		   no system is, the tests run without a window or scripts.
+		   Every test deletes the entities and scenes it made, so the
+		   next one starts from an empty ECS.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#ifndef TESTECS_H
+#define TESTECS_H
+
+#include "ECS/ECS.h"
+
+namespace test {
+
+	//more than the game allows, so a single frame can kill 5,000 entities
+	inline constexpr ecs::EntityID TestMaxEntity = 6000;
+
+	//the pools read MaxEntity once, when they are created
+	inline ecs::ECS* GetTestECS()
+	{
+		static ecs::ECS* ecs = [] {
+			ecs::MaxEntity = TestMaxEntity;
+			ecs::ECS* instance = ecs::ECS::m_GetInstance();
+			instance->m_AddComponentToECS<ecs::NameComponent>(ecs::TYPENAMECOMPONENT);
+			instance->m_AddComponentToECS<ecs::TransformComponent>(ecs::TYPETRANSFORMCOMPONENT);
+			instance->m_AddComponentToECS<ecs::SpriteComponent>(ecs::TYPESPRITECOMPONENT);
+			instance->m_AddComponentToECS<ecs::UISpriteComponent>(ecs::TYPEUISPRITECOMPONENT);
+			instance->m_AddComponentToECS<ecs::ColliderComponent>(ecs::TYPECOLLIDERCOMPONENT);
+			instance->m_AddComponentToECS<ecs::RigidBodyComponent>(ecs::TYPERIGIDBODYCOMPONENT);
+			instance->m_AddComponentToECS<ecs::EnemyComponent>(ecs::TYPEENEMYCOMPONENT);
+			instance->m_AddComponentToECS<ecs::TextComponent>(ecs::TYPETEXTCOMPONENT);
+			instance->m_AddComponentToECS<ecs::AnimationComponent>(ecs::TYPEANIMATIONCOMPONENT);
+			instance->m_AddComponentToECS<ecs::CameraComponent>(ecs::TYPECAMERACOMPONENT);
+			instance->m_AddComponentToECS<ecs::ScriptComponent>(ecs::TYPESCRIPTCOMPONENT);
+			instance->m_AddComponentToECS<ecs::ButtonComponent>(ecs::TYPEBUTTONCOMPONENT);
+			instance->m_AddComponentToECS<ecs::TilemapComponent>(ecs::TYPETILEMAPCOMPONENT);
+			instance->m_AddComponentToECS<ecs::AudioComponent>(ecs::TYPEAUDIOCOMPONENT);
+			instance->m_AddComponentToECS<ecs::LightingComponent>(ecs::TYPELIGHTINGCOMPONENT);
+			instance->m_AddComponentToECS<ecs::GridComponent>(ecs::TYPEGRIDCOMPONENT);
+			instance->m_AddComponentToECS<ecs::RaycastComponent>(ecs::TYPERAYCASTINGCOMPONENT);
+			instance->m_AddComponentToECS<ecs::PathfindingComponent>(ecs::TYPEPATHFINDINGCOMPONENT);
+			instance->m_AddComponentToECS<ecs::ParticleComponent>(ecs::TYPEPARTICLECOMPONENT);
+			instance->m_AddComponentToECS<ecs::VideoComponent>(ecs::TYPEVIDEOCOMPONENT);
+			return instance;
+		}();
+		return ecs;
+	}
+
+	//deletes a test scene with every entity still in it
+	inline void ClearTestScene(const std::string& scene)
+	{
+		ecs::ECS* ecs = GetTestECS();
+		const auto& sceneIt = ecs->m_ECS_SceneMap.find(scene);
+		if (sceneIt == ecs->m_ECS_SceneMap.end()) return;
+
+		const std::vector<ecs::EntityID> ids = sceneIt->second.m_sceneIDs;
+		ecs->m_DeleteEntities(ids);
+		ecs->m_ECS_SceneMap.erase(scene);
+	}
+}
+
+#endif TESTECS_H
@@ -0,0 +1,99 @@
+/******************************************************************/
+/*!
+\file      TestFramework.h
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      April 20, 2025
+\brief     This file contains the TEST and CHECK macros of the engine
+		   tests.
+
+		   Every TEST registers itself before main runs, main runs
+		   them in the order they were registered. A failed CHECK
+		   prints the file, line and expression and fails the test,
+		   the test keeps running so every failed check is shown.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#ifndef TESTFRAMEWORK_H
+#define TESTFRAMEWORK_H
+
+#include <filesystem>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace test {
+
+	struct TestCase {
+		std::string m_name;
+		std::function<void()> m_function;
+	};
+
+	inline std::vector<TestCase>& GetTests() {
+		static std::vector<TestCase> tests;
+		return tests;
+	}
+
+	//failed checks of the test that is running
+	inline int& GetFailures() {
+		static int failures{};
+		return failures;
+	}
+
+	//path of the test executable, for tests that run it as a child process
+	inline std::filesystem::path& GetExecutablePath() {
+		static std::filesystem::path path;
+		return path;
+	}
+
+	struct Register {
+		Register(const char* name, std::function<void()> function) {
+			GetTests().push_back(TestCase{ name, std::move(function) });
+		}
+	};
+
+	//empty folder in the temp directory, removed again when the test ends
+	class TempDirectory {
+	public:
+		explicit TempDirectory(const std::string& name)
+			: m_path{ std::filesystem::temp_directory_path() / ("kos_test_" + name) }
+		{
+			std::error_code ec;
+			std::filesystem::remove_all(m_path, ec);
+			std::filesystem::create_directories(m_path);
+		}
+
+		~TempDirectory() {
+			std::error_code ec;
+			std::filesystem::remove_all(m_path, ec);
+		}
+
+		const std::filesystem::path& m_Get() const { return m_path; }
+
+	private:
+		std::filesystem::path m_path;
+	};
+
+}
+
+#define TEST_CONCAT_INNER(a, b) a##b
+#define TEST_CONCAT(a, b) TEST_CONCAT_INNER(a, b)
+
+#define TEST(name) \
+	static void TEST_CONCAT(Test_, name)(); \
+	static test::Register TEST_CONCAT(register_, name){ #name, &TEST_CONCAT(Test_, name) }; \
+	static void TEST_CONCAT(Test_, name)()
+
+#define CHECK(expression) \
+	do { \
+		if (!(expression)) { \
+			std::cout << "  " << __FILE__ << "(" << __LINE__ << "): CHECK(" #expression ") failed\n"; \
+			test::GetFailures()++; \
+		} \
+	} while (0)
+
+#endif TESTFRAMEWORK_H
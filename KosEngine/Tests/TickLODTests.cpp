@@ -0,0 +1,126 @@
+/******************************************************************/
+/*!
+\file      TickLODTests.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      April 24, 2025
+\brief     This file contains the tests of the TickLOD time keeping.
+
+		   An entity updated every 1, 2, 4 or 8 frames, with the
+		   interval changing while the game runs, must be handed the
+		   same total time and fixed steps as the frames it lived
+		   through, no frame may be lost or counted twice.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include "TestFramework.h"
+#include "ECS/TickLOD.h"
+#include <cmath>
+
+using namespace ecs;
+
+namespace {
+	struct Received {
+		double m_time{};
+		int64_t m_steps{};
+		int m_ticks{};
+	};
+}
+
+TEST(TickLOD_SkippedFramesAddUpToTheFrameTotals)
+{
+	TickLOD lod;
+
+	//neighbouring indices get different offsets, one index is reused by a new generation
+	const std::vector<EntityID> ids{ m_MakeEntityID(0, 0), m_MakeEntityID(1, 0), m_MakeEntityID(2, 3), m_MakeEntityID(7, 0), m_MakeEntityID(250, 1) };
+	const int intervals[] = { 1, 2, 4, 8 };
+
+	std::vector<Received> received(ids.size());
+	double totalTime{};
+	int64_t totalSteps{};
+	bool everyFrameMatches = true;
+
+	const int frames = 1000;
+	for (int frame{}; frame <= frames; frame++) {
+		//a frame time that jitters, with 0 to 2 fixed steps
+		const float deltaTime = 1.f / 60.f + 0.001f * static_cast<float>(frame % 7);
+		const int steps = frame % 5 == 0 ? 0 : 1 + frame % 2;
+		lod.m_NewFrame(deltaTime, steps);
+		totalTime += deltaTime;
+		totalSteps += steps;
+
+		for (size_t n{}; n < ids.size(); n++) {
+			//the interval switches every few frames, the last frame updates everyone to settle the debt
+			const int interval = frame == frames ? 1 : intervals[(frame / (13 + static_cast<int>(n) * 5) + n) % 4];
+
+			TickTime time{};
+			if (!lod.m_ShouldTick(TICKSCRIPT, ids[n], interval, time)) continue;
+
+			received[n].m_time += time.m_deltaTime;
+			received[n].m_steps += time.m_steps;
+			received[n].m_ticks++;
+		}
+
+		//an entity updated every frame gets exactly the frame's time
+		TickTime time{};
+		if (lod.m_ShouldTick(TICKANIMATION, ids[0], 1, time) && !(time == TickTime{ deltaTime, steps })) {
+			everyFrameMatches = false;
+		}
+	}
+
+	size_t mismatched{};
+	for (const Received& entity : received) {
+		if (std::fabs(entity.m_time - totalTime) > 1e-3 || entity.m_steps != totalSteps || entity.m_ticks == 0) {
+			mismatched++;
+		}
+	}
+	CHECK(mismatched == 0);
+	CHECK(everyFrameMatches);
+
+	//the slower intervals really skipped frames
+	CHECK(received[1].m_ticks < frames);
+	CHECK(lod.m_GetTicked(TICKSCRIPT) == ids.size());
+}
+
+TEST(TickLOD_EntityNotAskedForStartsOver)
+{
+	TickLOD lod;
+	const EntityID id = m_MakeEntityID(3, 0);
+
+	TickTime time{};
+	for (int frame{}; frame < 10; frame++) {
+		lod.m_NewFrame(0.5f, 1);
+		lod.m_ShouldTick(TICKPATHFINDING, id, 1, time);
+	}
+
+	//the system stopped updating it, the frames in between are not owed
+	for (int frame{}; frame < 5; frame++) {
+		lod.m_NewFrame(0.5f, 1);
+	}
+
+	double time8{};
+	int64_t steps8{};
+	for (int frame{}; frame < 16; frame++) {
+		lod.m_NewFrame(0.25f, 2);
+		if (lod.m_ShouldTick(TICKPATHFINDING, id, 8, time)) {
+			time8 += time.m_deltaTime;
+			steps8 += time.m_steps;
+		}
+	}
+	lod.m_NewFrame(0.25f, 2);
+	CHECK(lod.m_ShouldTick(TICKPATHFINDING, id, 1, time));
+	time8 += time.m_deltaTime;
+	steps8 += time.m_steps;
+
+	CHECK(std::fabs(time8 - 17 * 0.25) < 1e-4);
+	CHECK(steps8 == 17 * 2);
+
+	//another generation at the same index is a new entity
+	const EntityID reused = m_MakeEntityID(3, 1);
+	lod.m_NewFrame(0.25f, 2);
+	CHECK(lod.m_ShouldTick(TICKPATHFINDING, reused, 1, time));
+	CHECK((time == TickTime{ 0.25f, 2 }));
+}
@@ -0,0 +1,76 @@
+/******************************************************************/
+/*!
+\file      main.cpp
+\author    Ng Jaz winn, jazwinn.ng , 2301502
+\par       jazwinn.ng@digipen.edu
+\date      April 20, 2025
+\brief     This file contains the main function of the engine tests.
+
+		   Runs every test, or only the tests whose name contains the
+		   first argument, and exits with the number of tests that
+		   failed. Started with --fake-csc it acts as the C# compiler
+		   for the ScriptCompiler tests instead, started with
+		   --input-session it records or replays an InputRecorder
+		   session for the InputRecorder tests and started with
+		   --load-scene it loads a scene for the SceneStreamer tests.
+
+Copyright (C) 2024 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents without the
+prior written consent of DigiPen Institute of Technology is prohibited.
+*/
+/********************************************************************/
+#include "TestFramework.h"
+#include "Debugging/Logging.h"
+#include "Helper/Helper.h"
+#include <cstring>
+
+namespace Helper {
+	std::unique_ptr<Helpers> Helpers::InstancePtr = nullptr;
+}
+
+int FakeCompilerMain(int argc, char** argv);
+int InputSessionMain(int argc, char** argv);
+int LoadSceneMain(int argc, char** argv);
+
+int main(int argc, char** argv)
+{
+	if (argc > 1 && std::strcmp(argv[1], "--fake-csc") == 0) {
+		return FakeCompilerMain(argc - 2, argv + 2);
+	}
+
+	if (argc > 1 && std::strcmp(argv[1], "--input-session") == 0) {
+		LOGGING_INIT_LOGS((std::filesystem::temp_directory_path() / "kos_tests_session.log").string());
+		return InputSessionMain(argc - 2, argv + 2);
+	}
+
+	if (argc > 1 && std::strcmp(argv[1], "--load-scene") == 0) {
+		LOGGING_INIT_LOGS((std::filesystem::temp_directory_path() / "kos_tests_session.log").string());
+		return LoadSceneMain(argc - 2, argv + 2);
+	}
+
+	test::GetExecutablePath() = std::filesystem::absolute(argv[0]);
+	LOGGING_INIT_LOGS((std::filesystem::temp_directory_path() / "kos_tests.log").string());
+	const std::string filter = argc > 1 ? argv[1] : "";
+
+	int failed{};
+	int ran{};
+	for (const test::TestCase& testCase : test::GetTests()) {
+		if (!filter.empty() && testCase.m_name.find(filter) == std::string::npos) continue;
+
+		std::cout << "[ RUN  ] " << testCase.m_name << '\n';
+		test::GetFailures() = 0;
+		testCase.m_function();
+		ran++;
+
+		if (test::GetFailures() != 0) {
+			failed++;
+			std::cout << "[ FAIL ] " << testCase.m_name << '\n';
+		}
+		else {
+			std::cout << "[  OK  ] " << testCase.m_name << '\n';
+		}
+	}
+
+	std::cout << ran - failed << " of " << ran << " tests passed\n";
+	return failed;
+}